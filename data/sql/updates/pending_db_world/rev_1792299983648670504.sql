@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `name` = 'server profile';
+INSERT INTO `command` (`name`, `security`, `help`) VALUES
+('server profile', 3, 'Syntax: .server profile [$fileName]\r\n\r\nWrites the World::Update and Map::Update phases recorded by the tick profiler (TickProfiler.Enable) as Chrome trace JSON to the logs directory.');
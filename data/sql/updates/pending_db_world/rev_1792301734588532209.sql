@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `name` = 'server dbstats';
+INSERT INTO `command` (`name`, `security`, `help`) VALUES
+('server dbstats', 3, 'Syntax: .server dbstats [$database] [$count]\r\n\r\nShows the queue size, the queue wait and execution time percentiles of asynchronous operations and the $count (default 10) prepared statements with the highest total execution time of $database (login, character, world or all).');
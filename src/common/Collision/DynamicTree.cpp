@@ -30,12 +30,18 @@
 #include <G3D/AABox.h>
 #include <G3D/Ray.h>
 #include <G3D/Vector3.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <vector>
 
 using VMAP::ModelInstance;
 
 namespace
 {
     int CHECK_TREE_PERIOD = 200;
+
+    std::atomic<uint32> NextTreeId = 0;
 }
 
 template<> struct HashTrait< GameObjectModel>
@@ -63,7 +69,8 @@ struct DynTreeImpl : public ParentTree
 
     DynTreeImpl() :
         rebalance_timer(CHECK_TREE_PERIOD),
-        unbalanced_times(0)
+        unbalanced_times(0),
+        treeId(++NextTreeId)
     {
     }
 
@@ -71,25 +78,57 @@ struct DynTreeImpl : public ParentTree
     {
         base::insert(mdl);
         ++unbalanced_times;
+        invalidate(mdl, true);
     }
 
     void remove(const Model& mdl)
     {
         base::remove(mdl);
         ++unbalanced_times;
+        invalidate(mdl, true);
     }
 
     void balance()
     {
         base::balance();
         unbalanced_times = 0;
+
+        // models inserted or removed since the last balance are only found afterwards
+        for (uint32 cell : unbalancedCells)
+            ++cellGenerations[cell];
+
+        unbalancedCells.clear();
     }
 
-    void update(uint32 difftime)
+    void invalidate(const Model& mdl, bool untilBalanced)
+    {
+        G3D::AABox const& bounds = mdl.GetBounds();
+        Cell low = Cell::ComputeCell(bounds.low().x, bounds.low().y);
+        Cell high = Cell::ComputeCell(bounds.high().x, bounds.high().y);
+        for (int x = std::max(low.x, 0); x <= std::min(high.x, int(CELL_NUMBER) - 1); ++x)
+            for (int y = std::max(low.y, 0); y <= std::min(high.y, int(CELL_NUMBER) - 1); ++y)
+            {
+                uint32 cell = x * CELL_NUMBER + y;
+                ++cellGenerations[cell];
+                if (untilBalanced)
+                    unbalancedCells.push_back(cell);
+            }
+    }
+
+    uint64 getGeneration(float x, float y) const
+    {
+        Cell cell = Cell::ComputeCell(x, y);
+        if (!cell.isValid())
+            return uint64(treeId) << 32;
+
+        return (uint64(treeId) << 32) | cellGenerations[cell.x * CELL_NUMBER + cell.y].load(std::memory_order_relaxed);
+    }
+
+    bool update(uint32 difftime)
     {
         if (!size())
         {
-            return;
+            return false;
         }
 
         rebalance_timer.Update(difftime);
@@ -99,12 +138,19 @@ struct DynTreeImpl : public ParentTree
             if (unbalanced_times > 0)
             {
                 balance();
+                return true;
             }
         }
+
+        return false;
     }
 
     TimeTrackerSmall rebalance_timer;
     int unbalanced_times;
+
+    uint32 treeId;
+    std::array<std::atomic<uint32>, CELL_NUMBER * CELL_NUMBER> cellGenerations;
+    std::vector<uint32> unbalancedCells;
 };
 
 DynamicMapTree::DynamicMapTree() : impl(new DynTreeImpl()) { }
@@ -124,6 +170,16 @@ void DynamicMapTree::remove(const GameObjectModel& mdl)
     impl->remove(mdl);
 }
 
+void DynamicMapTree::invalidate(const GameObjectModel& mdl)
+{
+    impl->invalidate(mdl, false);
+}
+
+uint64 DynamicMapTree::GetGeneration(float x, float y) const
+{
+    return impl->getGeneration(x, y);
+}
+
 bool DynamicMapTree::contains(const GameObjectModel& mdl) const
 {
     return impl->contains(mdl);
@@ -63,6 +63,12 @@ public:
 
     void balance();
     void update(uint32 diff);
+
+    /// Called when a model in the tree is enabled, disabled or changes phase
+    void invalidate(const GameObjectModel&);
+
+    /// Unique among all trees, changes whenever query results in the cell of the position may change
+    [[nodiscard]] uint64 GetGeneration(float x, float y) const;
 };
 
 #endif // _DYNTREE_H
@@ -19,9 +19,11 @@
 #define _IVMAPMANAGER_H
 
 #include "Define.h"
+#include "G3D/Vector3.h"
 #include "ModelIgnoreFlags.h"
 #include "Optional.h"
 #include <string>
+#include <vector>
 
 //===========================================================
 
@@ -73,6 +75,14 @@ namespace VMAP
         Optional<LiquidInfo> liquidInfo;
     };
 
+    // one segment of a batch of line of sight checks
+    struct LineOfSightQuery
+    {
+        G3D::Vector3 start;
+        G3D::Vector3 end;
+        bool inLineOfSight = true; // segments already out of line of sight are not checked again
+    };
+
     //===========================================================
     class IVMapMgr
     {
@@ -93,6 +103,10 @@ namespace VMAP
         virtual void unloadMap(unsigned int pMapId) = 0;
 
         virtual bool isInLineOfSight(unsigned int pMapId, float x1, float y1, float z1, float x2, float y2, float z2, ModelIgnoreFlags ignoreFlags) = 0;
+        /**
+        isInLineOfSight of several segments at once, the map and its disabled checks are only looked up once
+        */
+        virtual void isInLineOfSight(unsigned int pMapId, std::vector<LineOfSightQuery>& queries, ModelIgnoreFlags ignoreFlags) = 0;
         virtual float getHeight(unsigned int pMapId, float x, float y, float z, float maxSearchDist) = 0;
         /**
         test if we hit an object. return true if we hit one. rx, ry, rz will hold the hit position or the dest position, if no intersection was found
@@ -20,6 +20,7 @@
 #include "Errors.h"
 #include "Log.h"
 #include "MapDefines.h"
+#include <mutex>
 
 namespace MMAP
 {
@@ -116,6 +117,7 @@ namespace MMAP
 
         // store inside our map list
         MMapData* mmap_data = new MMapData(mesh);
+        mmap_data->corridorCache.SetCapacity(sConfigMgr->GetOption<uint32>("MoveMaps.PathCacheSize", 1024));
         itr->second = mmap_data;
         return true;
     }
@@ -127,24 +129,16 @@ namespace MMAP
 
     bool MMapMgr::loadMap(uint32 mapId, int32 x, int32 y)
     {
-        // make sure the mmap is loaded and ready to load tiles
-        if (!loadMapData(mapId))
-        {
-            return false;
-        }
-
-        // get this mmap data
-        MMapData* mmap = loadedMMaps[mapId];
-        ASSERT(mmap->navMesh);
+        return loadTile(mapId, x, y, nullptr);
+    }
 
-        // check if we already have this tile loaded
-        uint32 packedGridPos = packTileID(x, y);
-        if (mmap->loadedTileRefs.find(packedGridPos) != mmap->loadedTileRefs.end())
-        {
-            LOG_ERROR("maps", "MMAP:loadMap: Asked to load already loaded navmesh tile. {:03}{:02}{:02}.mmtile", mapId, x, y);
-            return false;
-        }
+    bool MMapMgr::loadMap(uint32 mapId, int32 x, int32 y, MMapTileData&& tile)
+    {
+        return loadTile(mapId, x, y, &tile);
+    }
 
+    bool MMapMgr::readTile(uint32 mapId, int32 x, int32 y, MMapTileData& tile)
+    {
         // load this tile :: mmaps/MMMXXYY.mmtile
         std::string fileName = Acore::StringFormat(TILE_FILE_NAME_FORMAT, sConfigMgr->GetOption<std::string>("DataDir", "."), mapId, x, y);
         FILE* file = fopen(fileName.c_str(), "rb");
@@ -171,33 +165,74 @@ namespace MMAP
             return false;
         }
 
-        unsigned char* data = (unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM);
-        ASSERT(data);
+        MMapTileData data;
+        data.data = (unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM);
+        data.size = fileHeader.size;
+        ASSERT(data.data);
+
+        std::size_t result = fread(data.data, fileHeader.size, 1, file);
+        fclose(file);
 
-        std::size_t result = fread(data, fileHeader.size, 1, file);
         if (!result)
         {
             LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
-            fclose(file);
             return false;
         }
 
-        fclose(file);
+        tile = std::move(data);
+        return true;
+    }
+
+    bool MMapMgr::loadTile(uint32 mapId, int32 x, int32 y, MMapTileData* preloadedTile)
+    {
+        // make sure the mmap is loaded and ready to load tiles
+        if (!loadMapData(mapId))
+        {
+            return false;
+        }
+
+        // get this mmap data
+        MMapData* mmap = loadedMMaps[mapId];
+        ASSERT(mmap->navMesh);
+
+        // check if we already have this tile loaded
+        uint32 packedGridPos = packTileID(x, y);
+        if (mmap->loadedTileRefs.find(packedGridPos) != mmap->loadedTileRefs.end())
+        {
+            LOG_ERROR("maps", "MMAP:loadMap: Asked to load already loaded navmesh tile. {:03}{:02}{:02}.mmtile", mapId, x, y);
+            return false;
+        }
+
+        MMapTileData tile;
+        if (preloadedTile)
+        {
+            tile = std::move(*preloadedTile);
+        }
+        else
+        {
+            readTile(mapId, x, y, tile);
+        }
+
+        // the reason was logged while reading
+        if (!tile.data)
+        {
+            return false;
+        }
 
         dtTileRef tileRef = 0;
 
         // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
-        if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
+        if (dtStatusSucceed(mmap->navMesh->addTile(tile.data, tile.size, DT_TILE_FREE_DATA, 0, &tileRef)))
         {
+            dtMeshHeader* header = (dtMeshHeader*)std::exchange(tile.data, nullptr);
             mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
+            mmap->corridorCache.Clear();
             ++loadedTiles;
-            dtMeshHeader* header = (dtMeshHeader*)data;
             LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile {:03}[{:02},{:02}] into {:03}[{:02},{:02}]", mapId, x, y, mapId, header->x, header->y);
             return true;
         }
 
         LOG_ERROR("maps", "MMAP:loadMap: Could not load {:03}{:02}{:02}.mmtile into navmesh", mapId, x, y);
-        dtFree(data);
         return false;
     }
 
@@ -236,6 +271,7 @@ namespace MMAP
         }
 
         mmap->loadedTileRefs.erase(packedGridPos);
+        mmap->corridorCache.Clear();
         --loadedTiles;
         LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile {:03}[{:02},{:02}] from {:03}", mapId, x, y, mapId);
         return true;
@@ -288,6 +324,21 @@ namespace MMAP
         }
 
         MMapData* mmap = itr->second;
+        {
+            std::unique_lock<std::shared_mutex> guard(mmap->navMeshWorkerQueriesLock);
+            for (auto workerItr = mmap->navMeshWorkerQueries.begin(); workerItr != mmap->navMeshWorkerQueries.end();)
+            {
+                if (uint32(workerItr->first >> 32) != instanceId)
+                {
+                    ++workerItr;
+                    continue;
+                }
+
+                dtFreeNavMeshQuery(workerItr->second);
+                workerItr = mmap->navMeshWorkerQueries.erase(workerItr);
+            }
+        }
+
         if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end())
         {
             LOG_DEBUG("maps", "MMAP:unloadMapInstance: Asked to unload not loaded dtNavMeshQuery mapId {:03} instanceId {}", mapId, instanceId);
@@ -314,6 +365,17 @@ namespace MMAP
         return itr->second->navMesh;
     }
 
+    PathCorridorCache* MMapMgr::GetPathCorridorCache(uint32 mapId)
+    {
+        MMapDataSet::const_iterator itr = GetMMapData(mapId);
+        if (itr == loadedMMaps.end())
+        {
+            return nullptr;
+        }
+
+        return &itr->second->corridorCache;
+    }
+
     dtNavMeshQuery const* MMapMgr::GetNavMeshQuery(uint32 mapId, uint32 instanceId)
     {
         MMapDataSet::const_iterator itr = GetMMapData(mapId);
@@ -346,4 +408,52 @@ namespace MMAP
 
         return mmap->navMeshQueries[instanceId];
     }
+
+    dtNavMeshQuery const* MMapMgr::GetNavMeshQuery(uint32 mapId, uint32 instanceId, uint32 slot)
+    {
+        if (!slot)
+        {
+            return GetNavMeshQuery(mapId, instanceId);
+        }
+
+        MMapDataSet::const_iterator itr = GetMMapData(mapId);
+        if (itr == loadedMMaps.end())
+        {
+            return nullptr;
+        }
+
+        MMapData* mmap = itr->second;
+        uint64 key = (uint64(instanceId) << 32) | slot;
+        {
+            std::shared_lock<std::shared_mutex> guard(mmap->navMeshWorkerQueriesLock);
+            auto queryItr = mmap->navMeshWorkerQueries.find(key);
+            if (queryItr != mmap->navMeshWorkerQueries.end())
+            {
+                return queryItr->second;
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> guard(mmap->navMeshWorkerQueriesLock);
+
+        // check again after acquiring the lock
+        auto queryItr = mmap->navMeshWorkerQueries.find(key);
+        if (queryItr != mmap->navMeshWorkerQueries.end())
+        {
+            return queryItr->second;
+        }
+
+        dtNavMeshQuery* query = dtAllocNavMeshQuery();
+        ASSERT(query);
+
+        if (dtStatusFailed(query->init(mmap->navMesh, 1024)))
+        {
+            dtFreeNavMeshQuery(query);
+            LOG_ERROR("maps", "MMAP:GetNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId {:03} instanceId {} slot {}", mapId, instanceId, slot);
+            return nullptr;
+        }
+
+        LOG_DEBUG("maps", "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId {:03} instanceId {} slot {}", mapId, instanceId, slot);
+        mmap->navMeshWorkerQueries.emplace(key, query);
+        return query;
+    }
 }
@@ -22,7 +22,10 @@
 #include "DetourAlloc.h"
 #include "DetourExtended.h"
 #include "DetourNavMesh.h"
+#include "PathCorridorCache.h"
+#include <shared_mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 //  memory management
@@ -41,6 +44,7 @@ namespace MMAP
 {
     typedef std::unordered_map<uint32, dtTileRef> MMapTileSet;
     typedef std::unordered_map<uint32, dtNavMeshQuery*> NavMeshQuerySet;
+    typedef std::unordered_map<uint64, dtNavMeshQuery*> NavMeshWorkerQuerySet;
 
     // dummy struct to hold map's mmap data
     struct MMapData
@@ -54,6 +58,11 @@ namespace MMAP
                 dtFreeNavMeshQuery(navMeshQuerie.second);
             }
 
+            for (auto& navMeshQuerie : navMeshWorkerQueries)
+            {
+                dtFreeNavMeshQuery(navMeshQuerie.second);
+            }
+
             if (navMesh)
             {
                 dtFreeNavMesh(navMesh);
@@ -62,12 +71,43 @@ namespace MMAP
 
         // we have to use single dtNavMeshQuery for every instance, since those are not thread safe
         NavMeshQuerySet navMeshQueries; // instanceId to query
+        NavMeshWorkerQuerySet navMeshWorkerQueries; // [instanceId, slot] to query of the threads calculating paths of the instance in parallel
+        std::shared_mutex navMeshWorkerQueriesLock; // the worker queries are created by the threads of several instances at once
         dtNavMesh* navMesh;
         MMapTileSet loadedTileRefs; // maps [map grid coords] to [dtTile]
+        PathCorridorCache corridorCache; // cleared whenever a tile is added or removed
     };
 
     typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
 
+    // mmtile contents read ahead of being added to the navmesh
+    struct MMapTileData
+    {
+        MMapTileData() = default;
+        MMapTileData(MMapTileData&& other) noexcept : data(std::exchange(other.data, nullptr)), size(std::exchange(other.size, 0)) { }
+
+        MMapTileData& operator=(MMapTileData&& other) noexcept
+        {
+            std::swap(data, other.data);
+            std::swap(size, other.size);
+            return *this;
+        }
+
+        ~MMapTileData()
+        {
+            if (data)
+            {
+                dtFree(data);
+            }
+        }
+
+        MMapTileData(MMapTileData const&) = delete;
+        MMapTileData& operator=(MMapTileData const&) = delete;
+
+        unsigned char* data{nullptr};
+        uint32 size{0};
+    };
+
     // singleton class
     // holds all all access to mmap loading unloading and meshes
     class MMapMgr
@@ -78,19 +118,29 @@ namespace MMAP
 
         void InitializeThreadUnsafe(const std::vector<uint32>& mapIds);
         bool loadMap(uint32 mapId, int32 x, int32 y);
+        // adds a tile read by readTile, an empty tile means the file could not be read
+        bool loadMap(uint32 mapId, int32 x, int32 y, MMapTileData&& tile);
         bool unloadMap(uint32 mapId, int32 x, int32 y);
         bool unloadMap(uint32 mapId);
         bool unloadMapInstance(uint32 mapId, uint32 instanceId);
 
         // the returned [dtNavMeshQuery const*] is NOT threadsafe
         dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId);
+        // slot 0 is the query returned above, the other slots are used by threads calculating paths of the instance next to it.
+        // Thread safe, but every slot of an instance must only be used by one thread at a time
+        dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId, uint32 slot);
         dtNavMesh const* GetNavMesh(uint32 mapId);
+        PathCorridorCache* GetPathCorridorCache(uint32 mapId);
 
         [[nodiscard]] uint32 getLoadedTilesCount() const { return loadedTiles; }
         [[nodiscard]] uint32 getLoadedMapsCount() const { return loadedMMaps.size(); }
 
+        // reads an mmtile file, touches no shared state and can be called from any thread
+        static bool readTile(uint32 mapId, int32 x, int32 y, MMapTileData& tile);
+
     private:
         bool loadMapData(uint32 mapId);
+        bool loadTile(uint32 mapId, int32 x, int32 y, MMapTileData* preloadedTile);
         uint32 packTileID(int32 x, int32 y);
         [[nodiscard]] MMapDataSet::const_iterator GetMMapData(uint32 mapId) const;
 
@@ -0,0 +1,99 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathCorridorCache.h"
+#include <algorithm>
+#include <iterator>
+
+namespace MMAP
+{
+    void PathCorridorCache::SetCapacity(uint32 capacity)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _capacity = capacity;
+
+        while (_entries.size() > _capacity)
+        {
+            _index.erase(_entries.back().CacheKey);
+            _entries.pop_back();
+        }
+    }
+
+    uint32 PathCorridorCache::Find(Key const& key, dtPolyRef* path, uint32 maxPathLength)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (!_capacity)
+            return 0;
+
+        auto itr = _index.find(key);
+        if (itr == _index.end() || itr->second->Corridor.size() > maxPathLength)
+        {
+            _misses.fetch_add(1, std::memory_order_relaxed);
+            return 0;
+        }
+
+        _entries.splice(_entries.begin(), _entries, itr->second);
+
+        std::vector<dtPolyRef> const& corridor = itr->second->Corridor;
+        std::copy(corridor.begin(), corridor.end(), path);
+
+        _hits.fetch_add(1, std::memory_order_relaxed);
+        return uint32(corridor.size());
+    }
+
+    void PathCorridorCache::Store(Key const& key, dtPolyRef const* path, uint32 pathLength)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (!_capacity || !pathLength)
+            return;
+
+        auto itr = _index.find(key);
+        if (itr != _index.end())
+        {
+            // another thread found it meanwhile
+            _entries.splice(_entries.begin(), _entries, itr->second);
+            return;
+        }
+
+        // the least recently used entry is reused, its corridor keeps its capacity
+        if (_entries.size() >= _capacity)
+        {
+            _index.erase(_entries.back().CacheKey);
+            _entries.splice(_entries.begin(), _entries, std::prev(_entries.end()));
+        }
+        else
+            _entries.emplace_front();
+
+        Entry& entry = _entries.front();
+        entry.CacheKey = key;
+        entry.Corridor.assign(path, path + pathLength);
+        _index.emplace(key, _entries.begin());
+    }
+
+    void PathCorridorCache::Clear()
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _entries.clear();
+        _index.clear();
+    }
+
+    std::size_t PathCorridorCache::GetSize() const
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        return _entries.size();
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PATH_CORRIDOR_CACHE_H
+#define _PATH_CORRIDOR_CACHE_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace MMAP
+{
+    /**
+     * @brief Least recently used poly corridors found by dtNavMeshQuery::findPath on one navmesh.
+     *
+     * Patrolling and escorted creatures and pets ask for the same start and end polygons over and over,
+     * the corridor between them only changes when tiles of the navmesh are added or removed, which clears
+     * the cache. Shared by every thread calculating paths on the navmesh.
+     */
+    class PathCorridorCache
+    {
+    public:
+        struct Key
+        {
+            dtPolyRef StartPoly;
+            dtPolyRef EndPoly;
+            uint16 IncludeFlags;
+            uint16 ExcludeFlags;
+
+            bool operator==(Key const& other) const
+            {
+                return StartPoly == other.StartPoly && EndPoly == other.EndPoly && IncludeFlags == other.IncludeFlags && ExcludeFlags == other.ExcludeFlags;
+            }
+        };
+
+        /// Stores up to capacity corridors, 0 disables the cache
+        void SetCapacity(uint32 capacity);
+
+        /// Copies the corridor of key to path, returns its length or 0 if it is not cached or longer than maxPathLength
+        uint32 Find(Key const& key, dtPolyRef* path, uint32 maxPathLength);
+        void Store(Key const& key, dtPolyRef const* path, uint32 pathLength);
+
+        /// Called when a tile is added to or removed from the navmesh
+        void Clear();
+
+        [[nodiscard]] uint64 GetHits() const { return _hits.load(std::memory_order_relaxed); }
+        [[nodiscard]] uint64 GetMisses() const { return _misses.load(std::memory_order_relaxed); }
+        [[nodiscard]] std::size_t GetSize() const;
+
+    private:
+        struct KeyHash
+        {
+            std::size_t operator()(Key const& key) const
+            {
+                std::size_t hash = std::hash<dtPolyRef>()(key.StartPoly);
+                hash ^= std::hash<dtPolyRef>()(key.EndPoly) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                return hash ^ ((std::size_t(key.IncludeFlags) << 16) | key.ExcludeFlags);
+            }
+        };
+
+        struct Entry
+        {
+            Key CacheKey;
+            std::vector<dtPolyRef> Corridor;
+        };
+
+        typedef std::list<Entry> EntryList;
+
+        mutable std::mutex _lock;
+        EntryList _entries; ///< most recently used first
+        std::unordered_map<Key, EntryList::iterator, KeyHash> _index;
+        uint32 _capacity = 0;
+        std::atomic<uint64> _hits = 0;
+        std::atomic<uint64> _misses = 0;
+    };
+}
+
+#endif
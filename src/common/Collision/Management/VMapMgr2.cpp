@@ -194,6 +194,37 @@ namespace VMAP
         return true;
     }
 
+    void VMapMgr2::isInLineOfSight(unsigned int mapId, std::vector<LineOfSightQuery>& queries, ModelIgnoreFlags ignoreFlags)
+    {
+#if defined(ENABLE_VMAP_CHECKS)
+        if (!isLineOfSightCalcEnabled() || IsVMAPDisabledForPtr(mapId, VMAP_DISABLE_LOS))
+        {
+            return;
+        }
+#endif
+
+        InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+        {
+            return;
+        }
+
+        for (LineOfSightQuery& query : queries)
+        {
+            if (!query.inLineOfSight)
+            {
+                continue;
+            }
+
+            Vector3 pos1 = convertPositionToInternalRep(query.start.x, query.start.y, query.start.z);
+            Vector3 pos2 = convertPositionToInternalRep(query.end.x, query.end.y, query.end.z);
+            if (pos1 != pos2)
+            {
+                query.inLineOfSight = instanceTree->second->isInLineOfSight(pos1, pos2, ignoreFlags);
+            }
+        }
+    }
+
     /**
     get the hit position and return true if we hit something
     otherwise the result pos will be the dest pos
@@ -339,30 +370,61 @@ namespace VMAP
 
     WorldModel* VMapMgr2::acquireModelInstance(const std::string& basepath, const std::string& filename, uint32 flags/* Only used when creating the model */)
     {
-        //! Critical section, thread safe access to iLoadedModelFiles
-        std::lock_guard<std::mutex> lock(LoadedModelFilesLock);
-
-        ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
-        if (model == iLoadedModelFiles.end())
         {
-            WorldModel* worldmodel = new WorldModel();
-            if (!worldmodel->readFile(basepath + filename + ".vmo"))
+            //! Critical section, thread safe access to iLoadedModelFiles
+            std::lock_guard<std::mutex> lock(LoadedModelFilesLock);
+
+            ModelFileMap::iterator model = iLoadedModelFiles.find(filename);
+            if (model != iLoadedModelFiles.end())
             {
-                LOG_ERROR("maps", "VMapMgr2: could not load '{}{}.vmo'", basepath, filename);
-                delete worldmodel;
-                return nullptr;
+                return model->second.getModel();
             }
-            LOG_DEBUG("maps", "VMapMgr2: loading file '{}{}'", basepath, filename);
+        }
 
-            worldmodel->Flags = flags;
+        // read the file without holding the lock, grid terrain preloading acquires models from other threads
+        WorldModel* worldmodel = new WorldModel();
+        if (!worldmodel->readFile(basepath + filename + ".vmo"))
+        {
+            LOG_ERROR("maps", "VMapMgr2: could not load '{}{}.vmo'", basepath, filename);
+            delete worldmodel;
+            return nullptr;
+        }
+        LOG_DEBUG("maps", "VMapMgr2: loading file '{}{}'", basepath, filename);
+
+        worldmodel->Flags = flags;
 
-            model = iLoadedModelFiles.insert(std::pair<std::string, ManagedModel>(filename, ManagedModel())).first;
+        std::lock_guard<std::mutex> lock(LoadedModelFilesLock);
+
+        auto [model, inserted] = iLoadedModelFiles.try_emplace(filename);
+        if (inserted)
+        {
             model->second.setModel(worldmodel);
         }
+        else
+        {
+            // another thread loaded the same model in the meantime
+            delete worldmodel;
+        }
 
         return model->second.getModel();
     }
 
+    void VMapMgr2::preloadMapTileModels(const char* basePath, unsigned int mapId, int x, int y)
+    {
+        if (!isMapLoadingEnabled())
+        {
+            return;
+        }
+
+        std::string basePathStr = basePath;
+        if (!basePathStr.empty() && basePathStr.back() != '/' && basePathStr.back() != '\\')
+        {
+            basePathStr.push_back('/');
+        }
+
+        StaticMapTree::PreloadMapTileModels(basePathStr, mapId, x, y, this);
+    }
+
     void VMapMgr2::releaseModelInstance(const std::string& filename)
     {
         //! Critical section, thread safe access to iLoadedModelFiles
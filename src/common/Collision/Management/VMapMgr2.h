@@ -107,6 +107,7 @@ namespace VMAP
         void unloadMap(unsigned int mapId) override;
 
         bool isInLineOfSight(unsigned int mapId, float x1, float y1, float z1, float x2, float y2, float z2, ModelIgnoreFlags ignoreFlags) override ;
+        void isInLineOfSight(unsigned int mapId, std::vector<LineOfSightQuery>& queries, ModelIgnoreFlags ignoreFlags) override;
         /**
         fill the hit pos and return true, if an object was hit
         */
@@ -122,6 +123,9 @@ namespace VMAP
         WorldModel* acquireModelInstance(const std::string& basepath, const std::string& filename, uint32 flags);
         void releaseModelInstance(const std::string& filename);
 
+        /// Reads the models spawned on a tile ahead of loadMap, can be called from any thread
+        void preloadMapTileModels(const char* basePath, unsigned int mapId, int x, int y);
+
         // what's the use of this? o.O
         [[nodiscard]] std::string getDirFileName(unsigned int mapId, int /*x*/, int /*y*/) const override
         {
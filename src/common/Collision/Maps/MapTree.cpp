@@ -289,6 +289,40 @@ namespace VMAP
         return result;
     }
 
+    //=========================================================
+    /**
+    Acquires the models spawned on a tile without touching any tree, so LoadMapTile
+    later finds them already loaded. basePath must end with a path separator.
+    */
+    void StaticMapTree::PreloadMapTileModels(const std::string& basePath, uint32 mapID, uint32 tileX, uint32 tileY, VMapMgr2* vm)
+    {
+        std::string tilefile = basePath + getTileFileName(mapID, tileX, tileY);
+        FILE* tf = fopen(tilefile.c_str(), "rb");
+        if (!tf)
+        {
+            return;
+        }
+
+        char chunk[8];
+        uint32 numSpawns = 0;
+        if (readChunk(tf, chunk, VMAP_MAGIC, 8) && fread(&numSpawns, sizeof(uint32), 1, tf) == 1)
+        {
+            for (uint32 i = 0; i < numSpawns; ++i)
+            {
+                ModelSpawn spawn;
+                uint32 referencedVal;
+                if (!ModelSpawn::readFromFile(tf, spawn) || fread(&referencedVal, sizeof(uint32), 1, tf) != 1)
+                {
+                    break;
+                }
+
+                vm->acquireModelInstance(basePath, spawn.name, spawn.flags);
+            }
+        }
+
+        fclose(tf);
+    }
+
     //=========================================================
 
     bool StaticMapTree::InitMap(const std::string& fname, VMapMgr2* vm)
@@ -39,6 +39,7 @@ public:
 
     void setLogLevel(LogLevel);
     void write(LogMessage* message);
+    virtual void flush() { } ///< Writes out output buffered by write
     static char const* getLogLevelString(LogLevel level);
     virtual void setRealmId(uint32 /*realmId*/) { }
 
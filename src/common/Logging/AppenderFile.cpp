@@ -18,16 +18,24 @@
 #include "AppenderFile.h"
 #include "Log.h"
 #include "LogMessage.h"
+#include "LogWriter.h"
 #include "StringConvert.h"
 #include "Timer.h"
 #include <algorithm>
 
+namespace
+{
+    // dynamic names are usually accounts or characters, not all of them can keep their file open
+    constexpr std::size_t MaxOpenDynamicFiles = 32;
+}
+
 AppenderFile::AppenderFile(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& args) :
     Appender(id, name, level, flags),
     logfile(nullptr),
     _logDir(sLog->GetLogsDir()),
     _maxFileSize(0),
-    _fileSize(0)
+    _fileSize(0),
+    _flushSize(sLog->GetFlushSize())
 {
     if (args.size() < 4)
     {
@@ -78,6 +86,7 @@ AppenderFile::AppenderFile(uint8 id, std::string const& name, LogLevel level, Ap
 
 AppenderFile::~AppenderFile()
 {
+    CloseDynamicFiles();
     CloseFile();
 }
 
@@ -90,6 +99,12 @@ void AppenderFile::_write(LogMessage const* message)
         char namebuf[ACORE_PATH_MAX];
         snprintf(namebuf, ACORE_PATH_MAX, _fileName.c_str(), message->param1.c_str());
 
+        if (LogWriter::IsWriterThread())
+        {
+            WriteDynamicFile(namebuf, message);
+            return;
+        }
+
         // always use "a" with dynamic name otherwise it could delete the log we wrote in last _write() call
         FILE* file = OpenFile(namebuf, "a", _backup || exceedMaxSize);
         if (!file)
@@ -114,9 +129,107 @@ void AppenderFile::_write(LogMessage const* message)
         return;
     }
 
-    fprintf(logfile, "%s%s\n", message->prefix.c_str(), message->text.c_str());
-    fflush(logfile);
+    // synchronous logging writes from every thread at once, fprintf locks the file for each line
+    if (!LogWriter::IsWriterThread())
+    {
+        fprintf(logfile, "%s%s\n", message->prefix.c_str(), message->text.c_str());
+        fflush(logfile);
+        _fileSize += uint64(message->Size());
+        return;
+    }
+
+    _pending.append(message->prefix).append(message->text).push_back('\n');
     _fileSize += uint64(message->Size());
+
+    if (_pending.size() >= _flushSize)
+    {
+        flush();
+    }
+}
+
+void AppenderFile::WriteDynamicFile(std::string const& fileName, LogMessage const* message)
+{
+    auto itr = _dynamicFiles.find(fileName);
+    if (itr == _dynamicFiles.end())
+    {
+        if (_dynamicFiles.size() >= MaxOpenDynamicFiles)
+        {
+            CloseDynamicFiles();
+        }
+
+        // always use "a" with dynamic name otherwise it could delete the log we wrote before it was closed
+        FILE* file = OpenFile(fileName, "a", _backup);
+        if (!file)
+        {
+            return;
+        }
+
+        itr = _dynamicFiles.emplace(fileName, DynamicFile{ file, uint64(ftell(file)), {} }).first;
+    }
+
+    DynamicFile& file = itr->second;
+    if (_maxFileSize > 0 && (file.Size + message->Size()) > _maxFileSize)
+    {
+        FlushDynamicFile(file);
+        fclose(file.File);
+
+        file.File = OpenFile(fileName, "a", true);
+        if (!file.File)
+        {
+            _dynamicFiles.erase(itr);
+            return;
+        }
+
+        file.Size = uint64(ftell(file.File));
+    }
+
+    file.Pending.append(message->prefix).append(message->text).push_back('\n');
+    file.Size += uint64(message->Size());
+
+    if (file.Pending.size() >= _flushSize)
+    {
+        FlushDynamicFile(file);
+    }
+}
+
+void AppenderFile::FlushDynamicFile(DynamicFile& file)
+{
+    if (file.Pending.empty())
+    {
+        return;
+    }
+
+    fwrite(file.Pending.data(), 1, file.Pending.size(), file.File);
+    fflush(file.File);
+    file.Pending.clear();
+}
+
+void AppenderFile::CloseDynamicFiles()
+{
+    for (auto& [fileName, file] : _dynamicFiles)
+    {
+        FlushDynamicFile(file);
+        fclose(file.File);
+    }
+
+    _dynamicFiles.clear();
+}
+
+void AppenderFile::flush()
+{
+    for (auto& [fileName, file] : _dynamicFiles)
+    {
+        FlushDynamicFile(file);
+    }
+
+    if (_pending.empty() || !logfile)
+    {
+        return;
+    }
+
+    fwrite(_pending.data(), 1, _pending.size(), logfile);
+    fflush(logfile);
+    _pending.clear();
 }
 
 FILE* AppenderFile::OpenFile(std::string const& filename, std::string const& mode, bool backup)
@@ -145,6 +258,7 @@ void AppenderFile::CloseFile()
 {
     if (logfile)
     {
+        flush();
         fclose(logfile);
         logfile = nullptr;
     }
@@ -20,6 +20,7 @@
 
 #include "Appender.h"
 #include <atomic> // NOTE: this import is NEEDED (even though some IDEs report it as unused)
+#include <unordered_map>
 #include <vector>
 
 class AppenderFile : public Appender
@@ -31,9 +32,21 @@ public:
     ~AppenderFile();
     FILE* OpenFile(std::string const& name, std::string const& mode, bool backup);
     AppenderType getType() const override { return type; }
+    void flush() override;
 
 private:
+    /// File of a resolved dynamic name, kept open by the LogWriter thread
+    struct DynamicFile
+    {
+        FILE* File = nullptr;
+        uint64 Size = 0;
+        std::string Pending;
+    };
+
     void CloseFile();
+    void WriteDynamicFile(std::string const& fileName, LogMessage const* message);
+    static void FlushDynamicFile(DynamicFile& file);
+    void CloseDynamicFiles();
     void _write(LogMessage const* message) override;
     FILE* logfile;
     std::string _fileName;
@@ -42,6 +55,9 @@ private:
     bool _backup;
     uint64 _maxFileSize;
     std::atomic<uint64> _fileSize;
+    std::string _pending;  ///< Lines written by the LogWriter thread but not to logfile yet, written in one go by flush()
+    std::size_t _flushSize;
+    std::unordered_map<std::string, DynamicFile> _dynamicFiles; ///< LogWriter thread only
 };
 
 #endif
@@ -20,18 +20,16 @@
 #include "AppenderFile.h"
 #include "Config.h"
 #include "Errors.h"
-#include "IoContext.h"
 #include "LogMessage.h"
-#include "LogOperation.h"
+#include "LogWriter.h"
 #include "Logger.h"
-#include "Strand.h"
 #include "StringConvert.h"
 #include "Timer.h"
 #include "Tokenize.h"
 #include <chrono>
 #include <memory>
 
-Log::Log() : AppenderId(0), highestLogLevel(LOG_LEVEL_FATAL)
+Log::Log() : AppenderId(0), highestLogLevel(LOG_LEVEL_FATAL), _flushSize(0)
 {
     m_logsTimestamp = "_" + GetTimestampStr();
     RegisterAppender<AppenderConsole>();
@@ -40,6 +38,7 @@ Log::Log() : AppenderId(0), highestLogLevel(LOG_LEVEL_FATAL)
 
 Log::~Log()
 {
+    _writer.reset();
     Close();
 }
 
@@ -240,17 +239,22 @@ void Log::_outCommand(std::string_view message, std::string_view param1)
 
 void Log::write(std::unique_ptr<LogMessage>&& msg) const
 {
-    Logger const* logger = GetLoggerByType(msg->type);
-
-    if (_ioContext)
+    if (_writer)
     {
-        std::shared_ptr<LogOperation> logOperation = std::make_shared<LogOperation>(logger, std::move(msg));
-        Acore::Asio::post(*_ioContext, Acore::Asio::bind_executor(*_strand, [logOperation]() { logOperation->call(); }));
+        _writer->Enqueue(std::move(msg));
+        return;
     }
-    else
+
+    if (Logger const* logger = GetLoggerByType(msg->type))
         logger->write(msg.get());
 }
 
+void Log::FlushAppenders() const
+{
+    for (std::pair<uint8 const, std::unique_ptr<Appender>> const& appender : appenders)
+        appender.second->flush();
+}
+
 Logger const* Log::GetLoggerByType(std::string const& type) const
 {
     auto it = loggers.find(type);
@@ -364,30 +368,47 @@ Log* Log::instance()
     return &instance;
 }
 
-void Log::Initialize(Acore::Asio::IoContext* ioContext)
+void Log::Initialize(bool async)
 {
-    if (ioContext)
+    LoadFromConfig();
+
+    if (async)
     {
-        _ioContext = ioContext;
-        _strand = std::make_unique<Acore::Asio::Strand>(*ioContext);
+        std::size_t queueSize = sConfigMgr->GetOption<uint32>("Log.Async.QueueSize", 8192, false);
+        Milliseconds flushInterval(sConfigMgr->GetOption<uint32>("Log.Async.FlushInterval", 1000, false));
+
+        _writer = std::make_unique<LogWriter>(queueSize, flushInterval,
+            [this](LogMessage* message)
+            {
+                if (Logger const* logger = GetLoggerByType(message->type))
+                    logger->write(message);
+            },
+            [this]() { FlushAppenders(); });
     }
-
-    LoadFromConfig();
 }
 
 void Log::SetSynchronous()
 {
-    _strand.reset();
-    _ioContext = nullptr;
+    _writer.reset();
+}
+
+uint64 Log::GetDroppedMessageCount() const
+{
+    return _writer ? _writer->GetDroppedMessageCount() : 0;
 }
 
 void Log::LoadFromConfig()
 {
+    std::unique_lock<std::mutex> writerGuard;
+    if (_writer)
+        writerGuard = _writer->LockWrites();
+
     Close();
 
     highestLogLevel = LOG_LEVEL_FATAL;
     AppenderId = 0;
     m_logsDir = sConfigMgr->GetOption<std::string>("LogsDir", "", false);
+    _flushSize = sConfigMgr->GetOption<uint32>("Log.Async.FlushSize", 65536, false);
 
     if (!m_logsDir.empty())
         if ((m_logsDir.at(m_logsDir.length() - 1) != '/') && (m_logsDir.at(m_logsDir.length() - 1) != '\\'))
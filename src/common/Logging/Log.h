@@ -18,7 +18,6 @@
 #ifndef _LOG_H__
 #define _LOG_H__
 
-#include "IoContext.h"
 #include "Define.h"
 #include "LogCommon.h"
 #include "StringFormat.h"
@@ -28,14 +27,9 @@
 
 class Appender;
 class Logger;
+class LogWriter;
 struct LogMessage;
 
-namespace Acore::Asio
-{
-    class IoContext;
-    class Strand;
-}
-
 #define LOGGER_ROOT "root"
 
 typedef Appender*(*AppenderCreatorFn)(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& extraArgs);
@@ -61,7 +55,7 @@ private:
 public:
     static Log* instance();
 
-    void Initialize(Acore::Asio::IoContext* ioContext = nullptr);
+    void Initialize(bool async = false);
     void SetSynchronous();  // Not threadsafe - should only be called from main() after all threads are joined
     void LoadFromConfig();
     void Close();
@@ -95,10 +89,13 @@ public:
 
     [[nodiscard]] std::string const& GetLogsDir() const { return m_logsDir; }
     [[nodiscard]] std::string const& GetLogsTimestamp() const { return m_logsTimestamp; }
+    [[nodiscard]] uint32 GetFlushSize() const { return _flushSize; }
+    [[nodiscard]] uint64 GetDroppedMessageCount() const;
 
 private:
     static std::string GetTimestampStr();
     void write(std::unique_ptr<LogMessage>&& msg) const;
+    void FlushAppenders() const;
 
     [[nodiscard]] Logger const* GetLoggerByType(std::string const& type) const;
     Appender* GetAppenderByName(std::string_view name);
@@ -120,8 +117,8 @@ private:
     std::string m_logsDir;
     std::string m_logsTimestamp;
 
-    Acore::Asio::IoContext* _ioContext;
-    std::unique_ptr<Acore::Asio::Strand> _strand;
+    uint32 _flushSize;
+    std::unique_ptr<LogWriter> _writer;
 };
 
 #define sLog Log::instance()
@@ -0,0 +1,174 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LogWriter.h"
+#include "LogMessage.h"
+#include "SPSCQueue.h"
+#include "StringFormat.h"
+#include <algorithm>
+
+/// Idle writer thread wakes up this often to look for new messages
+static constexpr Milliseconds LogWriterPollInterval = 5ms;
+
+struct LogWriter::ProducerQueue
+{
+    explicit ProducerQueue(std::size_t size) : Queue(size), Abandoned(false) { }
+
+    SPSCQueue<LogMessage*> Queue;
+    std::atomic<bool> Abandoned; ///< Set when the producer thread exits, the writer drops the queue once it is drained
+};
+
+thread_local LogWriter::ThreadQueue LogWriter::_threadQueue;
+thread_local bool LogWriter::_isWriterThread = false;
+
+LogWriter::ThreadQueue::~ThreadQueue()
+{
+    if (Queue)
+        Queue->Abandoned.store(true, std::memory_order_release);
+}
+
+LogWriter::LogWriter(std::size_t queueSize, Milliseconds flushInterval, WriteFn write, FlushFn flush)
+    : _queueSize(queueSize), _flushInterval(flushInterval), _write(std::move(write)), _flush(std::move(flush)),
+    _droppedMessages(0), _reportedDroppedMessages(0), _stop(false)
+{
+    _thread = std::thread(&LogWriter::Run, this);
+}
+
+LogWriter::~LogWriter()
+{
+    {
+        std::lock_guard<std::mutex> guard(_wakeLock);
+        _stop = true;
+    }
+
+    _wakeCondition.notify_one();
+    _thread.join();
+
+    // the writer drained everything before exiting, only messages queued after that can be left
+    for (std::shared_ptr<ProducerQueue> const& queue : _queues)
+    {
+        LogMessage* message;
+        while (queue->Queue.Dequeue(message))
+            delete message;
+    }
+}
+
+void LogWriter::Enqueue(std::unique_ptr<LogMessage>&& message)
+{
+    if (GetProducerQueue()->Queue.Enqueue(message.get()))
+        message.release();
+    else
+        _droppedMessages.fetch_add(1, std::memory_order_relaxed);
+}
+
+LogWriter::ProducerQueue* LogWriter::GetProducerQueue()
+{
+    if (_threadQueue.Owner == this)
+        return _threadQueue.Queue.get();
+
+    // first message of this thread, or the thread outlived a previous writer
+    if (_threadQueue.Queue)
+        _threadQueue.Queue->Abandoned.store(true, std::memory_order_release);
+
+    _threadQueue.Queue = std::make_shared<ProducerQueue>(_queueSize);
+    _threadQueue.Owner = this;
+
+    std::lock_guard<std::mutex> guard(_queuesLock);
+    _queues.push_back(_threadQueue.Queue);
+    return _threadQueue.Queue.get();
+}
+
+void LogWriter::Run()
+{
+    _isWriterThread = true;
+
+    std::chrono::steady_clock::time_point lastFlush = std::chrono::steady_clock::now();
+    while (!_stop)
+    {
+        bool idle = !WriteQueuedMessages();
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (idle || now - lastFlush >= _flushInterval)
+        {
+            std::lock_guard<std::mutex> guard(_writeLock);
+            ReportDroppedMessages();
+            _flush();
+            lastFlush = now;
+        }
+
+        if (idle)
+        {
+            std::unique_lock<std::mutex> lock(_wakeLock);
+            _wakeCondition.wait_for(lock, LogWriterPollInterval, [this]() { return _stop.load(); });
+        }
+    }
+
+    WriteQueuedMessages();
+
+    std::lock_guard<std::mutex> guard(_writeLock);
+    ReportDroppedMessages();
+    _flush();
+}
+
+bool LogWriter::WriteQueuedMessages()
+{
+    bool wrote = false;
+
+    // appenders may log themselves, which registers a ring for this thread, so _queuesLock is not held while writing
+    {
+        std::lock_guard<std::mutex> guard(_queuesLock);
+        _drainQueues.assign(_queues.begin(), _queues.end());
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(_writeLock);
+        for (std::shared_ptr<ProducerQueue> const& queue : _drainQueues)
+        {
+            // a ring only holds what fit since the last pass, so draining it whole keeps every producer moving
+            LogMessage* message;
+            while (queue->Queue.Dequeue(message))
+            {
+                std::unique_ptr<LogMessage> owned(message);
+                _write(owned.get());
+                wrote = true;
+            }
+        }
+    }
+
+    _drainQueues.clear();
+
+    // checking the flag before the ring guarantees that nothing is pushed after the ring was seen empty
+    std::lock_guard<std::mutex> guard(_queuesLock);
+    _queues.erase(std::remove_if(_queues.begin(), _queues.end(), [](std::shared_ptr<ProducerQueue> const& queue)
+    {
+        return queue->Abandoned.load(std::memory_order_acquire) && queue->Queue.Empty();
+    }), _queues.end());
+
+    return wrote;
+}
+
+void LogWriter::ReportDroppedMessages()
+{
+    uint64 dropped = _droppedMessages.load(std::memory_order_relaxed);
+    if (dropped == _reportedDroppedMessages)
+        return;
+
+    LogMessage message(LOG_LEVEL_WARN, "server", Acore::StringFormat("LogWriter: queue full, {} messages dropped ({} since startup). Consider raising Log.Async.QueueSize.",
+        dropped - _reportedDroppedMessages, dropped));
+    _write(&message);
+    _reportedDroppedMessages = dropped;
+}
@@ -0,0 +1,103 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LogWriter_h__
+#define LogWriter_h__
+
+#include "Define.h"
+#include "Duration.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct LogMessage;
+
+/**
+ * @brief Asynchronous logging backend.
+ *
+ * Every producer thread owns a bounded lock-free ring of formatted messages, a single writer thread drains
+ * all rings and hands the messages to the appenders, which batch their output until the next flush.
+ * A flush happens once the writer runs out of messages or FlushInterval elapsed. Messages that do not
+ * fit in a full ring are dropped and reported by the writer.
+ */
+class LogWriter
+{
+public:
+    typedef std::function<void(LogMessage* message)> WriteFn;
+    typedef std::function<void()> FlushFn;
+
+    LogWriter(std::size_t queueSize, Milliseconds flushInterval, WriteFn write, FlushFn flush);
+    ~LogWriter();
+
+    LogWriter(LogWriter const&) = delete;
+    LogWriter& operator=(LogWriter const&) = delete;
+
+    /// Queues a message from the calling thread, never blocks
+    void Enqueue(std::unique_ptr<LogMessage>&& message);
+
+    /// Blocks the writer thread while loggers and appenders are modified
+    [[nodiscard]] std::unique_lock<std::mutex> LockWrites() { return std::unique_lock<std::mutex>(_writeLock); }
+
+    [[nodiscard]] uint64 GetDroppedMessageCount() const { return _droppedMessages.load(std::memory_order_relaxed); }
+
+    /// Appenders only buffer output on the writer thread, synchronous logging may come from any thread
+    [[nodiscard]] static bool IsWriterThread() { return _isWriterThread; }
+
+private:
+    struct ProducerQueue;
+
+    /// Ring of the calling thread, registered with the writer on the first message
+    struct ThreadQueue
+    {
+        ~ThreadQueue();
+
+        LogWriter const* Owner = nullptr;
+        std::shared_ptr<ProducerQueue> Queue;
+    };
+
+    static thread_local ThreadQueue _threadQueue;
+    static thread_local bool _isWriterThread;
+
+    ProducerQueue* GetProducerQueue();
+    void Run();
+    bool WriteQueuedMessages();
+    void ReportDroppedMessages();
+
+    std::size_t _queueSize;
+    Milliseconds _flushInterval;
+    WriteFn _write;
+    FlushFn _flush;
+
+    std::mutex _queuesLock;
+    std::vector<std::shared_ptr<ProducerQueue>> _queues;
+    std::vector<std::shared_ptr<ProducerQueue>> _drainQueues; ///< Writer thread copy of _queues
+
+    std::mutex _writeLock;
+    std::atomic<uint64> _droppedMessages;
+    uint64 _reportedDroppedMessages;
+
+    std::atomic<bool> _stop;
+    std::mutex _wakeLock;
+    std::condition_variable _wakeCondition;
+    std::thread _thread;
+};
+
+#endif // LogWriter_h__
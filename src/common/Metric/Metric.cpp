@@ -18,11 +18,168 @@
 #include "Metric.h"
 #include "Config.h"
 #include "Log.h"
+#include "MetricHistogram.h"
 #include "SteadyTimer.h"
 #include "Strand.h"
 #include "Tokenize.h"
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <fstream>
+
+namespace
+{
+    constexpr uint32 SlotsPerChunk = 64;
+    constexpr uint32 MaxSlotChunks = 128;
+    constexpr uint32 MaxSeries = SlotsPerChunk * MaxSlotChunks;
+    constexpr uint32 SeriesCacheSize = 256;
+    constexpr uint64 IdleEpoch = std::numeric_limits<uint64>::max();
+
+    /// FNV-1a, the separators keep ("ab", "c") and ("a", "bc") apart
+    struct SeriesHasher
+    {
+        std::size_t Hash = 14695981039346656037ULL;
+
+        void Add(std::string_view value)
+        {
+            for (char c : value)
+                Hash = (Hash ^ uint8(c)) * 1099511628211ULL;
+
+            Hash = (Hash ^ 0xFF) * 1099511628211ULL;
+        }
+    };
+
+    std::size_t HashSeries(MetricSeriesType type, std::string_view category, std::initializer_list<MetricTagView> tags)
+    {
+        SeriesHasher hasher;
+        hasher.Hash ^= type;
+        hasher.Add(category);
+        for (MetricTagView const& tag : tags)
+        {
+            hasher.Add(tag.first);
+            hasher.Add(tag.second);
+        }
+
+        return hasher.Hash;
+    }
+}
+
+struct Metric::Series
+{
+    uint32 Id;
+    std::size_t Hash;
+    MetricSeriesType Type;
+    std::string Category;
+    std::vector<MetricTag> Tags;
+
+    bool Matches(MetricSeriesType type, std::string_view category, std::initializer_list<MetricTagView> tags) const
+    {
+        if (type != Type || category != Category || tags.size() != Tags.size())
+            return false;
+
+        return std::equal(tags.begin(), tags.end(), Tags.begin(), [](MetricTagView const& left, MetricTag const& right)
+        {
+            return left.first == right.first && left.second == right.second;
+        });
+    }
+};
+
+/// Cumulative values of a series over all threads at the last batch and the difference to the batch before
+struct Metric::SeriesTotals
+{
+    Series const* Entry = nullptr;
+    uint64 Count = 0;
+    int64 Sum = 0;
+    double FloatSum = 0.0;
+    std::unique_ptr<MetricHistogram::Buckets> Buckets;
+
+    uint64 IntervalCount = 0;
+    int64 IntervalSum = 0;
+    double IntervalFloatSum = 0.0;
+    std::unique_ptr<MetricHistogram::Buckets> IntervalBuckets;
+
+    double LastMean = 0.0; ///< Mean of the last interval with samples, reported by the Prometheus dump
+
+    /// Since the series was interned, Count and Sum also include former series of the same id
+    uint64 SeriesCount = 0;
+    int64 SeriesSum = 0;
+    uint32 IdleIntervals = 0;
+};
+
+/// Per thread aggregate of one series, written by the owning thread only so plain load + store is enough
+struct Metric::Slot
+{
+    std::atomic<uint64> Count = 0;
+    std::atomic<int64> Sum = 0;           ///< Integer values, timers in microseconds
+    std::atomic<double> FloatSum = 0.0;
+    std::atomic<MetricHistogram*> Histogram = nullptr; ///< Timers only, microseconds
+
+    ~Slot() { delete Histogram.load(std::memory_order_relaxed); }
+
+    template<class T>
+    static void Add(std::atomic<T>& field, T value)
+    {
+        field.store(field.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+};
+
+struct Metric::ThreadSlots
+{
+    struct CachedSeries
+    {
+        std::size_t Hash = 0;
+        Series const* Entry = nullptr;
+    };
+
+    std::array<std::atomic<Slot*>, MaxSlotChunks> Chunks;
+    std::atomic<bool> InUse = true;
+    std::atomic<uint64> ActiveEpoch = IdleEpoch; ///< Series epoch seen by the owner while it uses a series
+    uint64 CacheEpoch = 0;
+    std::array<CachedSeries, SeriesCacheSize> Cache; ///< Owner only, saves the registry lookup for recently used series
+
+    ThreadSlots()
+    {
+        for (std::atomic<Slot*>& chunk : Chunks)
+            chunk.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~ThreadSlots()
+    {
+        for (std::atomic<Slot*>& chunk : Chunks)
+            delete[] chunk.load(std::memory_order_relaxed);
+    }
+
+    Slot* GetSlot(uint32 id)
+    {
+        std::atomic<Slot*>& chunk = Chunks[id / SlotsPerChunk];
+        Slot* slots = chunk.load(std::memory_order_relaxed);
+        if (!slots)
+        {
+            slots = new Slot[SlotsPerChunk];
+            chunk.store(slots, std::memory_order_release);
+        }
+
+        return &slots[id % SlotsPerChunk];
+    }
+
+    Slot const* FindSlot(uint32 id) const
+    {
+        Slot const* slots = Chunks[id / SlotsPerChunk].load(std::memory_order_acquire);
+        return slots ? &slots[id % SlotsPerChunk] : nullptr;
+    }
+};
+
+thread_local Metric::ThreadSlotsHolder Metric::_threadSlotsHolder;
+
+Metric::ThreadSlotsHolder::~ThreadSlotsHolder()
+{
+    if (Slots)
+        Slots->InUse.store(false, std::memory_order_release);
+}
 
 Metric::Metric()
 {
@@ -86,6 +243,8 @@ void Metric::LoadFromConfigs()
         _overallStatusTimerInterval = 1;
     }
 
+    _prometheusFile = sConfigMgr->GetOption<std::string>("Metric.PrometheusFile", "");
+
     _thresholds.clear();
     std::vector<std::string> thresholdSettings = sConfigMgr->GetKeysByString("Metric.Threshold.");
     for (std::string const& thresholdSetting : thresholdSettings)
@@ -167,6 +326,189 @@ bool Metric::ShouldLog(std::string const& category, int64 value) const
     return value >= threshold->second;
 }
 
+Metric::ThreadSlots* Metric::GetThreadSlots()
+{
+    if (_threadSlotsHolder.Slots)
+        return _threadSlotsHolder.Slots;
+
+    std::lock_guard<std::mutex> guard(_threadSlotsLock);
+
+    // cumulative values stay valid when another thread continues them, so slots of exited threads are reused
+    for (std::unique_ptr<ThreadSlots> const& threadSlots : _threadSlots)
+    {
+        if (!threadSlots->InUse.load(std::memory_order_acquire))
+        {
+            threadSlots->InUse.store(true, std::memory_order_relaxed);
+            _threadSlotsHolder.Slots = threadSlots.get();
+            return _threadSlotsHolder.Slots;
+        }
+    }
+
+    _threadSlotsHolder.Slots = _threadSlots.emplace_back(std::make_unique<ThreadSlots>()).get();
+    return _threadSlotsHolder.Slots;
+}
+
+Metric::ThreadSlots* Metric::BeginSlotAccess()
+{
+    ThreadSlots* threadSlots = GetThreadSlots();
+
+    // announced before any series is used, CollectSeries only frees the series evicted before the announced epoch
+    uint64 epoch = _seriesEpoch.load();
+    while (true)
+    {
+        threadSlots->ActiveEpoch.store(epoch);
+        uint64 currentEpoch = _seriesEpoch.load();
+        if (currentEpoch == epoch)
+            break;
+
+        epoch = currentEpoch;
+    }
+
+    if (threadSlots->CacheEpoch != epoch)
+    {
+        threadSlots->Cache.fill(ThreadSlots::CachedSeries());
+        threadSlots->CacheEpoch = epoch;
+    }
+
+    return threadSlots;
+}
+
+void Metric::EndSlotAccess(ThreadSlots* threadSlots)
+{
+    threadSlots->ActiveEpoch.store(IdleEpoch, std::memory_order_release);
+}
+
+Metric::Slot* Metric::GetSlot(ThreadSlots* threadSlots, MetricSeriesType type, std::string_view category, std::initializer_list<MetricTagView> tags)
+{
+    std::size_t hash = HashSeries(type, category, tags);
+
+    ThreadSlots::CachedSeries& cached = threadSlots->Cache[hash % SeriesCacheSize];
+    if (!cached.Entry || cached.Hash != hash || !cached.Entry->Matches(type, category, tags))
+    {
+        Series const* series = InternSeries(type, hash, category, tags);
+        if (!series)
+            return nullptr;
+
+        cached.Hash = hash;
+        cached.Entry = series;
+    }
+
+    return threadSlots->GetSlot(cached.Entry->Id);
+}
+
+Metric::Series const* Metric::InternSeries(MetricSeriesType type, std::size_t hash, std::string_view category, std::initializer_list<MetricTagView> tags)
+{
+    std::lock_guard<std::mutex> guard(_seriesLock);
+
+    auto [begin, end] = _seriesByHash.equal_range(hash);
+    for (auto itr = begin; itr != end; ++itr)
+        if (itr->second->Matches(type, category, tags))
+            return itr->second;
+
+    uint32 id;
+    if (!_freeSeriesIds.empty())
+    {
+        id = _freeSeriesIds.back();
+        _freeSeriesIds.pop_back();
+    }
+    else if (_series.size() < MaxSeries)
+    {
+        id = uint32(_series.size());
+        _series.emplace_back();
+    }
+    else
+    {
+        if (!_seriesLimitReported)
+        {
+            LOG_ERROR("metric", "Metric: more than {} series in use, samples of new series ('{}') are dropped. Avoid tags with unbounded values.",
+                MaxSeries, category);
+            _seriesLimitReported = true;
+        }
+
+        return nullptr;
+    }
+
+    std::unique_ptr<Series> series = std::make_unique<Series>();
+    series->Id = id;
+    series->Hash = hash;
+    series->Type = type;
+    series->Category.assign(category);
+    series->Tags.reserve(tags.size());
+    for (MetricTagView const& tag : tags)
+        series->Tags.emplace_back(std::string(tag.first), std::string(tag.second));
+
+    Series const* entry = (_series[id] = std::move(series)).get();
+    _seriesByHash.emplace(hash, entry);
+    return entry;
+}
+
+std::size_t Metric::GetSeriesCount()
+{
+    std::lock_guard<std::mutex> guard(_seriesLock);
+    return _seriesByHash.size();
+}
+
+void Metric::LogIntegerValue(std::string_view category, int64 value, std::initializer_list<MetricTagView> tags)
+{
+    ThreadSlots* threadSlots = BeginSlotAccess();
+    if (Slot* slot = GetSlot(threadSlots, METRIC_SERIES_INTEGER, category, tags))
+    {
+        Slot::Add<uint64>(slot->Count, 1);
+        Slot::Add<int64>(slot->Sum, value);
+    }
+
+    EndSlotAccess(threadSlots);
+}
+
+void Metric::LogFloatValue(std::string_view category, double value, std::initializer_list<MetricTagView> tags)
+{
+    ThreadSlots* threadSlots = BeginSlotAccess();
+    if (Slot* slot = GetSlot(threadSlots, METRIC_SERIES_FLOAT, category, tags))
+    {
+        Slot::Add<uint64>(slot->Count, 1);
+        Slot::Add<double>(slot->FloatSum, value);
+    }
+
+    EndSlotAccess(threadSlots);
+}
+
+void Metric::LogDuration(std::string_view category, std::chrono::nanoseconds value, std::initializer_list<MetricTagView> tags)
+{
+    ThreadSlots* threadSlots = BeginSlotAccess();
+    if (Slot* slot = GetSlot(threadSlots, METRIC_SERIES_TIMER, category, tags))
+    {
+        MetricHistogram* histogram = slot->Histogram.load(std::memory_order_relaxed);
+        if (!histogram)
+        {
+            histogram = new MetricHistogram();
+            slot->Histogram.store(histogram, std::memory_order_release);
+        }
+
+        int64 microseconds = std::max<int64>(0, std::chrono::duration_cast<Microseconds>(value).count());
+        histogram->Record(uint64(microseconds));
+        Slot::Add<uint64>(slot->Count, 1);
+        Slot::Add<int64>(slot->Sum, microseconds);
+    }
+
+    EndSlotAccess(threadSlots);
+}
+
+void Metric::LogSample(std::string_view category, int64 value, std::initializer_list<MetricTagView> tags)
+{
+    using namespace std::chrono;
+
+    MetricData* data = new MetricData;
+    data->Category.assign(category);
+    data->Timestamp = system_clock::now();
+    data->Type = METRIC_DATA_VALUE;
+    data->Value = FormatInfluxDBValue(value);
+    data->Tags.reserve(tags.size());
+    for (MetricTagView const& tag : tags)
+        data->Tags.emplace_back(std::string(tag.first), std::string(tag.second));
+
+    _queuedData.Enqueue(data);
+}
+
 void Metric::LogEvent(std::string const& category, std::string const& title, std::string const& description)
 {
     using namespace std::chrono;
@@ -181,17 +523,277 @@ void Metric::LogEvent(std::string const& category, std::string const& title, std
     _queuedData.Enqueue(data);
 }
 
+void Metric::CollectSeries()
+{
+    std::lock_guard<std::mutex> seriesGuard(_seriesLock);
+    std::lock_guard<std::mutex> threadSlotsGuard(_threadSlotsLock);
+
+    // series evicted before the oldest epoch a thread announced are no longer used, samples they got
+    // meanwhile are merged below so they do not end up in the next series of the id
+    uint64 oldestActiveEpoch = IdleEpoch;
+    for (std::unique_ptr<ThreadSlots> const& threadSlots : _threadSlots)
+        oldestActiveEpoch = std::min(oldestActiveEpoch, threadSlots->ActiveEpoch.load());
+
+    auto unusedSeries = std::partition(_retiredSeries.begin(), _retiredSeries.end(), [oldestActiveEpoch](auto const& retired)
+    {
+        return retired.first > oldestActiveEpoch;
+    });
+
+    std::vector<uint32> freedIds;
+    for (auto itr = unusedSeries; itr != _retiredSeries.end(); ++itr)
+        freedIds.push_back(itr->second->Id);
+
+    _retiredSeries.erase(unusedSeries, _retiredSeries.end());
+
+    _seriesTotals.resize(_series.size());
+
+    std::vector<std::unique_ptr<Series>> evictedSeries;
+    MetricHistogram::Buckets buckets;
+    for (uint32 id = 0; id < _series.size(); ++id)
+    {
+        Series const* series = _series[id].get();
+        uint64 count = 0;
+        int64 sum = 0;
+        double floatSum = 0.0;
+        buckets.fill(0);
+
+        for (std::unique_ptr<ThreadSlots> const& threadSlots : _threadSlots)
+        {
+            Slot const* slot = threadSlots->FindSlot(id);
+            if (!slot)
+                continue;
+
+            count += slot->Count.load(std::memory_order_relaxed);
+            sum += slot->Sum.load(std::memory_order_relaxed);
+            floatSum += slot->FloatSum.load(std::memory_order_relaxed);
+            if (MetricHistogram const* histogram = slot->Histogram.load(std::memory_order_acquire))
+                histogram->AddTo(buckets);
+        }
+
+        SeriesTotals& totals = _seriesTotals[id];
+        if (totals.Entry != series)
+        {
+            totals.Entry = series;
+            totals.LastMean = 0.0;
+            totals.SeriesCount = 0;
+            totals.SeriesSum = 0;
+            totals.IdleIntervals = 0;
+        }
+
+        totals.IntervalCount = count - totals.Count;
+        totals.IntervalSum = sum - totals.Sum;
+        totals.IntervalFloatSum = floatSum - totals.FloatSum;
+        totals.Count = count;
+        totals.Sum = sum;
+        totals.FloatSum = floatSum;
+
+        // slots keep the histograms of former timers of the id
+        if (totals.Buckets || (series && series->Type == METRIC_SERIES_TIMER))
+        {
+            if (!totals.Buckets)
+            {
+                totals.Buckets = std::make_unique<MetricHistogram::Buckets>();
+                totals.Buckets->fill(0);
+                totals.IntervalBuckets = std::make_unique<MetricHistogram::Buckets>();
+            }
+
+            for (uint32 i = 0; i < MetricHistogram::BucketCount; ++i)
+                (*totals.IntervalBuckets)[i] = buckets[i] - (*totals.Buckets)[i];
+
+            *totals.Buckets = buckets;
+        }
+
+        if (!series)
+            continue;
+
+        if (!totals.IntervalCount)
+        {
+            if (++totals.IdleIntervals < MaxIdleIntervals)
+                continue;
+
+            auto [begin, end] = _seriesByHash.equal_range(series->Hash);
+            for (auto itr = begin; itr != end; ++itr)
+            {
+                if (itr->second == series)
+                {
+                    _seriesByHash.erase(itr);
+                    break;
+                }
+            }
+
+            totals.Entry = nullptr;
+            evictedSeries.push_back(std::move(_series[id]));
+            continue;
+        }
+
+        totals.IdleIntervals = 0;
+        totals.SeriesCount += totals.IntervalCount;
+        totals.SeriesSum += totals.IntervalSum;
+
+        switch (series->Type)
+        {
+            case METRIC_SERIES_INTEGER:
+            case METRIC_SERIES_TIMER:
+                totals.LastMean = double(totals.IntervalSum) / double(totals.IntervalCount);
+                break;
+            case METRIC_SERIES_FLOAT:
+                totals.LastMean = totals.IntervalFloatSum / double(totals.IntervalCount);
+                break;
+        }
+    }
+
+    if (!evictedSeries.empty())
+    {
+        // threads drop their cached series once they see the new epoch
+        uint64 epoch = ++_seriesEpoch;
+        for (std::unique_ptr<Series>& series : evictedSeries)
+            _retiredSeries.emplace_back(epoch, std::move(series));
+    }
+
+    if (!freedIds.empty())
+    {
+        _freeSeriesIds.insert(_freeSeriesIds.end(), freedIds.begin(), freedIds.end());
+        _seriesLimitReported = false;
+    }
+}
+
+void Metric::WriteInfluxDBSeries(std::ostream& out, std::string const& timestamp) const
+{
+    // _series may change meanwhile, the series of the totals are only freed by CollectSeries
+    for (SeriesTotals const& totals : _seriesTotals)
+    {
+        if (!totals.Entry || !totals.IntervalCount)
+            continue;
+
+        Series const& series = *totals.Entry;
+        if (out.tellp() != std::streampos(0))
+            out << "\n";
+
+        out << series.Category;
+        if (!_realmName.empty())
+            out << ",realm=" << _realmName;
+
+        for (MetricTag const& tag : series.Tags)
+            out << "," << tag.first << "=" << FormatInfluxDBTagValue(tag.second);
+
+        // value keeps the type of the former per sample points (integers, timers in whole milliseconds)
+        switch (series.Type)
+        {
+            case METRIC_SERIES_INTEGER:
+                out << " value=" << std::llround(totals.LastMean) << "i,sum=" << totals.IntervalSum << 'i';
+                break;
+            case METRIC_SERIES_FLOAT:
+                out << " value=" << totals.LastMean << ",sum=" << totals.IntervalFloatSum;
+                break;
+            case METRIC_SERIES_TIMER:
+            {
+                MetricHistogram::Buckets const& buckets = *totals.IntervalBuckets;
+                out << " value=" << std::llround(totals.LastMean / 1000.0) << 'i'
+                    << ",p50=" << double(MetricHistogram::GetPercentile(buckets, 0.50)) / 1000.0
+                    << ",p95=" << double(MetricHistogram::GetPercentile(buckets, 0.95)) / 1000.0
+                    << ",p99=" << double(MetricHistogram::GetPercentile(buckets, 0.99)) / 1000.0
+                    << ",max=" << double(MetricHistogram::GetMax(buckets)) / 1000.0;
+                break;
+            }
+        }
+
+        out << ",count=" << totals.IntervalCount << "i " << timestamp;
+    }
+}
+
+void Metric::WritePrometheusFile() const
+{
+    // the text format wants all series of a metric next to each other
+    std::vector<Series const*> sortedSeries;
+    for (SeriesTotals const& totals : _seriesTotals)
+        if (totals.Entry && totals.SeriesCount)
+            sortedSeries.push_back(totals.Entry);
+
+    std::stable_sort(sortedSeries.begin(), sortedSeries.end(), [](Series const* left, Series const* right)
+    {
+        return left->Category < right->Category;
+    });
+
+    std::string realmLabel;
+    if (!_realmName.empty())
+        realmLabel = "realm=\"" + FormatPrometheusLabelValue(boost::replace_all_copy(_realmName, "\\ ", " ")) + "\"";
+
+    std::ostringstream out;
+    std::string lastCategory;
+
+    for (Series const* entry : sortedSeries)
+    {
+        Series const& series = *entry;
+        SeriesTotals const& totals = _seriesTotals[series.Id];
+        bool timer = series.Type == METRIC_SERIES_TIMER;
+
+        std::string labels = realmLabel;
+
+        for (MetricTag const& tag : series.Tags)
+        {
+            if (!labels.empty())
+                labels += ',';
+
+            labels += tag.first + "=\"" + FormatPrometheusLabelValue(tag.second) + "\"";
+        }
+
+        if (series.Category != lastCategory)
+        {
+            out << "# TYPE " << series.Category << (timer ? " summary\n" : " gauge\n");
+            lastCategory = series.Category;
+        }
+
+        if (!timer)
+        {
+            out << series.Category << '{' << labels << "} " << totals.LastMean << '\n';
+            continue;
+        }
+
+        // quantiles of the last interval, sum and count since the series was interned as Prometheus expects, all in seconds
+        std::string separator = labels.empty() ? "" : ",";
+        for (double quantile : { 0.5, 0.95, 0.99 })
+            out << series.Category << '{' << labels << separator << "quantile=\"" << quantile << "\"} "
+                << double(MetricHistogram::GetPercentile(*totals.IntervalBuckets, quantile)) / 1000000.0 << '\n';
+
+        out << series.Category << "_sum{" << labels << "} " << double(totals.SeriesSum) / 1000000.0 << '\n';
+        out << series.Category << "_count{" << labels << "} " << totals.SeriesCount << '\n';
+    }
+
+    // written next to the target and renamed so scrapers never read a partial file
+    std::string temporaryFile = _prometheusFile + ".tmp";
+    {
+        std::ofstream file(temporaryFile, std::ios::out | std::ios::trunc);
+        if (!file)
+        {
+            LOG_ERROR("metric", "Metric: could not open '{}' for writing.", temporaryFile);
+            return;
+        }
+
+        file << out.str();
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporaryFile, _prometheusFile, error);
+    if (error)
+        LOG_ERROR("metric", "Metric: could not replace '{}': {}", _prometheusFile, error.message());
+}
+
 void Metric::SendBatch()
 {
     using namespace std::chrono;
 
     std::stringstream batchedData;
-    MetricData* data;
-    bool firstLoop = true;
 
+    CollectSeries();
+    WriteInfluxDBSeries(batchedData, std::to_string(duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count()));
+
+    if (!_prometheusFile.empty())
+        WritePrometheusFile();
+
+    MetricData* data;
     while (_queuedData.Dequeue(data))
     {
-        if (!firstLoop)
+        if (batchedData.tellp() != std::streampos(0))
             batchedData << "\n";
 
         batchedData << data->Category;
@@ -215,7 +817,6 @@ void Metric::SendBatch()
 
         batchedData << " " << std::to_string(duration_cast<nanoseconds>(data->Timestamp.time_since_epoch()).count());
 
-        firstLoop = false;
         delete data;
     }
 
@@ -359,6 +960,14 @@ std::string Metric::FormatInfluxDBTagValue(std::string const& value)
     return boost::replace_all_copy(value, " ", "\\ ");
 }
 
+std::string Metric::FormatPrometheusLabelValue(std::string const& value)
+{
+    std::string formatted = boost::replace_all_copy(value, "\\", "\\\\");
+    boost::replace_all(formatted, "\"", "\\\"");
+    boost::replace_all(formatted, "\n", "\\n");
+    return formatted;
+}
+
 std::string Metric::FormatInfluxDBValue(std::chrono::nanoseconds value)
 {
     return FormatInfluxDBValue(std::chrono::duration_cast<Milliseconds>(value).count());
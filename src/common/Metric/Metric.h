@@ -22,9 +22,14 @@
 #include "Duration.h"
 #include "MPSCQueue.h"
 #include <boost/asio/steady_timer.hpp>
+#include <atomic>
 #include <functional>
+#include <initializer_list>
 #include <memory> // NOTE: this import is NEEDED (even though some IDEs report it as unused)
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -39,8 +44,18 @@ enum MetricDataType
     METRIC_DATA_EVENT
 };
 
+enum MetricSeriesType : uint8
+{
+    METRIC_SERIES_INTEGER,
+    METRIC_SERIES_FLOAT,
+    METRIC_SERIES_TIMER
+};
+
 typedef std::pair<std::string, std::string> MetricTag;
 
+/// Tag as passed by METRIC_TAG, only valid for the duration of the logging call
+typedef std::pair<std::string_view, std::string_view> MetricTagView;
+
 struct MetricData
 {
     std::string Category;
@@ -56,9 +71,34 @@ struct MetricData
     std::string Text;
 };
 
+/**
+ * @brief Collects statistics and sends them to InfluxDB.
+ *
+ * Values and timers are not sent one by one: each category + tag set is interned once as a series and
+ * every thread aggregates its samples into its own slot of that series (count and sum, plus a histogram
+ * for timers) without locks or allocations. Every Metric.Interval the slots of all threads are merged and
+ * each series that got samples is sent as a single point, optionally also dumped in Prometheus text format.
+ * Series without samples for MaxIdleIntervals are evicted, so tags of short lived map instances do not use
+ * up the series limit. Events and threshold filtered detailed timers keep being sent sample by sample.
+ */
 class AC_COMMON_API Metric
 {
 private:
+    struct Series;
+    struct SeriesTotals;
+    struct Slot;
+    struct ThreadSlots;
+
+    /// Slots of the calling thread, handed over to the next new thread once this one exits
+    struct ThreadSlotsHolder
+    {
+        ~ThreadSlotsHolder();
+
+        ThreadSlots* Slots = nullptr;
+    };
+
+    static thread_local ThreadSlotsHolder _threadSlotsHolder;
+
     std::iostream& GetDataStream() { return *_dataStream; }
     std::unique_ptr<std::iostream> _dataStream;
     MPSCQueue<MetricData> _queuedData;
@@ -78,6 +118,28 @@ private:
     std::function<void()> _overallStatusLogger;
     std::string _realmName;
     std::unordered_map<std::string, int64> _thresholds;
+    std::string _prometheusFile;
+
+    std::mutex _seriesLock;
+    std::vector<std::unique_ptr<Series>> _series; ///< By id, empty while the id is free or its series is retiring
+    std::unordered_multimap<std::size_t, Series const*> _seriesByHash;
+    std::vector<uint32> _freeSeriesIds;
+    std::vector<std::pair<uint64, std::unique_ptr<Series>>> _retiredSeries; ///< Evicted series and the epoch they were evicted in
+    std::atomic<uint64> _seriesEpoch = 0; ///< Bumped whenever series are evicted
+    bool _seriesLimitReported = false;
+
+    std::mutex _threadSlotsLock;
+    std::vector<std::unique_ptr<ThreadSlots>> _threadSlots;
+
+    std::vector<SeriesTotals> _seriesTotals; ///< Only accessed when sending a batch
+
+    ThreadSlots* GetThreadSlots();
+    ThreadSlots* BeginSlotAccess();
+    static void EndSlotAccess(ThreadSlots* threadSlots);
+    Slot* GetSlot(ThreadSlots* threadSlots, MetricSeriesType type, std::string_view category, std::initializer_list<MetricTagView> tags);
+    Series const* InternSeries(MetricSeriesType type, std::size_t hash, std::string_view category, std::initializer_list<MetricTagView> tags);
+    void WriteInfluxDBSeries(std::ostream& out, std::string const& timestamp) const;
+    void WritePrometheusFile() const;
 
     bool Connect();
     void SendBatch();
@@ -96,10 +158,14 @@ private:
     static std::string FormatInfluxDBValue(std::chrono::nanoseconds value);
 
     static std::string FormatInfluxDBTagValue(std::string const& value);
+    static std::string FormatPrometheusLabelValue(std::string const& value);
 
     /// @todo: should format TagKey and FieldKey too in the same way as TagValue
 
 public:
+    /// Number of Metric.Interval without samples after which a series is evicted
+    static constexpr uint32 MaxIdleIntervals = 60;
+
     Metric();
     ~Metric();
 
@@ -110,23 +176,31 @@ public:
     void Update();
     bool ShouldLog(std::string const& category, int64 value) const;
 
+    /// Aggregates a sample into the series of category and tags, durations are aggregated as timers
     template<class T>
-    void LogValue(std::string const& category, T value, std::vector<MetricTag> tags)
+    void LogValue(std::string_view category, T value, std::initializer_list<MetricTagView> tags)
     {
-        using namespace std::chrono;
+        if constexpr (std::is_floating_point_v<T>)
+            LogFloatValue(category, double(value), tags);
+        else if constexpr (std::is_integral_v<T>)
+            LogIntegerValue(category, int64(value), tags);
+        else
+            LogDuration(category, std::chrono::duration_cast<std::chrono::nanoseconds>(value), tags);
+    }
 
-        MetricData* data = new MetricData;
-        data->Category = category;
-        data->Timestamp = system_clock::now();
-        data->Type = METRIC_DATA_VALUE;
-        data->Value = FormatInfluxDBValue(value);
-        data->Tags = std::move(tags);
+    void LogIntegerValue(std::string_view category, int64 value, std::initializer_list<MetricTagView> tags);
+    void LogFloatValue(std::string_view category, double value, std::initializer_list<MetricTagView> tags);
+    void LogDuration(std::string_view category, std::chrono::nanoseconds value, std::initializer_list<MetricTagView> tags);
 
-        _queuedData.Enqueue(data);
-    }
+    /// Sends the value as its own point instead of aggregating it, meant for rare samples like threshold filtered timers
+    void LogSample(std::string_view category, int64 value, std::initializer_list<MetricTagView> tags);
 
     void LogEvent(std::string const& category, std::string const& title, std::string const& description);
 
+    /// Merges the slots of all threads into the totals of the next batch and evicts idle series, called every Metric.Interval
+    void CollectSeries();
+    [[nodiscard]] std::size_t GetSeriesCount();
+
     void Unload();
     bool IsEnabled() const { return _enabled; }
 };
@@ -214,7 +288,7 @@ MetricStopWatch<LoggerType> MakeMetricStopWatch(LoggerType&& loggerFunc)
         {                                                                                                        \
             int64 duration = int64(std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - start).count()); \
             if (sMetric->ShouldLog(category, duration))                                                          \
-                sMetric->LogValue(category, duration, { __VA_ARGS__ });                                          \
+                sMetric->LogSample(category, duration, { __VA_ARGS__ });                                         \
         });
 #define METRIC_DETAILED_NO_THRESHOLD_TIMER(category, ...) METRIC_TIMER(category, __VA_ARGS__)
 #define METRIC_DETAILED_EVENT(category, title, description) METRIC_EVENT(category, title, description)
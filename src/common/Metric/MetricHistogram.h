@@ -0,0 +1,151 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef METRIC_HISTOGRAM_H__
+#define METRIC_HISTOGRAM_H__
+
+#include "Define.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+
+/**
+ * @brief Log-linear (HDR style) histogram of unsigned values.
+ *
+ * Values below SubBucketCount get their own bucket, every following power of two is split in SubBucketCount
+ * linear sub-buckets, so any recorded value is known within 1 / SubBucketCount of its real magnitude.
+ * Values of MaxValueBits bits or more land in the last bucket.
+ *
+ * Bucket counters are cumulative and only ever written by one thread, readers compute interval counts
+ * from the difference of two snapshots.
+ */
+class MetricHistogram
+{
+public:
+    static constexpr uint32 SubBucketBits = 4;
+    static constexpr uint32 SubBucketCount = 1 << SubBucketBits;
+    static constexpr uint32 MaxValueBits = 32;
+    static constexpr uint32 BucketCount = (MaxValueBits - SubBucketBits + 1) * SubBucketCount;
+
+    typedef std::array<uint64, BucketCount> Buckets;
+
+    MetricHistogram()
+    {
+        for (std::atomic<uint64>& bucket : _buckets)
+            bucket.store(0, std::memory_order_relaxed);
+    }
+
+    /// Adds a value, may only be called from the owning thread
+    void Record(uint64 value)
+    {
+        std::atomic<uint64>& bucket = _buckets[GetBucketIndex(value)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /// Adds the cumulative bucket counts to buckets, can be called from any thread
+    void AddTo(Buckets& buckets) const
+    {
+        for (uint32 i = 0; i < BucketCount; ++i)
+            buckets[i] += _buckets[i].load(std::memory_order_relaxed);
+    }
+
+    static uint32 GetBucketIndex(uint64 value)
+    {
+        if (value < SubBucketCount)
+            return uint32(value);
+
+        uint32 highestBit = uint32(std::bit_width(value)) - 1;
+        if (highestBit >= MaxValueBits)
+            return BucketCount - 1;
+
+        uint32 shift = highestBit - SubBucketBits;
+        return (shift + 1) * SubBucketCount + uint32((value >> shift) & (SubBucketCount - 1));
+    }
+
+    /// Smallest value stored in the bucket
+    static uint64 GetBucketLowerBound(uint32 index)
+    {
+        if (index < SubBucketCount)
+            return index;
+
+        uint32 shift = index / SubBucketCount - 1;
+        return uint64(SubBucketCount + index % SubBucketCount) << shift;
+    }
+
+    /// Largest value stored in the bucket
+    static uint64 GetBucketUpperBound(uint32 index)
+    {
+        if (index < SubBucketCount)
+            return index;
+
+        return GetBucketLowerBound(index) + (uint64(1) << (index / SubBucketCount - 1)) - 1;
+    }
+
+    /// Number of values in buckets
+    static uint64 GetCount(Buckets const& buckets)
+    {
+        uint64 count = 0;
+        for (uint64 bucketCount : buckets)
+            count += bucketCount;
+
+        return count;
+    }
+
+    /**
+     * @brief Value below which the given fraction of the recorded values fall.
+     *
+     * @param buckets Bucket counts, usually the difference of two snapshots.
+     * @param fraction Percentile in [0, 1].
+     * @return Middle of the bucket holding the percentile, 0 if buckets is empty.
+     */
+    static uint64 GetPercentile(Buckets const& buckets, double fraction)
+    {
+        uint64 count = GetCount(buckets);
+        if (!count)
+            return 0;
+
+        uint64 rank = std::max<uint64>(1, uint64(fraction * double(count) + 0.5));
+        uint64 seen = 0;
+        for (uint32 i = 0; i < BucketCount; ++i)
+        {
+            seen += buckets[i];
+            if (seen >= rank)
+                return (GetBucketLowerBound(i) + GetBucketUpperBound(i)) / 2;
+        }
+
+        return GetBucketUpperBound(BucketCount - 1);
+    }
+
+    /// Upper bound of the highest non empty bucket, 0 if buckets is empty
+    static uint64 GetMax(Buckets const& buckets)
+    {
+        for (uint32 i = BucketCount; i > 0; --i)
+            if (buckets[i - 1])
+                return GetBucketUpperBound(i - 1);
+
+        return 0;
+    }
+
+private:
+    std::array<std::atomic<uint64>, BucketCount> _buckets;
+
+    MetricHistogram(MetricHistogram const&) = delete;
+    MetricHistogram& operator=(MetricHistogram const&) = delete;
+};
+
+#endif // METRIC_HISTOGRAM_H__
@@ -0,0 +1,108 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _BOUNDEDWORKERPOOL_H
+#define _BOUNDEDWORKERPOOL_H
+
+#include "Define.h"
+#include "PCQueue.h"
+#include <atomic>
+#include <functional>
+#include <future>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Worker threads for CPU bound jobs of network threads.
+ *
+ * The pool counts its pending jobs, callers check IsFull() before admitting new work and reject
+ * it early instead of letting the queue grow. Enqueue itself never rejects, so work belonging to
+ * something already admitted always completes. Without threads, jobs run on the calling thread.
+ */
+class BoundedWorkerPool
+{
+public:
+    BoundedWorkerPool() = default;
+    ~BoundedWorkerPool() { Stop(); }
+
+    void Start(uint32 threads, uint32 maxPending)
+    {
+        _maxPending = maxPending;
+
+        for (uint32 i = 0; i < threads; ++i)
+        {
+            _threads.emplace_back([this]()
+            {
+                for (;;)
+                {
+                    std::packaged_task<void()>* job = nullptr;
+                    _queue.WaitAndPop(job);
+                    if (!job)
+                        return;
+
+                    (*job)();
+                    delete job;
+                    _pending.fetch_sub(1, std::memory_order_relaxed);
+                }
+            });
+        }
+    }
+
+    /// Finishes the queued jobs and joins the threads
+    void Stop()
+    {
+        _queue.Shutdown();
+        for (std::thread& thread : _threads)
+            thread.join();
+
+        _threads.clear();
+    }
+
+    std::future<void> Enqueue(std::function<void()>&& work)
+    {
+        std::packaged_task<void()>* job = new std::packaged_task<void()>(std::move(work));
+        std::future<void> result = job->get_future();
+
+        if (_threads.empty())
+        {
+            (*job)();
+            delete job;
+            return result;
+        }
+
+        _pending.fetch_add(1, std::memory_order_relaxed);
+        _queue.Push(job);
+        return result;
+    }
+
+    /// New work should be rejected while the pending jobs reached the configured maximum, 0 for unbounded
+    [[nodiscard]] bool IsFull() const { return _maxPending && _pending.load(std::memory_order_relaxed) >= _maxPending; }
+
+    [[nodiscard]] uint32 GetPendingCount() const { return _pending.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::size_t GetThreadCount() const { return _threads.size(); }
+
+private:
+    BoundedWorkerPool(BoundedWorkerPool const&) = delete;
+    BoundedWorkerPool& operator=(BoundedWorkerPool const&) = delete;
+
+    ProducerConsumerQueue<std::packaged_task<void()>*> _queue;
+    std::vector<std::thread> _threads;
+    std::atomic<uint32> _pending = 0;
+    uint32 _maxPending = 0;
+};
+
+#endif
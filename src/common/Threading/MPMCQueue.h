@@ -0,0 +1,144 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPMCQueue_h__
+#define MPMCQueue_h__
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief C++ implementation of Dmitry Vyukov's bounded lock-free MPMC queue.
+ *
+ * Any number of producers and consumers may use the queue concurrently. Every cell carries a sequence
+ * number telling whether it is ready to be written or read for the current lap, so Enqueue and Dequeue
+ * only need a single compare-and-swap on their position in the common case and never allocate.
+ *
+ * @tparam T The type of data that is being enqueued in the queue, should be cheap to copy (pointers, indices).
+ */
+template<typename T>
+class MPMCQueue
+{
+public:
+    /**
+     * @brief Constructs a new MPMCQueue object.
+     *
+     * @param capacity Maximum number of queued items, rounded up to the next power of two.
+     */
+    explicit MPMCQueue(std::size_t capacity = 1024)
+    {
+        std::size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+
+        _buffer = std::make_unique<Cell[]>(size);
+        _mask = size - 1;
+
+        for (std::size_t i = 0; i < size; ++i)
+            _buffer[i].Sequence.store(i, std::memory_order_relaxed);
+
+        _enqueuePos.store(0, std::memory_order_relaxed);
+        _dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Enqueues a new item in the queue.
+     *
+     * @param input Item to be enqueued.
+     * @return True if the item was enqueued, false if the queue was full.
+     */
+    bool Enqueue(T const& input)
+    {
+        Cell* cell;
+        std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &_buffer[pos & _mask];
+            std::size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = std::ptrdiff_t(sequence) - std::ptrdiff_t(pos);
+            if (diff == 0)
+            {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false; ///< The cell still holds an item of the previous lap
+            else
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+
+        cell->Data = input;
+        cell->Sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Dequeues the oldest item from the queue.
+     *
+     * @param result Reference where the dequeued item will be stored.
+     * @return True if an item was dequeued, false if the queue was empty.
+     */
+    bool Dequeue(T& result)
+    {
+        Cell* cell;
+        std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &_buffer[pos & _mask];
+            std::size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = std::ptrdiff_t(sequence) - std::ptrdiff_t(pos + 1);
+            if (diff == 0)
+            {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+                return false; ///< Nothing was written to the cell for this lap yet
+            else
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+        }
+
+        result = cell->Data;
+        cell->Sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Maximum number of items the queue can hold.
+     */
+    [[nodiscard]] std::size_t Capacity() const { return _mask + 1; }
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> Sequence; ///< Lap marker, equals the position when writable and position + 1 when readable
+        T Data;
+    };
+
+    static constexpr std::size_t CacheLineSize = 64;
+
+    std::unique_ptr<Cell[]> _buffer;
+    std::size_t _mask;
+    alignas(CacheLineSize) std::atomic<std::size_t> _enqueuePos; ///< Kept on its own cache line, producers only
+    alignas(CacheLineSize) std::atomic<std::size_t> _dequeuePos; ///< Kept on its own cache line, consumers only
+
+    MPMCQueue(MPMCQueue const&) = delete; ///< Deleted copy constructor
+    MPMCQueue& operator=(MPMCQueue const&) = delete; ///< Deleted copy assignment operator
+};
+
+#endif // MPMCQueue_h__
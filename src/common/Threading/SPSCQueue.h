@@ -0,0 +1,113 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SPSCQueue_h__
+#define SPSCQueue_h__
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Bounded lock-free ring buffer for exactly one producer thread and one consumer thread.
+ *
+ * Both sides only touch their own position with relaxed stores and read the other one with acquire
+ * semantics, so Enqueue and Dequeue are wait-free and never allocate.
+ *
+ * @tparam T The type of data that is being enqueued in the queue, should be cheap to copy (pointers, indices).
+ */
+template<typename T>
+class SPSCQueue
+{
+public:
+    /**
+     * @brief Constructs a new SPSCQueue object.
+     *
+     * @param capacity Maximum number of queued items, rounded up to the next power of two.
+     */
+    explicit SPSCQueue(std::size_t capacity = 1024)
+    {
+        std::size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+
+        _buffer = std::make_unique<T[]>(size);
+        _mask = size - 1;
+        _head.store(0, std::memory_order_relaxed);
+        _tail.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Enqueues a new item in the queue, may only be called from the producer thread.
+     *
+     * @param input Item to be enqueued.
+     * @return True if the item was enqueued, false if the queue was full.
+     */
+    bool Enqueue(T const& input)
+    {
+        std::size_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) > _mask)
+            return false;
+
+        _buffer[head & _mask] = input;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Dequeues the oldest item from the queue, may only be called from the consumer thread.
+     *
+     * @param result Reference where the dequeued item will be stored.
+     * @return True if an item was dequeued, false if the queue was empty.
+     */
+    bool Dequeue(T& result)
+    {
+        std::size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire))
+            return false;
+
+        result = _buffer[tail & _mask];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Checks if the queue is empty, exact only when called from the consumer thread.
+     */
+    [[nodiscard]] bool Empty() const
+    {
+        return _tail.load(std::memory_order_relaxed) == _head.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Maximum number of items the queue can hold.
+     */
+    [[nodiscard]] std::size_t Capacity() const { return _mask + 1; }
+
+private:
+    static constexpr std::size_t CacheLineSize = 64;
+
+    std::unique_ptr<T[]> _buffer;
+    std::size_t _mask;
+    alignas(CacheLineSize) std::atomic<std::size_t> _head; ///< Next position written by the producer
+    alignas(CacheLineSize) std::atomic<std::size_t> _tail; ///< Next position read by the consumer
+
+    SPSCQueue(SPSCQueue const&) = delete; ///< Deleted copy constructor
+    SPSCQueue& operator=(SPSCQueue const&) = delete; ///< Deleted copy assignment operator
+};
+
+#endif // SPSCQueue_h__
@@ -18,9 +18,26 @@
 #define ACORE_OPTIONAL_H
 
 #include <optional>
+#include <type_traits>
 
 //! Optional helper class to wrap optional values within.
 template <class T>
 using Optional = std::optional<T>;
 
+namespace Acore
+{
+    template<typename>
+    struct is_optional : std::false_type
+    {
+    };
+
+    template<typename T>
+    struct is_optional<std::optional<T>> : std::true_type
+    {
+    };
+
+    template<typename T>
+    constexpr bool is_optional_v = is_optional<T>::value;
+}
+
 #endif // ACORE_OPTIONAL_H
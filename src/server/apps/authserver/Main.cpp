@@ -24,6 +24,7 @@
 */
 
 #include "AppenderDB.h"
+#include "AuthCryptoPool.h"
 #include "AuthSocketMgr.h"
 #include "Banner.h"
 #include "Config.h"
@@ -86,7 +87,7 @@ int main(int argc, char** argv)
 
     // Init logging
     sLog->RegisterAppender<AppenderDB>();
-    sLog->Initialize(nullptr);
+    sLog->Initialize();
 
     Acore::Banner::Show("authserver",
         [](std::string_view text)
@@ -158,6 +159,11 @@ int main(int argc, char** argv)
 
     std::string bindIp = sConfigMgr->GetOption<std::string>("BindIP", "0.0.0.0");
 
+    // Start the workers of the SRP6 math before accepting the first client
+    sAuthCryptoPool.Start(sConfigMgr->GetOption<uint32>("CryptoThreads", 2), sConfigMgr->GetOption<uint32>("CryptoMaxPendingLogons", 500));
+
+    std::shared_ptr<void> sAuthCryptoPoolHandle(nullptr, [](void*) { sAuthCryptoPool.Stop(); });
+
     if (!sAuthSocketMgr.StartNetwork(*ioContext, bindIp, port))
     {
         LOG_ERROR("server.authserver", "Failed to initialize network");
@@ -0,0 +1,82 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AuthCryptoPool_h__
+#define AuthCryptoPool_h__
+
+#include "BoundedWorkerPool.h"
+#include "Log.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+
+/// Worker threads doing the SRP6 math of the logon challenge and proof, keeps the network thread free to accept during login storms
+class AuthCryptoPool : public BoundedWorkerPool
+{
+public:
+    static AuthCryptoPool& Instance()
+    {
+        static AuthCryptoPool instance;
+        return instance;
+    }
+
+    /// Counts a logon challenge rejected with WOW_FAIL_DB_BUSY because the pool was full
+    void OnRejected() { _rejected.fetch_add(1, std::memory_order_relaxed); }
+    [[nodiscard]] uint64 GetRejectedCount() const { return _rejected.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64> _rejected = 0;
+};
+
+#define sAuthCryptoPool AuthCryptoPool::Instance()
+
+/// Continues an AuthSession on its network thread once its AuthCryptoPool job finished, see AuthSession::Update.
+/// onFailure is called instead of callback if the job threw or was dropped when the pool stopped.
+class AuthCryptoCallback
+{
+public:
+    AuthCryptoCallback(std::future<void>&& future, std::function<void()>&& callback, std::function<void()>&& onFailure)
+        : _future(std::move(future)), _callback(std::move(callback)), _onFailure(std::move(onFailure)) { }
+
+    bool InvokeIfReady()
+    {
+        if (_future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return false;
+
+        try
+        {
+            _future.get();
+        }
+        catch (std::exception const& e)
+        {
+            LOG_ERROR("server.authserver", "AuthCryptoPool job failed: {}", e.what());
+            _onFailure();
+            return true;
+        }
+
+        _callback();
+        return true;
+    }
+
+private:
+    std::future<void> _future;
+    std::function<void()> _callback;
+    std::function<void()> _onFailure;
+};
+
+#endif // AuthCryptoPool_h__
@@ -182,6 +182,7 @@ bool AuthSession::Update()
         return false;
 
     _queryProcessor.ProcessReadyCallbacks();
+    _cryptoCallbacks.ProcessReadyCallbacks();
 
     return true;
 }
@@ -291,6 +292,22 @@ bool AuthSession::HandleLogonChallenge()
     std::string login((char const*)challenge->I, challenge->I_len);
     LOG_DEBUG("server.authserver", "[AuthChallenge] '{}'", login);
 
+    // Reject early while the crypto workers are behind, before the account is even queried
+    if (sAuthCryptoPool.IsFull())
+    {
+        sAuthCryptoPool.OnRejected();
+
+        ByteBuffer pkt;
+        pkt << uint8(AUTH_LOGON_CHALLENGE);
+        pkt << uint8(0x00);
+        pkt << uint8(WOW_FAIL_DB_BUSY);
+        SendPacket(pkt);
+
+        LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] Rejected account {}, {} logons are waiting for the crypto workers",
+            GetRemoteIpAddress().to_string(), GetRemotePort(), login, sAuthCryptoPool.GetPendingCount());
+        return true;
+    }
+
     _build = challenge->build;
     _expversion = uint8(AuthHelper::IsPostBCAcceptedClientBuild(_build) ? POST_BC_EXP_FLAG : (AuthHelper::IsPreBCAcceptedClientBuild(_build) ? PRE_BC_EXP_FLAG : NO_VALID_EXP_FLAG));
     std::array<char, 5> os;
@@ -405,9 +422,27 @@ void AuthSession::LogonChallengeCallback(PreparedQueryResult result)
         }
     }
 
-    _srp6.emplace(_accountInfo.Login,
-        fields[12].Get<Binary, Acore::Crypto::SRP6::SALT_LENGTH>(),
-        fields[13].Get<Binary, Acore::Crypto::SRP6::VERIFIER_LENGTH>());
+    // B = 3v + g^b is a modular exponentiation, done by the AuthCryptoPool while the network thread goes on
+    std::string login = _accountInfo.Login;
+    Acore::Crypto::SRP6::Salt salt = fields[12].Get<Binary, Acore::Crypto::SRP6::SALT_LENGTH>();
+    Acore::Crypto::SRP6::Verifier verifier = fields[13].Get<Binary, Acore::Crypto::SRP6::VERIFIER_LENGTH>();
+
+    std::shared_ptr<std::shared_ptr<Acore::Crypto::SRP6>> srp6 = std::make_shared<std::shared_ptr<Acore::Crypto::SRP6>>();
+    _cryptoCallbacks.AddCallback({ sAuthCryptoPool.Enqueue([srp6, login = std::move(login), salt, verifier]()
+    {
+        *srp6 = std::make_shared<Acore::Crypto::SRP6>(login, salt, verifier);
+    }), [this, srp6, securityFlags]()
+    {
+        _srp6 = std::move(*srp6);
+        SendLogonChallengeResponse(securityFlags);
+    }, [this]() { CloseSocket(); } });
+}
+
+void AuthSession::SendLogonChallengeResponse(uint8 securityFlags)
+{
+    ByteBuffer pkt;
+    pkt << uint8(AUTH_LOGON_CHALLENGE);
+    pkt << uint8(0x00);
 
     // Fill the response packet with the result
     if (AuthHelper::IsAcceptedClientBuild(_build))
@@ -442,7 +477,7 @@ void AuthSession::LogonChallengeCallback(PreparedQueryResult result)
             pkt << uint8(1);
 
         LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] account {} is using '{}' locale ({})",
-            ipAddress, port, _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
+            GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
 
         _status = STATUS_LOGON_PROOF;
     }
@@ -469,25 +504,57 @@ bool AuthSession::HandleLogonProof()
         return false;
     }
 
-    // Check if SRP6 results match (password is correct), else send an error
-    if (Optional<SessionKey> K = _srp6->VerifyChallengeResponse(logonProof->A, logonProof->clientM))
+    Acore::Crypto::SRP6::EphemeralKey A = logonProof->A;
+    Acore::Crypto::SHA1::Digest clientM = logonProof->clientM;
+    Acore::Crypto::SHA1::Digest crcHash = logonProof->crc_hash;
+
+    // Check auth token
+    bool sentToken = (logonProof->securityFlags & 0x04);
+    Optional<uint32> incomingToken;
+    if (sentToken && _totpSecret)
     {
-        _sessionKey = *K;
-        // Check auth token
-        bool tokenSuccess = false;
-        bool sentToken = (logonProof->securityFlags & 0x04);
-        if (sentToken && _totpSecret)
-        {
-            uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
-            std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
-            GetReadBuffer().ReadCompleted(sizeof(size) + size);
+        uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
+        std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
+        GetReadBuffer().ReadCompleted(sizeof(size) + size);
 
-            uint32 incomingToken = *Acore::StringTo<uint32>(token);
-            tokenSuccess = Acore::Crypto::TOTP::ValidateToken(*_totpSecret, incomingToken);
-            memset(_totpSecret->data(), 0, _totpSecret->size());
-        }
-        else if (!sentToken && !_totpSecret)
-            tokenSuccess = true;
+        incomingToken = Acore::StringTo<uint32>(token);
+    }
+
+    // Check if SRP6 results match (password is correct) on the AuthCryptoPool, the packet is answered by LogonProofCallback
+    struct LogonProofResult
+    {
+        Optional<SessionKey> Key;
+        bool TokenSuccess = false;
+    };
+
+    std::shared_ptr<LogonProofResult> result = std::make_shared<LogonProofResult>();
+    result->TokenSuccess = !sentToken && !_totpSecret;
+
+    Optional<std::vector<uint8>> totpSecret = std::move(_totpSecret);
+    _totpSecret.reset();
+
+    _cryptoCallbacks.AddCallback({ sAuthCryptoPool.Enqueue([result, srp6 = _srp6, A, clientM, incomingToken, totpSecret = std::move(totpSecret)]() mutable
+    {
+        result->Key = srp6->VerifyChallengeResponse(A, clientM);
+        if (result->Key && incomingToken && totpSecret)
+            result->TokenSuccess = Acore::Crypto::TOTP::ValidateToken(*totpSecret, *incomingToken);
+
+        if (totpSecret)
+            memset(totpSecret->data(), 0, totpSecret->size());
+    }), [this, result, A, clientM, crcHash]()
+    {
+        LogonProofCallback(A, clientM, crcHash, result->Key, result->TokenSuccess);
+    }, [this]() { CloseSocket(); } });
+
+    return true;
+}
+
+void AuthSession::LogonProofCallback(Acore::Crypto::SRP6::EphemeralKey const& A, Acore::Crypto::SHA1::Digest const& clientM, Acore::Crypto::SHA1::Digest const& crcHash,
+    Optional<SessionKey> const& sessionKey, bool tokenSuccess)
+{
+    if (sessionKey)
+    {
+        _sessionKey = *sessionKey;
 
         if (!tokenSuccess)
         {
@@ -496,16 +563,16 @@ bool AuthSession::HandleLogonProof()
             packet << uint8(WOW_FAIL_UNKNOWN_ACCOUNT);
             packet << uint16(0);    // LoginFlags, 1 has account message
             SendPacket(packet);
-            return true;
+            return;
         }
 
-        if (!VerifyVersion(logonProof->A.data(), logonProof->A.size(), logonProof->crc_hash, false))
+        if (!VerifyVersion(A.data(), A.size(), crcHash, false))
         {
             ByteBuffer packet;
             packet << uint8(AUTH_LOGON_PROOF);
             packet << uint8(WOW_FAIL_VERSION_INVALID);
             SendPacket(packet);
-            return true;
+            return;
         }
 
         LOG_DEBUG("server.authserver", "'{}:{}' User '{}' successfully authenticated", GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login);
@@ -523,7 +590,7 @@ bool AuthSession::HandleLogonProof()
         LoginDatabase.DirectExecute(stmt);
 
         // Finish SRP6 and send the final result to the client
-        Acore::Crypto::SHA1::Digest M2 = Acore::Crypto::SRP6::GetSessionVerifier(logonProof->A, logonProof->clientM, _sessionKey);
+        Acore::Crypto::SHA1::Digest M2 = Acore::Crypto::SRP6::GetSessionVerifier(A, clientM, _sessionKey);
 
         ByteBuffer packet;
         if (_expversion & POST_BC_EXP_FLAG)                 // 2.x and 3.x clients
@@ -614,7 +681,6 @@ bool AuthSession::HandleLogonProof()
         }
     }
 
-    return true;
 }
 
 bool AuthSession::HandleReconnectChallenge()
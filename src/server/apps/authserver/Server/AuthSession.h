@@ -19,6 +19,7 @@
 #define __AUTHSESSION_H__
 
 #include "AsyncCallbackProcessor.h"
+#include "AuthCryptoPool.h"
 #include "BigNumber.h"
 #include "ByteBuffer.h"
 #include "Common.h"
@@ -89,9 +90,13 @@ private:
     void ReconnectChallengeCallback(PreparedQueryResult result);
     void RealmListCallback(PreparedQueryResult result);
 
+    void SendLogonChallengeResponse(uint8 securityFlags);
+    void LogonProofCallback(Acore::Crypto::SRP6::EphemeralKey const& A, Acore::Crypto::SHA1::Digest const& clientM, Acore::Crypto::SHA1::Digest const& crcHash,
+        Optional<SessionKey> const& sessionKey, bool tokenSuccess);
+
     bool VerifyVersion(uint8 const* a, int32 aLength, Acore::Crypto::SHA1::Digest const& versionProof, bool isReconnect);
 
-    Optional<Acore::Crypto::SRP6> _srp6;
+    std::shared_ptr<Acore::Crypto::SRP6> _srp6; // shared with the AuthCryptoPool job using it, the session does not touch it meanwhile
     SessionKey _sessionKey = {};
     std::array<uint8, 16> _reconnectProof = {};
 
@@ -105,6 +110,7 @@ private:
     uint8 _expversion;
 
     QueryCallbackProcessor _queryProcessor;
+    AsyncCallbackProcessor<AuthCryptoCallback> _cryptoCallbacks;
 };
 
 #pragma pack(push, 1)
@@ -39,6 +39,7 @@
 #include "MySQLThreading.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvPMgr.h"
+#include "PlayerSaveScheduler.h"
 #include "ProcessPriority.h"
 #include "RASession.h"
 #include "RealmList.h"
@@ -48,6 +49,7 @@
 #include "SecretMgr.h"
 #include "SharedDefines.h"
 #include "SteadyTimer.h"
+#include "TickProfiler.h"
 #include "World.h"
 #include "WorldSessionMgr.h"
 #include "WorldSocket.h"
@@ -187,8 +189,8 @@ int main(int argc, char** argv)
 
     // Init all logs
     sLog->RegisterAppender<AppenderDB>();
-    // If logs are supposed to be handled async then we need to pass the IoContext into the Log singleton
-    sLog->Initialize(sConfigMgr->GetOption<bool>("Log.Async.Enable", false) ? ioContext.get() : nullptr);
+    // If logs are supposed to be handled async the Log singleton starts its own writer thread
+    sLog->Initialize(sConfigMgr->GetOption<bool>("Log.Async.Enable", false));
 
     Acore::Banner::Show("worldserver-daemon",
         [](std::string_view text)
@@ -290,6 +292,8 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+        METRIC_VALUE("player_save_pending", sPlayerSaveScheduler->GetPendingSaveCount());
+        METRIC_VALUE("player_save_in_flight", sPlayerSaveScheduler->GetInFlightSaveCount());
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
@@ -567,6 +571,8 @@ void WorldUpdateLoop()
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
 
+    sTickProfiler->SetThreadName("World");
+
     ///- While we have not World::m_stopEvent, update the world
     while (!World::IsStopped())
     {
@@ -56,6 +56,22 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
         uint8 const synchThreads = sConfigMgr->GetOption<uint8>(name + "Database.SynchThreads", 1);
 
         pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetQueryHolderParallelism(sConfigMgr->GetOption<uint8>(name + "Database.QueryHolderParallelism", 0, false));
+
+        std::string const replicaString = sConfigMgr->GetOption<std::string>(name + "Database.ReplicaInfo", "", false);
+        if (!replicaString.empty())
+        {
+            uint8 const replicaThreads = sConfigMgr->GetOption<uint8>(name + "Database.ReplicaThreads", 1, false);
+            if (replicaThreads < 1 || replicaThreads > 32)
+            {
+                LOG_ERROR(_logger, "{} database: invalid number of replica threads specified. "
+                          "Please pick a value between 1 and 32.", name);
+                return false;
+            }
+
+            Milliseconds const replicaMaxLag = Milliseconds(sConfigMgr->GetOption<uint32>(name + "Database.ReplicaMaxLag", 2000, false));
+            pool.SetReplicaConnectionInfo(replicaString, replicaThreads, replicaMaxLag);
+        }
 
         if (uint32 error = pool.Open())
         {
@@ -0,0 +1,76 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DatabaseStatistics.h"
+#include <algorithm>
+
+namespace
+{
+    void Increment(std::atomic<uint64>& counter, uint64 value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+}
+
+void DatabaseConnectionStatistics::SetStatementCount(uint32 count)
+{
+    // reconnecting prepares the same statements again, readers keep using the counters they found
+    if (_statementCount.load(std::memory_order_relaxed))
+        return;
+
+    _statements = std::make_unique<StatementCounters[]>(count);
+    _statementCount.store(count, std::memory_order_release);
+}
+
+void DatabaseConnectionStatistics::RecordOperation(std::chrono::microseconds queueWait, std::chrono::microseconds execution)
+{
+    _queueWait.Record(uint64(std::max<int64>(queueWait.count(), 0)));
+    _execution.Record(uint64(std::max<int64>(execution.count(), 0)));
+}
+
+void DatabaseConnectionStatistics::RecordStatement(uint32 index, uint32 executions, std::chrono::microseconds duration)
+{
+    if (index >= _statementCount.load(std::memory_order_relaxed))
+        return;
+
+    StatementCounters& counters = _statements[index];
+    Increment(counters.Count, executions);
+    Increment(counters.TotalMicroseconds, uint64(std::max<int64>(duration.count(), 0)));
+}
+
+void DatabaseConnectionStatistics::AddTo(DatabasePoolStatistics& statistics) const
+{
+    _queueWait.AddTo(statistics.QueueWait);
+    _execution.AddTo(statistics.Execution);
+
+    uint32 statementCount = _statementCount.load(std::memory_order_acquire);
+    for (uint32 index = 0; index < statementCount; ++index)
+    {
+        uint64 count = _statements[index].Count.load(std::memory_order_relaxed);
+        if (!count)
+            continue;
+
+        auto itr = std::lower_bound(statistics.Statements.begin(), statistics.Statements.end(), index,
+            [](DatabaseStatementStatistics const& statement, uint32 value) { return statement.Index < value; });
+
+        if (itr == statistics.Statements.end() || itr->Index != index)
+            itr = statistics.Statements.insert(itr, { index, 0, 0, {}, {} });
+
+        itr->Count += count;
+        itr->TotalMicroseconds += _statements[index].TotalMicroseconds.load(std::memory_order_relaxed);
+    }
+}
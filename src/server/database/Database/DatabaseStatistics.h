@@ -0,0 +1,79 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DATABASESTATISTICS_H
+#define _DATABASESTATISTICS_H
+
+#include "Define.h"
+#include "MetricHistogram.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Executions of one prepared statement and the time spent in them
+struct DatabaseStatementStatistics
+{
+    uint32 Index = 0;
+    uint64 Count = 0;
+    uint64 TotalMicroseconds = 0;
+    std::string_view Name; ///< Enumerator of the statement, the index changes whenever statements are added
+    std::string Query;     ///< Empty if the statement is not prepared on any connection
+};
+
+/// Statistics of all connections of a DatabaseWorkerPool since it was opened, see DatabaseWorkerPool::GetStatistics
+struct DatabasePoolStatistics
+{
+    std::size_t QueueSize = 0;
+    MetricHistogram::Buckets QueueWait{}; ///< Microseconds from enqueueing an asynchronous operation until a worker started it
+    MetricHistogram::Buckets Execution{}; ///< Microseconds a worker spent on an asynchronous operation
+    std::vector<DatabaseStatementStatistics> Statements; ///< Statements executed at least once, by Index, Name and Query are set by DatabaseWorkerPool::GetStatistics
+};
+
+/**
+ * @brief Statistics of one MySQLConnection.
+ *
+ * A connection is only used by one thread at a time, so every counter has a single writer and
+ * readers of other threads only ever see slightly outdated values.
+ */
+class AC_DATABASE_API DatabaseConnectionStatistics
+{
+public:
+    /// Allocates the statement counters, done once when the statements are prepared the first time
+    void SetStatementCount(uint32 count);
+
+    void RecordOperation(std::chrono::microseconds queueWait, std::chrono::microseconds execution);
+    void RecordStatement(uint32 index, uint32 executions, std::chrono::microseconds duration);
+
+    void AddTo(DatabasePoolStatistics& statistics) const;
+
+private:
+    struct StatementCounters
+    {
+        std::atomic<uint64> Count = 0;
+        std::atomic<uint64> TotalMicroseconds = 0;
+    };
+
+    MetricHistogram _queueWait;
+    MetricHistogram _execution;
+    std::unique_ptr<StatementCounters[]> _statements;
+    std::atomic<uint32> _statementCount = 0;
+};
+
+#endif
@@ -16,6 +16,8 @@
  */
 
 #include "DatabaseWorker.h"
+#include "Metric.h"
+#include "MySQLConnection.h"
 #include "PCQueue.h"
 #include "SQLOperation.h"
 
@@ -45,9 +47,23 @@ void DatabaseWorker::WorkerThread()
         if (!operation)
             return;
 
+        // the read replica is down, the primary does its reads meanwhile
+        if (_connection->RedirectIfReplicaDown(operation))
+            continue;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
         operation->SetConnection(_connection);
         operation->call();
 
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::duration queueWait = start - operation->m_enqueueTime;
+        _connection->GetStatistics().RecordOperation(std::chrono::duration_cast<std::chrono::microseconds>(queueWait),
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start));
+
+        METRIC_VALUE("db_queue_wait", queueWait, METRIC_TAG("database", _connection->GetDatabaseName()));
+        METRIC_VALUE("db_operation_time", end - start, METRIC_TAG("database", _connection->GetDatabaseName()));
+
         delete operation;
     }
 }
@@ -29,8 +29,10 @@
 #include "QueryHolder.h"
 #include "QueryResult.h"
 #include "SQLOperation.h"
+#include "SmartEnum.h"
 #include "Transaction.h"
 #include "WorldDatabase.h"
+#include <algorithm>
 #include <limits>
 #include <mysqld_error.h>
 #include <sstream>
@@ -55,7 +57,13 @@ template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool() :
     _queue(new ProducerConsumerQueue<SQLOperation*>()),
     _async_threads(0),
-    _synch_threads(0)
+    _synch_threads(0),
+    _queryHolderParallelism(0),
+    _replicaQueue(new ProducerConsumerQueue<SQLOperation*>()),
+    _replicaMaxLag(0),
+    _replica_threads(0),
+    _replicaHealthy(false),
+    _nextReplicaProbe(0)
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
 
@@ -72,6 +80,7 @@ template <class T>
 DatabaseWorkerPool<T>::~DatabaseWorkerPool()
 {
     _queue->Cancel();
+    _replicaQueue->Cancel();
 }
 
 template <class T>
@@ -83,6 +92,14 @@ void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8
     _synch_threads = synchThreads;
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::SetReplicaConnectionInfo(std::string_view infoString, uint8 const threads, std::chrono::milliseconds maxLag)
+{
+    _replicaConnectionInfo = std::make_unique<MySQLConnectionInfo>(infoString);
+    _replica_threads = threads;
+    _replicaMaxLag = maxLag;
+}
+
 template <class T>
 uint32 DatabaseWorkerPool<T>::Open()
 {
@@ -98,10 +115,21 @@ uint32 DatabaseWorkerPool<T>::Open()
 
     error = OpenConnections(IDX_SYNCH, _synch_threads);
 
+    if (!error && _replicaConnectionInfo && _connections[IDX_REPLICA].empty())
+    {
+        LOG_INFO("sql.driver", "Opening read replica of DatabasePool '{}' at {}:{}. Asynchronous connections: {}.",
+            GetDatabaseName(), _replicaConnectionInfo->host, _replicaConnectionInfo->port_or_socket, _replica_threads);
+
+        // the primary can do without the replica, so failing to connect only disables it
+        _replicaQueue = std::make_unique<ProducerConsumerQueue<SQLOperation*>>();
+        if (OpenConnections(IDX_REPLICA, _replica_threads))
+            LOG_ERROR("sql.driver", "Could not open the read replica of DatabasePool '{}', all reads go to the primary.", GetDatabaseName());
+    }
+
     if (!error)
     {
         LOG_INFO("sql.driver", "DatabasePool '{}' opened successfully. {} total connections running.",
-            GetDatabaseName(), (_connections[IDX_SYNCH].size() + _connections[IDX_ASYNC].size()));
+            GetDatabaseName(), (_connections[IDX_SYNCH].size() + _connections[IDX_ASYNC].size() + _connections[IDX_REPLICA].size()));
     }
 
     LOG_INFO("sql.driver", " ");
@@ -116,6 +144,9 @@ void DatabaseWorkerPool<T>::Close()
 
     // Gracefully close async query queue, worker threads will block when the destructor
     // is called from the .clear() functions below until the queue is empty
+    _replicaQueue->Shutdown();
+    _connections[IDX_REPLICA].clear();
+
     _queue->Shutdown();
 
     //! Closes the actualy MySQL connection.
@@ -136,9 +167,9 @@ void DatabaseWorkerPool<T>::Close()
 template <class T>
 bool DatabaseWorkerPool<T>::PrepareStatements()
 {
-    for (auto const& connections : _connections)
+    for (InternalIndex type : { IDX_ASYNC, IDX_SYNCH })
     {
-        for (auto const& connection : connections)
+        for (auto const& connection : _connections[type])
         {
             connection->LockIfReady();
             if (!connection->PrepareStatements())
@@ -174,6 +205,34 @@ bool DatabaseWorkerPool<T>::PrepareStatements()
         }
     }
 
+    _replicaStatements.clear();
+
+    for (auto const& connection : _connections[IDX_REPLICA])
+    {
+        connection->LockIfReady();
+        bool prepared = connection->PrepareStatements();
+        connection->Unlock();
+
+        if (!prepared)
+        {
+            LOG_ERROR("sql.driver", "Could not prepare the statements on the read replica of DatabasePool '{}', all reads go to the primary.", GetDatabaseName());
+            _replicaQueue->Cancel();
+            _connections[IDX_REPLICA].clear();
+            _replicaStatements.clear();
+            break;
+        }
+
+        // every replica connection prepares the same statements
+        if (_replicaStatements.empty())
+        {
+            _replicaStatements.resize(connection->m_stmts.size());
+            for (std::size_t i = 0; i < connection->m_stmts.size(); ++i)
+                _replicaStatements[i] = connection->m_stmts[i] != nullptr;
+        }
+    }
+
+    _replicaHealthy = HasReplica();
+
     return true;
 }
 
@@ -226,20 +285,71 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(std::string_view sql)
 template <class T>
 QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
 {
+    return EnqueueQuery(stmt, nullptr);
+}
+
+template <class T>
+QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt, ReadYourWritesToken const& token)
+{
+    return EnqueueQuery(stmt, &token);
+}
+
+template <class T>
+QueryCallback DatabaseWorkerPool<T>::EnqueueQuery(PreparedStatement<T>* stmt, ReadYourWritesToken const* token)
+{
+    bool replica = IsReplicaStatement(stmt) && CanReadFromReplica(token);
+
     PreparedStatementTask* task = new PreparedStatementTask(stmt, true);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     PreparedQueryResultFuture result = task->GetFuture();
-    Enqueue(task);
+
+    if (replica)
+        EnqueueReplica(task);
+    else
+        Enqueue(task);
+
     return QueryCallback(std::move(result));
 }
 
 template <class T>
 SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
 {
-    SQLQueryHolderTask* task = new SQLQueryHolderTask(holder);
-    // Store future result before enqueueing - task might get already processed and deleted before returning from this method
-    QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    return EnqueueQueryHolder(std::move(holder), nullptr);
+}
+
+template <class T>
+SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, ReadYourWritesToken const& token)
+{
+    return EnqueueQueryHolder(std::move(holder), &token);
+}
+
+template <class T>
+SQLQueryHolderCallback DatabaseWorkerPool<T>::EnqueueQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, ReadYourWritesToken const* token)
+{
+    bool replica = CanReadFromReplica(token) && std::all_of(holder->m_queries.begin(), holder->m_queries.end(), [this](auto const& query)
+    {
+        return !query.first || IsReplicaStatement(query.first);
+    });
+
+    // one part per worker connection, so the round trips of the parts overlap
+    std::size_t workers = replica ? _connections[IDX_REPLICA].size() : _connections[IDX_ASYNC].size();
+    if (_queryHolderParallelism)
+        workers = std::min<std::size_t>(workers, _queryHolderParallelism);
+
+    std::vector<SQLQueryHolderPart> parts = holder->SplitIntoParts(workers);
+    std::shared_ptr<SQLQueryHolderCompletion> completion = std::make_shared<SQLQueryHolderCompletion>(parts.size());
+    // Store future result before enqueueing - tasks might get already processed and deleted before returning from this method
+    QueryResultHolderFuture result = completion->Result.get_future();
+
+    for (SQLQueryHolderPart const& part : parts)
+    {
+        SQLQueryHolderTask* task = new SQLQueryHolderTask(holder, part, completion);
+        if (replica)
+            EnqueueReplica(task);
+        else
+            Enqueue(task);
+    }
+
     return { std::move(holder), std::move(result) };
 }
 
@@ -368,6 +478,9 @@ void DatabaseWorkerPool<T>::KeepAlive()
 
     for (uint8 i = 0; i < count; ++i)
         Enqueue(new PingOperation);
+
+    for (std::size_t i = 0; i < _connections[IDX_REPLICA].size(); ++i)
+        EnqueueReplica(new PingOperation);
 }
 
 /**
@@ -428,6 +541,14 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConne
                 return std::make_unique<T>(_queue.get(), *_connectionInfo);
             case IDX_SYNCH:
                 return std::make_unique<T>(*_connectionInfo);
+            case IDX_REPLICA:
+            {
+                auto replica = std::make_unique<T>(_replicaQueue.get(), *_replicaConnectionInfo);
+                replica->m_connectionFlags = CONNECTION_REPLICA;
+                replica->m_replicaHealthy = &_replicaHealthy;
+                replica->m_primaryQueue = _queue.get();
+                return replica;
+            }
             default:
                 ABORT();
             }
@@ -436,7 +557,7 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConne
         if (uint32 error = connection->Open())
         {
             // Failed to open a connection or invalid version, abort and cleanup
-            _queue->Cancel();
+            (type == IDX_REPLICA ? _replicaQueue : _queue)->Cancel();
             _connections[type].clear();
             return error;
         }
@@ -468,6 +589,7 @@ unsigned long DatabaseWorkerPool<T>::EscapeString(char* to, char const* from, un
 template <class T>
 void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op)
 {
+    op->m_enqueueTime = std::chrono::steady_clock::now();
     _queue->Push(op);
 }
 
@@ -477,6 +599,69 @@ std::size_t DatabaseWorkerPool<T>::QueueSize() const
     return _queue->Size();
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::EnqueueReplica(SQLOperation* op)
+{
+    op->m_enqueueTime = std::chrono::steady_clock::now();
+    _replicaQueue->Push(op);
+}
+
+template <class T>
+bool DatabaseWorkerPool<T>::IsReplicaStatement(PreparedStatementBase const* stmt) const
+{
+    return stmt->GetIndex() < _replicaStatements.size() && _replicaStatements[stmt->GetIndex()];
+}
+
+template <class T>
+bool DatabaseWorkerPool<T>::CanReadFromReplica(ReadYourWritesToken const* token) const
+{
+    if (!HasReplica() || (token && !token->IsReplicated(_replicaMaxLag)))
+        return false;
+
+    if (_replicaHealthy.load(std::memory_order_relaxed))
+        return true;
+
+    // the replica is down, now and then a read is sent anyway so a replica connection tries to reconnect.
+    // If that fails the connection passes the read on to the primary, see MySQLConnection::RedirectIfReplicaDown
+    std::chrono::steady_clock::rep now = std::chrono::steady_clock::now().time_since_epoch().count();
+    std::chrono::steady_clock::rep nextProbe = _nextReplicaProbe.load(std::memory_order_relaxed);
+    return now >= nextProbe && _nextReplicaProbe.compare_exchange_strong(nextProbe,
+        now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(MySQLConnection::REPLICA_RECONNECT_INTERVAL).count());
+}
+
+template <class T>
+DatabasePoolStatistics DatabaseWorkerPool<T>::GetStatistics() const
+{
+    DatabasePoolStatistics statistics;
+    statistics.QueueSize = _queue->Size() + _replicaQueue->Size();
+
+    for (auto const& connections : _connections)
+        for (auto const& connection : connections)
+            connection->m_statistics.AddTo(statistics);
+
+    for (DatabaseStatementStatistics& statement : statistics.Statements)
+    {
+        if (statement.Index < EnumUtils::Count<typename T::Statements>())
+            statement.Name = EnumUtils::ToConstant(static_cast<typename T::Statements>(statement.Index));
+
+        // statements are only prepared on the connections of their ConnectionFlags
+        for (auto const& connections : _connections)
+        {
+            for (auto const& connection : connections)
+            {
+                statement.Query = connection->GetStatementQuery(statement.Index);
+                if (!statement.Query.empty())
+                    break;
+            }
+
+            if (!statement.Query.empty())
+                break;
+        }
+    }
+
+    return statistics;
+}
+
 template <class T>
 T* DatabaseWorkerPool<T>::GetFreeConnection()
 {
@@ -19,9 +19,13 @@
 #define _DATABASEWORKERPOOL_H
 
 #include "DatabaseEnvFwd.h"
+#include "DatabaseStatistics.h"
 #include "Define.h"
+#include "ReadYourWritesToken.h"
 #include "StringFormat.h"
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <vector>
 
 /** @file DatabaseWorkerPool.h */
@@ -52,6 +56,7 @@ private:
     {
         IDX_ASYNC,
         IDX_SYNCH,
+        IDX_REPLICA,
         IDX_SIZE
     };
 
@@ -62,6 +67,16 @@ public:
 
     void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads);
 
+    //! Sets up an optional read only replica, asynchronous reads of statements prepared with CONNECTION_REPLICA are sent there.
+    //! Reads passing a ReadYourWritesToken stay on the primary until maxLag passed since the last committed write of the token.
+    void SetReplicaConnectionInfo(std::string_view infoString, uint8 const threads, std::chrono::milliseconds maxLag);
+
+    [[nodiscard]] bool HasReplica() const { return !_connections[IDX_REPLICA].empty(); }
+    [[nodiscard]] std::chrono::milliseconds GetReplicaMaxLag() const { return _replicaMaxLag; }
+
+    //! Maximum number of worker connections a query holder is split across, 0 for all of them.
+    void SetQueryHolderParallelism(uint8 const parallelism) { _queryHolderParallelism = parallelism; }
+
     uint32 Open();
     void Close();
 
@@ -156,12 +171,20 @@ public:
     //! Statement must be prepared with CONNECTION_ASYNC flag.
     QueryCallback AsyncQuery(PreparedStatement<T>* stmt);
 
+    //! Same as AsyncQuery(stmt), but the query is only sent to the read replica once it replicated the last write of token.
+    QueryCallback AsyncQuery(PreparedStatement<T>* stmt, ReadYourWritesToken const& token);
+
     //! Enqueues a vector of SQL operations (can be both adhoc and prepared) that will set the value of the QueryResultHolderFuture
     //! return object as soon as the query is executed.
     //! The return value is then processed in ProcessQueryCallback methods.
     //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
+    //! The statements are split into consecutive parts executed in parallel by the worker threads, see SetQueryHolderParallelism.
     SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder);
 
+    //! Same as DelayQueryHolder(holder), the holder is sent to the read replica if all of its statements are prepared with
+    //! CONNECTION_REPLICA and the replica had the time to replicate the last write of token.
+    SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, ReadYourWritesToken const& token);
+
     /**
         Transaction context methods.
     */
@@ -215,12 +238,23 @@ public:
 
     [[nodiscard]] std::size_t QueueSize() const;
 
+    //! Queue depth, latencies of asynchronous operations and statement counters of all connections.
+    [[nodiscard]] DatabasePoolStatistics GetStatistics() const;
+
 private:
     uint32 OpenConnections(InternalIndex type, uint8 numConnections);
 
     unsigned long EscapeString(char* to, char const* from, unsigned long length);
 
     void Enqueue(SQLOperation* op);
+    void EnqueueReplica(SQLOperation* op);
+
+    [[nodiscard]] bool IsReplicaStatement(PreparedStatementBase const* stmt) const;
+    [[nodiscard]] bool CanReadFromReplica(ReadYourWritesToken const* token) const;
+
+    //! token nullptr if the caller does not need to read back its own writes
+    QueryCallback EnqueueQuery(PreparedStatement<T>* stmt, ReadYourWritesToken const* token);
+    SQLQueryHolderCallback EnqueueQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, ReadYourWritesToken const* token);
 
     //! Gets a free connection in the synchronous connection pool.
     //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
@@ -234,6 +268,16 @@ private:
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
     std::vector<uint8> _preparedStatementSize;
     uint8 _async_threads, _synch_threads;
+    uint8 _queryHolderParallelism;
+
+    //! Queue shared by the replica connections.
+    std::unique_ptr<ProducerConsumerQueue<SQLOperation*>> _replicaQueue;
+    std::unique_ptr<MySQLConnectionInfo> _replicaConnectionInfo;
+    std::vector<bool> _replicaStatements; //! Statements prepared on the replica connections
+    std::chrono::milliseconds _replicaMaxLag;
+    uint8 _replica_threads;
+    std::atomic<bool> _replicaHealthy; //! Cleared by the replica connections when they lose the replica, set again once one reconnected
+    mutable std::atomic<std::chrono::steady_clock::rep> _nextReplicaProbe; //! While the replica is down, next read sent there to find out if it is back
 #ifdef ACORE_DEBUG
     static inline thread_local bool _warnSyncQueries = false;
 #endif
@@ -20,14 +20,14 @@
 
 #include "MySQLConnection.h"
 
+/*  Naming standard for defines:
+    {DB}_{SEL/INS/UPD/DEL/REP}_{Summary of data changed}
+    When updating more than one field, consider looking at the calling function
+    name for a suiting suffix.
+*/
+// EnumUtils: DESCRIBE THIS
 enum CharacterDatabaseStatements : uint32
 {
-    /*  Naming standard for defines:
-        {DB}_{SEL/INS/UPD/DEL/REP}_{Summary of data changed}
-        When updating more than one field, consider looking at the calling function
-        name for a suiting suffix.
-    */
-
     CHAR_DEL_QUEST_POOL_SAVE,
     CHAR_INS_QUEST_POOL_SAVE,
     CHAR_DEL_NONEXISTENT_GUILD_BANK_ITEM,
@@ -528,7 +528,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DELETE_INSTANCE_SAVED_DATA,
     CHAR_SANITIZE_INSTANCE_SAVED_DATA,
 
-    MAX_CHARACTERDATABASE_STATEMENTS
+    MAX_CHARACTERDATABASE_STATEMENTS // SKIP
 };
 
 class AC_DATABASE_API CharacterDatabaseConnection : public MySQLConnection
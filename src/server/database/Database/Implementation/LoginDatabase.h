@@ -20,14 +20,14 @@
 
 #include "MySQLConnection.h"
 
+/*  Naming standard for defines:
+    {DB}_{SEL/INS/UPD/DEL/REP}_{Summary of data changed}
+    When updating more than one field, consider looking at the calling function
+    name for a suiting suffix.
+*/
+// EnumUtils: DESCRIBE THIS
 enum LoginDatabaseStatements : uint32
 {
-    /*  Naming standard for defines:
-        {DB}_{SEL/INS/UPD/DEL/REP}_{Summary of data changed}
-        When updating more than one field, consider looking at the calling function
-        name for a suiting suffix.
-    */
-
     LOGIN_SEL_REALMLIST,
     LOGIN_DEL_EXPIRED_IP_BANS,
     LOGIN_UPD_EXPIRED_ACCOUNT_BANS,
@@ -124,7 +124,7 @@ enum LoginDatabaseStatements : uint32
 
     LOGIN_INS_UPTIME,
 
-    MAX_LOGINDATABASE_STATEMENTS
+    MAX_LOGINDATABASE_STATEMENTS // SKIP
 };
 
 class AC_DATABASE_API LoginDatabaseConnection : public MySQLConnection
@@ -20,14 +20,14 @@
 
 #include "MySQLConnection.h"
 
+/*  Naming standard for defines:
+    {DB}_{SEL/INS/UPD/DEL/REP}_{Summary of data changed}
+    When updating more than one field, consider looking at the calling function
+    name for a suiting suffix.
+*/
+// EnumUtils: DESCRIBE THIS
 enum WorldDatabaseStatements : uint32
 {
-    /*  Naming standard for defines:
-        {DB}_{SEL/INS/UPD/DEL/REP}_{Summary of data changed}
-        When updating more than one field, consider looking at the calling function
-        name for a suiting suffix.
-    */
-
     WORLD_SEL_QUEST_POOLS,
     WORLD_DEL_CRELINKED_RESPAWN,
     WORLD_REP_CREATURE_LINKED_RESPAWN,
@@ -118,7 +118,7 @@ enum WorldDatabaseStatements : uint32
     WORLD_INS_GAMEOBJECT_ADDON,
     WORLD_UPD_VERSION,
 
-    MAX_WORLDDATABASE_STATEMENTS
+    MAX_WORLDDATABASE_STATEMENTS // SKIP
 };
 
 class AC_DATABASE_API WorldDatabaseConnection : public MySQLConnection
@@ -0,0 +1,1444 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CharacterDatabase.h"
+#include "Define.h"
+#include "SmartEnum.h"
+#include <stdexcept>
+
+namespace Acore::Impl::EnumUtilsImpl
+{
+
+/***************************************************************************************\
+|* data for enum 'CharacterDatabaseStatements' in 'CharacterDatabase.h' auto-generated *|
+\***************************************************************************************/
+template <>
+AC_API_EXPORT EnumText EnumUtils<CharacterDatabaseStatements>::ToString(CharacterDatabaseStatements value)
+{
+    switch (value)
+    {
+        case CHAR_DEL_QUEST_POOL_SAVE: return { "CHAR_DEL_QUEST_POOL_SAVE", "CHAR_DEL_QUEST_POOL_SAVE", "" };
+        case CHAR_INS_QUEST_POOL_SAVE: return { "CHAR_INS_QUEST_POOL_SAVE", "CHAR_INS_QUEST_POOL_SAVE", "" };
+        case CHAR_DEL_NONEXISTENT_GUILD_BANK_ITEM: return { "CHAR_DEL_NONEXISTENT_GUILD_BANK_ITEM", "CHAR_DEL_NONEXISTENT_GUILD_BANK_ITEM", "" };
+        case CHAR_DEL_EXPIRED_BANS: return { "CHAR_DEL_EXPIRED_BANS", "CHAR_DEL_EXPIRED_BANS", "" };
+        case CHAR_SEL_DATA_BY_NAME: return { "CHAR_SEL_DATA_BY_NAME", "CHAR_SEL_DATA_BY_NAME", "" };
+        case CHAR_SEL_DATA_BY_GUID: return { "CHAR_SEL_DATA_BY_GUID", "CHAR_SEL_DATA_BY_GUID", "" };
+        case CHAR_SEL_CHECK_NAME: return { "CHAR_SEL_CHECK_NAME", "CHAR_SEL_CHECK_NAME", "" };
+        case CHAR_SEL_CHECK_GUID: return { "CHAR_SEL_CHECK_GUID", "CHAR_SEL_CHECK_GUID", "" };
+        case CHAR_SEL_SUM_CHARS: return { "CHAR_SEL_SUM_CHARS", "CHAR_SEL_SUM_CHARS", "" };
+        case CHAR_SEL_CHAR_CREATE_INFO: return { "CHAR_SEL_CHAR_CREATE_INFO", "CHAR_SEL_CHAR_CREATE_INFO", "" };
+        case CHAR_INS_CHARACTER_BAN: return { "CHAR_INS_CHARACTER_BAN", "CHAR_INS_CHARACTER_BAN", "" };
+        case CHAR_UPD_CHARACTER_BAN: return { "CHAR_UPD_CHARACTER_BAN", "CHAR_UPD_CHARACTER_BAN", "" };
+        case CHAR_DEL_CHARACTER_BAN: return { "CHAR_DEL_CHARACTER_BAN", "CHAR_DEL_CHARACTER_BAN", "" };
+        case CHAR_SEL_BANINFO: return { "CHAR_SEL_BANINFO", "CHAR_SEL_BANINFO", "" };
+        case CHAR_SEL_GUID_BY_NAME_FILTER: return { "CHAR_SEL_GUID_BY_NAME_FILTER", "CHAR_SEL_GUID_BY_NAME_FILTER", "" };
+        case CHAR_SEL_BANINFO_LIST: return { "CHAR_SEL_BANINFO_LIST", "CHAR_SEL_BANINFO_LIST", "" };
+        case CHAR_SEL_BANNED_NAME: return { "CHAR_SEL_BANNED_NAME", "CHAR_SEL_BANNED_NAME", "" };
+        case CHAR_SEL_ENUM: return { "CHAR_SEL_ENUM", "CHAR_SEL_ENUM", "" };
+        case CHAR_SEL_ENUM_DECLINED_NAME: return { "CHAR_SEL_ENUM_DECLINED_NAME", "CHAR_SEL_ENUM_DECLINED_NAME", "" };
+        case CHAR_SEL_FREE_NAME: return { "CHAR_SEL_FREE_NAME", "CHAR_SEL_FREE_NAME", "" };
+        case CHAR_SEL_CHAR_ZONE: return { "CHAR_SEL_CHAR_ZONE", "CHAR_SEL_CHAR_ZONE", "" };
+        case CHAR_SEL_CHARACTER_NAME_DATA: return { "CHAR_SEL_CHARACTER_NAME_DATA", "CHAR_SEL_CHARACTER_NAME_DATA", "" };
+        case CHAR_SEL_CHAR_POSITION_XYZ: return { "CHAR_SEL_CHAR_POSITION_XYZ", "CHAR_SEL_CHAR_POSITION_XYZ", "" };
+        case CHAR_SEL_CHAR_POSITION: return { "CHAR_SEL_CHAR_POSITION", "CHAR_SEL_CHAR_POSITION", "" };
+        case CHAR_DEL_QUEST_STATUS_DAILY: return { "CHAR_DEL_QUEST_STATUS_DAILY", "CHAR_DEL_QUEST_STATUS_DAILY", "" };
+        case CHAR_DEL_QUEST_STATUS_WEEKLY: return { "CHAR_DEL_QUEST_STATUS_WEEKLY", "CHAR_DEL_QUEST_STATUS_WEEKLY", "" };
+        case CHAR_DEL_QUEST_STATUS_MONTHLY: return { "CHAR_DEL_QUEST_STATUS_MONTHLY", "CHAR_DEL_QUEST_STATUS_MONTHLY", "" };
+        case CHAR_DEL_QUEST_STATUS_SEASONAL: return { "CHAR_DEL_QUEST_STATUS_SEASONAL", "CHAR_DEL_QUEST_STATUS_SEASONAL", "" };
+        case CHAR_DEL_QUEST_STATUS_DAILY_CHAR: return { "CHAR_DEL_QUEST_STATUS_DAILY_CHAR", "CHAR_DEL_QUEST_STATUS_DAILY_CHAR", "" };
+        case CHAR_DEL_QUEST_STATUS_WEEKLY_CHAR: return { "CHAR_DEL_QUEST_STATUS_WEEKLY_CHAR", "CHAR_DEL_QUEST_STATUS_WEEKLY_CHAR", "" };
+        case CHAR_DEL_QUEST_STATUS_MONTHLY_CHAR: return { "CHAR_DEL_QUEST_STATUS_MONTHLY_CHAR", "CHAR_DEL_QUEST_STATUS_MONTHLY_CHAR", "" };
+        case CHAR_DEL_QUEST_STATUS_SEASONAL_CHAR: return { "CHAR_DEL_QUEST_STATUS_SEASONAL_CHAR", "CHAR_DEL_QUEST_STATUS_SEASONAL_CHAR", "" };
+        case CHAR_DEL_BATTLEGROUND_RANDOM: return { "CHAR_DEL_BATTLEGROUND_RANDOM", "CHAR_DEL_BATTLEGROUND_RANDOM", "" };
+        case CHAR_INS_BATTLEGROUND_RANDOM: return { "CHAR_INS_BATTLEGROUND_RANDOM", "CHAR_INS_BATTLEGROUND_RANDOM", "" };
+        case CHAR_SEL_CHARACTER: return { "CHAR_SEL_CHARACTER", "CHAR_SEL_CHARACTER", "" };
+        case CHAR_SEL_CHARACTER_AURAS: return { "CHAR_SEL_CHARACTER_AURAS", "CHAR_SEL_CHARACTER_AURAS", "" };
+        case CHAR_SEL_CHARACTER_SPELL: return { "CHAR_SEL_CHARACTER_SPELL", "CHAR_SEL_CHARACTER_SPELL", "" };
+        case CHAR_SEL_CHARACTER_QUESTSTATUS: return { "CHAR_SEL_CHARACTER_QUESTSTATUS", "CHAR_SEL_CHARACTER_QUESTSTATUS", "" };
+        case CHAR_SEL_CHARACTER_DAILYQUESTSTATUS: return { "CHAR_SEL_CHARACTER_DAILYQUESTSTATUS", "CHAR_SEL_CHARACTER_DAILYQUESTSTATUS", "" };
+        case CHAR_SEL_CHARACTER_WEEKLYQUESTSTATUS: return { "CHAR_SEL_CHARACTER_WEEKLYQUESTSTATUS", "CHAR_SEL_CHARACTER_WEEKLYQUESTSTATUS", "" };
+        case CHAR_SEL_CHARACTER_MONTHLYQUESTSTATUS: return { "CHAR_SEL_CHARACTER_MONTHLYQUESTSTATUS", "CHAR_SEL_CHARACTER_MONTHLYQUESTSTATUS", "" };
+        case CHAR_SEL_CHARACTER_SEASONALQUESTSTATUS: return { "CHAR_SEL_CHARACTER_SEASONALQUESTSTATUS", "CHAR_SEL_CHARACTER_SEASONALQUESTSTATUS", "" };
+        case CHAR_INS_CHARACTER_DAILYQUESTSTATUS: return { "CHAR_INS_CHARACTER_DAILYQUESTSTATUS", "CHAR_INS_CHARACTER_DAILYQUESTSTATUS", "" };
+        case CHAR_INS_CHARACTER_WEEKLYQUESTSTATUS: return { "CHAR_INS_CHARACTER_WEEKLYQUESTSTATUS", "CHAR_INS_CHARACTER_WEEKLYQUESTSTATUS", "" };
+        case CHAR_INS_CHARACTER_MONTHLYQUESTSTATUS: return { "CHAR_INS_CHARACTER_MONTHLYQUESTSTATUS", "CHAR_INS_CHARACTER_MONTHLYQUESTSTATUS", "" };
+        case CHAR_INS_CHARACTER_SEASONALQUESTSTATUS: return { "CHAR_INS_CHARACTER_SEASONALQUESTSTATUS", "CHAR_INS_CHARACTER_SEASONALQUESTSTATUS", "" };
+        case CHAR_SEL_CHARACTER_REPUTATION: return { "CHAR_SEL_CHARACTER_REPUTATION", "CHAR_SEL_CHARACTER_REPUTATION", "" };
+        case CHAR_SEL_CHARACTER_INVENTORY: return { "CHAR_SEL_CHARACTER_INVENTORY", "CHAR_SEL_CHARACTER_INVENTORY", "" };
+        case CHAR_SEL_CHARACTER_ACTIONS: return { "CHAR_SEL_CHARACTER_ACTIONS", "CHAR_SEL_CHARACTER_ACTIONS", "" };
+        case CHAR_SEL_CHARACTER_ACTIONS_SPEC: return { "CHAR_SEL_CHARACTER_ACTIONS_SPEC", "CHAR_SEL_CHARACTER_ACTIONS_SPEC", "" };
+        case CHAR_SEL_CHARACTER_MAILCOUNT_UNREAD: return { "CHAR_SEL_CHARACTER_MAILCOUNT_UNREAD", "CHAR_SEL_CHARACTER_MAILCOUNT_UNREAD", "" };
+        case CHAR_SEL_CHARACTER_MAILCOUNT_UNREAD_SYNCH: return { "CHAR_SEL_CHARACTER_MAILCOUNT_UNREAD_SYNCH", "CHAR_SEL_CHARACTER_MAILCOUNT_UNREAD_SYNCH", "" };
+        case CHAR_SEL_MAIL_SERVER_CHARACTER: return { "CHAR_SEL_MAIL_SERVER_CHARACTER", "CHAR_SEL_MAIL_SERVER_CHARACTER", "" };
+        case CHAR_REP_MAIL_SERVER_CHARACTER: return { "CHAR_REP_MAIL_SERVER_CHARACTER", "CHAR_REP_MAIL_SERVER_CHARACTER", "" };
+        case CHAR_SEL_CHARACTER_SOCIALLIST: return { "CHAR_SEL_CHARACTER_SOCIALLIST", "CHAR_SEL_CHARACTER_SOCIALLIST", "" };
+        case CHAR_SEL_CHARACTER_HOMEBIND: return { "CHAR_SEL_CHARACTER_HOMEBIND", "CHAR_SEL_CHARACTER_HOMEBIND", "" };
+        case CHAR_SEL_CHARACTER_SPELLCOOLDOWNS: return { "CHAR_SEL_CHARACTER_SPELLCOOLDOWNS", "CHAR_SEL_CHARACTER_SPELLCOOLDOWNS", "" };
+        case CHAR_SEL_CHARACTER_DECLINEDNAMES: return { "CHAR_SEL_CHARACTER_DECLINEDNAMES", "CHAR_SEL_CHARACTER_DECLINEDNAMES", "" };
+        case CHAR_SEL_CHARACTER_ACHIEVEMENTS: return { "CHAR_SEL_CHARACTER_ACHIEVEMENTS", "CHAR_SEL_CHARACTER_ACHIEVEMENTS", "" };
+        case CHAR_SEL_CHARACTER_CRITERIAPROGRESS: return { "CHAR_SEL_CHARACTER_CRITERIAPROGRESS", "CHAR_SEL_CHARACTER_CRITERIAPROGRESS", "" };
+        case CHAR_SEL_CHARACTER_EQUIPMENTSETS: return { "CHAR_SEL_CHARACTER_EQUIPMENTSETS", "CHAR_SEL_CHARACTER_EQUIPMENTSETS", "" };
+        case CHAR_SEL_CHARACTER_ENTRY_POINT: return { "CHAR_SEL_CHARACTER_ENTRY_POINT", "CHAR_SEL_CHARACTER_ENTRY_POINT", "" };
+        case CHAR_SEL_CHARACTER_GLYPHS: return { "CHAR_SEL_CHARACTER_GLYPHS", "CHAR_SEL_CHARACTER_GLYPHS", "" };
+        case CHAR_SEL_CHARACTER_TALENTS: return { "CHAR_SEL_CHARACTER_TALENTS", "CHAR_SEL_CHARACTER_TALENTS", "" };
+        case CHAR_SEL_CHARACTER_SKILLS: return { "CHAR_SEL_CHARACTER_SKILLS", "CHAR_SEL_CHARACTER_SKILLS", "" };
+        case CHAR_SEL_CHARACTER_RANDOMBG: return { "CHAR_SEL_CHARACTER_RANDOMBG", "CHAR_SEL_CHARACTER_RANDOMBG", "" };
+        case CHAR_SEL_CHARACTER_BANNED: return { "CHAR_SEL_CHARACTER_BANNED", "CHAR_SEL_CHARACTER_BANNED", "" };
+        case CHAR_SEL_CHARACTER_QUESTSTATUSREW: return { "CHAR_SEL_CHARACTER_QUESTSTATUSREW", "CHAR_SEL_CHARACTER_QUESTSTATUSREW", "" };
+        case CHAR_SEL_ACCOUNT_INSTANCELOCKTIMES: return { "CHAR_SEL_ACCOUNT_INSTANCELOCKTIMES", "CHAR_SEL_ACCOUNT_INSTANCELOCKTIMES", "" };
+        case CHAR_SEL_MAILITEMS: return { "CHAR_SEL_MAILITEMS", "CHAR_SEL_MAILITEMS", "" };
+        case CHAR_SEL_BREW_OF_THE_MONTH: return { "CHAR_SEL_BREW_OF_THE_MONTH", "CHAR_SEL_BREW_OF_THE_MONTH", "" };
+        case CHAR_REP_BREW_OF_THE_MONTH: return { "CHAR_REP_BREW_OF_THE_MONTH", "CHAR_REP_BREW_OF_THE_MONTH", "" };
+        case CHAR_SEL_AUCTION_ITEMS: return { "CHAR_SEL_AUCTION_ITEMS", "CHAR_SEL_AUCTION_ITEMS", "" };
+        case CHAR_INS_AUCTION: return { "CHAR_INS_AUCTION", "CHAR_INS_AUCTION", "" };
+        case CHAR_DEL_AUCTION: return { "CHAR_DEL_AUCTION", "CHAR_DEL_AUCTION", "" };
+        case CHAR_UPD_AUCTION_BID: return { "CHAR_UPD_AUCTION_BID", "CHAR_UPD_AUCTION_BID", "" };
+        case CHAR_SEL_AUCTIONS: return { "CHAR_SEL_AUCTIONS", "CHAR_SEL_AUCTIONS", "" };
+        case CHAR_INS_MAIL: return { "CHAR_INS_MAIL", "CHAR_INS_MAIL", "" };
+        case CHAR_DEL_MAIL_BY_ID: return { "CHAR_DEL_MAIL_BY_ID", "CHAR_DEL_MAIL_BY_ID", "" };
+        case CHAR_INS_MAIL_ITEM: return { "CHAR_INS_MAIL_ITEM", "CHAR_INS_MAIL_ITEM", "" };
+        case CHAR_DEL_MAIL_ITEM: return { "CHAR_DEL_MAIL_ITEM", "CHAR_DEL_MAIL_ITEM", "" };
+        case CHAR_DEL_INVALID_MAIL_ITEM: return { "CHAR_DEL_INVALID_MAIL_ITEM", "CHAR_DEL_INVALID_MAIL_ITEM", "" };
+        case CHAR_SEL_EXPIRED_MAIL: return { "CHAR_SEL_EXPIRED_MAIL", "CHAR_SEL_EXPIRED_MAIL", "" };
+        case CHAR_SEL_EXPIRED_MAIL_ITEMS: return { "CHAR_SEL_EXPIRED_MAIL_ITEMS", "CHAR_SEL_EXPIRED_MAIL_ITEMS", "" };
+        case CHAR_UPD_MAIL_RETURNED: return { "CHAR_UPD_MAIL_RETURNED", "CHAR_UPD_MAIL_RETURNED", "" };
+        case CHAR_UPD_MAIL_ITEM_RECEIVER: return { "CHAR_UPD_MAIL_ITEM_RECEIVER", "CHAR_UPD_MAIL_ITEM_RECEIVER", "" };
+        case CHAR_UPD_ITEM_OWNER: return { "CHAR_UPD_ITEM_OWNER", "CHAR_UPD_ITEM_OWNER", "" };
+        case CHAR_SEL_ITEM_REFUNDS: return { "CHAR_SEL_ITEM_REFUNDS", "CHAR_SEL_ITEM_REFUNDS", "" };
+        case CHAR_SEL_ITEM_BOP_TRADE: return { "CHAR_SEL_ITEM_BOP_TRADE", "CHAR_SEL_ITEM_BOP_TRADE", "" };
+        case CHAR_DEL_ITEM_BOP_TRADE: return { "CHAR_DEL_ITEM_BOP_TRADE", "CHAR_DEL_ITEM_BOP_TRADE", "" };
+        case CHAR_INS_ITEM_BOP_TRADE: return { "CHAR_INS_ITEM_BOP_TRADE", "CHAR_INS_ITEM_BOP_TRADE", "" };
+        case CHAR_REP_INVENTORY_ITEM: return { "CHAR_REP_INVENTORY_ITEM", "CHAR_REP_INVENTORY_ITEM", "" };
+        case CHAR_REP_ITEM_INSTANCE: return { "CHAR_REP_ITEM_INSTANCE", "CHAR_REP_ITEM_INSTANCE", "" };
+        case CHAR_UPD_ITEM_INSTANCE: return { "CHAR_UPD_ITEM_INSTANCE", "CHAR_UPD_ITEM_INSTANCE", "" };
+        case CHAR_UPD_ITEM_INSTANCE_ON_LOAD: return { "CHAR_UPD_ITEM_INSTANCE_ON_LOAD", "CHAR_UPD_ITEM_INSTANCE_ON_LOAD", "" };
+        case CHAR_DEL_ITEM_INSTANCE: return { "CHAR_DEL_ITEM_INSTANCE", "CHAR_DEL_ITEM_INSTANCE", "" };
+        case CHAR_DEL_ITEM_INSTANCE_BY_OWNER: return { "CHAR_DEL_ITEM_INSTANCE_BY_OWNER", "CHAR_DEL_ITEM_INSTANCE_BY_OWNER", "" };
+        case CHAR_UPD_GIFT_OWNER: return { "CHAR_UPD_GIFT_OWNER", "CHAR_UPD_GIFT_OWNER", "" };
+        case CHAR_DEL_GIFT: return { "CHAR_DEL_GIFT", "CHAR_DEL_GIFT", "" };
+        case CHAR_SEL_CHARACTER_GIFT_BY_ITEM: return { "CHAR_SEL_CHARACTER_GIFT_BY_ITEM", "CHAR_SEL_CHARACTER_GIFT_BY_ITEM", "" };
+        case CHAR_SEL_ACCOUNT_BY_NAME: return { "CHAR_SEL_ACCOUNT_BY_NAME", "CHAR_SEL_ACCOUNT_BY_NAME", "" };
+        case CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES: return { "CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES", "CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES", "" };
+        case CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES: return { "CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES", "CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES", "" };
+        case CHAR_SEL_MATCH_MAKER_RATING: return { "CHAR_SEL_MATCH_MAKER_RATING", "CHAR_SEL_MATCH_MAKER_RATING", "" };
+        case CHAR_SEL_CHARACTER_COUNT: return { "CHAR_SEL_CHARACTER_COUNT", "CHAR_SEL_CHARACTER_COUNT", "" };
+        case CHAR_UPD_NAME_BY_GUID: return { "CHAR_UPD_NAME_BY_GUID", "CHAR_UPD_NAME_BY_GUID", "" };
+        case CHAR_DEL_DECLINED_NAME: return { "CHAR_DEL_DECLINED_NAME", "CHAR_DEL_DECLINED_NAME", "" };
+        case CHAR_INS_GUILD: return { "CHAR_INS_GUILD", "CHAR_INS_GUILD", "" };
+        case CHAR_DEL_GUILD: return { "CHAR_DEL_GUILD", "CHAR_DEL_GUILD", "" };
+        case CHAR_UPD_GUILD_NAME: return { "CHAR_UPD_GUILD_NAME", "CHAR_UPD_GUILD_NAME", "" };
+        case CHAR_INS_GUILD_MEMBER: return { "CHAR_INS_GUILD_MEMBER", "CHAR_INS_GUILD_MEMBER", "" };
+        case CHAR_DEL_GUILD_MEMBER: return { "CHAR_DEL_GUILD_MEMBER", "CHAR_DEL_GUILD_MEMBER", "" };
+        case CHAR_DEL_GUILD_MEMBERS: return { "CHAR_DEL_GUILD_MEMBERS", "CHAR_DEL_GUILD_MEMBERS", "" };
+        case CHAR_SEL_GUILD_MEMBER_EXTENDED: return { "CHAR_SEL_GUILD_MEMBER_EXTENDED", "CHAR_SEL_GUILD_MEMBER_EXTENDED", "" };
+        case CHAR_INS_GUILD_RANK: return { "CHAR_INS_GUILD_RANK", "CHAR_INS_GUILD_RANK", "" };
+        case CHAR_DEL_GUILD_RANKS: return { "CHAR_DEL_GUILD_RANKS", "CHAR_DEL_GUILD_RANKS", "" };
+        case CHAR_DEL_GUILD_LOWEST_RANK: return { "CHAR_DEL_GUILD_LOWEST_RANK", "CHAR_DEL_GUILD_LOWEST_RANK", "" };
+        case CHAR_INS_GUILD_BANK_TAB: return { "CHAR_INS_GUILD_BANK_TAB", "CHAR_INS_GUILD_BANK_TAB", "" };
+        case CHAR_DEL_GUILD_BANK_TAB: return { "CHAR_DEL_GUILD_BANK_TAB", "CHAR_DEL_GUILD_BANK_TAB", "" };
+        case CHAR_DEL_GUILD_BANK_TABS: return { "CHAR_DEL_GUILD_BANK_TABS", "CHAR_DEL_GUILD_BANK_TABS", "" };
+        case CHAR_INS_GUILD_BANK_ITEM: return { "CHAR_INS_GUILD_BANK_ITEM", "CHAR_INS_GUILD_BANK_ITEM", "" };
+        case CHAR_DEL_GUILD_BANK_ITEM: return { "CHAR_DEL_GUILD_BANK_ITEM", "CHAR_DEL_GUILD_BANK_ITEM", "" };
+        case CHAR_DEL_GUILD_BANK_ITEMS: return { "CHAR_DEL_GUILD_BANK_ITEMS", "CHAR_DEL_GUILD_BANK_ITEMS", "" };
+        case CHAR_INS_GUILD_BANK_RIGHT: return { "CHAR_INS_GUILD_BANK_RIGHT", "CHAR_INS_GUILD_BANK_RIGHT", "" };
+        case CHAR_DEL_GUILD_BANK_RIGHTS: return { "CHAR_DEL_GUILD_BANK_RIGHTS", "CHAR_DEL_GUILD_BANK_RIGHTS", "" };
+        case CHAR_DEL_GUILD_BANK_RIGHTS_FOR_RANK: return { "CHAR_DEL_GUILD_BANK_RIGHTS_FOR_RANK", "CHAR_DEL_GUILD_BANK_RIGHTS_FOR_RANK", "" };
+        case CHAR_INS_GUILD_BANK_EVENTLOG: return { "CHAR_INS_GUILD_BANK_EVENTLOG", "CHAR_INS_GUILD_BANK_EVENTLOG", "" };
+        case CHAR_DEL_GUILD_BANK_EVENTLOG: return { "CHAR_DEL_GUILD_BANK_EVENTLOG", "CHAR_DEL_GUILD_BANK_EVENTLOG", "" };
+        case CHAR_DEL_GUILD_BANK_EVENTLOGS: return { "CHAR_DEL_GUILD_BANK_EVENTLOGS", "CHAR_DEL_GUILD_BANK_EVENTLOGS", "" };
+        case CHAR_INS_GUILD_EVENTLOG: return { "CHAR_INS_GUILD_EVENTLOG", "CHAR_INS_GUILD_EVENTLOG", "" };
+        case CHAR_DEL_GUILD_EVENTLOG: return { "CHAR_DEL_GUILD_EVENTLOG", "CHAR_DEL_GUILD_EVENTLOG", "" };
+        case CHAR_DEL_GUILD_EVENTLOGS: return { "CHAR_DEL_GUILD_EVENTLOGS", "CHAR_DEL_GUILD_EVENTLOGS", "" };
+        case CHAR_UPD_GUILD_MEMBER_PNOTE: return { "CHAR_UPD_GUILD_MEMBER_PNOTE", "CHAR_UPD_GUILD_MEMBER_PNOTE", "" };
+        case CHAR_UPD_GUILD_MEMBER_OFFNOTE: return { "CHAR_UPD_GUILD_MEMBER_OFFNOTE", "CHAR_UPD_GUILD_MEMBER_OFFNOTE", "" };
+        case CHAR_UPD_GUILD_MEMBER_RANK: return { "CHAR_UPD_GUILD_MEMBER_RANK", "CHAR_UPD_GUILD_MEMBER_RANK", "" };
+        case CHAR_UPD_GUILD_MOTD: return { "CHAR_UPD_GUILD_MOTD", "CHAR_UPD_GUILD_MOTD", "" };
+        case CHAR_UPD_GUILD_INFO: return { "CHAR_UPD_GUILD_INFO", "CHAR_UPD_GUILD_INFO", "" };
+        case CHAR_UPD_GUILD_LEADER: return { "CHAR_UPD_GUILD_LEADER", "CHAR_UPD_GUILD_LEADER", "" };
+        case CHAR_UPD_GUILD_RANK_NAME: return { "CHAR_UPD_GUILD_RANK_NAME", "CHAR_UPD_GUILD_RANK_NAME", "" };
+        case CHAR_UPD_GUILD_RANK_RIGHTS: return { "CHAR_UPD_GUILD_RANK_RIGHTS", "CHAR_UPD_GUILD_RANK_RIGHTS", "" };
+        case CHAR_UPD_GUILD_EMBLEM_INFO: return { "CHAR_UPD_GUILD_EMBLEM_INFO", "CHAR_UPD_GUILD_EMBLEM_INFO", "" };
+        case CHAR_UPD_GUILD_BANK_TAB_INFO: return { "CHAR_UPD_GUILD_BANK_TAB_INFO", "CHAR_UPD_GUILD_BANK_TAB_INFO", "" };
+        case CHAR_UPD_GUILD_BANK_MONEY: return { "CHAR_UPD_GUILD_BANK_MONEY", "CHAR_UPD_GUILD_BANK_MONEY", "" };
+        case CHAR_UPD_GUILD_BANK_EVENTLOG_TAB: return { "CHAR_UPD_GUILD_BANK_EVENTLOG_TAB", "CHAR_UPD_GUILD_BANK_EVENTLOG_TAB", "" };
+        case CHAR_UPD_GUILD_RANK_BANK_MONEY: return { "CHAR_UPD_GUILD_RANK_BANK_MONEY", "CHAR_UPD_GUILD_RANK_BANK_MONEY", "" };
+        case CHAR_UPD_GUILD_BANK_TAB_TEXT: return { "CHAR_UPD_GUILD_BANK_TAB_TEXT", "CHAR_UPD_GUILD_BANK_TAB_TEXT", "" };
+        case CHAR_INS_GUILD_MEMBER_WITHDRAW: return { "CHAR_INS_GUILD_MEMBER_WITHDRAW", "CHAR_INS_GUILD_MEMBER_WITHDRAW", "" };
+        case CHAR_DEL_GUILD_MEMBER_WITHDRAW: return { "CHAR_DEL_GUILD_MEMBER_WITHDRAW", "CHAR_DEL_GUILD_MEMBER_WITHDRAW", "" };
+        case CHAR_SEL_CHAR_DATA_FOR_GUILD: return { "CHAR_SEL_CHAR_DATA_FOR_GUILD", "CHAR_SEL_CHAR_DATA_FOR_GUILD", "" };
+        case CHAR_INS_CHANNEL: return { "CHAR_INS_CHANNEL", "CHAR_INS_CHANNEL", "" };
+        case CHAR_UPD_CHANNEL: return { "CHAR_UPD_CHANNEL", "CHAR_UPD_CHANNEL", "" };
+        case CHAR_DEL_CHANNEL: return { "CHAR_DEL_CHANNEL", "CHAR_DEL_CHANNEL", "" };
+        case CHAR_UPD_CHANNEL_USAGE: return { "CHAR_UPD_CHANNEL_USAGE", "CHAR_UPD_CHANNEL_USAGE", "" };
+        case CHAR_DEL_OLD_CHANNELS: return { "CHAR_DEL_OLD_CHANNELS", "CHAR_DEL_OLD_CHANNELS", "" };
+        case CHAR_DEL_OLD_CHANNELS_BANS: return { "CHAR_DEL_OLD_CHANNELS_BANS", "CHAR_DEL_OLD_CHANNELS_BANS", "" };
+        case CHAR_INS_CHANNEL_BAN: return { "CHAR_INS_CHANNEL_BAN", "CHAR_INS_CHANNEL_BAN", "" };
+        case CHAR_DEL_CHANNEL_BAN: return { "CHAR_DEL_CHANNEL_BAN", "CHAR_DEL_CHANNEL_BAN", "" };
+        case CHAR_UPD_EQUIP_SET: return { "CHAR_UPD_EQUIP_SET", "CHAR_UPD_EQUIP_SET", "" };
+        case CHAR_INS_EQUIP_SET: return { "CHAR_INS_EQUIP_SET", "CHAR_INS_EQUIP_SET", "" };
+        case CHAR_DEL_EQUIP_SET: return { "CHAR_DEL_EQUIP_SET", "CHAR_DEL_EQUIP_SET", "" };
+        case CHAR_INS_AURA: return { "CHAR_INS_AURA", "CHAR_INS_AURA", "" };
+        case CHAR_SEL_ACCOUNT_DATA: return { "CHAR_SEL_ACCOUNT_DATA", "CHAR_SEL_ACCOUNT_DATA", "" };
+        case CHAR_REP_ACCOUNT_DATA: return { "CHAR_REP_ACCOUNT_DATA", "CHAR_REP_ACCOUNT_DATA", "" };
+        case CHAR_DEL_ACCOUNT_DATA: return { "CHAR_DEL_ACCOUNT_DATA", "CHAR_DEL_ACCOUNT_DATA", "" };
+        case CHAR_SEL_PLAYER_ACCOUNT_DATA: return { "CHAR_SEL_PLAYER_ACCOUNT_DATA", "CHAR_SEL_PLAYER_ACCOUNT_DATA", "" };
+        case CHAR_REP_PLAYER_ACCOUNT_DATA: return { "CHAR_REP_PLAYER_ACCOUNT_DATA", "CHAR_REP_PLAYER_ACCOUNT_DATA", "" };
+        case CHAR_DEL_PLAYER_ACCOUNT_DATA: return { "CHAR_DEL_PLAYER_ACCOUNT_DATA", "CHAR_DEL_PLAYER_ACCOUNT_DATA", "" };
+        case CHAR_SEL_TUTORIALS: return { "CHAR_SEL_TUTORIALS", "CHAR_SEL_TUTORIALS", "" };
+        case CHAR_SEL_HAS_TUTORIALS: return { "CHAR_SEL_HAS_TUTORIALS", "CHAR_SEL_HAS_TUTORIALS", "" };
+        case CHAR_INS_TUTORIALS: return { "CHAR_INS_TUTORIALS", "CHAR_INS_TUTORIALS", "" };
+        case CHAR_UPD_TUTORIALS: return { "CHAR_UPD_TUTORIALS", "CHAR_UPD_TUTORIALS", "" };
+        case CHAR_DEL_TUTORIALS: return { "CHAR_DEL_TUTORIALS", "CHAR_DEL_TUTORIALS", "" };
+        case CHAR_INS_INSTANCE_SAVE: return { "CHAR_INS_INSTANCE_SAVE", "CHAR_INS_INSTANCE_SAVE", "" };
+        case CHAR_UPD_INSTANCE_SAVE_DATA: return { "CHAR_UPD_INSTANCE_SAVE_DATA", "CHAR_UPD_INSTANCE_SAVE_DATA", "" };
+        case CHAR_UPD_INSTANCE_SAVE_ENCOUNTERMASK: return { "CHAR_UPD_INSTANCE_SAVE_ENCOUNTERMASK", "CHAR_UPD_INSTANCE_SAVE_ENCOUNTERMASK", "" };
+        case CHAR_DEL_GAME_EVENT_SAVE: return { "CHAR_DEL_GAME_EVENT_SAVE", "CHAR_DEL_GAME_EVENT_SAVE", "" };
+        case CHAR_INS_GAME_EVENT_SAVE: return { "CHAR_INS_GAME_EVENT_SAVE", "CHAR_INS_GAME_EVENT_SAVE", "" };
+        case CHAR_DEL_ALL_GAME_EVENT_CONDITION_SAVE: return { "CHAR_DEL_ALL_GAME_EVENT_CONDITION_SAVE", "CHAR_DEL_ALL_GAME_EVENT_CONDITION_SAVE", "" };
+        case CHAR_DEL_GAME_EVENT_CONDITION_SAVE: return { "CHAR_DEL_GAME_EVENT_CONDITION_SAVE", "CHAR_DEL_GAME_EVENT_CONDITION_SAVE", "" };
+        case CHAR_INS_GAME_EVENT_CONDITION_SAVE: return { "CHAR_INS_GAME_EVENT_CONDITION_SAVE", "CHAR_INS_GAME_EVENT_CONDITION_SAVE", "" };
+        case CHAR_SEL_GAME_EVENT_CONDITION_SAVE_DATA: return { "CHAR_SEL_GAME_EVENT_CONDITION_SAVE_DATA", "CHAR_SEL_GAME_EVENT_CONDITION_SAVE_DATA", "" };
+        case CHAR_SEL_GAME_EVENT_SAVE_DATA: return { "CHAR_SEL_GAME_EVENT_SAVE_DATA", "CHAR_SEL_GAME_EVENT_SAVE_DATA", "" };
+        case CHAR_INS_ARENA_TEAM: return { "CHAR_INS_ARENA_TEAM", "CHAR_INS_ARENA_TEAM", "" };
+        case CHAR_INS_ARENA_TEAM_MEMBER: return { "CHAR_INS_ARENA_TEAM_MEMBER", "CHAR_INS_ARENA_TEAM_MEMBER", "" };
+        case CHAR_DEL_ARENA_TEAM: return { "CHAR_DEL_ARENA_TEAM", "CHAR_DEL_ARENA_TEAM", "" };
+        case CHAR_DEL_ARENA_TEAM_MEMBERS: return { "CHAR_DEL_ARENA_TEAM_MEMBERS", "CHAR_DEL_ARENA_TEAM_MEMBERS", "" };
+        case CHAR_UPD_ARENA_TEAM_CAPTAIN: return { "CHAR_UPD_ARENA_TEAM_CAPTAIN", "CHAR_UPD_ARENA_TEAM_CAPTAIN", "" };
+        case CHAR_DEL_ARENA_TEAM_MEMBER: return { "CHAR_DEL_ARENA_TEAM_MEMBER", "CHAR_DEL_ARENA_TEAM_MEMBER", "" };
+        case CHAR_UPD_ARENA_TEAM_STATS: return { "CHAR_UPD_ARENA_TEAM_STATS", "CHAR_UPD_ARENA_TEAM_STATS", "" };
+        case CHAR_UPD_ARENA_TEAM_MEMBER: return { "CHAR_UPD_ARENA_TEAM_MEMBER", "CHAR_UPD_ARENA_TEAM_MEMBER", "" };
+        case CHAR_REP_CHARACTER_ARENA_STATS: return { "CHAR_REP_CHARACTER_ARENA_STATS", "CHAR_REP_CHARACTER_ARENA_STATS", "" };
+        case CHAR_SEL_PLAYER_ARENA_TEAMS: return { "CHAR_SEL_PLAYER_ARENA_TEAMS", "CHAR_SEL_PLAYER_ARENA_TEAMS", "" };
+        case CHAR_UPD_ARENA_TEAM_NAME: return { "CHAR_UPD_ARENA_TEAM_NAME", "CHAR_UPD_ARENA_TEAM_NAME", "" };
+        case CHAR_DEL_ALL_PETITION_SIGNATURES: return { "CHAR_DEL_ALL_PETITION_SIGNATURES", "CHAR_DEL_ALL_PETITION_SIGNATURES", "" };
+        case CHAR_DEL_PETITION_SIGNATURE: return { "CHAR_DEL_PETITION_SIGNATURE", "CHAR_DEL_PETITION_SIGNATURE", "" };
+        case CHAR_INS_PLAYER_ENTRY_POINT: return { "CHAR_INS_PLAYER_ENTRY_POINT", "CHAR_INS_PLAYER_ENTRY_POINT", "" };
+        case CHAR_DEL_PLAYER_ENTRY_POINT: return { "CHAR_DEL_PLAYER_ENTRY_POINT", "CHAR_DEL_PLAYER_ENTRY_POINT", "" };
+        case CHAR_INS_PLAYER_HOMEBIND: return { "CHAR_INS_PLAYER_HOMEBIND", "CHAR_INS_PLAYER_HOMEBIND", "" };
+        case CHAR_UPD_PLAYER_HOMEBIND: return { "CHAR_UPD_PLAYER_HOMEBIND", "CHAR_UPD_PLAYER_HOMEBIND", "" };
+        case CHAR_DEL_PLAYER_HOMEBIND: return { "CHAR_DEL_PLAYER_HOMEBIND", "CHAR_DEL_PLAYER_HOMEBIND", "" };
+        case CHAR_SEL_CORPSES: return { "CHAR_SEL_CORPSES", "CHAR_SEL_CORPSES", "" };
+        case CHAR_INS_CORPSE: return { "CHAR_INS_CORPSE", "CHAR_INS_CORPSE", "" };
+        case CHAR_DEL_CORPSE: return { "CHAR_DEL_CORPSE", "CHAR_DEL_CORPSE", "" };
+        case CHAR_DEL_CORPSES_FROM_MAP: return { "CHAR_DEL_CORPSES_FROM_MAP", "CHAR_DEL_CORPSES_FROM_MAP", "" };
+        case CHAR_SEL_CORPSE_LOCATION: return { "CHAR_SEL_CORPSE_LOCATION", "CHAR_SEL_CORPSE_LOCATION", "" };
+        case CHAR_SEL_CREATURE_RESPAWNS: return { "CHAR_SEL_CREATURE_RESPAWNS", "CHAR_SEL_CREATURE_RESPAWNS", "" };
+        case CHAR_REP_CREATURE_RESPAWN: return { "CHAR_REP_CREATURE_RESPAWN", "CHAR_REP_CREATURE_RESPAWN", "" };
+        case CHAR_DEL_CREATURE_RESPAWN: return { "CHAR_DEL_CREATURE_RESPAWN", "CHAR_DEL_CREATURE_RESPAWN", "" };
+        case CHAR_DEL_CREATURE_RESPAWN_BY_INSTANCE: return { "CHAR_DEL_CREATURE_RESPAWN_BY_INSTANCE", "CHAR_DEL_CREATURE_RESPAWN_BY_INSTANCE", "" };
+        case CHAR_SEL_GO_RESPAWNS: return { "CHAR_SEL_GO_RESPAWNS", "CHAR_SEL_GO_RESPAWNS", "" };
+        case CHAR_REP_GO_RESPAWN: return { "CHAR_REP_GO_RESPAWN", "CHAR_REP_GO_RESPAWN", "" };
+        case CHAR_DEL_GO_RESPAWN: return { "CHAR_DEL_GO_RESPAWN", "CHAR_DEL_GO_RESPAWN", "" };
+        case CHAR_DEL_GO_RESPAWN_BY_INSTANCE: return { "CHAR_DEL_GO_RESPAWN_BY_INSTANCE", "CHAR_DEL_GO_RESPAWN_BY_INSTANCE", "" };
+        case CHAR_SEL_GM_TICKETS: return { "CHAR_SEL_GM_TICKETS", "CHAR_SEL_GM_TICKETS", "" };
+        case CHAR_REP_GM_TICKET: return { "CHAR_REP_GM_TICKET", "CHAR_REP_GM_TICKET", "" };
+        case CHAR_DEL_GM_TICKET: return { "CHAR_DEL_GM_TICKET", "CHAR_DEL_GM_TICKET", "" };
+        case CHAR_DEL_ALL_GM_TICKETS: return { "CHAR_DEL_ALL_GM_TICKETS", "CHAR_DEL_ALL_GM_TICKETS", "" };
+        case CHAR_DEL_PLAYER_GM_TICKETS: return { "CHAR_DEL_PLAYER_GM_TICKETS", "CHAR_DEL_PLAYER_GM_TICKETS", "" };
+        case CHAR_UPD_PLAYER_GM_TICKETS_ON_CHAR_DELETION: return { "CHAR_UPD_PLAYER_GM_TICKETS_ON_CHAR_DELETION", "CHAR_UPD_PLAYER_GM_TICKETS_ON_CHAR_DELETION", "" };
+        case CHAR_INS_GM_SURVEY: return { "CHAR_INS_GM_SURVEY", "CHAR_INS_GM_SURVEY", "" };
+        case CHAR_INS_GM_SUBSURVEY: return { "CHAR_INS_GM_SUBSURVEY", "CHAR_INS_GM_SUBSURVEY", "" };
+        case CHAR_INS_LAG_REPORT: return { "CHAR_INS_LAG_REPORT", "CHAR_INS_LAG_REPORT", "" };
+        case CHAR_INS_CHARACTER: return { "CHAR_INS_CHARACTER", "CHAR_INS_CHARACTER", "" };
+        case CHAR_UPD_CHARACTER: return { "CHAR_UPD_CHARACTER", "CHAR_UPD_CHARACTER", "" };
+        case CHAR_UPD_ADD_AT_LOGIN_FLAG: return { "CHAR_UPD_ADD_AT_LOGIN_FLAG", "CHAR_UPD_ADD_AT_LOGIN_FLAG", "" };
+        case CHAR_UPD_REM_AT_LOGIN_FLAG: return { "CHAR_UPD_REM_AT_LOGIN_FLAG", "CHAR_UPD_REM_AT_LOGIN_FLAG", "" };
+        case CHAR_UPD_ALL_AT_LOGIN_FLAGS: return { "CHAR_UPD_ALL_AT_LOGIN_FLAGS", "CHAR_UPD_ALL_AT_LOGIN_FLAGS", "" };
+        case CHAR_INS_BUG_REPORT: return { "CHAR_INS_BUG_REPORT", "CHAR_INS_BUG_REPORT", "" };
+        case CHAR_UPD_PETITION_NAME: return { "CHAR_UPD_PETITION_NAME", "CHAR_UPD_PETITION_NAME", "" };
+        case CHAR_INS_PETITION_SIGNATURE: return { "CHAR_INS_PETITION_SIGNATURE", "CHAR_INS_PETITION_SIGNATURE", "" };
+        case CHAR_UPD_ACCOUNT_ONLINE: return { "CHAR_UPD_ACCOUNT_ONLINE", "CHAR_UPD_ACCOUNT_ONLINE", "" };
+        case CHAR_INS_GROUP: return { "CHAR_INS_GROUP", "CHAR_INS_GROUP", "" };
+        case CHAR_REP_GROUP_MEMBER: return { "CHAR_REP_GROUP_MEMBER", "CHAR_REP_GROUP_MEMBER", "" };
+        case CHAR_DEL_GROUP_MEMBER: return { "CHAR_DEL_GROUP_MEMBER", "CHAR_DEL_GROUP_MEMBER", "" };
+        case CHAR_UPD_GROUP_LEADER: return { "CHAR_UPD_GROUP_LEADER", "CHAR_UPD_GROUP_LEADER", "" };
+        case CHAR_UPD_GROUP_TYPE: return { "CHAR_UPD_GROUP_TYPE", "CHAR_UPD_GROUP_TYPE", "" };
+        case CHAR_UPD_GROUP_MEMBER_SUBGROUP: return { "CHAR_UPD_GROUP_MEMBER_SUBGROUP", "CHAR_UPD_GROUP_MEMBER_SUBGROUP", "" };
+        case CHAR_UPD_GROUP_MEMBER_FLAG: return { "CHAR_UPD_GROUP_MEMBER_FLAG", "CHAR_UPD_GROUP_MEMBER_FLAG", "" };
+        case CHAR_UPD_GROUP_DIFFICULTY: return { "CHAR_UPD_GROUP_DIFFICULTY", "CHAR_UPD_GROUP_DIFFICULTY", "" };
+        case CHAR_UPD_GROUP_RAID_DIFFICULTY: return { "CHAR_UPD_GROUP_RAID_DIFFICULTY", "CHAR_UPD_GROUP_RAID_DIFFICULTY", "" };
+        case CHAR_DEL_INVALID_SPELL_SPELLS: return { "CHAR_DEL_INVALID_SPELL_SPELLS", "CHAR_DEL_INVALID_SPELL_SPELLS", "" };
+        case CHAR_DEL_INVALID_SPELL_TALENTS: return { "CHAR_DEL_INVALID_SPELL_TALENTS", "CHAR_DEL_INVALID_SPELL_TALENTS", "" };
+        case CHAR_UPD_DELETE_INFO: return { "CHAR_UPD_DELETE_INFO", "CHAR_UPD_DELETE_INFO", "" };
+        case CHAR_UDP_RESTORE_DELETE_INFO: return { "CHAR_UDP_RESTORE_DELETE_INFO", "CHAR_UDP_RESTORE_DELETE_INFO", "" };
+        case CHAR_UPD_ZONE: return { "CHAR_UPD_ZONE", "CHAR_UPD_ZONE", "" };
+        case CHAR_UPD_LEVEL: return { "CHAR_UPD_LEVEL", "CHAR_UPD_LEVEL", "" };
+        case CHAR_UPD_XP_ACCUMULATIVE: return { "CHAR_UPD_XP_ACCUMULATIVE", "CHAR_UPD_XP_ACCUMULATIVE", "" };
+        case CHAR_DEL_INVALID_ACHIEV_PROGRESS_CRITERIA: return { "CHAR_DEL_INVALID_ACHIEV_PROGRESS_CRITERIA", "CHAR_DEL_INVALID_ACHIEV_PROGRESS_CRITERIA", "" };
+        case CHAR_DEL_INVALID_ACHIEVMENT: return { "CHAR_DEL_INVALID_ACHIEVMENT", "CHAR_DEL_INVALID_ACHIEVMENT", "" };
+        case CHAR_INS_ADDON: return { "CHAR_INS_ADDON", "CHAR_INS_ADDON", "" };
+        case CHAR_DEL_INVALID_PET_SPELL: return { "CHAR_DEL_INVALID_PET_SPELL", "CHAR_DEL_INVALID_PET_SPELL", "" };
+        case CHAR_UPD_GLOBAL_INSTANCE_RESETTIME: return { "CHAR_UPD_GLOBAL_INSTANCE_RESETTIME", "CHAR_UPD_GLOBAL_INSTANCE_RESETTIME", "" };
+        case CHAR_UPD_CHAR_ONLINE: return { "CHAR_UPD_CHAR_ONLINE", "CHAR_UPD_CHAR_ONLINE", "" };
+        case CHAR_UPD_CHAR_NAME_AT_LOGIN: return { "CHAR_UPD_CHAR_NAME_AT_LOGIN", "CHAR_UPD_CHAR_NAME_AT_LOGIN", "" };
+        case CHAR_UPD_WORLDSTATE: return { "CHAR_UPD_WORLDSTATE", "CHAR_UPD_WORLDSTATE", "" };
+        case CHAR_INS_WORLDSTATE: return { "CHAR_INS_WORLDSTATE", "CHAR_INS_WORLDSTATE", "" };
+        case CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE: return { "CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE", "CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE", "" };
+        case CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_NOT_EXTENDED: return { "CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_NOT_EXTENDED", "CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_NOT_EXTENDED", "" };
+        case CHAR_UPD_CHAR_INSTANCE_SET_NOT_EXTENDED: return { "CHAR_UPD_CHAR_INSTANCE_SET_NOT_EXTENDED", "CHAR_UPD_CHAR_INSTANCE_SET_NOT_EXTENDED", "" };
+        case CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_GUID: return { "CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_GUID", "CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_GUID", "" };
+        case CHAR_UPD_CHAR_INSTANCE: return { "CHAR_UPD_CHAR_INSTANCE", "CHAR_UPD_CHAR_INSTANCE", "" };
+        case CHAR_UPD_CHAR_INSTANCE_EXTENDED: return { "CHAR_UPD_CHAR_INSTANCE_EXTENDED", "CHAR_UPD_CHAR_INSTANCE_EXTENDED", "" };
+        case CHAR_INS_CHAR_INSTANCE: return { "CHAR_INS_CHAR_INSTANCE", "CHAR_INS_CHAR_INSTANCE", "" };
+        case CHAR_INS_ARENA_LOG_FIGHT: return { "CHAR_INS_ARENA_LOG_FIGHT", "CHAR_INS_ARENA_LOG_FIGHT", "" };
+        case CHAR_INS_ARENA_LOG_MEMBERSTATS: return { "CHAR_INS_ARENA_LOG_MEMBERSTATS", "CHAR_INS_ARENA_LOG_MEMBERSTATS", "" };
+        case CHAR_UPD_GENDER_AND_APPEARANCE: return { "CHAR_UPD_GENDER_AND_APPEARANCE", "CHAR_UPD_GENDER_AND_APPEARANCE", "" };
+        case CHAR_DEL_CHARACTER_SKILL: return { "CHAR_DEL_CHARACTER_SKILL", "CHAR_DEL_CHARACTER_SKILL", "" };
+        case CHAR_UPD_ADD_CHARACTER_SOCIAL_FLAGS: return { "CHAR_UPD_ADD_CHARACTER_SOCIAL_FLAGS", "CHAR_UPD_ADD_CHARACTER_SOCIAL_FLAGS", "" };
+        case CHAR_UPD_REM_CHARACTER_SOCIAL_FLAGS: return { "CHAR_UPD_REM_CHARACTER_SOCIAL_FLAGS", "CHAR_UPD_REM_CHARACTER_SOCIAL_FLAGS", "" };
+        case CHAR_INS_CHARACTER_SOCIAL: return { "CHAR_INS_CHARACTER_SOCIAL", "CHAR_INS_CHARACTER_SOCIAL", "" };
+        case CHAR_DEL_CHARACTER_SOCIAL: return { "CHAR_DEL_CHARACTER_SOCIAL", "CHAR_DEL_CHARACTER_SOCIAL", "" };
+        case CHAR_UPD_CHARACTER_SOCIAL_NOTE: return { "CHAR_UPD_CHARACTER_SOCIAL_NOTE", "CHAR_UPD_CHARACTER_SOCIAL_NOTE", "" };
+        case CHAR_UPD_CHARACTER_POSITION: return { "CHAR_UPD_CHARACTER_POSITION", "CHAR_UPD_CHARACTER_POSITION", "" };
+        case CHAR_REP_LFG_DATA: return { "CHAR_REP_LFG_DATA", "CHAR_REP_LFG_DATA", "" };
+        case CHAR_DEL_LFG_DATA: return { "CHAR_DEL_LFG_DATA", "CHAR_DEL_LFG_DATA", "" };
+        case CHAR_SEL_CHARACTER_AURA_FROZEN: return { "CHAR_SEL_CHARACTER_AURA_FROZEN", "CHAR_SEL_CHARACTER_AURA_FROZEN", "" };
+        case CHAR_SEL_CHARACTER_ONLINE: return { "CHAR_SEL_CHARACTER_ONLINE", "CHAR_SEL_CHARACTER_ONLINE", "" };
+        case CHAR_SEL_CHAR_DEL_INFO_BY_GUID: return { "CHAR_SEL_CHAR_DEL_INFO_BY_GUID", "CHAR_SEL_CHAR_DEL_INFO_BY_GUID", "" };
+        case CHAR_SEL_CHAR_DEL_INFO_BY_NAME: return { "CHAR_SEL_CHAR_DEL_INFO_BY_NAME", "CHAR_SEL_CHAR_DEL_INFO_BY_NAME", "" };
+        case CHAR_SEL_CHAR_DEL_INFO: return { "CHAR_SEL_CHAR_DEL_INFO", "CHAR_SEL_CHAR_DEL_INFO", "" };
+        case CHAR_SEL_CHARS_BY_ACCOUNT_ID: return { "CHAR_SEL_CHARS_BY_ACCOUNT_ID", "CHAR_SEL_CHARS_BY_ACCOUNT_ID", "" };
+        case CHAR_SEL_CHAR_PINFO: return { "CHAR_SEL_CHAR_PINFO", "CHAR_SEL_CHAR_PINFO", "" };
+        case CHAR_SEL_PINFO_XP: return { "CHAR_SEL_PINFO_XP", "CHAR_SEL_PINFO_XP", "" };
+        case CHAR_SEL_PINFO_MAILS: return { "CHAR_SEL_PINFO_MAILS", "CHAR_SEL_PINFO_MAILS", "" };
+        case CHAR_SEL_PINFO_BANS: return { "CHAR_SEL_PINFO_BANS", "CHAR_SEL_PINFO_BANS", "" };
+        case CHAR_SEL_CHAR_HOMEBIND: return { "CHAR_SEL_CHAR_HOMEBIND", "CHAR_SEL_CHAR_HOMEBIND", "" };
+        case CHAR_SEL_CHAR_GUID_NAME_BY_ACC: return { "CHAR_SEL_CHAR_GUID_NAME_BY_ACC", "CHAR_SEL_CHAR_GUID_NAME_BY_ACC", "" };
+        case CHAR_SEL_POOL_QUEST_SAVE: return { "CHAR_SEL_POOL_QUEST_SAVE", "CHAR_SEL_POOL_QUEST_SAVE", "" };
+        case CHAR_SEL_CHARACTER_AT_LOGIN: return { "CHAR_SEL_CHARACTER_AT_LOGIN", "CHAR_SEL_CHARACTER_AT_LOGIN", "" };
+        case CHAR_SEL_CHAR_CLASS_LVL_AT_LOGIN: return { "CHAR_SEL_CHAR_CLASS_LVL_AT_LOGIN", "CHAR_SEL_CHAR_CLASS_LVL_AT_LOGIN", "" };
+        case CHAR_SEL_CHAR_CUSTOMIZE_INFO: return { "CHAR_SEL_CHAR_CUSTOMIZE_INFO", "CHAR_SEL_CHAR_CUSTOMIZE_INFO", "" };
+        case CHAR_SEL_CHAR_RACE_OR_FACTION_CHANGE_INFOS: return { "CHAR_SEL_CHAR_RACE_OR_FACTION_CHANGE_INFOS", "CHAR_SEL_CHAR_RACE_OR_FACTION_CHANGE_INFOS", "" };
+        case CHAR_SEL_CHAR_AT_LOGIN_TITLES_MONEY: return { "CHAR_SEL_CHAR_AT_LOGIN_TITLES_MONEY", "CHAR_SEL_CHAR_AT_LOGIN_TITLES_MONEY", "" };
+        case CHAR_SEL_CHAR_COD_ITEM_MAIL: return { "CHAR_SEL_CHAR_COD_ITEM_MAIL", "CHAR_SEL_CHAR_COD_ITEM_MAIL", "" };
+        case CHAR_SEL_CHAR_SOCIAL: return { "CHAR_SEL_CHAR_SOCIAL", "CHAR_SEL_CHAR_SOCIAL", "" };
+        case CHAR_SEL_CHAR_OLD_CHARS: return { "CHAR_SEL_CHAR_OLD_CHARS", "CHAR_SEL_CHAR_OLD_CHARS", "" };
+        case CHAR_SEL_ARENA_TEAM_ID_BY_PLAYER_GUID: return { "CHAR_SEL_ARENA_TEAM_ID_BY_PLAYER_GUID", "CHAR_SEL_ARENA_TEAM_ID_BY_PLAYER_GUID", "" };
+        case CHAR_SEL_MAIL: return { "CHAR_SEL_MAIL", "CHAR_SEL_MAIL", "" };
+        case CHAR_SEL_NEXT_MAIL_DELIVERYTIME: return { "CHAR_SEL_NEXT_MAIL_DELIVERYTIME", "CHAR_SEL_NEXT_MAIL_DELIVERYTIME", "" };
+        case CHAR_DEL_CHAR_AURA_FROZEN: return { "CHAR_DEL_CHAR_AURA_FROZEN", "CHAR_DEL_CHAR_AURA_FROZEN", "" };
+        case CHAR_SEL_CHAR_INVENTORY_COUNT_ITEM: return { "CHAR_SEL_CHAR_INVENTORY_COUNT_ITEM", "CHAR_SEL_CHAR_INVENTORY_COUNT_ITEM", "" };
+        case CHAR_SEL_MAIL_COUNT_ITEM: return { "CHAR_SEL_MAIL_COUNT_ITEM", "CHAR_SEL_MAIL_COUNT_ITEM", "" };
+        case CHAR_SEL_AUCTIONHOUSE_COUNT_ITEM: return { "CHAR_SEL_AUCTIONHOUSE_COUNT_ITEM", "CHAR_SEL_AUCTIONHOUSE_COUNT_ITEM", "" };
+        case CHAR_SEL_GUILD_BANK_COUNT_ITEM: return { "CHAR_SEL_GUILD_BANK_COUNT_ITEM", "CHAR_SEL_GUILD_BANK_COUNT_ITEM", "" };
+        case CHAR_SEL_CHAR_INVENTORY_ITEM_BY_ENTRY: return { "CHAR_SEL_CHAR_INVENTORY_ITEM_BY_ENTRY", "CHAR_SEL_CHAR_INVENTORY_ITEM_BY_ENTRY", "" };
+        case CHAR_SEL_CHAR_INVENTORY_ITEM_BY_ENTRY_AND_OWNER: return { "CHAR_SEL_CHAR_INVENTORY_ITEM_BY_ENTRY_AND_OWNER", "CHAR_SEL_CHAR_INVENTORY_ITEM_BY_ENTRY_AND_OWNER", "" };
+        case CHAR_SEL_MAIL_ITEMS_BY_ENTRY: return { "CHAR_SEL_MAIL_ITEMS_BY_ENTRY", "CHAR_SEL_MAIL_ITEMS_BY_ENTRY", "" };
+        case CHAR_SEL_AUCTIONHOUSE_ITEM_BY_ENTRY: return { "CHAR_SEL_AUCTIONHOUSE_ITEM_BY_ENTRY", "CHAR_SEL_AUCTIONHOUSE_ITEM_BY_ENTRY", "" };
+        case CHAR_SEL_GUILD_BANK_ITEM_BY_ENTRY: return { "CHAR_SEL_GUILD_BANK_ITEM_BY_ENTRY", "CHAR_SEL_GUILD_BANK_ITEM_BY_ENTRY", "" };
+        case CHAR_DEL_CHAR_ACHIEVEMENT: return { "CHAR_DEL_CHAR_ACHIEVEMENT", "CHAR_DEL_CHAR_ACHIEVEMENT", "" };
+        case CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS: return { "CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS", "CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS", "" };
+        case CHAR_INS_CHAR_ACHIEVEMENT: return { "CHAR_INS_CHAR_ACHIEVEMENT", "CHAR_INS_CHAR_ACHIEVEMENT", "" };
+        case CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA: return { "CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA", "CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA", "" };
+        case CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS: return { "CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS", "CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS", "" };
+        case CHAR_INS_CHAR_ACHIEVEMENT_OFFLINE_UPDATES: return { "CHAR_INS_CHAR_ACHIEVEMENT_OFFLINE_UPDATES", "CHAR_INS_CHAR_ACHIEVEMENT_OFFLINE_UPDATES", "" };
+        case CHAR_SEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES: return { "CHAR_SEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES", "CHAR_SEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES", "" };
+        case CHAR_DEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES: return { "CHAR_DEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES", "CHAR_DEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES", "" };
+        case CHAR_DEL_CHAR_REPUTATION_BY_FACTION: return { "CHAR_DEL_CHAR_REPUTATION_BY_FACTION", "CHAR_DEL_CHAR_REPUTATION_BY_FACTION", "" };
+        case CHAR_INS_CHAR_REPUTATION_BY_FACTION: return { "CHAR_INS_CHAR_REPUTATION_BY_FACTION", "CHAR_INS_CHAR_REPUTATION_BY_FACTION", "" };
+        case CHAR_UPD_CHAR_ARENA_POINTS: return { "CHAR_UPD_CHAR_ARENA_POINTS", "CHAR_UPD_CHAR_ARENA_POINTS", "" };
+        case CHAR_DEL_ITEM_REFUND_INSTANCE: return { "CHAR_DEL_ITEM_REFUND_INSTANCE", "CHAR_DEL_ITEM_REFUND_INSTANCE", "" };
+        case CHAR_INS_ITEM_REFUND_INSTANCE: return { "CHAR_INS_ITEM_REFUND_INSTANCE", "CHAR_INS_ITEM_REFUND_INSTANCE", "" };
+        case CHAR_DEL_GROUP: return { "CHAR_DEL_GROUP", "CHAR_DEL_GROUP", "" };
+        case CHAR_DEL_GROUP_MEMBER_ALL: return { "CHAR_DEL_GROUP_MEMBER_ALL", "CHAR_DEL_GROUP_MEMBER_ALL", "" };
+        case CHAR_INS_CHAR_GIFT: return { "CHAR_INS_CHAR_GIFT", "CHAR_INS_CHAR_GIFT", "" };
+        case CHAR_DEL_INSTANCE_BY_INSTANCE: return { "CHAR_DEL_INSTANCE_BY_INSTANCE", "CHAR_DEL_INSTANCE_BY_INSTANCE", "" };
+        case CHAR_DEL_MAIL_ITEM_BY_ID: return { "CHAR_DEL_MAIL_ITEM_BY_ID", "CHAR_DEL_MAIL_ITEM_BY_ID", "" };
+        case CHAR_INS_PETITION: return { "CHAR_INS_PETITION", "CHAR_INS_PETITION", "" };
+        case CHAR_DEL_PETITION_BY_GUID: return { "CHAR_DEL_PETITION_BY_GUID", "CHAR_DEL_PETITION_BY_GUID", "" };
+        case CHAR_DEL_PETITION_SIGNATURE_BY_GUID: return { "CHAR_DEL_PETITION_SIGNATURE_BY_GUID", "CHAR_DEL_PETITION_SIGNATURE_BY_GUID", "" };
+        case CHAR_DEL_CHAR_DECLINED_NAME: return { "CHAR_DEL_CHAR_DECLINED_NAME", "CHAR_DEL_CHAR_DECLINED_NAME", "" };
+        case CHAR_INS_CHAR_DECLINED_NAME: return { "CHAR_INS_CHAR_DECLINED_NAME", "CHAR_INS_CHAR_DECLINED_NAME", "" };
+        case CHAR_UPD_CHAR_RACE: return { "CHAR_UPD_CHAR_RACE", "CHAR_UPD_CHAR_RACE", "" };
+        case CHAR_DEL_CHAR_SKILL_LANGUAGES: return { "CHAR_DEL_CHAR_SKILL_LANGUAGES", "CHAR_DEL_CHAR_SKILL_LANGUAGES", "" };
+        case CHAR_INS_CHAR_SKILL_LANGUAGE: return { "CHAR_INS_CHAR_SKILL_LANGUAGE", "CHAR_INS_CHAR_SKILL_LANGUAGE", "" };
+        case CHAR_UPD_CHAR_TAXI_PATH: return { "CHAR_UPD_CHAR_TAXI_PATH", "CHAR_UPD_CHAR_TAXI_PATH", "" };
+        case CHAR_UPD_CHAR_TAXIMASK: return { "CHAR_UPD_CHAR_TAXIMASK", "CHAR_UPD_CHAR_TAXIMASK", "" };
+        case CHAR_DEL_CHAR_QUESTSTATUS: return { "CHAR_DEL_CHAR_QUESTSTATUS", "CHAR_DEL_CHAR_QUESTSTATUS", "" };
+        case CHAR_DEL_CHAR_SOCIAL_BY_GUID: return { "CHAR_DEL_CHAR_SOCIAL_BY_GUID", "CHAR_DEL_CHAR_SOCIAL_BY_GUID", "" };
+        case CHAR_DEL_CHAR_SOCIAL_BY_FRIEND: return { "CHAR_DEL_CHAR_SOCIAL_BY_FRIEND", "CHAR_DEL_CHAR_SOCIAL_BY_FRIEND", "" };
+        case CHAR_DEL_CHAR_ACHIEVEMENT_BY_ACHIEVEMENT: return { "CHAR_DEL_CHAR_ACHIEVEMENT_BY_ACHIEVEMENT", "CHAR_DEL_CHAR_ACHIEVEMENT_BY_ACHIEVEMENT", "" };
+        case CHAR_UPD_CHAR_ACHIEVEMENT: return { "CHAR_UPD_CHAR_ACHIEVEMENT", "CHAR_UPD_CHAR_ACHIEVEMENT", "" };
+        case CHAR_UPD_CHAR_INVENTORY_FACTION_CHANGE: return { "CHAR_UPD_CHAR_INVENTORY_FACTION_CHANGE", "CHAR_UPD_CHAR_INVENTORY_FACTION_CHANGE", "" };
+        case CHAR_DEL_CHAR_SPELL_BY_SPELL: return { "CHAR_DEL_CHAR_SPELL_BY_SPELL", "CHAR_DEL_CHAR_SPELL_BY_SPELL", "" };
+        case CHAR_UPD_CHAR_SPELL_FACTION_CHANGE: return { "CHAR_UPD_CHAR_SPELL_FACTION_CHANGE", "CHAR_UPD_CHAR_SPELL_FACTION_CHANGE", "" };
+        case CHAR_SEL_CHAR_REP_BY_FACTION: return { "CHAR_SEL_CHAR_REP_BY_FACTION", "CHAR_SEL_CHAR_REP_BY_FACTION", "" };
+        case CHAR_DEL_CHAR_REP_BY_FACTION: return { "CHAR_DEL_CHAR_REP_BY_FACTION", "CHAR_DEL_CHAR_REP_BY_FACTION", "" };
+        case CHAR_UPD_CHAR_REP_FACTION_CHANGE: return { "CHAR_UPD_CHAR_REP_FACTION_CHANGE", "CHAR_UPD_CHAR_REP_FACTION_CHANGE", "" };
+        case CHAR_UPD_CHAR_TITLES_FACTION_CHANGE: return { "CHAR_UPD_CHAR_TITLES_FACTION_CHANGE", "CHAR_UPD_CHAR_TITLES_FACTION_CHANGE", "" };
+        case CHAR_RES_CHAR_TITLES_FACTION_CHANGE: return { "CHAR_RES_CHAR_TITLES_FACTION_CHANGE", "CHAR_RES_CHAR_TITLES_FACTION_CHANGE", "" };
+        case CHAR_DEL_CHAR_SPELL_COOLDOWN: return { "CHAR_DEL_CHAR_SPELL_COOLDOWN", "CHAR_DEL_CHAR_SPELL_COOLDOWN", "" };
+        case CHAR_DEL_CHARACTER: return { "CHAR_DEL_CHARACTER", "CHAR_DEL_CHARACTER", "" };
+        case CHAR_DEL_CHAR_ACTION: return { "CHAR_DEL_CHAR_ACTION", "CHAR_DEL_CHAR_ACTION", "" };
+        case CHAR_DEL_CHAR_AURA: return { "CHAR_DEL_CHAR_AURA", "CHAR_DEL_CHAR_AURA", "" };
+        case CHAR_DEL_CHAR_GIFT: return { "CHAR_DEL_CHAR_GIFT", "CHAR_DEL_CHAR_GIFT", "" };
+        case CHAR_DEL_CHAR_INSTANCE: return { "CHAR_DEL_CHAR_INSTANCE", "CHAR_DEL_CHAR_INSTANCE", "" };
+        case CHAR_DEL_CHAR_INVENTORY: return { "CHAR_DEL_CHAR_INVENTORY", "CHAR_DEL_CHAR_INVENTORY", "" };
+        case CHAR_DEL_CHAR_QUESTSTATUS_REWARDED: return { "CHAR_DEL_CHAR_QUESTSTATUS_REWARDED", "CHAR_DEL_CHAR_QUESTSTATUS_REWARDED", "" };
+        case CHAR_DEL_CHAR_REPUTATION: return { "CHAR_DEL_CHAR_REPUTATION", "CHAR_DEL_CHAR_REPUTATION", "" };
+        case CHAR_DEL_CHAR_SPELL: return { "CHAR_DEL_CHAR_SPELL", "CHAR_DEL_CHAR_SPELL", "" };
+        case CHAR_DEL_MAIL: return { "CHAR_DEL_MAIL", "CHAR_DEL_MAIL", "" };
+        case CHAR_DEL_MAIL_ITEMS: return { "CHAR_DEL_MAIL_ITEMS", "CHAR_DEL_MAIL_ITEMS", "" };
+        case CHAR_DEL_CHAR_ACHIEVEMENTS: return { "CHAR_DEL_CHAR_ACHIEVEMENTS", "CHAR_DEL_CHAR_ACHIEVEMENTS", "" };
+        case CHAR_DEL_CHAR_EQUIPMENTSETS: return { "CHAR_DEL_CHAR_EQUIPMENTSETS", "CHAR_DEL_CHAR_EQUIPMENTSETS", "" };
+        case CHAR_DEL_GUILD_EVENTLOG_BY_PLAYER: return { "CHAR_DEL_GUILD_EVENTLOG_BY_PLAYER", "CHAR_DEL_GUILD_EVENTLOG_BY_PLAYER", "" };
+        case CHAR_DEL_GUILD_BANK_EVENTLOG_BY_PLAYER: return { "CHAR_DEL_GUILD_BANK_EVENTLOG_BY_PLAYER", "CHAR_DEL_GUILD_BANK_EVENTLOG_BY_PLAYER", "" };
+        case CHAR_DEL_CHAR_GLYPHS: return { "CHAR_DEL_CHAR_GLYPHS", "CHAR_DEL_CHAR_GLYPHS", "" };
+        case CHAR_DEL_CHAR_TALENT: return { "CHAR_DEL_CHAR_TALENT", "CHAR_DEL_CHAR_TALENT", "" };
+        case CHAR_DEL_CHAR_SKILLS: return { "CHAR_DEL_CHAR_SKILLS", "CHAR_DEL_CHAR_SKILLS", "" };
+        case CHAR_UDP_CHAR_HONOR_POINTS: return { "CHAR_UDP_CHAR_HONOR_POINTS", "CHAR_UDP_CHAR_HONOR_POINTS", "" };
+        case CHAR_UDP_CHAR_HONOR_POINTS_ACCUMULATIVE: return { "CHAR_UDP_CHAR_HONOR_POINTS_ACCUMULATIVE", "CHAR_UDP_CHAR_HONOR_POINTS_ACCUMULATIVE", "" };
+        case CHAR_UDP_CHAR_ARENA_POINTS: return { "CHAR_UDP_CHAR_ARENA_POINTS", "CHAR_UDP_CHAR_ARENA_POINTS", "" };
+        case CHAR_UDP_CHAR_ARENA_POINTS_ACCUMULATIVE: return { "CHAR_UDP_CHAR_ARENA_POINTS_ACCUMULATIVE", "CHAR_UDP_CHAR_ARENA_POINTS_ACCUMULATIVE", "" };
+        case CHAR_UDP_CHAR_MONEY: return { "CHAR_UDP_CHAR_MONEY", "CHAR_UDP_CHAR_MONEY", "" };
+        case CHAR_UDP_CHAR_MONEY_ACCUMULATIVE: return { "CHAR_UDP_CHAR_MONEY_ACCUMULATIVE", "CHAR_UDP_CHAR_MONEY_ACCUMULATIVE", "" };
+        case CHAR_UPD_CHAR_REMOVE_GHOST: return { "CHAR_UPD_CHAR_REMOVE_GHOST", "CHAR_UPD_CHAR_REMOVE_GHOST", "pussywizard" };
+        case CHAR_INS_CHAR_ACTION: return { "CHAR_INS_CHAR_ACTION", "CHAR_INS_CHAR_ACTION", "" };
+        case CHAR_UPD_CHAR_ACTION: return { "CHAR_UPD_CHAR_ACTION", "CHAR_UPD_CHAR_ACTION", "" };
+        case CHAR_DEL_CHAR_ACTION_BY_BUTTON_SPEC: return { "CHAR_DEL_CHAR_ACTION_BY_BUTTON_SPEC", "CHAR_DEL_CHAR_ACTION_BY_BUTTON_SPEC", "" };
+        case CHAR_DEL_CHAR_INVENTORY_BY_ITEM: return { "CHAR_DEL_CHAR_INVENTORY_BY_ITEM", "CHAR_DEL_CHAR_INVENTORY_BY_ITEM", "" };
+        case CHAR_DEL_CHAR_INVENTORY_BY_BAG_SLOT: return { "CHAR_DEL_CHAR_INVENTORY_BY_BAG_SLOT", "CHAR_DEL_CHAR_INVENTORY_BY_BAG_SLOT", "" };
+        case CHAR_UPD_MAIL: return { "CHAR_UPD_MAIL", "CHAR_UPD_MAIL", "" };
+        case CHAR_REP_CHAR_QUESTSTATUS: return { "CHAR_REP_CHAR_QUESTSTATUS", "CHAR_REP_CHAR_QUESTSTATUS", "" };
+        case CHAR_DEL_CHAR_QUESTSTATUS_BY_QUEST: return { "CHAR_DEL_CHAR_QUESTSTATUS_BY_QUEST", "CHAR_DEL_CHAR_QUESTSTATUS_BY_QUEST", "" };
+        case CHAR_INS_CHAR_QUESTSTATUS_REWARDED: return { "CHAR_INS_CHAR_QUESTSTATUS_REWARDED", "CHAR_INS_CHAR_QUESTSTATUS_REWARDED", "" };
+        case CHAR_DEL_CHAR_QUESTSTATUS_REWARDED_BY_QUEST: return { "CHAR_DEL_CHAR_QUESTSTATUS_REWARDED_BY_QUEST", "CHAR_DEL_CHAR_QUESTSTATUS_REWARDED_BY_QUEST", "" };
+        case CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_FACTION_CHANGE: return { "CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_FACTION_CHANGE", "CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_FACTION_CHANGE", "" };
+        case CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_ACTIVE: return { "CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_ACTIVE", "CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_ACTIVE", "" };
+        case CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_ACTIVE_BY_QUEST: return { "CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_ACTIVE_BY_QUEST", "CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_ACTIVE_BY_QUEST", "" };
+        case CHAR_DEL_CHAR_SKILL_BY_SKILL: return { "CHAR_DEL_CHAR_SKILL_BY_SKILL", "CHAR_DEL_CHAR_SKILL_BY_SKILL", "" };
+        case CHAR_INS_CHAR_SKILLS: return { "CHAR_INS_CHAR_SKILLS", "CHAR_INS_CHAR_SKILLS", "" };
+        case CHAR_UDP_CHAR_SKILLS: return { "CHAR_UDP_CHAR_SKILLS", "CHAR_UDP_CHAR_SKILLS", "" };
+        case CHAR_INS_CHAR_SPELL: return { "CHAR_INS_CHAR_SPELL", "CHAR_INS_CHAR_SPELL", "" };
+        case CHAR_DEL_CHAR_STATS: return { "CHAR_DEL_CHAR_STATS", "CHAR_DEL_CHAR_STATS", "" };
+        case CHAR_INS_CHAR_STATS: return { "CHAR_INS_CHAR_STATS", "CHAR_INS_CHAR_STATS", "" };
+        case CHAR_SEL_CHAR_STATS: return { "CHAR_SEL_CHAR_STATS", "CHAR_SEL_CHAR_STATS", "" };
+        case CHAR_DEL_PETITION_BY_OWNER: return { "CHAR_DEL_PETITION_BY_OWNER", "CHAR_DEL_PETITION_BY_OWNER", "" };
+        case CHAR_DEL_PETITION_SIGNATURE_BY_OWNER: return { "CHAR_DEL_PETITION_SIGNATURE_BY_OWNER", "CHAR_DEL_PETITION_SIGNATURE_BY_OWNER", "" };
+        case CHAR_DEL_PETITION_BY_OWNER_AND_TYPE: return { "CHAR_DEL_PETITION_BY_OWNER_AND_TYPE", "CHAR_DEL_PETITION_BY_OWNER_AND_TYPE", "" };
+        case CHAR_DEL_PETITION_SIGNATURE_BY_OWNER_AND_TYPE: return { "CHAR_DEL_PETITION_SIGNATURE_BY_OWNER_AND_TYPE", "CHAR_DEL_PETITION_SIGNATURE_BY_OWNER_AND_TYPE", "" };
+        case CHAR_INS_CHAR_GLYPHS: return { "CHAR_INS_CHAR_GLYPHS", "CHAR_INS_CHAR_GLYPHS", "" };
+        case CHAR_DEL_CHAR_TALENT_BY_SPELL: return { "CHAR_DEL_CHAR_TALENT_BY_SPELL", "CHAR_DEL_CHAR_TALENT_BY_SPELL", "" };
+        case CHAR_INS_CHAR_TALENT: return { "CHAR_INS_CHAR_TALENT", "CHAR_INS_CHAR_TALENT", "" };
+        case CHAR_DEL_CHAR_ACTION_EXCEPT_SPEC: return { "CHAR_DEL_CHAR_ACTION_EXCEPT_SPEC", "CHAR_DEL_CHAR_ACTION_EXCEPT_SPEC", "" };
+        case CHAR_REP_CALENDAR_EVENT: return { "CHAR_REP_CALENDAR_EVENT", "CHAR_REP_CALENDAR_EVENT", "" };
+        case CHAR_DEL_CALENDAR_EVENT: return { "CHAR_DEL_CALENDAR_EVENT", "CHAR_DEL_CALENDAR_EVENT", "" };
+        case CHAR_REP_CALENDAR_INVITE: return { "CHAR_REP_CALENDAR_INVITE", "CHAR_REP_CALENDAR_INVITE", "" };
+        case CHAR_DEL_CALENDAR_INVITE: return { "CHAR_DEL_CALENDAR_INVITE", "CHAR_DEL_CALENDAR_INVITE", "" };
+        case CHAR_SEL_PET_AURA: return { "CHAR_SEL_PET_AURA", "CHAR_SEL_PET_AURA", "" };
+        case CHAR_SEL_PET_SPELL: return { "CHAR_SEL_PET_SPELL", "CHAR_SEL_PET_SPELL", "" };
+        case CHAR_SEL_PET_SPELL_COOLDOWN: return { "CHAR_SEL_PET_SPELL_COOLDOWN", "CHAR_SEL_PET_SPELL_COOLDOWN", "" };
+        case CHAR_DEL_PET_AURAS: return { "CHAR_DEL_PET_AURAS", "CHAR_DEL_PET_AURAS", "" };
+        case CHAR_DEL_PET_SPELL_COOLDOWNS: return { "CHAR_DEL_PET_SPELL_COOLDOWNS", "CHAR_DEL_PET_SPELL_COOLDOWNS", "" };
+        case CHAR_INS_PET_SPELL_COOLDOWN: return { "CHAR_INS_PET_SPELL_COOLDOWN", "CHAR_INS_PET_SPELL_COOLDOWN", "" };
+        case CHAR_DEL_PET_SPELL_BY_SPELL: return { "CHAR_DEL_PET_SPELL_BY_SPELL", "CHAR_DEL_PET_SPELL_BY_SPELL", "" };
+        case CHAR_INS_PET_SPELL: return { "CHAR_INS_PET_SPELL", "CHAR_INS_PET_SPELL", "" };
+        case CHAR_INS_PET_AURA: return { "CHAR_INS_PET_AURA", "CHAR_INS_PET_AURA", "" };
+        case CHAR_DEL_PET_SPELLS: return { "CHAR_DEL_PET_SPELLS", "CHAR_DEL_PET_SPELLS", "" };
+        case CHAR_DEL_CHAR_PET_BY_OWNER: return { "CHAR_DEL_CHAR_PET_BY_OWNER", "CHAR_DEL_CHAR_PET_BY_OWNER", "" };
+        case CHAR_DEL_CHAR_PET_DECLINEDNAME_BY_OWNER: return { "CHAR_DEL_CHAR_PET_DECLINEDNAME_BY_OWNER", "CHAR_DEL_CHAR_PET_DECLINEDNAME_BY_OWNER", "" };
+        case CHAR_SEL_CHAR_PETS: return { "CHAR_SEL_CHAR_PETS", "CHAR_SEL_CHAR_PETS", "" };
+        case CHAR_SEL_CHAR_PET_IDS: return { "CHAR_SEL_CHAR_PET_IDS", "CHAR_SEL_CHAR_PET_IDS", "" };
+        case CHAR_DEL_CHAR_PET_DECLINEDNAME: return { "CHAR_DEL_CHAR_PET_DECLINEDNAME", "CHAR_DEL_CHAR_PET_DECLINEDNAME", "" };
+        case CHAR_ADD_CHAR_PET_DECLINEDNAME: return { "CHAR_ADD_CHAR_PET_DECLINEDNAME", "CHAR_ADD_CHAR_PET_DECLINEDNAME", "" };
+        case CHAR_SEL_PET_DECLINED_NAME: return { "CHAR_SEL_PET_DECLINED_NAME", "CHAR_SEL_PET_DECLINED_NAME", "" };
+        case CHAR_UPD_CHAR_PET_NAME: return { "CHAR_UPD_CHAR_PET_NAME", "CHAR_UPD_CHAR_PET_NAME", "" };
+        case CHAR_UPD_CHAR_PET_SLOT_BY_ID: return { "CHAR_UPD_CHAR_PET_SLOT_BY_ID", "CHAR_UPD_CHAR_PET_SLOT_BY_ID", "" };
+        case CHAR_DEL_CHAR_PET_BY_ID: return { "CHAR_DEL_CHAR_PET_BY_ID", "CHAR_DEL_CHAR_PET_BY_ID", "" };
+        case CHAR_DEL_CHAR_PET_BY_SLOT: return { "CHAR_DEL_CHAR_PET_BY_SLOT", "CHAR_DEL_CHAR_PET_BY_SLOT", "" };
+        case CHAR_REP_CHAR_PET: return { "CHAR_REP_CHAR_PET", "CHAR_REP_CHAR_PET", "" };
+        case CHAR_SEL_ITEMCONTAINER_ITEMS: return { "CHAR_SEL_ITEMCONTAINER_ITEMS", "CHAR_SEL_ITEMCONTAINER_ITEMS", "" };
+        case CHAR_DEL_ITEMCONTAINER_SINGLE_ITEM: return { "CHAR_DEL_ITEMCONTAINER_SINGLE_ITEM", "CHAR_DEL_ITEMCONTAINER_SINGLE_ITEM", "" };
+        case CHAR_INS_ITEMCONTAINER_SINGLE_ITEM: return { "CHAR_INS_ITEMCONTAINER_SINGLE_ITEM", "CHAR_INS_ITEMCONTAINER_SINGLE_ITEM", "" };
+        case CHAR_DEL_ITEMCONTAINER_CONTAINER: return { "CHAR_DEL_ITEMCONTAINER_CONTAINER", "CHAR_DEL_ITEMCONTAINER_CONTAINER", "" };
+        case CHAR_SEL_PVPSTATS_MAXID: return { "CHAR_SEL_PVPSTATS_MAXID", "CHAR_SEL_PVPSTATS_MAXID", "" };
+        case CHAR_INS_PVPSTATS_BATTLEGROUND: return { "CHAR_INS_PVPSTATS_BATTLEGROUND", "CHAR_INS_PVPSTATS_BATTLEGROUND", "" };
+        case CHAR_INS_PVPSTATS_PLAYER: return { "CHAR_INS_PVPSTATS_PLAYER", "CHAR_INS_PVPSTATS_PLAYER", "" };
+        case CHAR_SEL_PVPSTATS_FACTIONS_OVERALL: return { "CHAR_SEL_PVPSTATS_FACTIONS_OVERALL", "CHAR_SEL_PVPSTATS_FACTIONS_OVERALL", "" };
+        case CHAR_SEL_PVPSTATS_BRACKET_MONTH: return { "CHAR_SEL_PVPSTATS_BRACKET_MONTH", "CHAR_SEL_PVPSTATS_BRACKET_MONTH", "" };
+        case CHAR_INS_DESERTER_TRACK: return { "CHAR_INS_DESERTER_TRACK", "CHAR_INS_DESERTER_TRACK", "" };
+        case CHAR_INS_QUEST_TRACK: return { "CHAR_INS_QUEST_TRACK", "CHAR_INS_QUEST_TRACK", "" };
+        case CHAR_UPD_QUEST_TRACK_GM_COMPLETE: return { "CHAR_UPD_QUEST_TRACK_GM_COMPLETE", "CHAR_UPD_QUEST_TRACK_GM_COMPLETE", "" };
+        case CHAR_UPD_QUEST_TRACK_COMPLETE_TIME: return { "CHAR_UPD_QUEST_TRACK_COMPLETE_TIME", "CHAR_UPD_QUEST_TRACK_COMPLETE_TIME", "" };
+        case CHAR_UPD_QUEST_TRACK_ABANDON_TIME: return { "CHAR_UPD_QUEST_TRACK_ABANDON_TIME", "CHAR_UPD_QUEST_TRACK_ABANDON_TIME", "" };
+        case CHAR_INS_RECOVERY_ITEM: return { "CHAR_INS_RECOVERY_ITEM", "CHAR_INS_RECOVERY_ITEM", "" };
+        case CHAR_SEL_RECOVERY_ITEM: return { "CHAR_SEL_RECOVERY_ITEM", "CHAR_SEL_RECOVERY_ITEM", "" };
+        case CHAR_SEL_RECOVERY_ITEM_LIST: return { "CHAR_SEL_RECOVERY_ITEM_LIST", "CHAR_SEL_RECOVERY_ITEM_LIST", "" };
+        case CHAR_DEL_RECOVERY_ITEM: return { "CHAR_DEL_RECOVERY_ITEM", "CHAR_DEL_RECOVERY_ITEM", "" };
+        case CHAR_DEL_RECOVERY_ITEM_BY_RECOVERY_ID: return { "CHAR_DEL_RECOVERY_ITEM_BY_RECOVERY_ID", "CHAR_DEL_RECOVERY_ITEM_BY_RECOVERY_ID", "" };
+        case CHAR_SEL_RECOVERY_ITEM_OLD_ITEMS: return { "CHAR_SEL_RECOVERY_ITEM_OLD_ITEMS", "CHAR_SEL_RECOVERY_ITEM_OLD_ITEMS", "" };
+        case CHAR_DEL_RECOVERY_ITEM_BY_GUID: return { "CHAR_DEL_RECOVERY_ITEM_BY_GUID", "CHAR_DEL_RECOVERY_ITEM_BY_GUID", "" };
+        case CHAR_SEL_HONORPOINTS: return { "CHAR_SEL_HONORPOINTS", "CHAR_SEL_HONORPOINTS", "" };
+        case CHAR_SEL_ARENAPOINTS: return { "CHAR_SEL_ARENAPOINTS", "CHAR_SEL_ARENAPOINTS", "" };
+        case CHAR_INS_RESERVED_PLAYER_NAME: return { "CHAR_INS_RESERVED_PLAYER_NAME", "CHAR_INS_RESERVED_PLAYER_NAME", "" };
+        case CHAR_INS_PROFANITY_PLAYER_NAME: return { "CHAR_INS_PROFANITY_PLAYER_NAME", "CHAR_INS_PROFANITY_PLAYER_NAME", "" };
+        case CHAR_SEL_CHAR_SETTINGS: return { "CHAR_SEL_CHAR_SETTINGS", "CHAR_SEL_CHAR_SETTINGS", "" };
+        case CHAR_REP_CHAR_SETTINGS: return { "CHAR_REP_CHAR_SETTINGS", "CHAR_REP_CHAR_SETTINGS", "" };
+        case CHAR_DEL_CHAR_SETTINGS: return { "CHAR_DEL_CHAR_SETTINGS", "CHAR_DEL_CHAR_SETTINGS", "" };
+        case CHAR_SELECT_INSTANCE_SAVED_DATA: return { "CHAR_SELECT_INSTANCE_SAVED_DATA", "CHAR_SELECT_INSTANCE_SAVED_DATA", "" };
+        case CHAR_INSERT_INSTANCE_SAVED_DATA: return { "CHAR_INSERT_INSTANCE_SAVED_DATA", "CHAR_INSERT_INSTANCE_SAVED_DATA", "" };
+        case CHAR_DELETE_INSTANCE_SAVED_DATA: return { "CHAR_DELETE_INSTANCE_SAVED_DATA", "CHAR_DELETE_INSTANCE_SAVED_DATA", "" };
+        case CHAR_SANITIZE_INSTANCE_SAVED_DATA: return { "CHAR_SANITIZE_INSTANCE_SAVED_DATA", "CHAR_SANITIZE_INSTANCE_SAVED_DATA", "" };
+        default: throw std::out_of_range("value");
+    }
+}
+
+template <>
+AC_API_EXPORT std::size_t EnumUtils<CharacterDatabaseStatements>::Count() { return 462; }
+
+template <>
+AC_API_EXPORT CharacterDatabaseStatements EnumUtils<CharacterDatabaseStatements>::FromIndex(std::size_t index)
+{
+    switch (index)
+    {
+        case 0: return CHAR_DEL_QUEST_POOL_SAVE;
+        case 1: return CHAR_INS_QUEST_POOL_SAVE;
+        case 2: return CHAR_DEL_NONEXISTENT_GUILD_BANK_ITEM;
+        case 3: return CHAR_DEL_EXPIRED_BANS;
+        case 4: return CHAR_SEL_DATA_BY_NAME;
+        case 5: return CHAR_SEL_DATA_BY_GUID;
+        case 6: return CHAR_SEL_CHECK_NAME;
+        case 7: return CHAR_SEL_CHECK_GUID;
+        case 8: return CHAR_SEL_SUM_CHARS;
+        case 9: return CHAR_SEL_CHAR_CREATE_INFO;
+        case 10: return CHAR_INS_CHARACTER_BAN;
+        case 11: return CHAR_UPD_CHARACTER_BAN;
+        case 12: return CHAR_DEL_CHARACTER_BAN;
+        case 13: return CHAR_SEL_BANINFO;
+        case 14: return CHAR_SEL_GUID_BY_NAME_FILTER;
+        case 15: return CHAR_SEL_BANINFO_LIST;
+        case 16: return CHAR_SEL_BANNED_NAME;
+        case 17: return CHAR_SEL_ENUM;
+        case 18: return CHAR_SEL_ENUM_DECLINED_NAME;
+        case 19: return CHAR_SEL_FREE_NAME;
+        case 20: return CHAR_SEL_CHAR_ZONE;
+        case 21: return CHAR_SEL_CHARACTER_NAME_DATA;
+        case 22: return CHAR_SEL_CHAR_POSITION_XYZ;
+        case 23: return CHAR_SEL_CHAR_POSITION;
+        case 24: return CHAR_DEL_QUEST_STATUS_DAILY;
+        case 25: return CHAR_DEL_QUEST_STATUS_WEEKLY;
+        case 26: return CHAR_DEL_QUEST_STATUS_MONTHLY;
+        case 27: return CHAR_DEL_QUEST_STATUS_SEASONAL;
+        case 28: return CHAR_DEL_QUEST_STATUS_DAILY_CHAR;
+        case 29: return CHAR_DEL_QUEST_STATUS_WEEKLY_CHAR;
+        case 30: return CHAR_DEL_QUEST_STATUS_MONTHLY_CHAR;
+        case 31: return CHAR_DEL_QUEST_STATUS_SEASONAL_CHAR;
+        case 32: return CHAR_DEL_BATTLEGROUND_RANDOM;
+        case 33: return CHAR_INS_BATTLEGROUND_RANDOM;
+        case 34: return CHAR_SEL_CHARACTER;
+        case 35: return CHAR_SEL_CHARACTER_AURAS;
+        case 36: return CHAR_SEL_CHARACTER_SPELL;
+        case 37: return CHAR_SEL_CHARACTER_QUESTSTATUS;
+        case 38: return CHAR_SEL_CHARACTER_DAILYQUESTSTATUS;
+        case 39: return CHAR_SEL_CHARACTER_WEEKLYQUESTSTATUS;
+        case 40: return CHAR_SEL_CHARACTER_MONTHLYQUESTSTATUS;
+        case 41: return CHAR_SEL_CHARACTER_SEASONALQUESTSTATUS;
+        case 42: return CHAR_INS_CHARACTER_DAILYQUESTSTATUS;
+        case 43: return CHAR_INS_CHARACTER_WEEKLYQUESTSTATUS;
+        case 44: return CHAR_INS_CHARACTER_MONTHLYQUESTSTATUS;
+        case 45: return CHAR_INS_CHARACTER_SEASONALQUESTSTATUS;
+        case 46: return CHAR_SEL_CHARACTER_REPUTATION;
+        case 47: return CHAR_SEL_CHARACTER_INVENTORY;
+        case 48: return CHAR_SEL_CHARACTER_ACTIONS;
+        case 49: return CHAR_SEL_CHARACTER_ACTIONS_SPEC;
+        case 50: return CHAR_SEL_CHARACTER_MAILCOUNT_UNREAD;
+        case 51: return CHAR_SEL_CHARACTER_MAILCOUNT_UNREAD_SYNCH;
+        case 52: return CHAR_SEL_MAIL_SERVER_CHARACTER;
+        case 53: return CHAR_REP_MAIL_SERVER_CHARACTER;
+        case 54: return CHAR_SEL_CHARACTER_SOCIALLIST;
+        case 55: return CHAR_SEL_CHARACTER_HOMEBIND;
+        case 56: return CHAR_SEL_CHARACTER_SPELLCOOLDOWNS;
+        case 57: return CHAR_SEL_CHARACTER_DECLINEDNAMES;
+        case 58: return CHAR_SEL_CHARACTER_ACHIEVEMENTS;
+        case 59: return CHAR_SEL_CHARACTER_CRITERIAPROGRESS;
+        case 60: return CHAR_SEL_CHARACTER_EQUIPMENTSETS;
+        case 61: return CHAR_SEL_CHARACTER_ENTRY_POINT;
+        case 62: return CHAR_SEL_CHARACTER_GLYPHS;
+        case 63: return CHAR_SEL_CHARACTER_TALENTS;
+        case 64: return CHAR_SEL_CHARACTER_SKILLS;
+        case 65: return CHAR_SEL_CHARACTER_RANDOMBG;
+        case 66: return CHAR_SEL_CHARACTER_BANNED;
+        case 67: return CHAR_SEL_CHARACTER_QUESTSTATUSREW;
+        case 68: return CHAR_SEL_ACCOUNT_INSTANCELOCKTIMES;
+        case 69: return CHAR_SEL_MAILITEMS;
+        case 70: return CHAR_SEL_BREW_OF_THE_MONTH;
+        case 71: return CHAR_REP_BREW_OF_THE_MONTH;
+        case 72: return CHAR_SEL_AUCTION_ITEMS;
+        case 73: return CHAR_INS_AUCTION;
+        case 74: return CHAR_DEL_AUCTION;
+        case 75: return CHAR_UPD_AUCTION_BID;
+        case 76: return CHAR_SEL_AUCTIONS;
+        case 77: return CHAR_INS_MAIL;
+        case 78: return CHAR_DEL_MAIL_BY_ID;
+        case 79: return CHAR_INS_MAIL_ITEM;
+        case 80: return CHAR_DEL_MAIL_ITEM;
+        case 81: return CHAR_DEL_INVALID_MAIL_ITEM;
+        case 82: return CHAR_SEL_EXPIRED_MAIL;
+        case 83: return CHAR_SEL_EXPIRED_MAIL_ITEMS;
+        case 84: return CHAR_UPD_MAIL_RETURNED;
+        case 85: return CHAR_UPD_MAIL_ITEM_RECEIVER;
+        case 86: return CHAR_UPD_ITEM_OWNER;
+        case 87: return CHAR_SEL_ITEM_REFUNDS;
+        case 88: return CHAR_SEL_ITEM_BOP_TRADE;
+        case 89: return CHAR_DEL_ITEM_BOP_TRADE;
+        case 90: return CHAR_INS_ITEM_BOP_TRADE;
+        case 91: return CHAR_REP_INVENTORY_ITEM;
+        case 92: return CHAR_REP_ITEM_INSTANCE;
+        case 93: return CHAR_UPD_ITEM_INSTANCE;
+        case 94: return CHAR_UPD_ITEM_INSTANCE_ON_LOAD;
+        case 95: return CHAR_DEL_ITEM_INSTANCE;
+        case 96: return CHAR_DEL_ITEM_INSTANCE_BY_OWNER;
+        case 97: return CHAR_UPD_GIFT_OWNER;
+        case 98: return CHAR_DEL_GIFT;
+        case 99: return CHAR_SEL_CHARACTER_GIFT_BY_ITEM;
+        case 100: return CHAR_SEL_ACCOUNT_BY_NAME;
+        case 101: return CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES;
+        case 102: return CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES;
+        case 103: return CHAR_SEL_MATCH_MAKER_RATING;
+        case 104: return CHAR_SEL_CHARACTER_COUNT;
+        case 105: return CHAR_UPD_NAME_BY_GUID;
+        case 106: return CHAR_DEL_DECLINED_NAME;
+        case 107: return CHAR_INS_GUILD;
+        case 108: return CHAR_DEL_GUILD;
+        case 109: return CHAR_UPD_GUILD_NAME;
+        case 110: return CHAR_INS_GUILD_MEMBER;
+        case 111: return CHAR_DEL_GUILD_MEMBER;
+        case 112: return CHAR_DEL_GUILD_MEMBERS;
+        case 113: return CHAR_SEL_GUILD_MEMBER_EXTENDED;
+        case 114: return CHAR_INS_GUILD_RANK;
+        case 115: return CHAR_DEL_GUILD_RANKS;
+        case 116: return CHAR_DEL_GUILD_LOWEST_RANK;
+        case 117: return CHAR_INS_GUILD_BANK_TAB;
+        case 118: return CHAR_DEL_GUILD_BANK_TAB;
+        case 119: return CHAR_DEL_GUILD_BANK_TABS;
+        case 120: return CHAR_INS_GUILD_BANK_ITEM;
+        case 121: return CHAR_DEL_GUILD_BANK_ITEM;
+        case 122: return CHAR_DEL_GUILD_BANK_ITEMS;
+        case 123: return CHAR_INS_GUILD_BANK_RIGHT;
+        case 124: return CHAR_DEL_GUILD_BANK_RIGHTS;
+        case 125: return CHAR_DEL_GUILD_BANK_RIGHTS_FOR_RANK;
+        case 126: return CHAR_INS_GUILD_BANK_EVENTLOG;
+        case 127: return CHAR_DEL_GUILD_BANK_EVENTLOG;
+        case 128: return CHAR_DEL_GUILD_BANK_EVENTLOGS;
+        case 129: return CHAR_INS_GUILD_EVENTLOG;
+        case 130: return CHAR_DEL_GUILD_EVENTLOG;
+        case 131: return CHAR_DEL_GUILD_EVENTLOGS;
+        case 132: return CHAR_UPD_GUILD_MEMBER_PNOTE;
+        case 133: return CHAR_UPD_GUILD_MEMBER_OFFNOTE;
+        case 134: return CHAR_UPD_GUILD_MEMBER_RANK;
+        case 135: return CHAR_UPD_GUILD_MOTD;
+        case 136: return CHAR_UPD_GUILD_INFO;
+        case 137: return CHAR_UPD_GUILD_LEADER;
+        case 138: return CHAR_UPD_GUILD_RANK_NAME;
+        case 139: return CHAR_UPD_GUILD_RANK_RIGHTS;
+        case 140: return CHAR_UPD_GUILD_EMBLEM_INFO;
+        case 141: return CHAR_UPD_GUILD_BANK_TAB_INFO;
+        case 142: return CHAR_UPD_GUILD_BANK_MONEY;
+        case 143: return CHAR_UPD_GUILD_BANK_EVENTLOG_TAB;
+        case 144: return CHAR_UPD_GUILD_RANK_BANK_MONEY;
+        case 145: return CHAR_UPD_GUILD_BANK_TAB_TEXT;
+        case 146: return CHAR_INS_GUILD_MEMBER_WITHDRAW;
+        case 147: return CHAR_DEL_GUILD_MEMBER_WITHDRAW;
+        case 148: return CHAR_SEL_CHAR_DATA_FOR_GUILD;
+        case 149: return CHAR_INS_CHANNEL;
+        case 150: return CHAR_UPD_CHANNEL;
+        case 151: return CHAR_DEL_CHANNEL;
+        case 152: return CHAR_UPD_CHANNEL_USAGE;
+        case 153: return CHAR_DEL_OLD_CHANNELS;
+        case 154: return CHAR_DEL_OLD_CHANNELS_BANS;
+        case 155: return CHAR_INS_CHANNEL_BAN;
+        case 156: return CHAR_DEL_CHANNEL_BAN;
+        case 157: return CHAR_UPD_EQUIP_SET;
+        case 158: return CHAR_INS_EQUIP_SET;
+        case 159: return CHAR_DEL_EQUIP_SET;
+        case 160: return CHAR_INS_AURA;
+        case 161: return CHAR_SEL_ACCOUNT_DATA;
+        case 162: return CHAR_REP_ACCOUNT_DATA;
+        case 163: return CHAR_DEL_ACCOUNT_DATA;
+        case 164: return CHAR_SEL_PLAYER_ACCOUNT_DATA;
+        case 165: return CHAR_REP_PLAYER_ACCOUNT_DATA;
+        case 166: return CHAR_DEL_PLAYER_ACCOUNT_DATA;
+        case 167: return CHAR_SEL_TUTORIALS;
+        case 168: return CHAR_SEL_HAS_TUTORIALS;
+        case 169: return CHAR_INS_TUTORIALS;
+        case 170: return CHAR_UPD_TUTORIALS;
+        case 171: return CHAR_DEL_TUTORIALS;
+        case 172: return CHAR_INS_INSTANCE_SAVE;
+        case 173: return CHAR_UPD_INSTANCE_SAVE_DATA;
+        case 174: return CHAR_UPD_INSTANCE_SAVE_ENCOUNTERMASK;
+        case 175: return CHAR_DEL_GAME_EVENT_SAVE;
+        case 176: return CHAR_INS_GAME_EVENT_SAVE;
+        case 177: return CHAR_DEL_ALL_GAME_EVENT_CONDITION_SAVE;
+        case 178: return CHAR_DEL_GAME_EVENT_CONDITION_SAVE;
+        case 179: return CHAR_INS_GAME_EVENT_CONDITION_SAVE;
+        case 180: return CHAR_SEL_GAME_EVENT_CONDITION_SAVE_DATA;
+        case 181: return CHAR_SEL_GAME_EVENT_SAVE_DATA;
+        case 182: return CHAR_INS_ARENA_TEAM;
+        case 183: return CHAR_INS_ARENA_TEAM_MEMBER;
+        case 184: return CHAR_DEL_ARENA_TEAM;
+        case 185: return CHAR_DEL_ARENA_TEAM_MEMBERS;
+        case 186: return CHAR_UPD_ARENA_TEAM_CAPTAIN;
+        case 187: return CHAR_DEL_ARENA_TEAM_MEMBER;
+        case 188: return CHAR_UPD_ARENA_TEAM_STATS;
+        case 189: return CHAR_UPD_ARENA_TEAM_MEMBER;
+        case 190: return CHAR_REP_CHARACTER_ARENA_STATS;
+        case 191: return CHAR_SEL_PLAYER_ARENA_TEAMS;
+        case 192: return CHAR_UPD_ARENA_TEAM_NAME;
+        case 193: return CHAR_DEL_ALL_PETITION_SIGNATURES;
+        case 194: return CHAR_DEL_PETITION_SIGNATURE;
+        case 195: return CHAR_INS_PLAYER_ENTRY_POINT;
+        case 196: return CHAR_DEL_PLAYER_ENTRY_POINT;
+        case 197: return CHAR_INS_PLAYER_HOMEBIND;
+        case 198: return CHAR_UPD_PLAYER_HOMEBIND;
+        case 199: return CHAR_DEL_PLAYER_HOMEBIND;
+        case 200: return CHAR_SEL_CORPSES;
+        case 201: return CHAR_INS_CORPSE;
+        case 202: return CHAR_DEL_CORPSE;
+        case 203: return CHAR_DEL_CORPSES_FROM_MAP;
+        case 204: return CHAR_SEL_CORPSE_LOCATION;
+        case 205: return CHAR_SEL_CREATURE_RESPAWNS;
+        case 206: return CHAR_REP_CREATURE_RESPAWN;
+        case 207: return CHAR_DEL_CREATURE_RESPAWN;
+        case 208: return CHAR_DEL_CREATURE_RESPAWN_BY_INSTANCE;
+        case 209: return CHAR_SEL_GO_RESPAWNS;
+        case 210: return CHAR_REP_GO_RESPAWN;
+        case 211: return CHAR_DEL_GO_RESPAWN;
+        case 212: return CHAR_DEL_GO_RESPAWN_BY_INSTANCE;
+        case 213: return CHAR_SEL_GM_TICKETS;
+        case 214: return CHAR_REP_GM_TICKET;
+        case 215: return CHAR_DEL_GM_TICKET;
+        case 216: return CHAR_DEL_ALL_GM_TICKETS;
+        case 217: return CHAR_DEL_PLAYER_GM_TICKETS;
+        case 218: return CHAR_UPD_PLAYER_GM_TICKETS_ON_CHAR_DELETION;
+        case 219: return CHAR_INS_GM_SURVEY;
+        case 220: return CHAR_INS_GM_SUBSURVEY;
+        case 221: return CHAR_INS_LAG_REPORT;
+        case 222: return CHAR_INS_CHARACTER;
+        case 223: return CHAR_UPD_CHARACTER;
+        case 224: return CHAR_UPD_ADD_AT_LOGIN_FLAG;
+        case 225: return CHAR_UPD_REM_AT_LOGIN_FLAG;
+        case 226: return CHAR_UPD_ALL_AT_LOGIN_FLAGS;
+        case 227: return CHAR_INS_BUG_REPORT;
+        case 228: return CHAR_UPD_PETITION_NAME;
+        case 229: return CHAR_INS_PETITION_SIGNATURE;
+        case 230: return CHAR_UPD_ACCOUNT_ONLINE;
+        case 231: return CHAR_INS_GROUP;
+        case 232: return CHAR_REP_GROUP_MEMBER;
+        case 233: return CHAR_DEL_GROUP_MEMBER;
+        case 234: return CHAR_UPD_GROUP_LEADER;
+        case 235: return CHAR_UPD_GROUP_TYPE;
+        case 236: return CHAR_UPD_GROUP_MEMBER_SUBGROUP;
+        case 237: return CHAR_UPD_GROUP_MEMBER_FLAG;
+        case 238: return CHAR_UPD_GROUP_DIFFICULTY;
+        case 239: return CHAR_UPD_GROUP_RAID_DIFFICULTY;
+        case 240: return CHAR_DEL_INVALID_SPELL_SPELLS;
+        case 241: return CHAR_DEL_INVALID_SPELL_TALENTS;
+        case 242: return CHAR_UPD_DELETE_INFO;
+        case 243: return CHAR_UDP_RESTORE_DELETE_INFO;
+        case 244: return CHAR_UPD_ZONE;
+        case 245: return CHAR_UPD_LEVEL;
+        case 246: return CHAR_UPD_XP_ACCUMULATIVE;
+        case 247: return CHAR_DEL_INVALID_ACHIEV_PROGRESS_CRITERIA;
+        case 248: return CHAR_DEL_INVALID_ACHIEVMENT;
+        case 249: return CHAR_INS_ADDON;
+        case 250: return CHAR_DEL_INVALID_PET_SPELL;
+        case 251: return CHAR_UPD_GLOBAL_INSTANCE_RESETTIME;
+        case 252: return CHAR_UPD_CHAR_ONLINE;
+        case 253: return CHAR_UPD_CHAR_NAME_AT_LOGIN;
+        case 254: return CHAR_UPD_WORLDSTATE;
+        case 255: return CHAR_INS_WORLDSTATE;
+        case 256: return CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE;
+        case 257: return CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_NOT_EXTENDED;
+        case 258: return CHAR_UPD_CHAR_INSTANCE_SET_NOT_EXTENDED;
+        case 259: return CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_GUID;
+        case 260: return CHAR_UPD_CHAR_INSTANCE;
+        case 261: return CHAR_UPD_CHAR_INSTANCE_EXTENDED;
+        case 262: return CHAR_INS_CHAR_INSTANCE;
+        case 263: return CHAR_INS_ARENA_LOG_FIGHT;
+        case 264: return CHAR_INS_ARENA_LOG_MEMBERSTATS;
+        case 265: return CHAR_UPD_GENDER_AND_APPEARANCE;
+        case 266: return CHAR_DEL_CHARACTER_SKILL;
+        case 267: return CHAR_UPD_ADD_CHARACTER_SOCIAL_FLAGS;
+        case 268: return CHAR_UPD_REM_CHARACTER_SOCIAL_FLAGS;
+        case 269: return CHAR_INS_CHARACTER_SOCIAL;
+        case 270: return CHAR_DEL_CHARACTER_SOCIAL;
+        case 271: return CHAR_UPD_CHARACTER_SOCIAL_NOTE;
+        case 272: return CHAR_UPD_CHARACTER_POSITION;
+        case 273: return CHAR_REP_LFG_DATA;
+        case 274: return CHAR_DEL_LFG_DATA;
+        case 275: return CHAR_SEL_CHARACTER_AURA_FROZEN;
+        case 276: return CHAR_SEL_CHARACTER_ONLINE;
+        case 277: return CHAR_SEL_CHAR_DEL_INFO_BY_GUID;
+        case 278: return CHAR_SEL_CHAR_DEL_INFO_BY_NAME;
+        case 279: return CHAR_SEL_CHAR_DEL_INFO;
+        case 280: return CHAR_SEL_CHARS_BY_ACCOUNT_ID;
+        case 281: return CHAR_SEL_CHAR_PINFO;
+        case 282: return CHAR_SEL_PINFO_XP;
+        case 283: return CHAR_SEL_PINFO_MAILS;
+        case 284: return CHAR_SEL_PINFO_BANS;
+        case 285: return CHAR_SEL_CHAR_HOMEBIND;
+        case 286: return CHAR_SEL_CHAR_GUID_NAME_BY_ACC;
+        case 287: return CHAR_SEL_POOL_QUEST_SAVE;
+        case 288: return CHAR_SEL_CHARACTER_AT_LOGIN;
+        case 289: return CHAR_SEL_CHAR_CLASS_LVL_AT_LOGIN;
+        case 290: return CHAR_SEL_CHAR_CUSTOMIZE_INFO;
+        case 291: return CHAR_SEL_CHAR_RACE_OR_FACTION_CHANGE_INFOS;
+        case 292: return CHAR_SEL_CHAR_AT_LOGIN_TITLES_MONEY;
+        case 293: return CHAR_SEL_CHAR_COD_ITEM_MAIL;
+        case 294: return CHAR_SEL_CHAR_SOCIAL;
+        case 295: return CHAR_SEL_CHAR_OLD_CHARS;
+        case 296: return CHAR_SEL_ARENA_TEAM_ID_BY_PLAYER_GUID;
+        case 297: return CHAR_SEL_MAIL;
+        case 298: return CHAR_SEL_NEXT_MAIL_DELIVERYTIME;
+        case 299: return CHAR_DEL_CHAR_AURA_FROZEN;
+        case 300: return CHAR_SEL_CHAR_INVENTORY_COUNT_ITEM;
+        case 301: return CHAR_SEL_MAIL_COUNT_ITEM;
+        case 302: return CHAR_SEL_AUCTIONHOUSE_COUNT_ITEM;
+        case 303: return CHAR_SEL_GUILD_BANK_COUNT_ITEM;
+        case 304: return CHAR_SEL_CHAR_INVENTORY_ITEM_BY_ENTRY;
+        case 305: return CHAR_SEL_CHAR_INVENTORY_ITEM_BY_ENTRY_AND_OWNER;
+        case 306: return CHAR_SEL_MAIL_ITEMS_BY_ENTRY;
+        case 307: return CHAR_SEL_AUCTIONHOUSE_ITEM_BY_ENTRY;
+        case 308: return CHAR_SEL_GUILD_BANK_ITEM_BY_ENTRY;
+        case 309: return CHAR_DEL_CHAR_ACHIEVEMENT;
+        case 310: return CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS;
+        case 311: return CHAR_INS_CHAR_ACHIEVEMENT;
+        case 312: return CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA;
+        case 313: return CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS;
+        case 314: return CHAR_INS_CHAR_ACHIEVEMENT_OFFLINE_UPDATES;
+        case 315: return CHAR_SEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES;
+        case 316: return CHAR_DEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES;
+        case 317: return CHAR_DEL_CHAR_REPUTATION_BY_FACTION;
+        case 318: return CHAR_INS_CHAR_REPUTATION_BY_FACTION;
+        case 319: return CHAR_UPD_CHAR_ARENA_POINTS;
+        case 320: return CHAR_DEL_ITEM_REFUND_INSTANCE;
+        case 321: return CHAR_INS_ITEM_REFUND_INSTANCE;
+        case 322: return CHAR_DEL_GROUP;
+        case 323: return CHAR_DEL_GROUP_MEMBER_ALL;
+        case 324: return CHAR_INS_CHAR_GIFT;
+        case 325: return CHAR_DEL_INSTANCE_BY_INSTANCE;
+        case 326: return CHAR_DEL_MAIL_ITEM_BY_ID;
+        case 327: return CHAR_INS_PETITION;
+        case 328: return CHAR_DEL_PETITION_BY_GUID;
+        case 329: return CHAR_DEL_PETITION_SIGNATURE_BY_GUID;
+        case 330: return CHAR_DEL_CHAR_DECLINED_NAME;
+        case 331: return CHAR_INS_CHAR_DECLINED_NAME;
+        case 332: return CHAR_UPD_CHAR_RACE;
+        case 333: return CHAR_DEL_CHAR_SKILL_LANGUAGES;
+        case 334: return CHAR_INS_CHAR_SKILL_LANGUAGE;
+        case 335: return CHAR_UPD_CHAR_TAXI_PATH;
+        case 336: return CHAR_UPD_CHAR_TAXIMASK;
+        case 337: return CHAR_DEL_CHAR_QUESTSTATUS;
+        case 338: return CHAR_DEL_CHAR_SOCIAL_BY_GUID;
+        case 339: return CHAR_DEL_CHAR_SOCIAL_BY_FRIEND;
+        case 340: return CHAR_DEL_CHAR_ACHIEVEMENT_BY_ACHIEVEMENT;
+        case 341: return CHAR_UPD_CHAR_ACHIEVEMENT;
+        case 342: return CHAR_UPD_CHAR_INVENTORY_FACTION_CHANGE;
+        case 343: return CHAR_DEL_CHAR_SPELL_BY_SPELL;
+        case 344: return CHAR_UPD_CHAR_SPELL_FACTION_CHANGE;
+        case 345: return CHAR_SEL_CHAR_REP_BY_FACTION;
+        case 346: return CHAR_DEL_CHAR_REP_BY_FACTION;
+        case 347: return CHAR_UPD_CHAR_REP_FACTION_CHANGE;
+        case 348: return CHAR_UPD_CHAR_TITLES_FACTION_CHANGE;
+        case 349: return CHAR_RES_CHAR_TITLES_FACTION_CHANGE;
+        case 350: return CHAR_DEL_CHAR_SPELL_COOLDOWN;
+        case 351: return CHAR_DEL_CHARACTER;
+        case 352: return CHAR_DEL_CHAR_ACTION;
+        case 353: return CHAR_DEL_CHAR_AURA;
+        case 354: return CHAR_DEL_CHAR_GIFT;
+        case 355: return CHAR_DEL_CHAR_INSTANCE;
+        case 356: return CHAR_DEL_CHAR_INVENTORY;
+        case 357: return CHAR_DEL_CHAR_QUESTSTATUS_REWARDED;
+        case 358: return CHAR_DEL_CHAR_REPUTATION;
+        case 359: return CHAR_DEL_CHAR_SPELL;
+        case 360: return CHAR_DEL_MAIL;
+        case 361: return CHAR_DEL_MAIL_ITEMS;
+        case 362: return CHAR_DEL_CHAR_ACHIEVEMENTS;
+        case 363: return CHAR_DEL_CHAR_EQUIPMENTSETS;
+        case 364: return CHAR_DEL_GUILD_EVENTLOG_BY_PLAYER;
+        case 365: return CHAR_DEL_GUILD_BANK_EVENTLOG_BY_PLAYER;
+        case 366: return CHAR_DEL_CHAR_GLYPHS;
+        case 367: return CHAR_DEL_CHAR_TALENT;
+        case 368: return CHAR_DEL_CHAR_SKILLS;
+        case 369: return CHAR_UDP_CHAR_HONOR_POINTS;
+        case 370: return CHAR_UDP_CHAR_HONOR_POINTS_ACCUMULATIVE;
+        case 371: return CHAR_UDP_CHAR_ARENA_POINTS;
+        case 372: return CHAR_UDP_CHAR_ARENA_POINTS_ACCUMULATIVE;
+        case 373: return CHAR_UDP_CHAR_MONEY;
+        case 374: return CHAR_UDP_CHAR_MONEY_ACCUMULATIVE;
+        case 375: return CHAR_UPD_CHAR_REMOVE_GHOST;
+        case 376: return CHAR_INS_CHAR_ACTION;
+        case 377: return CHAR_UPD_CHAR_ACTION;
+        case 378: return CHAR_DEL_CHAR_ACTION_BY_BUTTON_SPEC;
+        case 379: return CHAR_DEL_CHAR_INVENTORY_BY_ITEM;
+        case 380: return CHAR_DEL_CHAR_INVENTORY_BY_BAG_SLOT;
+        case 381: return CHAR_UPD_MAIL;
+        case 382: return CHAR_REP_CHAR_QUESTSTATUS;
+        case 383: return CHAR_DEL_CHAR_QUESTSTATUS_BY_QUEST;
+        case 384: return CHAR_INS_CHAR_QUESTSTATUS_REWARDED;
+        case 385: return CHAR_DEL_CHAR_QUESTSTATUS_REWARDED_BY_QUEST;
+        case 386: return CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_FACTION_CHANGE;
+        case 387: return CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_ACTIVE;
+        case 388: return CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_ACTIVE_BY_QUEST;
+        case 389: return CHAR_DEL_CHAR_SKILL_BY_SKILL;
+        case 390: return CHAR_INS_CHAR_SKILLS;
+        case 391: return CHAR_UDP_CHAR_SKILLS;
+        case 392: return CHAR_INS_CHAR_SPELL;
+        case 393: return CHAR_DEL_CHAR_STATS;
+        case 394: return CHAR_INS_CHAR_STATS;
+        case 395: return CHAR_SEL_CHAR_STATS;
+        case 396: return CHAR_DEL_PETITION_BY_OWNER;
+        case 397: return CHAR_DEL_PETITION_SIGNATURE_BY_OWNER;
+        case 398: return CHAR_DEL_PETITION_BY_OWNER_AND_TYPE;
+        case 399: return CHAR_DEL_PETITION_SIGNATURE_BY_OWNER_AND_TYPE;
+        case 400: return CHAR_INS_CHAR_GLYPHS;
+        case 401: return CHAR_DEL_CHAR_TALENT_BY_SPELL;
+        case 402: return CHAR_INS_CHAR_TALENT;
+        case 403: return CHAR_DEL_CHAR_ACTION_EXCEPT_SPEC;
+        case 404: return CHAR_REP_CALENDAR_EVENT;
+        case 405: return CHAR_DEL_CALENDAR_EVENT;
+        case 406: return CHAR_REP_CALENDAR_INVITE;
+        case 407: return CHAR_DEL_CALENDAR_INVITE;
+        case 408: return CHAR_SEL_PET_AURA;
+        case 409: return CHAR_SEL_PET_SPELL;
+        case 410: return CHAR_SEL_PET_SPELL_COOLDOWN;
+        case 411: return CHAR_DEL_PET_AURAS;
+        case 412: return CHAR_DEL_PET_SPELL_COOLDOWNS;
+        case 413: return CHAR_INS_PET_SPELL_COOLDOWN;
+        case 414: return CHAR_DEL_PET_SPELL_BY_SPELL;
+        case 415: return CHAR_INS_PET_SPELL;
+        case 416: return CHAR_INS_PET_AURA;
+        case 417: return CHAR_DEL_PET_SPELLS;
+        case 418: return CHAR_DEL_CHAR_PET_BY_OWNER;
+        case 419: return CHAR_DEL_CHAR_PET_DECLINEDNAME_BY_OWNER;
+        case 420: return CHAR_SEL_CHAR_PETS;
+        case 421: return CHAR_SEL_CHAR_PET_IDS;
+        case 422: return CHAR_DEL_CHAR_PET_DECLINEDNAME;
+        case 423: return CHAR_ADD_CHAR_PET_DECLINEDNAME;
+        case 424: return CHAR_SEL_PET_DECLINED_NAME;
+        case 425: return CHAR_UPD_CHAR_PET_NAME;
+        case 426: return CHAR_UPD_CHAR_PET_SLOT_BY_ID;
+        case 427: return CHAR_DEL_CHAR_PET_BY_ID;
+        case 428: return CHAR_DEL_CHAR_PET_BY_SLOT;
+        case 429: return CHAR_REP_CHAR_PET;
+        case 430: return CHAR_SEL_ITEMCONTAINER_ITEMS;
+        case 431: return CHAR_DEL_ITEMCONTAINER_SINGLE_ITEM;
+        case 432: return CHAR_INS_ITEMCONTAINER_SINGLE_ITEM;
+        case 433: return CHAR_DEL_ITEMCONTAINER_CONTAINER;
+        case 434: return CHAR_SEL_PVPSTATS_MAXID;
+        case 435: return CHAR_INS_PVPSTATS_BATTLEGROUND;
+        case 436: return CHAR_INS_PVPSTATS_PLAYER;
+        case 437: return CHAR_SEL_PVPSTATS_FACTIONS_OVERALL;
+        case 438: return CHAR_SEL_PVPSTATS_BRACKET_MONTH;
+        case 439: return CHAR_INS_DESERTER_TRACK;
+        case 440: return CHAR_INS_QUEST_TRACK;
+        case 441: return CHAR_UPD_QUEST_TRACK_GM_COMPLETE;
+        case 442: return CHAR_UPD_QUEST_TRACK_COMPLETE_TIME;
+        case 443: return CHAR_UPD_QUEST_TRACK_ABANDON_TIME;
+        case 444: return CHAR_INS_RECOVERY_ITEM;
+        case 445: return CHAR_SEL_RECOVERY_ITEM;
+        case 446: return CHAR_SEL_RECOVERY_ITEM_LIST;
+        case 447: return CHAR_DEL_RECOVERY_ITEM;
+        case 448: return CHAR_DEL_RECOVERY_ITEM_BY_RECOVERY_ID;
+        case 449: return CHAR_SEL_RECOVERY_ITEM_OLD_ITEMS;
+        case 450: return CHAR_DEL_RECOVERY_ITEM_BY_GUID;
+        case 451: return CHAR_SEL_HONORPOINTS;
+        case 452: return CHAR_SEL_ARENAPOINTS;
+        case 453: return CHAR_INS_RESERVED_PLAYER_NAME;
+        case 454: return CHAR_INS_PROFANITY_PLAYER_NAME;
+        case 455: return CHAR_SEL_CHAR_SETTINGS;
+        case 456: return CHAR_REP_CHAR_SETTINGS;
+        case 457: return CHAR_DEL_CHAR_SETTINGS;
+        case 458: return CHAR_SELECT_INSTANCE_SAVED_DATA;
+        case 459: return CHAR_INSERT_INSTANCE_SAVED_DATA;
+        case 460: return CHAR_DELETE_INSTANCE_SAVED_DATA;
+        case 461: return CHAR_SANITIZE_INSTANCE_SAVED_DATA;
+        default: throw std::out_of_range("index");
+    }
+}
+
+template <>
+AC_API_EXPORT std::size_t EnumUtils<CharacterDatabaseStatements>::ToIndex(CharacterDatabaseStatements value)
+{
+    switch (value)
+    {
+        case CHAR_DEL_QUEST_POOL_SAVE: return 0;
+        case CHAR_INS_QUEST_POOL_SAVE: return 1;
+        case CHAR_DEL_NONEXISTENT_GUILD_BANK_ITEM: return 2;
+        case CHAR_DEL_EXPIRED_BANS: return 3;
+        case CHAR_SEL_DATA_BY_NAME: return 4;
+        case CHAR_SEL_DATA_BY_GUID: return 5;
+        case CHAR_SEL_CHECK_NAME: return 6;
+        case CHAR_SEL_CHECK_GUID: return 7;
+        case CHAR_SEL_SUM_CHARS: return 8;
+        case CHAR_SEL_CHAR_CREATE_INFO: return 9;
+        case CHAR_INS_CHARACTER_BAN: return 10;
+        case CHAR_UPD_CHARACTER_BAN: return 11;
+        case CHAR_DEL_CHARACTER_BAN: return 12;
+        case CHAR_SEL_BANINFO: return 13;
+        case CHAR_SEL_GUID_BY_NAME_FILTER: return 14;
+        case CHAR_SEL_BANINFO_LIST: return 15;
+        case CHAR_SEL_BANNED_NAME: return 16;
+        case CHAR_SEL_ENUM: return 17;
+        case CHAR_SEL_ENUM_DECLINED_NAME: return 18;
+        case CHAR_SEL_FREE_NAME: return 19;
+        case CHAR_SEL_CHAR_ZONE: return 20;
+        case CHAR_SEL_CHARACTER_NAME_DATA: return 21;
+        case CHAR_SEL_CHAR_POSITION_XYZ: return 22;
+        case CHAR_SEL_CHAR_POSITION: return 23;
+        case CHAR_DEL_QUEST_STATUS_DAILY: return 24;
+        case CHAR_DEL_QUEST_STATUS_WEEKLY: return 25;
+        case CHAR_DEL_QUEST_STATUS_MONTHLY: return 26;
+        case CHAR_DEL_QUEST_STATUS_SEASONAL: return 27;
+        case CHAR_DEL_QUEST_STATUS_DAILY_CHAR: return 28;
+        case CHAR_DEL_QUEST_STATUS_WEEKLY_CHAR: return 29;
+        case CHAR_DEL_QUEST_STATUS_MONTHLY_CHAR: return 30;
+        case CHAR_DEL_QUEST_STATUS_SEASONAL_CHAR: return 31;
+        case CHAR_DEL_BATTLEGROUND_RANDOM: return 32;
+        case CHAR_INS_BATTLEGROUND_RANDOM: return 33;
+        case CHAR_SEL_CHARACTER: return 34;
+        case CHAR_SEL_CHARACTER_AURAS: return 35;
+        case CHAR_SEL_CHARACTER_SPELL: return 36;
+        case CHAR_SEL_CHARACTER_QUESTSTATUS: return 37;
+        case CHAR_SEL_CHARACTER_DAILYQUESTSTATUS: return 38;
+        case CHAR_SEL_CHARACTER_WEEKLYQUESTSTATUS: return 39;
+        case CHAR_SEL_CHARACTER_MONTHLYQUESTSTATUS: return 40;
+        case CHAR_SEL_CHARACTER_SEASONALQUESTSTATUS: return 41;
+        case CHAR_INS_CHARACTER_DAILYQUESTSTATUS: return 42;
+        case CHAR_INS_CHARACTER_WEEKLYQUESTSTATUS: return 43;
+        case CHAR_INS_CHARACTER_MONTHLYQUESTSTATUS: return 44;
+        case CHAR_INS_CHARACTER_SEASONALQUESTSTATUS: return 45;
+        case CHAR_SEL_CHARACTER_REPUTATION: return 46;
+        case CHAR_SEL_CHARACTER_INVENTORY: return 47;
+        case CHAR_SEL_CHARACTER_ACTIONS: return 48;
+        case CHAR_SEL_CHARACTER_ACTIONS_SPEC: return 49;
+        case CHAR_SEL_CHARACTER_MAILCOUNT_UNREAD: return 50;
+        case CHAR_SEL_CHARACTER_MAILCOUNT_UNREAD_SYNCH: return 51;
+        case CHAR_SEL_MAIL_SERVER_CHARACTER: return 52;
+        case CHAR_REP_MAIL_SERVER_CHARACTER: return 53;
+        case CHAR_SEL_CHARACTER_SOCIALLIST: return 54;
+        case CHAR_SEL_CHARACTER_HOMEBIND: return 55;
+        case CHAR_SEL_CHARACTER_SPELLCOOLDOWNS: return 56;
+        case CHAR_SEL_CHARACTER_DECLINEDNAMES: return 57;
+        case CHAR_SEL_CHARACTER_ACHIEVEMENTS: return 58;
+        case CHAR_SEL_CHARACTER_CRITERIAPROGRESS: return 59;
+        case CHAR_SEL_CHARACTER_EQUIPMENTSETS: return 60;
+        case CHAR_SEL_CHARACTER_ENTRY_POINT: return 61;
+        case CHAR_SEL_CHARACTER_GLYPHS: return 62;
+        case CHAR_SEL_CHARACTER_TALENTS: return 63;
+        case CHAR_SEL_CHARACTER_SKILLS: return 64;
+        case CHAR_SEL_CHARACTER_RANDOMBG: return 65;
+        case CHAR_SEL_CHARACTER_BANNED: return 66;
+        case CHAR_SEL_CHARACTER_QUESTSTATUSREW: return 67;
+        case CHAR_SEL_ACCOUNT_INSTANCELOCKTIMES: return 68;
+        case CHAR_SEL_MAILITEMS: return 69;
+        case CHAR_SEL_BREW_OF_THE_MONTH: return 70;
+        case CHAR_REP_BREW_OF_THE_MONTH: return 71;
+        case CHAR_SEL_AUCTION_ITEMS: return 72;
+        case CHAR_INS_AUCTION: return 73;
+        case CHAR_DEL_AUCTION: return 74;
+        case CHAR_UPD_AUCTION_BID: return 75;
+        case CHAR_SEL_AUCTIONS: return 76;
+        case CHAR_INS_MAIL: return 77;
+        case CHAR_DEL_MAIL_BY_ID: return 78;
+        case CHAR_INS_MAIL_ITEM: return 79;
+        case CHAR_DEL_MAIL_ITEM: return 80;
+        case CHAR_DEL_INVALID_MAIL_ITEM: return 81;
+        case CHAR_SEL_EXPIRED_MAIL: return 82;
+        case CHAR_SEL_EXPIRED_MAIL_ITEMS: return 83;
+        case CHAR_UPD_MAIL_RETURNED: return 84;
+        case CHAR_UPD_MAIL_ITEM_RECEIVER: return 85;
+        case CHAR_UPD_ITEM_OWNER: return 86;
+        case CHAR_SEL_ITEM_REFUNDS: return 87;
+        case CHAR_SEL_ITEM_BOP_TRADE: return 88;
+        case CHAR_DEL_ITEM_BOP_TRADE: return 89;
+        case CHAR_INS_ITEM_BOP_TRADE: return 90;
+        case CHAR_REP_INVENTORY_ITEM: return 91;
+        case CHAR_REP_ITEM_INSTANCE: return 92;
+        case CHAR_UPD_ITEM_INSTANCE: return 93;
+        case CHAR_UPD_ITEM_INSTANCE_ON_LOAD: return 94;
+        case CHAR_DEL_ITEM_INSTANCE: return 95;
+        case CHAR_DEL_ITEM_INSTANCE_BY_OWNER: return 96;
+        case CHAR_UPD_GIFT_OWNER: return 97;
+        case CHAR_DEL_GIFT: return 98;
+        case CHAR_SEL_CHARACTER_GIFT_BY_ITEM: return 99;
+        case CHAR_SEL_ACCOUNT_BY_NAME: return 100;
+        case CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES: return 101;
+        case CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES: return 102;
+        case CHAR_SEL_MATCH_MAKER_RATING: return 103;
+        case CHAR_SEL_CHARACTER_COUNT: return 104;
+        case CHAR_UPD_NAME_BY_GUID: return 105;
+        case CHAR_DEL_DECLINED_NAME: return 106;
+        case CHAR_INS_GUILD: return 107;
+        case CHAR_DEL_GUILD: return 108;
+        case CHAR_UPD_GUILD_NAME: return 109;
+        case CHAR_INS_GUILD_MEMBER: return 110;
+        case CHAR_DEL_GUILD_MEMBER: return 111;
+        case CHAR_DEL_GUILD_MEMBERS: return 112;
+        case CHAR_SEL_GUILD_MEMBER_EXTENDED: return 113;
+        case CHAR_INS_GUILD_RANK: return 114;
+        case CHAR_DEL_GUILD_RANKS: return 115;
+        case CHAR_DEL_GUILD_LOWEST_RANK: return 116;
+        case CHAR_INS_GUILD_BANK_TAB: return 117;
+        case CHAR_DEL_GUILD_BANK_TAB: return 118;
+        case CHAR_DEL_GUILD_BANK_TABS: return 119;
+        case CHAR_INS_GUILD_BANK_ITEM: return 120;
+        case CHAR_DEL_GUILD_BANK_ITEM: return 121;
+        case CHAR_DEL_GUILD_BANK_ITEMS: return 122;
+        case CHAR_INS_GUILD_BANK_RIGHT: return 123;
+        case CHAR_DEL_GUILD_BANK_RIGHTS: return 124;
+        case CHAR_DEL_GUILD_BANK_RIGHTS_FOR_RANK: return 125;
+        case CHAR_INS_GUILD_BANK_EVENTLOG: return 126;
+        case CHAR_DEL_GUILD_BANK_EVENTLOG: return 127;
+        case CHAR_DEL_GUILD_BANK_EVENTLOGS: return 128;
+        case CHAR_INS_GUILD_EVENTLOG: return 129;
+        case CHAR_DEL_GUILD_EVENTLOG: return 130;
+        case CHAR_DEL_GUILD_EVENTLOGS: return 131;
+        case CHAR_UPD_GUILD_MEMBER_PNOTE: return 132;
+        case CHAR_UPD_GUILD_MEMBER_OFFNOTE: return 133;
+        case CHAR_UPD_GUILD_MEMBER_RANK: return 134;
+        case CHAR_UPD_GUILD_MOTD: return 135;
+        case CHAR_UPD_GUILD_INFO: return 136;
+        case CHAR_UPD_GUILD_LEADER: return 137;
+        case CHAR_UPD_GUILD_RANK_NAME: return 138;
+        case CHAR_UPD_GUILD_RANK_RIGHTS: return 139;
+        case CHAR_UPD_GUILD_EMBLEM_INFO: return 140;
+        case CHAR_UPD_GUILD_BANK_TAB_INFO: return 141;
+        case CHAR_UPD_GUILD_BANK_MONEY: return 142;
+        case CHAR_UPD_GUILD_BANK_EVENTLOG_TAB: return 143;
+        case CHAR_UPD_GUILD_RANK_BANK_MONEY: return 144;
+        case CHAR_UPD_GUILD_BANK_TAB_TEXT: return 145;
+        case CHAR_INS_GUILD_MEMBER_WITHDRAW: return 146;
+        case CHAR_DEL_GUILD_MEMBER_WITHDRAW: return 147;
+        case CHAR_SEL_CHAR_DATA_FOR_GUILD: return 148;
+        case CHAR_INS_CHANNEL: return 149;
+        case CHAR_UPD_CHANNEL: return 150;
+        case CHAR_DEL_CHANNEL: return 151;
+        case CHAR_UPD_CHANNEL_USAGE: return 152;
+        case CHAR_DEL_OLD_CHANNELS: return 153;
+        case CHAR_DEL_OLD_CHANNELS_BANS: return 154;
+        case CHAR_INS_CHANNEL_BAN: return 155;
+        case CHAR_DEL_CHANNEL_BAN: return 156;
+        case CHAR_UPD_EQUIP_SET: return 157;
+        case CHAR_INS_EQUIP_SET: return 158;
+        case CHAR_DEL_EQUIP_SET: return 159;
+        case CHAR_INS_AURA: return 160;
+        case CHAR_SEL_ACCOUNT_DATA: return 161;
+        case CHAR_REP_ACCOUNT_DATA: return 162;
+        case CHAR_DEL_ACCOUNT_DATA: return 163;
+        case CHAR_SEL_PLAYER_ACCOUNT_DATA: return 164;
+        case CHAR_REP_PLAYER_ACCOUNT_DATA: return 165;
+        case CHAR_DEL_PLAYER_ACCOUNT_DATA: return 166;
+        case CHAR_SEL_TUTORIALS: return 167;
+        case CHAR_SEL_HAS_TUTORIALS: return 168;
+        case CHAR_INS_TUTORIALS: return 169;
+        case CHAR_UPD_TUTORIALS: return 170;
+        case CHAR_DEL_TUTORIALS: return 171;
+        case CHAR_INS_INSTANCE_SAVE: return 172;
+        case CHAR_UPD_INSTANCE_SAVE_DATA: return 173;
+        case CHAR_UPD_INSTANCE_SAVE_ENCOUNTERMASK: return 174;
+        case CHAR_DEL_GAME_EVENT_SAVE: return 175;
+        case CHAR_INS_GAME_EVENT_SAVE: return 176;
+        case CHAR_DEL_ALL_GAME_EVENT_CONDITION_SAVE: return 177;
+        case CHAR_DEL_GAME_EVENT_CONDITION_SAVE: return 178;
+        case CHAR_INS_GAME_EVENT_CONDITION_SAVE: return 179;
+        case CHAR_SEL_GAME_EVENT_CONDITION_SAVE_DATA: return 180;
+        case CHAR_SEL_GAME_EVENT_SAVE_DATA: return 181;
+        case CHAR_INS_ARENA_TEAM: return 182;
+        case CHAR_INS_ARENA_TEAM_MEMBER: return 183;
+        case CHAR_DEL_ARENA_TEAM: return 184;
+        case CHAR_DEL_ARENA_TEAM_MEMBERS: return 185;
+        case CHAR_UPD_ARENA_TEAM_CAPTAIN: return 186;
+        case CHAR_DEL_ARENA_TEAM_MEMBER: return 187;
+        case CHAR_UPD_ARENA_TEAM_STATS: return 188;
+        case CHAR_UPD_ARENA_TEAM_MEMBER: return 189;
+        case CHAR_REP_CHARACTER_ARENA_STATS: return 190;
+        case CHAR_SEL_PLAYER_ARENA_TEAMS: return 191;
+        case CHAR_UPD_ARENA_TEAM_NAME: return 192;
+        case CHAR_DEL_ALL_PETITION_SIGNATURES: return 193;
+        case CHAR_DEL_PETITION_SIGNATURE: return 194;
+        case CHAR_INS_PLAYER_ENTRY_POINT: return 195;
+        case CHAR_DEL_PLAYER_ENTRY_POINT: return 196;
+        case CHAR_INS_PLAYER_HOMEBIND: return 197;
+        case CHAR_UPD_PLAYER_HOMEBIND: return 198;
+        case CHAR_DEL_PLAYER_HOMEBIND: return 199;
+        case CHAR_SEL_CORPSES: return 200;
+        case CHAR_INS_CORPSE: return 201;
+        case CHAR_DEL_CORPSE: return 202;
+        case CHAR_DEL_CORPSES_FROM_MAP: return 203;
+        case CHAR_SEL_CORPSE_LOCATION: return 204;
+        case CHAR_SEL_CREATURE_RESPAWNS: return 205;
+        case CHAR_REP_CREATURE_RESPAWN: return 206;
+        case CHAR_DEL_CREATURE_RESPAWN: return 207;
+        case CHAR_DEL_CREATURE_RESPAWN_BY_INSTANCE: return 208;
+        case CHAR_SEL_GO_RESPAWNS: return 209;
+        case CHAR_REP_GO_RESPAWN: return 210;
+        case CHAR_DEL_GO_RESPAWN: return 211;
+        case CHAR_DEL_GO_RESPAWN_BY_INSTANCE: return 212;
+        case CHAR_SEL_GM_TICKETS: return 213;
+        case CHAR_REP_GM_TICKET: return 214;
+        case CHAR_DEL_GM_TICKET: return 215;
+        case CHAR_DEL_ALL_GM_TICKETS: return 216;
+        case CHAR_DEL_PLAYER_GM_TICKETS: return 217;
+        case CHAR_UPD_PLAYER_GM_TICKETS_ON_CHAR_DELETION: return 218;
+        case CHAR_INS_GM_SURVEY: return 219;
+        case CHAR_INS_GM_SUBSURVEY: return 220;
+        case CHAR_INS_LAG_REPORT: return 221;
+        case CHAR_INS_CHARACTER: return 222;
+        case CHAR_UPD_CHARACTER: return 223;
+        case CHAR_UPD_ADD_AT_LOGIN_FLAG: return 224;
+        case CHAR_UPD_REM_AT_LOGIN_FLAG: return 225;
+        case CHAR_UPD_ALL_AT_LOGIN_FLAGS: return 226;
+        case CHAR_INS_BUG_REPORT: return 227;
+        case CHAR_UPD_PETITION_NAME: return 228;
+        case CHAR_INS_PETITION_SIGNATURE: return 229;
+        case CHAR_UPD_ACCOUNT_ONLINE: return 230;
+        case CHAR_INS_GROUP: return 231;
+        case CHAR_REP_GROUP_MEMBER: return 232;
+        case CHAR_DEL_GROUP_MEMBER: return 233;
+        case CHAR_UPD_GROUP_LEADER: return 234;
+        case CHAR_UPD_GROUP_TYPE: return 235;
+        case CHAR_UPD_GROUP_MEMBER_SUBGROUP: return 236;
+        case CHAR_UPD_GROUP_MEMBER_FLAG: return 237;
+        case CHAR_UPD_GROUP_DIFFICULTY: return 238;
+        case CHAR_UPD_GROUP_RAID_DIFFICULTY: return 239;
+        case CHAR_DEL_INVALID_SPELL_SPELLS: return 240;
+        case CHAR_DEL_INVALID_SPELL_TALENTS: return 241;
+        case CHAR_UPD_DELETE_INFO: return 242;
+        case CHAR_UDP_RESTORE_DELETE_INFO: return 243;
+        case CHAR_UPD_ZONE: return 244;
+        case CHAR_UPD_LEVEL: return 245;
+        case CHAR_UPD_XP_ACCUMULATIVE: return 246;
+        case CHAR_DEL_INVALID_ACHIEV_PROGRESS_CRITERIA: return 247;
+        case CHAR_DEL_INVALID_ACHIEVMENT: return 248;
+        case CHAR_INS_ADDON: return 249;
+        case CHAR_DEL_INVALID_PET_SPELL: return 250;
+        case CHAR_UPD_GLOBAL_INSTANCE_RESETTIME: return 251;
+        case CHAR_UPD_CHAR_ONLINE: return 252;
+        case CHAR_UPD_CHAR_NAME_AT_LOGIN: return 253;
+        case CHAR_UPD_WORLDSTATE: return 254;
+        case CHAR_INS_WORLDSTATE: return 255;
+        case CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE: return 256;
+        case CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_NOT_EXTENDED: return 257;
+        case CHAR_UPD_CHAR_INSTANCE_SET_NOT_EXTENDED: return 258;
+        case CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_GUID: return 259;
+        case CHAR_UPD_CHAR_INSTANCE: return 260;
+        case CHAR_UPD_CHAR_INSTANCE_EXTENDED: return 261;
+        case CHAR_INS_CHAR_INSTANCE: return 262;
+        case CHAR_INS_ARENA_LOG_FIGHT: return 263;
+        case CHAR_INS_ARENA_LOG_MEMBERSTATS: return 264;
+        case CHAR_UPD_GENDER_AND_APPEARANCE: return 265;
+        case CHAR_DEL_CHARACTER_SKILL: return 266;
+        case CHAR_UPD_ADD_CHARACTER_SOCIAL_FLAGS: return 267;
+        case CHAR_UPD_REM_CHARACTER_SOCIAL_FLAGS: return 268;
+        case CHAR_INS_CHARACTER_SOCIAL: return 269;
+        case CHAR_DEL_CHARACTER_SOCIAL: return 270;
+        case CHAR_UPD_CHARACTER_SOCIAL_NOTE: return 271;
+        case CHAR_UPD_CHARACTER_POSITION: return 272;
+        case CHAR_REP_LFG_DATA: return 273;
+        case CHAR_DEL_LFG_DATA: return 274;
+        case CHAR_SEL_CHARACTER_AURA_FROZEN: return 275;
+        case CHAR_SEL_CHARACTER_ONLINE: return 276;
+        case CHAR_SEL_CHAR_DEL_INFO_BY_GUID: return 277;
+        case CHAR_SEL_CHAR_DEL_INFO_BY_NAME: return 278;
+        case CHAR_SEL_CHAR_DEL_INFO: return 279;
+        case CHAR_SEL_CHARS_BY_ACCOUNT_ID: return 280;
+        case CHAR_SEL_CHAR_PINFO: return 281;
+        case CHAR_SEL_PINFO_XP: return 282;
+        case CHAR_SEL_PINFO_MAILS: return 283;
+        case CHAR_SEL_PINFO_BANS: return 284;
+        case CHAR_SEL_CHAR_HOMEBIND: return 285;
+        case CHAR_SEL_CHAR_GUID_NAME_BY_ACC: return 286;
+        case CHAR_SEL_POOL_QUEST_SAVE: return 287;
+        case CHAR_SEL_CHARACTER_AT_LOGIN: return 288;
+        case CHAR_SEL_CHAR_CLASS_LVL_AT_LOGIN: return 289;
+        case CHAR_SEL_CHAR_CUSTOMIZE_INFO: return 290;
+        case CHAR_SEL_CHAR_RACE_OR_FACTION_CHANGE_INFOS: return 291;
+        case CHAR_SEL_CHAR_AT_LOGIN_TITLES_MONEY: return 292;
+        case CHAR_SEL_CHAR_COD_ITEM_MAIL: return 293;
+        case CHAR_SEL_CHAR_SOCIAL: return 294;
+        case CHAR_SEL_CHAR_OLD_CHARS: return 295;
+        case CHAR_SEL_ARENA_TEAM_ID_BY_PLAYER_GUID: return 296;
+        case CHAR_SEL_MAIL: return 297;
+        case CHAR_SEL_NEXT_MAIL_DELIVERYTIME: return 298;
+        case CHAR_DEL_CHAR_AURA_FROZEN: return 299;
+        case CHAR_SEL_CHAR_INVENTORY_COUNT_ITEM: return 300;
+        case CHAR_SEL_MAIL_COUNT_ITEM: return 301;
+        case CHAR_SEL_AUCTIONHOUSE_COUNT_ITEM: return 302;
+        case CHAR_SEL_GUILD_BANK_COUNT_ITEM: return 303;
+        case CHAR_SEL_CHAR_INVENTORY_ITEM_BY_ENTRY: return 304;
+        case CHAR_SEL_CHAR_INVENTORY_ITEM_BY_ENTRY_AND_OWNER: return 305;
+        case CHAR_SEL_MAIL_ITEMS_BY_ENTRY: return 306;
+        case CHAR_SEL_AUCTIONHOUSE_ITEM_BY_ENTRY: return 307;
+        case CHAR_SEL_GUILD_BANK_ITEM_BY_ENTRY: return 308;
+        case CHAR_DEL_CHAR_ACHIEVEMENT: return 309;
+        case CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS: return 310;
+        case CHAR_INS_CHAR_ACHIEVEMENT: return 311;
+        case CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA: return 312;
+        case CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS: return 313;
+        case CHAR_INS_CHAR_ACHIEVEMENT_OFFLINE_UPDATES: return 314;
+        case CHAR_SEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES: return 315;
+        case CHAR_DEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES: return 316;
+        case CHAR_DEL_CHAR_REPUTATION_BY_FACTION: return 317;
+        case CHAR_INS_CHAR_REPUTATION_BY_FACTION: return 318;
+        case CHAR_UPD_CHAR_ARENA_POINTS: return 319;
+        case CHAR_DEL_ITEM_REFUND_INSTANCE: return 320;
+        case CHAR_INS_ITEM_REFUND_INSTANCE: return 321;
+        case CHAR_DEL_GROUP: return 322;
+        case CHAR_DEL_GROUP_MEMBER_ALL: return 323;
+        case CHAR_INS_CHAR_GIFT: return 324;
+        case CHAR_DEL_INSTANCE_BY_INSTANCE: return 325;
+        case CHAR_DEL_MAIL_ITEM_BY_ID: return 326;
+        case CHAR_INS_PETITION: return 327;
+        case CHAR_DEL_PETITION_BY_GUID: return 328;
+        case CHAR_DEL_PETITION_SIGNATURE_BY_GUID: return 329;
+        case CHAR_DEL_CHAR_DECLINED_NAME: return 330;
+        case CHAR_INS_CHAR_DECLINED_NAME: return 331;
+        case CHAR_UPD_CHAR_RACE: return 332;
+        case CHAR_DEL_CHAR_SKILL_LANGUAGES: return 333;
+        case CHAR_INS_CHAR_SKILL_LANGUAGE: return 334;
+        case CHAR_UPD_CHAR_TAXI_PATH: return 335;
+        case CHAR_UPD_CHAR_TAXIMASK: return 336;
+        case CHAR_DEL_CHAR_QUESTSTATUS: return 337;
+        case CHAR_DEL_CHAR_SOCIAL_BY_GUID: return 338;
+        case CHAR_DEL_CHAR_SOCIAL_BY_FRIEND: return 339;
+        case CHAR_DEL_CHAR_ACHIEVEMENT_BY_ACHIEVEMENT: return 340;
+        case CHAR_UPD_CHAR_ACHIEVEMENT: return 341;
+        case CHAR_UPD_CHAR_INVENTORY_FACTION_CHANGE: return 342;
+        case CHAR_DEL_CHAR_SPELL_BY_SPELL: return 343;
+        case CHAR_UPD_CHAR_SPELL_FACTION_CHANGE: return 344;
+        case CHAR_SEL_CHAR_REP_BY_FACTION: return 345;
+        case CHAR_DEL_CHAR_REP_BY_FACTION: return 346;
+        case CHAR_UPD_CHAR_REP_FACTION_CHANGE: return 347;
+        case CHAR_UPD_CHAR_TITLES_FACTION_CHANGE: return 348;
+        case CHAR_RES_CHAR_TITLES_FACTION_CHANGE: return 349;
+        case CHAR_DEL_CHAR_SPELL_COOLDOWN: return 350;
+        case CHAR_DEL_CHARACTER: return 351;
+        case CHAR_DEL_CHAR_ACTION: return 352;
+        case CHAR_DEL_CHAR_AURA: return 353;
+        case CHAR_DEL_CHAR_GIFT: return 354;
+        case CHAR_DEL_CHAR_INSTANCE: return 355;
+        case CHAR_DEL_CHAR_INVENTORY: return 356;
+        case CHAR_DEL_CHAR_QUESTSTATUS_REWARDED: return 357;
+        case CHAR_DEL_CHAR_REPUTATION: return 358;
+        case CHAR_DEL_CHAR_SPELL: return 359;
+        case CHAR_DEL_MAIL: return 360;
+        case CHAR_DEL_MAIL_ITEMS: return 361;
+        case CHAR_DEL_CHAR_ACHIEVEMENTS: return 362;
+        case CHAR_DEL_CHAR_EQUIPMENTSETS: return 363;
+        case CHAR_DEL_GUILD_EVENTLOG_BY_PLAYER: return 364;
+        case CHAR_DEL_GUILD_BANK_EVENTLOG_BY_PLAYER: return 365;
+        case CHAR_DEL_CHAR_GLYPHS: return 366;
+        case CHAR_DEL_CHAR_TALENT: return 367;
+        case CHAR_DEL_CHAR_SKILLS: return 368;
+        case CHAR_UDP_CHAR_HONOR_POINTS: return 369;
+        case CHAR_UDP_CHAR_HONOR_POINTS_ACCUMULATIVE: return 370;
+        case CHAR_UDP_CHAR_ARENA_POINTS: return 371;
+        case CHAR_UDP_CHAR_ARENA_POINTS_ACCUMULATIVE: return 372;
+        case CHAR_UDP_CHAR_MONEY: return 373;
+        case CHAR_UDP_CHAR_MONEY_ACCUMULATIVE: return 374;
+        case CHAR_UPD_CHAR_REMOVE_GHOST: return 375;
+        case CHAR_INS_CHAR_ACTION: return 376;
+        case CHAR_UPD_CHAR_ACTION: return 377;
+        case CHAR_DEL_CHAR_ACTION_BY_BUTTON_SPEC: return 378;
+        case CHAR_DEL_CHAR_INVENTORY_BY_ITEM: return 379;
+        case CHAR_DEL_CHAR_INVENTORY_BY_BAG_SLOT: return 380;
+        case CHAR_UPD_MAIL: return 381;
+        case CHAR_REP_CHAR_QUESTSTATUS: return 382;
+        case CHAR_DEL_CHAR_QUESTSTATUS_BY_QUEST: return 383;
+        case CHAR_INS_CHAR_QUESTSTATUS_REWARDED: return 384;
+        case CHAR_DEL_CHAR_QUESTSTATUS_REWARDED_BY_QUEST: return 385;
+        case CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_FACTION_CHANGE: return 386;
+        case CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_ACTIVE: return 387;
+        case CHAR_UPD_CHAR_QUESTSTATUS_REWARDED_ACTIVE_BY_QUEST: return 388;
+        case CHAR_DEL_CHAR_SKILL_BY_SKILL: return 389;
+        case CHAR_INS_CHAR_SKILLS: return 390;
+        case CHAR_UDP_CHAR_SKILLS: return 391;
+        case CHAR_INS_CHAR_SPELL: return 392;
+        case CHAR_DEL_CHAR_STATS: return 393;
+        case CHAR_INS_CHAR_STATS: return 394;
+        case CHAR_SEL_CHAR_STATS: return 395;
+        case CHAR_DEL_PETITION_BY_OWNER: return 396;
+        case CHAR_DEL_PETITION_SIGNATURE_BY_OWNER: return 397;
+        case CHAR_DEL_PETITION_BY_OWNER_AND_TYPE: return 398;
+        case CHAR_DEL_PETITION_SIGNATURE_BY_OWNER_AND_TYPE: return 399;
+        case CHAR_INS_CHAR_GLYPHS: return 400;
+        case CHAR_DEL_CHAR_TALENT_BY_SPELL: return 401;
+        case CHAR_INS_CHAR_TALENT: return 402;
+        case CHAR_DEL_CHAR_ACTION_EXCEPT_SPEC: return 403;
+        case CHAR_REP_CALENDAR_EVENT: return 404;
+        case CHAR_DEL_CALENDAR_EVENT: return 405;
+        case CHAR_REP_CALENDAR_INVITE: return 406;
+        case CHAR_DEL_CALENDAR_INVITE: return 407;
+        case CHAR_SEL_PET_AURA: return 408;
+        case CHAR_SEL_PET_SPELL: return 409;
+        case CHAR_SEL_PET_SPELL_COOLDOWN: return 410;
+        case CHAR_DEL_PET_AURAS: return 411;
+        case CHAR_DEL_PET_SPELL_COOLDOWNS: return 412;
+        case CHAR_INS_PET_SPELL_COOLDOWN: return 413;
+        case CHAR_DEL_PET_SPELL_BY_SPELL: return 414;
+        case CHAR_INS_PET_SPELL: return 415;
+        case CHAR_INS_PET_AURA: return 416;
+        case CHAR_DEL_PET_SPELLS: return 417;
+        case CHAR_DEL_CHAR_PET_BY_OWNER: return 418;
+        case CHAR_DEL_CHAR_PET_DECLINEDNAME_BY_OWNER: return 419;
+        case CHAR_SEL_CHAR_PETS: return 420;
+        case CHAR_SEL_CHAR_PET_IDS: return 421;
+        case CHAR_DEL_CHAR_PET_DECLINEDNAME: return 422;
+        case CHAR_ADD_CHAR_PET_DECLINEDNAME: return 423;
+        case CHAR_SEL_PET_DECLINED_NAME: return 424;
+        case CHAR_UPD_CHAR_PET_NAME: return 425;
+        case CHAR_UPD_CHAR_PET_SLOT_BY_ID: return 426;
+        case CHAR_DEL_CHAR_PET_BY_ID: return 427;
+        case CHAR_DEL_CHAR_PET_BY_SLOT: return 428;
+        case CHAR_REP_CHAR_PET: return 429;
+        case CHAR_SEL_ITEMCONTAINER_ITEMS: return 430;
+        case CHAR_DEL_ITEMCONTAINER_SINGLE_ITEM: return 431;
+        case CHAR_INS_ITEMCONTAINER_SINGLE_ITEM: return 432;
+        case CHAR_DEL_ITEMCONTAINER_CONTAINER: return 433;
+        case CHAR_SEL_PVPSTATS_MAXID: return 434;
+        case CHAR_INS_PVPSTATS_BATTLEGROUND: return 435;
+        case CHAR_INS_PVPSTATS_PLAYER: return 436;
+        case CHAR_SEL_PVPSTATS_FACTIONS_OVERALL: return 437;
+        case CHAR_SEL_PVPSTATS_BRACKET_MONTH: return 438;
+        case CHAR_INS_DESERTER_TRACK: return 439;
+        case CHAR_INS_QUEST_TRACK: return 440;
+        case CHAR_UPD_QUEST_TRACK_GM_COMPLETE: return 441;
+        case CHAR_UPD_QUEST_TRACK_COMPLETE_TIME: return 442;
+        case CHAR_UPD_QUEST_TRACK_ABANDON_TIME: return 443;
+        case CHAR_INS_RECOVERY_ITEM: return 444;
+        case CHAR_SEL_RECOVERY_ITEM: return 445;
+        case CHAR_SEL_RECOVERY_ITEM_LIST: return 446;
+        case CHAR_DEL_RECOVERY_ITEM: return 447;
+        case CHAR_DEL_RECOVERY_ITEM_BY_RECOVERY_ID: return 448;
+        case CHAR_SEL_RECOVERY_ITEM_OLD_ITEMS: return 449;
+        case CHAR_DEL_RECOVERY_ITEM_BY_GUID: return 450;
+        case CHAR_SEL_HONORPOINTS: return 451;
+        case CHAR_SEL_ARENAPOINTS: return 452;
+        case CHAR_INS_RESERVED_PLAYER_NAME: return 453;
+        case CHAR_INS_PROFANITY_PLAYER_NAME: return 454;
+        case CHAR_SEL_CHAR_SETTINGS: return 455;
+        case CHAR_REP_CHAR_SETTINGS: return 456;
+        case CHAR_DEL_CHAR_SETTINGS: return 457;
+        case CHAR_SELECT_INSTANCE_SAVED_DATA: return 458;
+        case CHAR_INSERT_INSTANCE_SAVED_DATA: return 459;
+        case CHAR_DELETE_INSTANCE_SAVED_DATA: return 460;
+        case CHAR_SANITIZE_INSTANCE_SAVED_DATA: return 461;
+        default: throw std::out_of_range("value");
+    }
+}
+}
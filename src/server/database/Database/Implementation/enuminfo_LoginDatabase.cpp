@@ -0,0 +1,328 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoginDatabase.h"
+#include "Define.h"
+#include "SmartEnum.h"
+#include <stdexcept>
+
+namespace Acore::Impl::EnumUtilsImpl
+{
+
+/*******************************************************************************\
+|* data for enum 'LoginDatabaseStatements' in 'LoginDatabase.h' auto-generated *|
+\*******************************************************************************/
+template <>
+AC_API_EXPORT EnumText EnumUtils<LoginDatabaseStatements>::ToString(LoginDatabaseStatements value)
+{
+    switch (value)
+    {
+        case LOGIN_SEL_REALMLIST: return { "LOGIN_SEL_REALMLIST", "LOGIN_SEL_REALMLIST", "" };
+        case LOGIN_DEL_EXPIRED_IP_BANS: return { "LOGIN_DEL_EXPIRED_IP_BANS", "LOGIN_DEL_EXPIRED_IP_BANS", "" };
+        case LOGIN_UPD_EXPIRED_ACCOUNT_BANS: return { "LOGIN_UPD_EXPIRED_ACCOUNT_BANS", "LOGIN_UPD_EXPIRED_ACCOUNT_BANS", "" };
+        case LOGIN_SEL_IP_INFO: return { "LOGIN_SEL_IP_INFO", "LOGIN_SEL_IP_INFO", "" };
+        case LOGIN_SEL_IP_BANNED: return { "LOGIN_SEL_IP_BANNED", "LOGIN_SEL_IP_BANNED", "" };
+        case LOGIN_INS_IP_AUTO_BANNED: return { "LOGIN_INS_IP_AUTO_BANNED", "LOGIN_INS_IP_AUTO_BANNED", "" };
+        case LOGIN_SEL_ACCOUNT_BANNED: return { "LOGIN_SEL_ACCOUNT_BANNED", "LOGIN_SEL_ACCOUNT_BANNED", "" };
+        case LOGIN_SEL_ACCOUNT_BANNED_ALL: return { "LOGIN_SEL_ACCOUNT_BANNED_ALL", "LOGIN_SEL_ACCOUNT_BANNED_ALL", "" };
+        case LOGIN_SEL_ACCOUNT_BANNED_BY_USERNAME: return { "LOGIN_SEL_ACCOUNT_BANNED_BY_USERNAME", "LOGIN_SEL_ACCOUNT_BANNED_BY_USERNAME", "" };
+        case LOGIN_INS_ACCOUNT_AUTO_BANNED: return { "LOGIN_INS_ACCOUNT_AUTO_BANNED", "LOGIN_INS_ACCOUNT_AUTO_BANNED", "" };
+        case LOGIN_DEL_ACCOUNT_BANNED: return { "LOGIN_DEL_ACCOUNT_BANNED", "LOGIN_DEL_ACCOUNT_BANNED", "" };
+        case LOGIN_UPD_LOGON: return { "LOGIN_UPD_LOGON", "LOGIN_UPD_LOGON", "" };
+        case LOGIN_UPD_LOGONPROOF: return { "LOGIN_UPD_LOGONPROOF", "LOGIN_UPD_LOGONPROOF", "" };
+        case LOGIN_SEL_LOGONCHALLENGE: return { "LOGIN_SEL_LOGONCHALLENGE", "LOGIN_SEL_LOGONCHALLENGE", "" };
+        case LOGIN_SEL_RECONNECTCHALLENGE: return { "LOGIN_SEL_RECONNECTCHALLENGE", "LOGIN_SEL_RECONNECTCHALLENGE", "" };
+        case LOGIN_UPD_FAILEDLOGINS: return { "LOGIN_UPD_FAILEDLOGINS", "LOGIN_UPD_FAILEDLOGINS", "" };
+        case LOGIN_SEL_FAILEDLOGINS: return { "LOGIN_SEL_FAILEDLOGINS", "LOGIN_SEL_FAILEDLOGINS", "" };
+        case LOGIN_SEL_ACCOUNT_ID_BY_NAME: return { "LOGIN_SEL_ACCOUNT_ID_BY_NAME", "LOGIN_SEL_ACCOUNT_ID_BY_NAME", "" };
+        case LOGIN_SEL_ACCOUNT_LIST_BY_NAME: return { "LOGIN_SEL_ACCOUNT_LIST_BY_NAME", "LOGIN_SEL_ACCOUNT_LIST_BY_NAME", "" };
+        case LOGIN_SEL_ACCOUNT_INFO_BY_NAME: return { "LOGIN_SEL_ACCOUNT_INFO_BY_NAME", "LOGIN_SEL_ACCOUNT_INFO_BY_NAME", "" };
+        case LOGIN_SEL_ACCOUNT_LIST_BY_EMAIL: return { "LOGIN_SEL_ACCOUNT_LIST_BY_EMAIL", "LOGIN_SEL_ACCOUNT_LIST_BY_EMAIL", "" };
+        case LOGIN_SEL_NUM_CHARS_ON_REALM: return { "LOGIN_SEL_NUM_CHARS_ON_REALM", "LOGIN_SEL_NUM_CHARS_ON_REALM", "" };
+        case LOGIN_SEL_REALM_CHARACTER_COUNTS: return { "LOGIN_SEL_REALM_CHARACTER_COUNTS", "LOGIN_SEL_REALM_CHARACTER_COUNTS", "" };
+        case LOGIN_SEL_ACCOUNT_BY_IP: return { "LOGIN_SEL_ACCOUNT_BY_IP", "LOGIN_SEL_ACCOUNT_BY_IP", "" };
+        case LOGIN_INS_IP_BANNED: return { "LOGIN_INS_IP_BANNED", "LOGIN_INS_IP_BANNED", "" };
+        case LOGIN_DEL_IP_NOT_BANNED: return { "LOGIN_DEL_IP_NOT_BANNED", "LOGIN_DEL_IP_NOT_BANNED", "" };
+        case LOGIN_SEL_IP_BANNED_ALL: return { "LOGIN_SEL_IP_BANNED_ALL", "LOGIN_SEL_IP_BANNED_ALL", "" };
+        case LOGIN_SEL_IP_BANNED_BY_IP: return { "LOGIN_SEL_IP_BANNED_BY_IP", "LOGIN_SEL_IP_BANNED_BY_IP", "" };
+        case LOGIN_SEL_ACCOUNT_BY_ID: return { "LOGIN_SEL_ACCOUNT_BY_ID", "LOGIN_SEL_ACCOUNT_BY_ID", "" };
+        case LOGIN_INS_ACCOUNT_BANNED: return { "LOGIN_INS_ACCOUNT_BANNED", "LOGIN_INS_ACCOUNT_BANNED", "" };
+        case LOGIN_UPD_ACCOUNT_NOT_BANNED: return { "LOGIN_UPD_ACCOUNT_NOT_BANNED", "LOGIN_UPD_ACCOUNT_NOT_BANNED", "" };
+        case LOGIN_DEL_REALM_CHARACTERS: return { "LOGIN_DEL_REALM_CHARACTERS", "LOGIN_DEL_REALM_CHARACTERS", "" };
+        case LOGIN_REP_REALM_CHARACTERS: return { "LOGIN_REP_REALM_CHARACTERS", "LOGIN_REP_REALM_CHARACTERS", "" };
+        case LOGIN_SEL_SUM_REALM_CHARACTERS: return { "LOGIN_SEL_SUM_REALM_CHARACTERS", "LOGIN_SEL_SUM_REALM_CHARACTERS", "" };
+        case LOGIN_INS_ACCOUNT: return { "LOGIN_INS_ACCOUNT", "LOGIN_INS_ACCOUNT", "" };
+        case LOGIN_INS_REALM_CHARACTERS_INIT: return { "LOGIN_INS_REALM_CHARACTERS_INIT", "LOGIN_INS_REALM_CHARACTERS_INIT", "" };
+        case LOGIN_UPD_EXPANSION: return { "LOGIN_UPD_EXPANSION", "LOGIN_UPD_EXPANSION", "" };
+        case LOGIN_UPD_ACCOUNT_LOCK: return { "LOGIN_UPD_ACCOUNT_LOCK", "LOGIN_UPD_ACCOUNT_LOCK", "" };
+        case LOGIN_UPD_ACCOUNT_LOCK_COUNTRY: return { "LOGIN_UPD_ACCOUNT_LOCK_COUNTRY", "LOGIN_UPD_ACCOUNT_LOCK_COUNTRY", "" };
+        case LOGIN_UPD_EMAIL: return { "LOGIN_UPD_EMAIL", "LOGIN_UPD_EMAIL", "" };
+        case LOGIN_UPD_USERNAME: return { "LOGIN_UPD_USERNAME", "LOGIN_UPD_USERNAME", "" };
+        case LOGIN_UPD_MUTE_TIME: return { "LOGIN_UPD_MUTE_TIME", "LOGIN_UPD_MUTE_TIME", "" };
+        case LOGIN_UPD_MUTE_TIME_LOGIN: return { "LOGIN_UPD_MUTE_TIME_LOGIN", "LOGIN_UPD_MUTE_TIME_LOGIN", "" };
+        case LOGIN_UPD_LAST_IP: return { "LOGIN_UPD_LAST_IP", "LOGIN_UPD_LAST_IP", "" };
+        case LOGIN_UPD_LAST_ATTEMPT_IP: return { "LOGIN_UPD_LAST_ATTEMPT_IP", "LOGIN_UPD_LAST_ATTEMPT_IP", "" };
+        case LOGIN_UPD_ACCOUNT_ONLINE: return { "LOGIN_UPD_ACCOUNT_ONLINE", "LOGIN_UPD_ACCOUNT_ONLINE", "" };
+        case LOGIN_UPD_UPTIME_PLAYERS: return { "LOGIN_UPD_UPTIME_PLAYERS", "LOGIN_UPD_UPTIME_PLAYERS", "" };
+        case LOGIN_DEL_OLD_LOGS: return { "LOGIN_DEL_OLD_LOGS", "LOGIN_DEL_OLD_LOGS", "" };
+        case LOGIN_DEL_ACCOUNT_ACCESS: return { "LOGIN_DEL_ACCOUNT_ACCESS", "LOGIN_DEL_ACCOUNT_ACCESS", "" };
+        case LOGIN_DEL_ACCOUNT_ACCESS_BY_REALM: return { "LOGIN_DEL_ACCOUNT_ACCESS_BY_REALM", "LOGIN_DEL_ACCOUNT_ACCESS_BY_REALM", "" };
+        case LOGIN_INS_ACCOUNT_ACCESS: return { "LOGIN_INS_ACCOUNT_ACCESS", "LOGIN_INS_ACCOUNT_ACCESS", "" };
+        case LOGIN_GET_ACCOUNT_ID_BY_USERNAME: return { "LOGIN_GET_ACCOUNT_ID_BY_USERNAME", "LOGIN_GET_ACCOUNT_ID_BY_USERNAME", "" };
+        case LOGIN_GET_ACCOUNT_ACCESS_GMLEVEL: return { "LOGIN_GET_ACCOUNT_ACCESS_GMLEVEL", "LOGIN_GET_ACCOUNT_ACCESS_GMLEVEL", "" };
+        case LOGIN_GET_GMLEVEL_BY_REALMID: return { "LOGIN_GET_GMLEVEL_BY_REALMID", "LOGIN_GET_GMLEVEL_BY_REALMID", "" };
+        case LOGIN_GET_USERNAME_BY_ID: return { "LOGIN_GET_USERNAME_BY_ID", "LOGIN_GET_USERNAME_BY_ID", "" };
+        case LOGIN_SEL_CHECK_PASSWORD: return { "LOGIN_SEL_CHECK_PASSWORD", "LOGIN_SEL_CHECK_PASSWORD", "" };
+        case LOGIN_SEL_CHECK_PASSWORD_BY_NAME: return { "LOGIN_SEL_CHECK_PASSWORD_BY_NAME", "LOGIN_SEL_CHECK_PASSWORD_BY_NAME", "" };
+        case LOGIN_SEL_PINFO: return { "LOGIN_SEL_PINFO", "LOGIN_SEL_PINFO", "" };
+        case LOGIN_SEL_PINFO_BANS: return { "LOGIN_SEL_PINFO_BANS", "LOGIN_SEL_PINFO_BANS", "" };
+        case LOGIN_SEL_GM_ACCOUNTS: return { "LOGIN_SEL_GM_ACCOUNTS", "LOGIN_SEL_GM_ACCOUNTS", "" };
+        case LOGIN_SEL_ACCOUNT_INFO: return { "LOGIN_SEL_ACCOUNT_INFO", "LOGIN_SEL_ACCOUNT_INFO", "" };
+        case LOGIN_SEL_ACCOUNT_ACCESS_GMLEVEL_TEST: return { "LOGIN_SEL_ACCOUNT_ACCESS_GMLEVEL_TEST", "LOGIN_SEL_ACCOUNT_ACCESS_GMLEVEL_TEST", "" };
+        case LOGIN_SEL_ACCOUNT_ACCESS: return { "LOGIN_SEL_ACCOUNT_ACCESS", "LOGIN_SEL_ACCOUNT_ACCESS", "" };
+        case LOGIN_SEL_ACCOUNT_RECRUITER: return { "LOGIN_SEL_ACCOUNT_RECRUITER", "LOGIN_SEL_ACCOUNT_RECRUITER", "" };
+        case LOGIN_SEL_BANS: return { "LOGIN_SEL_BANS", "LOGIN_SEL_BANS", "" };
+        case LOGIN_SEL_ACCOUNT_WHOIS: return { "LOGIN_SEL_ACCOUNT_WHOIS", "LOGIN_SEL_ACCOUNT_WHOIS", "" };
+        case LOGIN_SEL_REALMLIST_SECURITY_LEVEL: return { "LOGIN_SEL_REALMLIST_SECURITY_LEVEL", "LOGIN_SEL_REALMLIST_SECURITY_LEVEL", "" };
+        case LOGIN_DEL_ACCOUNT: return { "LOGIN_DEL_ACCOUNT", "LOGIN_DEL_ACCOUNT", "" };
+        case LOGIN_SEL_AUTOBROADCAST: return { "LOGIN_SEL_AUTOBROADCAST", "LOGIN_SEL_AUTOBROADCAST", "" };
+        case LOGIN_SEL_AUTOBROADCAST_LOCALIZED: return { "LOGIN_SEL_AUTOBROADCAST_LOCALIZED", "LOGIN_SEL_AUTOBROADCAST_LOCALIZED", "" };
+        case LOGIN_SEL_MOTD: return { "LOGIN_SEL_MOTD", "LOGIN_SEL_MOTD", "" };
+        case LOGIN_SEL_MOTD_LOCALE: return { "LOGIN_SEL_MOTD_LOCALE", "LOGIN_SEL_MOTD_LOCALE", "" };
+        case LOGIN_REP_MOTD: return { "LOGIN_REP_MOTD", "LOGIN_REP_MOTD", "" };
+        case LOGIN_REP_MOTD_LOCALE: return { "LOGIN_REP_MOTD_LOCALE", "LOGIN_REP_MOTD_LOCALE", "" };
+        case LOGIN_SEL_LAST_ATTEMPT_IP: return { "LOGIN_SEL_LAST_ATTEMPT_IP", "LOGIN_SEL_LAST_ATTEMPT_IP", "" };
+        case LOGIN_SEL_LAST_IP: return { "LOGIN_SEL_LAST_IP", "LOGIN_SEL_LAST_IP", "" };
+        case LOGIN_INS_ALDL_IP_LOGGING: return { "LOGIN_INS_ALDL_IP_LOGGING", "LOGIN_INS_ALDL_IP_LOGGING", "" };
+        case LOGIN_INS_FACL_IP_LOGGING: return { "LOGIN_INS_FACL_IP_LOGGING", "LOGIN_INS_FACL_IP_LOGGING", "" };
+        case LOGIN_INS_CHAR_IP_LOGGING: return { "LOGIN_INS_CHAR_IP_LOGGING", "LOGIN_INS_CHAR_IP_LOGGING", "" };
+        case LOGIN_INS_FALP_IP_LOGGING: return { "LOGIN_INS_FALP_IP_LOGGING", "LOGIN_INS_FALP_IP_LOGGING", "" };
+        case LOGIN_INS_ACCOUNT_MUTE: return { "LOGIN_INS_ACCOUNT_MUTE", "LOGIN_INS_ACCOUNT_MUTE", "" };
+        case LOGIN_SEL_ACCOUNT_MUTE_INFO: return { "LOGIN_SEL_ACCOUNT_MUTE_INFO", "LOGIN_SEL_ACCOUNT_MUTE_INFO", "" };
+        case LOGIN_DEL_ACCOUNT_MUTED: return { "LOGIN_DEL_ACCOUNT_MUTED", "LOGIN_DEL_ACCOUNT_MUTED", "" };
+        case LOGIN_INS_LOG: return { "LOGIN_INS_LOG", "LOGIN_INS_LOG", "" };
+        case LOGIN_SEL_SECRET_DIGEST: return { "LOGIN_SEL_SECRET_DIGEST", "LOGIN_SEL_SECRET_DIGEST", "" };
+        case LOGIN_INS_SECRET_DIGEST: return { "LOGIN_INS_SECRET_DIGEST", "LOGIN_INS_SECRET_DIGEST", "" };
+        case LOGIN_DEL_SECRET_DIGEST: return { "LOGIN_DEL_SECRET_DIGEST", "LOGIN_DEL_SECRET_DIGEST", "" };
+        case LOGIN_SEL_ACCOUNT_TOTP_SECRET: return { "LOGIN_SEL_ACCOUNT_TOTP_SECRET", "LOGIN_SEL_ACCOUNT_TOTP_SECRET", "" };
+        case LOGIN_UPD_ACCOUNT_TOTP_SECRET: return { "LOGIN_UPD_ACCOUNT_TOTP_SECRET", "LOGIN_UPD_ACCOUNT_TOTP_SECRET", "" };
+        case LOGIN_INS_UPTIME: return { "LOGIN_INS_UPTIME", "LOGIN_INS_UPTIME", "" };
+        default: throw std::out_of_range("value");
+    }
+}
+
+template <>
+AC_API_EXPORT std::size_t EnumUtils<LoginDatabaseStatements>::Count() { return 90; }
+
+template <>
+AC_API_EXPORT LoginDatabaseStatements EnumUtils<LoginDatabaseStatements>::FromIndex(std::size_t index)
+{
+    switch (index)
+    {
+        case 0: return LOGIN_SEL_REALMLIST;
+        case 1: return LOGIN_DEL_EXPIRED_IP_BANS;
+        case 2: return LOGIN_UPD_EXPIRED_ACCOUNT_BANS;
+        case 3: return LOGIN_SEL_IP_INFO;
+        case 4: return LOGIN_SEL_IP_BANNED;
+        case 5: return LOGIN_INS_IP_AUTO_BANNED;
+        case 6: return LOGIN_SEL_ACCOUNT_BANNED;
+        case 7: return LOGIN_SEL_ACCOUNT_BANNED_ALL;
+        case 8: return LOGIN_SEL_ACCOUNT_BANNED_BY_USERNAME;
+        case 9: return LOGIN_INS_ACCOUNT_AUTO_BANNED;
+        case 10: return LOGIN_DEL_ACCOUNT_BANNED;
+        case 11: return LOGIN_UPD_LOGON;
+        case 12: return LOGIN_UPD_LOGONPROOF;
+        case 13: return LOGIN_SEL_LOGONCHALLENGE;
+        case 14: return LOGIN_SEL_RECONNECTCHALLENGE;
+        case 15: return LOGIN_UPD_FAILEDLOGINS;
+        case 16: return LOGIN_SEL_FAILEDLOGINS;
+        case 17: return LOGIN_SEL_ACCOUNT_ID_BY_NAME;
+        case 18: return LOGIN_SEL_ACCOUNT_LIST_BY_NAME;
+        case 19: return LOGIN_SEL_ACCOUNT_INFO_BY_NAME;
+        case 20: return LOGIN_SEL_ACCOUNT_LIST_BY_EMAIL;
+        case 21: return LOGIN_SEL_NUM_CHARS_ON_REALM;
+        case 22: return LOGIN_SEL_REALM_CHARACTER_COUNTS;
+        case 23: return LOGIN_SEL_ACCOUNT_BY_IP;
+        case 24: return LOGIN_INS_IP_BANNED;
+        case 25: return LOGIN_DEL_IP_NOT_BANNED;
+        case 26: return LOGIN_SEL_IP_BANNED_ALL;
+        case 27: return LOGIN_SEL_IP_BANNED_BY_IP;
+        case 28: return LOGIN_SEL_ACCOUNT_BY_ID;
+        case 29: return LOGIN_INS_ACCOUNT_BANNED;
+        case 30: return LOGIN_UPD_ACCOUNT_NOT_BANNED;
+        case 31: return LOGIN_DEL_REALM_CHARACTERS;
+        case 32: return LOGIN_REP_REALM_CHARACTERS;
+        case 33: return LOGIN_SEL_SUM_REALM_CHARACTERS;
+        case 34: return LOGIN_INS_ACCOUNT;
+        case 35: return LOGIN_INS_REALM_CHARACTERS_INIT;
+        case 36: return LOGIN_UPD_EXPANSION;
+        case 37: return LOGIN_UPD_ACCOUNT_LOCK;
+        case 38: return LOGIN_UPD_ACCOUNT_LOCK_COUNTRY;
+        case 39: return LOGIN_UPD_EMAIL;
+        case 40: return LOGIN_UPD_USERNAME;
+        case 41: return LOGIN_UPD_MUTE_TIME;
+        case 42: return LOGIN_UPD_MUTE_TIME_LOGIN;
+        case 43: return LOGIN_UPD_LAST_IP;
+        case 44: return LOGIN_UPD_LAST_ATTEMPT_IP;
+        case 45: return LOGIN_UPD_ACCOUNT_ONLINE;
+        case 46: return LOGIN_UPD_UPTIME_PLAYERS;
+        case 47: return LOGIN_DEL_OLD_LOGS;
+        case 48: return LOGIN_DEL_ACCOUNT_ACCESS;
+        case 49: return LOGIN_DEL_ACCOUNT_ACCESS_BY_REALM;
+        case 50: return LOGIN_INS_ACCOUNT_ACCESS;
+        case 51: return LOGIN_GET_ACCOUNT_ID_BY_USERNAME;
+        case 52: return LOGIN_GET_ACCOUNT_ACCESS_GMLEVEL;
+        case 53: return LOGIN_GET_GMLEVEL_BY_REALMID;
+        case 54: return LOGIN_GET_USERNAME_BY_ID;
+        case 55: return LOGIN_SEL_CHECK_PASSWORD;
+        case 56: return LOGIN_SEL_CHECK_PASSWORD_BY_NAME;
+        case 57: return LOGIN_SEL_PINFO;
+        case 58: return LOGIN_SEL_PINFO_BANS;
+        case 59: return LOGIN_SEL_GM_ACCOUNTS;
+        case 60: return LOGIN_SEL_ACCOUNT_INFO;
+        case 61: return LOGIN_SEL_ACCOUNT_ACCESS_GMLEVEL_TEST;
+        case 62: return LOGIN_SEL_ACCOUNT_ACCESS;
+        case 63: return LOGIN_SEL_ACCOUNT_RECRUITER;
+        case 64: return LOGIN_SEL_BANS;
+        case 65: return LOGIN_SEL_ACCOUNT_WHOIS;
+        case 66: return LOGIN_SEL_REALMLIST_SECURITY_LEVEL;
+        case 67: return LOGIN_DEL_ACCOUNT;
+        case 68: return LOGIN_SEL_AUTOBROADCAST;
+        case 69: return LOGIN_SEL_AUTOBROADCAST_LOCALIZED;
+        case 70: return LOGIN_SEL_MOTD;
+        case 71: return LOGIN_SEL_MOTD_LOCALE;
+        case 72: return LOGIN_REP_MOTD;
+        case 73: return LOGIN_REP_MOTD_LOCALE;
+        case 74: return LOGIN_SEL_LAST_ATTEMPT_IP;
+        case 75: return LOGIN_SEL_LAST_IP;
+        case 76: return LOGIN_INS_ALDL_IP_LOGGING;
+        case 77: return LOGIN_INS_FACL_IP_LOGGING;
+        case 78: return LOGIN_INS_CHAR_IP_LOGGING;
+        case 79: return LOGIN_INS_FALP_IP_LOGGING;
+        case 80: return LOGIN_INS_ACCOUNT_MUTE;
+        case 81: return LOGIN_SEL_ACCOUNT_MUTE_INFO;
+        case 82: return LOGIN_DEL_ACCOUNT_MUTED;
+        case 83: return LOGIN_INS_LOG;
+        case 84: return LOGIN_SEL_SECRET_DIGEST;
+        case 85: return LOGIN_INS_SECRET_DIGEST;
+        case 86: return LOGIN_DEL_SECRET_DIGEST;
+        case 87: return LOGIN_SEL_ACCOUNT_TOTP_SECRET;
+        case 88: return LOGIN_UPD_ACCOUNT_TOTP_SECRET;
+        case 89: return LOGIN_INS_UPTIME;
+        default: throw std::out_of_range("index");
+    }
+}
+
+template <>
+AC_API_EXPORT std::size_t EnumUtils<LoginDatabaseStatements>::ToIndex(LoginDatabaseStatements value)
+{
+    switch (value)
+    {
+        case LOGIN_SEL_REALMLIST: return 0;
+        case LOGIN_DEL_EXPIRED_IP_BANS: return 1;
+        case LOGIN_UPD_EXPIRED_ACCOUNT_BANS: return 2;
+        case LOGIN_SEL_IP_INFO: return 3;
+        case LOGIN_SEL_IP_BANNED: return 4;
+        case LOGIN_INS_IP_AUTO_BANNED: return 5;
+        case LOGIN_SEL_ACCOUNT_BANNED: return 6;
+        case LOGIN_SEL_ACCOUNT_BANNED_ALL: return 7;
+        case LOGIN_SEL_ACCOUNT_BANNED_BY_USERNAME: return 8;
+        case LOGIN_INS_ACCOUNT_AUTO_BANNED: return 9;
+        case LOGIN_DEL_ACCOUNT_BANNED: return 10;
+        case LOGIN_UPD_LOGON: return 11;
+        case LOGIN_UPD_LOGONPROOF: return 12;
+        case LOGIN_SEL_LOGONCHALLENGE: return 13;
+        case LOGIN_SEL_RECONNECTCHALLENGE: return 14;
+        case LOGIN_UPD_FAILEDLOGINS: return 15;
+        case LOGIN_SEL_FAILEDLOGINS: return 16;
+        case LOGIN_SEL_ACCOUNT_ID_BY_NAME: return 17;
+        case LOGIN_SEL_ACCOUNT_LIST_BY_NAME: return 18;
+        case LOGIN_SEL_ACCOUNT_INFO_BY_NAME: return 19;
+        case LOGIN_SEL_ACCOUNT_LIST_BY_EMAIL: return 20;
+        case LOGIN_SEL_NUM_CHARS_ON_REALM: return 21;
+        case LOGIN_SEL_REALM_CHARACTER_COUNTS: return 22;
+        case LOGIN_SEL_ACCOUNT_BY_IP: return 23;
+        case LOGIN_INS_IP_BANNED: return 24;
+        case LOGIN_DEL_IP_NOT_BANNED: return 25;
+        case LOGIN_SEL_IP_BANNED_ALL: return 26;
+        case LOGIN_SEL_IP_BANNED_BY_IP: return 27;
+        case LOGIN_SEL_ACCOUNT_BY_ID: return 28;
+        case LOGIN_INS_ACCOUNT_BANNED: return 29;
+        case LOGIN_UPD_ACCOUNT_NOT_BANNED: return 30;
+        case LOGIN_DEL_REALM_CHARACTERS: return 31;
+        case LOGIN_REP_REALM_CHARACTERS: return 32;
+        case LOGIN_SEL_SUM_REALM_CHARACTERS: return 33;
+        case LOGIN_INS_ACCOUNT: return 34;
+        case LOGIN_INS_REALM_CHARACTERS_INIT: return 35;
+        case LOGIN_UPD_EXPANSION: return 36;
+        case LOGIN_UPD_ACCOUNT_LOCK: return 37;
+        case LOGIN_UPD_ACCOUNT_LOCK_COUNTRY: return 38;
+        case LOGIN_UPD_EMAIL: return 39;
+        case LOGIN_UPD_USERNAME: return 40;
+        case LOGIN_UPD_MUTE_TIME: return 41;
+        case LOGIN_UPD_MUTE_TIME_LOGIN: return 42;
+        case LOGIN_UPD_LAST_IP: return 43;
+        case LOGIN_UPD_LAST_ATTEMPT_IP: return 44;
+        case LOGIN_UPD_ACCOUNT_ONLINE: return 45;
+        case LOGIN_UPD_UPTIME_PLAYERS: return 46;
+        case LOGIN_DEL_OLD_LOGS: return 47;
+        case LOGIN_DEL_ACCOUNT_ACCESS: return 48;
+        case LOGIN_DEL_ACCOUNT_ACCESS_BY_REALM: return 49;
+        case LOGIN_INS_ACCOUNT_ACCESS: return 50;
+        case LOGIN_GET_ACCOUNT_ID_BY_USERNAME: return 51;
+        case LOGIN_GET_ACCOUNT_ACCESS_GMLEVEL: return 52;
+        case LOGIN_GET_GMLEVEL_BY_REALMID: return 53;
+        case LOGIN_GET_USERNAME_BY_ID: return 54;
+        case LOGIN_SEL_CHECK_PASSWORD: return 55;
+        case LOGIN_SEL_CHECK_PASSWORD_BY_NAME: return 56;
+        case LOGIN_SEL_PINFO: return 57;
+        case LOGIN_SEL_PINFO_BANS: return 58;
+        case LOGIN_SEL_GM_ACCOUNTS: return 59;
+        case LOGIN_SEL_ACCOUNT_INFO: return 60;
+        case LOGIN_SEL_ACCOUNT_ACCESS_GMLEVEL_TEST: return 61;
+        case LOGIN_SEL_ACCOUNT_ACCESS: return 62;
+        case LOGIN_SEL_ACCOUNT_RECRUITER: return 63;
+        case LOGIN_SEL_BANS: return 64;
+        case LOGIN_SEL_ACCOUNT_WHOIS: return 65;
+        case LOGIN_SEL_REALMLIST_SECURITY_LEVEL: return 66;
+        case LOGIN_DEL_ACCOUNT: return 67;
+        case LOGIN_SEL_AUTOBROADCAST: return 68;
+        case LOGIN_SEL_AUTOBROADCAST_LOCALIZED: return 69;
+        case LOGIN_SEL_MOTD: return 70;
+        case LOGIN_SEL_MOTD_LOCALE: return 71;
+        case LOGIN_REP_MOTD: return 72;
+        case LOGIN_REP_MOTD_LOCALE: return 73;
+        case LOGIN_SEL_LAST_ATTEMPT_IP: return 74;
+        case LOGIN_SEL_LAST_IP: return 75;
+        case LOGIN_INS_ALDL_IP_LOGGING: return 76;
+        case LOGIN_INS_FACL_IP_LOGGING: return 77;
+        case LOGIN_INS_CHAR_IP_LOGGING: return 78;
+        case LOGIN_INS_FALP_IP_LOGGING: return 79;
+        case LOGIN_INS_ACCOUNT_MUTE: return 80;
+        case LOGIN_SEL_ACCOUNT_MUTE_INFO: return 81;
+        case LOGIN_DEL_ACCOUNT_MUTED: return 82;
+        case LOGIN_INS_LOG: return 83;
+        case LOGIN_SEL_SECRET_DIGEST: return 84;
+        case LOGIN_INS_SECRET_DIGEST: return 85;
+        case LOGIN_DEL_SECRET_DIGEST: return 86;
+        case LOGIN_SEL_ACCOUNT_TOTP_SECRET: return 87;
+        case LOGIN_UPD_ACCOUNT_TOTP_SECRET: return 88;
+        case LOGIN_INS_UPTIME: return 89;
+        default: throw std::out_of_range("value");
+    }
+}
+}
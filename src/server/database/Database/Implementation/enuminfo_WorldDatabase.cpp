@@ -0,0 +1,325 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldDatabase.h"
+#include "Define.h"
+#include "SmartEnum.h"
+#include <stdexcept>
+
+namespace Acore::Impl::EnumUtilsImpl
+{
+
+/*******************************************************************************\
+|* data for enum 'WorldDatabaseStatements' in 'WorldDatabase.h' auto-generated *|
+\*******************************************************************************/
+template <>
+AC_API_EXPORT EnumText EnumUtils<WorldDatabaseStatements>::ToString(WorldDatabaseStatements value)
+{
+    switch (value)
+    {
+        case WORLD_SEL_QUEST_POOLS: return { "WORLD_SEL_QUEST_POOLS", "WORLD_SEL_QUEST_POOLS", "" };
+        case WORLD_DEL_CRELINKED_RESPAWN: return { "WORLD_DEL_CRELINKED_RESPAWN", "WORLD_DEL_CRELINKED_RESPAWN", "" };
+        case WORLD_REP_CREATURE_LINKED_RESPAWN: return { "WORLD_REP_CREATURE_LINKED_RESPAWN", "WORLD_REP_CREATURE_LINKED_RESPAWN", "" };
+        case WORLD_SEL_CREATURE_TEXT: return { "WORLD_SEL_CREATURE_TEXT", "WORLD_SEL_CREATURE_TEXT", "" };
+        case WORLD_SEL_SMART_SCRIPTS: return { "WORLD_SEL_SMART_SCRIPTS", "WORLD_SEL_SMART_SCRIPTS", "" };
+        case WORLD_SEL_SMARTAI_WP: return { "WORLD_SEL_SMARTAI_WP", "WORLD_SEL_SMARTAI_WP", "" };
+        case WORLD_DEL_GAMEOBJECT: return { "WORLD_DEL_GAMEOBJECT", "WORLD_DEL_GAMEOBJECT", "" };
+        case WORLD_DEL_EVENT_GAMEOBJECT: return { "WORLD_DEL_EVENT_GAMEOBJECT", "WORLD_DEL_EVENT_GAMEOBJECT", "" };
+        case WORLD_INS_GRAVEYARD_ZONE: return { "WORLD_INS_GRAVEYARD_ZONE", "WORLD_INS_GRAVEYARD_ZONE", "" };
+        case WORLD_DEL_GRAVEYARD_ZONE: return { "WORLD_DEL_GRAVEYARD_ZONE", "WORLD_DEL_GRAVEYARD_ZONE", "" };
+        case WORLD_INS_GAME_TELE: return { "WORLD_INS_GAME_TELE", "WORLD_INS_GAME_TELE", "" };
+        case WORLD_DEL_GAME_TELE: return { "WORLD_DEL_GAME_TELE", "WORLD_DEL_GAME_TELE", "" };
+        case WORLD_INS_NPC_VENDOR: return { "WORLD_INS_NPC_VENDOR", "WORLD_INS_NPC_VENDOR", "" };
+        case WORLD_DEL_NPC_VENDOR: return { "WORLD_DEL_NPC_VENDOR", "WORLD_DEL_NPC_VENDOR", "" };
+        case WORLD_SEL_NPC_VENDOR_REF: return { "WORLD_SEL_NPC_VENDOR_REF", "WORLD_SEL_NPC_VENDOR_REF", "" };
+        case WORLD_UPD_CREATURE_MOVEMENT_TYPE: return { "WORLD_UPD_CREATURE_MOVEMENT_TYPE", "WORLD_UPD_CREATURE_MOVEMENT_TYPE", "" };
+        case WORLD_UPD_CREATURE_FACTION: return { "WORLD_UPD_CREATURE_FACTION", "WORLD_UPD_CREATURE_FACTION", "" };
+        case WORLD_UPD_CREATURE_NPCFLAG: return { "WORLD_UPD_CREATURE_NPCFLAG", "WORLD_UPD_CREATURE_NPCFLAG", "" };
+        case WORLD_UPD_CREATURE_POSITION: return { "WORLD_UPD_CREATURE_POSITION", "WORLD_UPD_CREATURE_POSITION", "" };
+        case WORLD_UPD_CREATURE_WANDER_DISTANCE: return { "WORLD_UPD_CREATURE_WANDER_DISTANCE", "WORLD_UPD_CREATURE_WANDER_DISTANCE", "" };
+        case WORLD_UPD_CREATURE_SPAWN_TIME_SECS: return { "WORLD_UPD_CREATURE_SPAWN_TIME_SECS", "WORLD_UPD_CREATURE_SPAWN_TIME_SECS", "" };
+        case WORLD_INS_CREATURE_FORMATION: return { "WORLD_INS_CREATURE_FORMATION", "WORLD_INS_CREATURE_FORMATION", "" };
+        case WORLD_INS_WAYPOINT_DATA: return { "WORLD_INS_WAYPOINT_DATA", "WORLD_INS_WAYPOINT_DATA", "" };
+        case WORLD_DEL_WAYPOINT_DATA: return { "WORLD_DEL_WAYPOINT_DATA", "WORLD_DEL_WAYPOINT_DATA", "" };
+        case WORLD_UPD_WAYPOINT_DATA_POINT: return { "WORLD_UPD_WAYPOINT_DATA_POINT", "WORLD_UPD_WAYPOINT_DATA_POINT", "" };
+        case WORLD_UPD_WAYPOINT_DATA_POSITION: return { "WORLD_UPD_WAYPOINT_DATA_POSITION", "WORLD_UPD_WAYPOINT_DATA_POSITION", "" };
+        case WORLD_UPD_WAYPOINT_DATA_WPGUID: return { "WORLD_UPD_WAYPOINT_DATA_WPGUID", "WORLD_UPD_WAYPOINT_DATA_WPGUID", "" };
+        case WORLD_UPD_WAYPOINT_DATA_ALL_WPGUID: return { "WORLD_UPD_WAYPOINT_DATA_ALL_WPGUID", "WORLD_UPD_WAYPOINT_DATA_ALL_WPGUID", "" };
+        case WORLD_SEL_WAYPOINT_DATA_MAX_ID: return { "WORLD_SEL_WAYPOINT_DATA_MAX_ID", "WORLD_SEL_WAYPOINT_DATA_MAX_ID", "" };
+        case WORLD_SEL_WAYPOINT_DATA_BY_ID: return { "WORLD_SEL_WAYPOINT_DATA_BY_ID", "WORLD_SEL_WAYPOINT_DATA_BY_ID", "" };
+        case WORLD_SEL_WAYPOINT_DATA_POS_BY_ID: return { "WORLD_SEL_WAYPOINT_DATA_POS_BY_ID", "WORLD_SEL_WAYPOINT_DATA_POS_BY_ID", "" };
+        case WORLD_SEL_WAYPOINT_DATA_POS_FIRST_BY_ID: return { "WORLD_SEL_WAYPOINT_DATA_POS_FIRST_BY_ID", "WORLD_SEL_WAYPOINT_DATA_POS_FIRST_BY_ID", "" };
+        case WORLD_SEL_WAYPOINT_DATA_POS_LAST_BY_ID: return { "WORLD_SEL_WAYPOINT_DATA_POS_LAST_BY_ID", "WORLD_SEL_WAYPOINT_DATA_POS_LAST_BY_ID", "" };
+        case WORLD_SEL_WAYPOINT_DATA_BY_WPGUID: return { "WORLD_SEL_WAYPOINT_DATA_BY_WPGUID", "WORLD_SEL_WAYPOINT_DATA_BY_WPGUID", "" };
+        case WORLD_SEL_WAYPOINT_DATA_ALL_BY_WPGUID: return { "WORLD_SEL_WAYPOINT_DATA_ALL_BY_WPGUID", "WORLD_SEL_WAYPOINT_DATA_ALL_BY_WPGUID", "" };
+        case WORLD_SEL_WAYPOINT_DATA_MAX_POINT: return { "WORLD_SEL_WAYPOINT_DATA_MAX_POINT", "WORLD_SEL_WAYPOINT_DATA_MAX_POINT", "" };
+        case WORLD_SEL_WAYPOINT_DATA_BY_POS: return { "WORLD_SEL_WAYPOINT_DATA_BY_POS", "WORLD_SEL_WAYPOINT_DATA_BY_POS", "" };
+        case WORLD_SEL_WAYPOINT_DATA_WPGUID_BY_ID: return { "WORLD_SEL_WAYPOINT_DATA_WPGUID_BY_ID", "WORLD_SEL_WAYPOINT_DATA_WPGUID_BY_ID", "" };
+        case WORLD_SEL_WAYPOINT_DATA_ACTION: return { "WORLD_SEL_WAYPOINT_DATA_ACTION", "WORLD_SEL_WAYPOINT_DATA_ACTION", "" };
+        case WORLD_SEL_WAYPOINT_SCRIPTS_MAX_ID: return { "WORLD_SEL_WAYPOINT_SCRIPTS_MAX_ID", "WORLD_SEL_WAYPOINT_SCRIPTS_MAX_ID", "" };
+        case WORLD_UPD_CREATURE_ADDON_PATH: return { "WORLD_UPD_CREATURE_ADDON_PATH", "WORLD_UPD_CREATURE_ADDON_PATH", "" };
+        case WORLD_INS_CREATURE_ADDON: return { "WORLD_INS_CREATURE_ADDON", "WORLD_INS_CREATURE_ADDON", "" };
+        case WORLD_DEL_CREATURE_ADDON: return { "WORLD_DEL_CREATURE_ADDON", "WORLD_DEL_CREATURE_ADDON", "" };
+        case WORLD_SEL_CREATURE_ADDON_BY_GUID: return { "WORLD_SEL_CREATURE_ADDON_BY_GUID", "WORLD_SEL_CREATURE_ADDON_BY_GUID", "" };
+        case WORLD_INS_WAYPOINT_SCRIPT: return { "WORLD_INS_WAYPOINT_SCRIPT", "WORLD_INS_WAYPOINT_SCRIPT", "" };
+        case WORLD_DEL_WAYPOINT_SCRIPT: return { "WORLD_DEL_WAYPOINT_SCRIPT", "WORLD_DEL_WAYPOINT_SCRIPT", "" };
+        case WORLD_UPD_WAYPOINT_SCRIPT_ID: return { "WORLD_UPD_WAYPOINT_SCRIPT_ID", "WORLD_UPD_WAYPOINT_SCRIPT_ID", "" };
+        case WORLD_UPD_WAYPOINT_SCRIPT_X: return { "WORLD_UPD_WAYPOINT_SCRIPT_X", "WORLD_UPD_WAYPOINT_SCRIPT_X", "" };
+        case WORLD_UPD_WAYPOINT_SCRIPT_Y: return { "WORLD_UPD_WAYPOINT_SCRIPT_Y", "WORLD_UPD_WAYPOINT_SCRIPT_Y", "" };
+        case WORLD_UPD_WAYPOINT_SCRIPT_Z: return { "WORLD_UPD_WAYPOINT_SCRIPT_Z", "WORLD_UPD_WAYPOINT_SCRIPT_Z", "" };
+        case WORLD_UPD_WAYPOINT_SCRIPT_O: return { "WORLD_UPD_WAYPOINT_SCRIPT_O", "WORLD_UPD_WAYPOINT_SCRIPT_O", "" };
+        case WORLD_SEL_WAYPOINT_SCRIPT_ID_BY_GUID: return { "WORLD_SEL_WAYPOINT_SCRIPT_ID_BY_GUID", "WORLD_SEL_WAYPOINT_SCRIPT_ID_BY_GUID", "" };
+        case WORLD_DEL_CREATURE: return { "WORLD_DEL_CREATURE", "WORLD_DEL_CREATURE", "" };
+        case WORLD_SEL_COMMANDS: return { "WORLD_SEL_COMMANDS", "WORLD_SEL_COMMANDS", "" };
+        case WORLD_SEL_CREATURE_TEMPLATE: return { "WORLD_SEL_CREATURE_TEMPLATE", "WORLD_SEL_CREATURE_TEMPLATE", "" };
+        case WORLD_SEL_WAYPOINT_SCRIPT_BY_ID: return { "WORLD_SEL_WAYPOINT_SCRIPT_BY_ID", "WORLD_SEL_WAYPOINT_SCRIPT_BY_ID", "" };
+        case WORLD_SEL_ITEM_TEMPLATE_BY_NAME: return { "WORLD_SEL_ITEM_TEMPLATE_BY_NAME", "WORLD_SEL_ITEM_TEMPLATE_BY_NAME", "" };
+        case WORLD_SEL_CREATURE_BY_ID: return { "WORLD_SEL_CREATURE_BY_ID", "WORLD_SEL_CREATURE_BY_ID", "" };
+        case WORLD_SEL_GAMEOBJECT_NEAREST: return { "WORLD_SEL_GAMEOBJECT_NEAREST", "WORLD_SEL_GAMEOBJECT_NEAREST", "" };
+        case WORLD_SEL_CREATURE_NEAREST: return { "WORLD_SEL_CREATURE_NEAREST", "WORLD_SEL_CREATURE_NEAREST", "" };
+        case WORLD_SEL_GAMEOBJECT_TARGET: return { "WORLD_SEL_GAMEOBJECT_TARGET", "WORLD_SEL_GAMEOBJECT_TARGET", "" };
+        case WORLD_INS_CREATURE: return { "WORLD_INS_CREATURE", "WORLD_INS_CREATURE", "" };
+        case WORLD_SEL_GAME_EVENTS: return { "WORLD_SEL_GAME_EVENTS", "WORLD_SEL_GAME_EVENTS", "" };
+        case WORLD_SEL_GAME_EVENT_PREREQUISITE_DATA: return { "WORLD_SEL_GAME_EVENT_PREREQUISITE_DATA", "WORLD_SEL_GAME_EVENT_PREREQUISITE_DATA", "" };
+        case WORLD_SEL_GAME_EVENT_CREATURE_DATA: return { "WORLD_SEL_GAME_EVENT_CREATURE_DATA", "WORLD_SEL_GAME_EVENT_CREATURE_DATA", "" };
+        case WORLD_SEL_GAME_EVENT_GAMEOBJECT_DATA: return { "WORLD_SEL_GAME_EVENT_GAMEOBJECT_DATA", "WORLD_SEL_GAME_EVENT_GAMEOBJECT_DATA", "" };
+        case WORLD_SEL_GAME_EVENT_MODEL_EQUIPMENT_DATA: return { "WORLD_SEL_GAME_EVENT_MODEL_EQUIPMENT_DATA", "WORLD_SEL_GAME_EVENT_MODEL_EQUIPMENT_DATA", "" };
+        case WORLD_SEL_GAME_EVENT_QUEST_DATA: return { "WORLD_SEL_GAME_EVENT_QUEST_DATA", "WORLD_SEL_GAME_EVENT_QUEST_DATA", "" };
+        case WORLD_SEL_GAME_EVENT_GAMEOBJECT_QUEST_DATA: return { "WORLD_SEL_GAME_EVENT_GAMEOBJECT_QUEST_DATA", "WORLD_SEL_GAME_EVENT_GAMEOBJECT_QUEST_DATA", "" };
+        case WORLD_SEL_GAME_EVENT_QUEST_CONDITION_DATA: return { "WORLD_SEL_GAME_EVENT_QUEST_CONDITION_DATA", "WORLD_SEL_GAME_EVENT_QUEST_CONDITION_DATA", "" };
+        case WORLD_SEL_GAME_EVENT_CONDITION_DATA: return { "WORLD_SEL_GAME_EVENT_CONDITION_DATA", "WORLD_SEL_GAME_EVENT_CONDITION_DATA", "" };
+        case WORLD_SEL_GAME_EVENT_NPC_FLAGS: return { "WORLD_SEL_GAME_EVENT_NPC_FLAGS", "WORLD_SEL_GAME_EVENT_NPC_FLAGS", "" };
+        case WORLD_SEL_GAME_EVENT_QUEST_SEASONAL_RELATIONS: return { "WORLD_SEL_GAME_EVENT_QUEST_SEASONAL_RELATIONS", "WORLD_SEL_GAME_EVENT_QUEST_SEASONAL_RELATIONS", "" };
+        case WORLD_SEL_GAME_EVENT_BATTLEGROUND_DATA: return { "WORLD_SEL_GAME_EVENT_BATTLEGROUND_DATA", "WORLD_SEL_GAME_EVENT_BATTLEGROUND_DATA", "" };
+        case WORLD_SEL_GAME_EVENT_POOL_DATA: return { "WORLD_SEL_GAME_EVENT_POOL_DATA", "WORLD_SEL_GAME_EVENT_POOL_DATA", "" };
+        case WORLD_SEL_GAME_EVENT_ARENA_SEASON: return { "WORLD_SEL_GAME_EVENT_ARENA_SEASON", "WORLD_SEL_GAME_EVENT_ARENA_SEASON", "" };
+        case WORLD_SEL_GAME_EVENT_HOLIDAY_DATES: return { "WORLD_SEL_GAME_EVENT_HOLIDAY_DATES", "WORLD_SEL_GAME_EVENT_HOLIDAY_DATES", "" };
+        case WORLD_DEL_GAME_EVENT_CREATURE: return { "WORLD_DEL_GAME_EVENT_CREATURE", "WORLD_DEL_GAME_EVENT_CREATURE", "" };
+        case WORLD_DEL_GAME_EVENT_MODEL_EQUIP: return { "WORLD_DEL_GAME_EVENT_MODEL_EQUIP", "WORLD_DEL_GAME_EVENT_MODEL_EQUIP", "" };
+        case WORLD_SEL_GAME_EVENT_NPC_VENDOR: return { "WORLD_SEL_GAME_EVENT_NPC_VENDOR", "WORLD_SEL_GAME_EVENT_NPC_VENDOR", "" };
+        case WORLD_INS_GAMEOBJECT: return { "WORLD_INS_GAMEOBJECT", "WORLD_INS_GAMEOBJECT", "" };
+        case WORLD_SEL_DISABLES: return { "WORLD_SEL_DISABLES", "WORLD_SEL_DISABLES", "" };
+        case WORLD_INS_DISABLES: return { "WORLD_INS_DISABLES", "WORLD_INS_DISABLES", "" };
+        case WORLD_DEL_DISABLES: return { "WORLD_DEL_DISABLES", "WORLD_DEL_DISABLES", "" };
+        case WORLD_UPD_CREATURE_ZONE_AREA_DATA: return { "WORLD_UPD_CREATURE_ZONE_AREA_DATA", "WORLD_UPD_CREATURE_ZONE_AREA_DATA", "" };
+        case WORLD_UPD_GAMEOBJECT_ZONE_AREA_DATA: return { "WORLD_UPD_GAMEOBJECT_ZONE_AREA_DATA", "WORLD_UPD_GAMEOBJECT_ZONE_AREA_DATA", "" };
+        case WORLD_SEL_REQ_XP: return { "WORLD_SEL_REQ_XP", "WORLD_SEL_REQ_XP", "" };
+        case WORLD_INS_GAMEOBJECT_ADDON: return { "WORLD_INS_GAMEOBJECT_ADDON", "WORLD_INS_GAMEOBJECT_ADDON", "" };
+        case WORLD_UPD_VERSION: return { "WORLD_UPD_VERSION", "WORLD_UPD_VERSION", "" };
+        default: throw std::out_of_range("value");
+    }
+}
+
+template <>
+AC_API_EXPORT std::size_t EnumUtils<WorldDatabaseStatements>::Count() { return 89; }
+
+template <>
+AC_API_EXPORT WorldDatabaseStatements EnumUtils<WorldDatabaseStatements>::FromIndex(std::size_t index)
+{
+    switch (index)
+    {
+        case 0: return WORLD_SEL_QUEST_POOLS;
+        case 1: return WORLD_DEL_CRELINKED_RESPAWN;
+        case 2: return WORLD_REP_CREATURE_LINKED_RESPAWN;
+        case 3: return WORLD_SEL_CREATURE_TEXT;
+        case 4: return WORLD_SEL_SMART_SCRIPTS;
+        case 5: return WORLD_SEL_SMARTAI_WP;
+        case 6: return WORLD_DEL_GAMEOBJECT;
+        case 7: return WORLD_DEL_EVENT_GAMEOBJECT;
+        case 8: return WORLD_INS_GRAVEYARD_ZONE;
+        case 9: return WORLD_DEL_GRAVEYARD_ZONE;
+        case 10: return WORLD_INS_GAME_TELE;
+        case 11: return WORLD_DEL_GAME_TELE;
+        case 12: return WORLD_INS_NPC_VENDOR;
+        case 13: return WORLD_DEL_NPC_VENDOR;
+        case 14: return WORLD_SEL_NPC_VENDOR_REF;
+        case 15: return WORLD_UPD_CREATURE_MOVEMENT_TYPE;
+        case 16: return WORLD_UPD_CREATURE_FACTION;
+        case 17: return WORLD_UPD_CREATURE_NPCFLAG;
+        case 18: return WORLD_UPD_CREATURE_POSITION;
+        case 19: return WORLD_UPD_CREATURE_WANDER_DISTANCE;
+        case 20: return WORLD_UPD_CREATURE_SPAWN_TIME_SECS;
+        case 21: return WORLD_INS_CREATURE_FORMATION;
+        case 22: return WORLD_INS_WAYPOINT_DATA;
+        case 23: return WORLD_DEL_WAYPOINT_DATA;
+        case 24: return WORLD_UPD_WAYPOINT_DATA_POINT;
+        case 25: return WORLD_UPD_WAYPOINT_DATA_POSITION;
+        case 26: return WORLD_UPD_WAYPOINT_DATA_WPGUID;
+        case 27: return WORLD_UPD_WAYPOINT_DATA_ALL_WPGUID;
+        case 28: return WORLD_SEL_WAYPOINT_DATA_MAX_ID;
+        case 29: return WORLD_SEL_WAYPOINT_DATA_BY_ID;
+        case 30: return WORLD_SEL_WAYPOINT_DATA_POS_BY_ID;
+        case 31: return WORLD_SEL_WAYPOINT_DATA_POS_FIRST_BY_ID;
+        case 32: return WORLD_SEL_WAYPOINT_DATA_POS_LAST_BY_ID;
+        case 33: return WORLD_SEL_WAYPOINT_DATA_BY_WPGUID;
+        case 34: return WORLD_SEL_WAYPOINT_DATA_ALL_BY_WPGUID;
+        case 35: return WORLD_SEL_WAYPOINT_DATA_MAX_POINT;
+        case 36: return WORLD_SEL_WAYPOINT_DATA_BY_POS;
+        case 37: return WORLD_SEL_WAYPOINT_DATA_WPGUID_BY_ID;
+        case 38: return WORLD_SEL_WAYPOINT_DATA_ACTION;
+        case 39: return WORLD_SEL_WAYPOINT_SCRIPTS_MAX_ID;
+        case 40: return WORLD_UPD_CREATURE_ADDON_PATH;
+        case 41: return WORLD_INS_CREATURE_ADDON;
+        case 42: return WORLD_DEL_CREATURE_ADDON;
+        case 43: return WORLD_SEL_CREATURE_ADDON_BY_GUID;
+        case 44: return WORLD_INS_WAYPOINT_SCRIPT;
+        case 45: return WORLD_DEL_WAYPOINT_SCRIPT;
+        case 46: return WORLD_UPD_WAYPOINT_SCRIPT_ID;
+        case 47: return WORLD_UPD_WAYPOINT_SCRIPT_X;
+        case 48: return WORLD_UPD_WAYPOINT_SCRIPT_Y;
+        case 49: return WORLD_UPD_WAYPOINT_SCRIPT_Z;
+        case 50: return WORLD_UPD_WAYPOINT_SCRIPT_O;
+        case 51: return WORLD_SEL_WAYPOINT_SCRIPT_ID_BY_GUID;
+        case 52: return WORLD_DEL_CREATURE;
+        case 53: return WORLD_SEL_COMMANDS;
+        case 54: return WORLD_SEL_CREATURE_TEMPLATE;
+        case 55: return WORLD_SEL_WAYPOINT_SCRIPT_BY_ID;
+        case 56: return WORLD_SEL_ITEM_TEMPLATE_BY_NAME;
+        case 57: return WORLD_SEL_CREATURE_BY_ID;
+        case 58: return WORLD_SEL_GAMEOBJECT_NEAREST;
+        case 59: return WORLD_SEL_CREATURE_NEAREST;
+        case 60: return WORLD_SEL_GAMEOBJECT_TARGET;
+        case 61: return WORLD_INS_CREATURE;
+        case 62: return WORLD_SEL_GAME_EVENTS;
+        case 63: return WORLD_SEL_GAME_EVENT_PREREQUISITE_DATA;
+        case 64: return WORLD_SEL_GAME_EVENT_CREATURE_DATA;
+        case 65: return WORLD_SEL_GAME_EVENT_GAMEOBJECT_DATA;
+        case 66: return WORLD_SEL_GAME_EVENT_MODEL_EQUIPMENT_DATA;
+        case 67: return WORLD_SEL_GAME_EVENT_QUEST_DATA;
+        case 68: return WORLD_SEL_GAME_EVENT_GAMEOBJECT_QUEST_DATA;
+        case 69: return WORLD_SEL_GAME_EVENT_QUEST_CONDITION_DATA;
+        case 70: return WORLD_SEL_GAME_EVENT_CONDITION_DATA;
+        case 71: return WORLD_SEL_GAME_EVENT_NPC_FLAGS;
+        case 72: return WORLD_SEL_GAME_EVENT_QUEST_SEASONAL_RELATIONS;
+        case 73: return WORLD_SEL_GAME_EVENT_BATTLEGROUND_DATA;
+        case 74: return WORLD_SEL_GAME_EVENT_POOL_DATA;
+        case 75: return WORLD_SEL_GAME_EVENT_ARENA_SEASON;
+        case 76: return WORLD_SEL_GAME_EVENT_HOLIDAY_DATES;
+        case 77: return WORLD_DEL_GAME_EVENT_CREATURE;
+        case 78: return WORLD_DEL_GAME_EVENT_MODEL_EQUIP;
+        case 79: return WORLD_SEL_GAME_EVENT_NPC_VENDOR;
+        case 80: return WORLD_INS_GAMEOBJECT;
+        case 81: return WORLD_SEL_DISABLES;
+        case 82: return WORLD_INS_DISABLES;
+        case 83: return WORLD_DEL_DISABLES;
+        case 84: return WORLD_UPD_CREATURE_ZONE_AREA_DATA;
+        case 85: return WORLD_UPD_GAMEOBJECT_ZONE_AREA_DATA;
+        case 86: return WORLD_SEL_REQ_XP;
+        case 87: return WORLD_INS_GAMEOBJECT_ADDON;
+        case 88: return WORLD_UPD_VERSION;
+        default: throw std::out_of_range("index");
+    }
+}
+
+template <>
+AC_API_EXPORT std::size_t EnumUtils<WorldDatabaseStatements>::ToIndex(WorldDatabaseStatements value)
+{
+    switch (value)
+    {
+        case WORLD_SEL_QUEST_POOLS: return 0;
+        case WORLD_DEL_CRELINKED_RESPAWN: return 1;
+        case WORLD_REP_CREATURE_LINKED_RESPAWN: return 2;
+        case WORLD_SEL_CREATURE_TEXT: return 3;
+        case WORLD_SEL_SMART_SCRIPTS: return 4;
+        case WORLD_SEL_SMARTAI_WP: return 5;
+        case WORLD_DEL_GAMEOBJECT: return 6;
+        case WORLD_DEL_EVENT_GAMEOBJECT: return 7;
+        case WORLD_INS_GRAVEYARD_ZONE: return 8;
+        case WORLD_DEL_GRAVEYARD_ZONE: return 9;
+        case WORLD_INS_GAME_TELE: return 10;
+        case WORLD_DEL_GAME_TELE: return 11;
+        case WORLD_INS_NPC_VENDOR: return 12;
+        case WORLD_DEL_NPC_VENDOR: return 13;
+        case WORLD_SEL_NPC_VENDOR_REF: return 14;
+        case WORLD_UPD_CREATURE_MOVEMENT_TYPE: return 15;
+        case WORLD_UPD_CREATURE_FACTION: return 16;
+        case WORLD_UPD_CREATURE_NPCFLAG: return 17;
+        case WORLD_UPD_CREATURE_POSITION: return 18;
+        case WORLD_UPD_CREATURE_WANDER_DISTANCE: return 19;
+        case WORLD_UPD_CREATURE_SPAWN_TIME_SECS: return 20;
+        case WORLD_INS_CREATURE_FORMATION: return 21;
+        case WORLD_INS_WAYPOINT_DATA: return 22;
+        case WORLD_DEL_WAYPOINT_DATA: return 23;
+        case WORLD_UPD_WAYPOINT_DATA_POINT: return 24;
+        case WORLD_UPD_WAYPOINT_DATA_POSITION: return 25;
+        case WORLD_UPD_WAYPOINT_DATA_WPGUID: return 26;
+        case WORLD_UPD_WAYPOINT_DATA_ALL_WPGUID: return 27;
+        case WORLD_SEL_WAYPOINT_DATA_MAX_ID: return 28;
+        case WORLD_SEL_WAYPOINT_DATA_BY_ID: return 29;
+        case WORLD_SEL_WAYPOINT_DATA_POS_BY_ID: return 30;
+        case WORLD_SEL_WAYPOINT_DATA_POS_FIRST_BY_ID: return 31;
+        case WORLD_SEL_WAYPOINT_DATA_POS_LAST_BY_ID: return 32;
+        case WORLD_SEL_WAYPOINT_DATA_BY_WPGUID: return 33;
+        case WORLD_SEL_WAYPOINT_DATA_ALL_BY_WPGUID: return 34;
+        case WORLD_SEL_WAYPOINT_DATA_MAX_POINT: return 35;
+        case WORLD_SEL_WAYPOINT_DATA_BY_POS: return 36;
+        case WORLD_SEL_WAYPOINT_DATA_WPGUID_BY_ID: return 37;
+        case WORLD_SEL_WAYPOINT_DATA_ACTION: return 38;
+        case WORLD_SEL_WAYPOINT_SCRIPTS_MAX_ID: return 39;
+        case WORLD_UPD_CREATURE_ADDON_PATH: return 40;
+        case WORLD_INS_CREATURE_ADDON: return 41;
+        case WORLD_DEL_CREATURE_ADDON: return 42;
+        case WORLD_SEL_CREATURE_ADDON_BY_GUID: return 43;
+        case WORLD_INS_WAYPOINT_SCRIPT: return 44;
+        case WORLD_DEL_WAYPOINT_SCRIPT: return 45;
+        case WORLD_UPD_WAYPOINT_SCRIPT_ID: return 46;
+        case WORLD_UPD_WAYPOINT_SCRIPT_X: return 47;
+        case WORLD_UPD_WAYPOINT_SCRIPT_Y: return 48;
+        case WORLD_UPD_WAYPOINT_SCRIPT_Z: return 49;
+        case WORLD_UPD_WAYPOINT_SCRIPT_O: return 50;
+        case WORLD_SEL_WAYPOINT_SCRIPT_ID_BY_GUID: return 51;
+        case WORLD_DEL_CREATURE: return 52;
+        case WORLD_SEL_COMMANDS: return 53;
+        case WORLD_SEL_CREATURE_TEMPLATE: return 54;
+        case WORLD_SEL_WAYPOINT_SCRIPT_BY_ID: return 55;
+        case WORLD_SEL_ITEM_TEMPLATE_BY_NAME: return 56;
+        case WORLD_SEL_CREATURE_BY_ID: return 57;
+        case WORLD_SEL_GAMEOBJECT_NEAREST: return 58;
+        case WORLD_SEL_CREATURE_NEAREST: return 59;
+        case WORLD_SEL_GAMEOBJECT_TARGET: return 60;
+        case WORLD_INS_CREATURE: return 61;
+        case WORLD_SEL_GAME_EVENTS: return 62;
+        case WORLD_SEL_GAME_EVENT_PREREQUISITE_DATA: return 63;
+        case WORLD_SEL_GAME_EVENT_CREATURE_DATA: return 64;
+        case WORLD_SEL_GAME_EVENT_GAMEOBJECT_DATA: return 65;
+        case WORLD_SEL_GAME_EVENT_MODEL_EQUIPMENT_DATA: return 66;
+        case WORLD_SEL_GAME_EVENT_QUEST_DATA: return 67;
+        case WORLD_SEL_GAME_EVENT_GAMEOBJECT_QUEST_DATA: return 68;
+        case WORLD_SEL_GAME_EVENT_QUEST_CONDITION_DATA: return 69;
+        case WORLD_SEL_GAME_EVENT_CONDITION_DATA: return 70;
+        case WORLD_SEL_GAME_EVENT_NPC_FLAGS: return 71;
+        case WORLD_SEL_GAME_EVENT_QUEST_SEASONAL_RELATIONS: return 72;
+        case WORLD_SEL_GAME_EVENT_BATTLEGROUND_DATA: return 73;
+        case WORLD_SEL_GAME_EVENT_POOL_DATA: return 74;
+        case WORLD_SEL_GAME_EVENT_ARENA_SEASON: return 75;
+        case WORLD_SEL_GAME_EVENT_HOLIDAY_DATES: return 76;
+        case WORLD_DEL_GAME_EVENT_CREATURE: return 77;
+        case WORLD_DEL_GAME_EVENT_MODEL_EQUIP: return 78;
+        case WORLD_SEL_GAME_EVENT_NPC_VENDOR: return 79;
+        case WORLD_INS_GAMEOBJECT: return 80;
+        case WORLD_SEL_DISABLES: return 81;
+        case WORLD_INS_DISABLES: return 82;
+        case WORLD_DEL_DISABLES: return 83;
+        case WORLD_UPD_CREATURE_ZONE_AREA_DATA: return 84;
+        case WORLD_UPD_GAMEOBJECT_ZONE_AREA_DATA: return 85;
+        case WORLD_SEL_REQ_XP: return 86;
+        case WORLD_INS_GAMEOBJECT_ADDON: return 87;
+        case WORLD_UPD_VERSION: return 88;
+        default: throw std::out_of_range("value");
+    }
+}
+}
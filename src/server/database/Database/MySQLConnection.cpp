@@ -20,8 +20,10 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "MySQLPreparedStatement.h"
+#include "PCQueue.h"
 #include "PreparedStatement.h"
 #include "QueryResult.h"
+#include "StatementBatch.h"
 #include "StringConvert.h"
 #include "Timer.h"
 #include "Tokenize.h"
@@ -53,7 +55,9 @@ MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo) :
     m_Mysql(nullptr),
     m_queue(nullptr),
     m_connectionInfo(connInfo),
-    m_connectionFlags(CONNECTION_SYNCH) { }
+    m_connectionFlags(CONNECTION_SYNCH),
+    m_replicaHealthy(nullptr),
+    m_primaryQueue(nullptr) { }
 
 MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo) :
     m_reconnecting(false),
@@ -61,7 +65,9 @@ MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, My
     m_Mysql(nullptr),
     m_queue(queue),
     m_connectionInfo(connInfo),
-    m_connectionFlags(CONNECTION_ASYNC)
+    m_connectionFlags(CONNECTION_ASYNC),
+    m_replicaHealthy(nullptr),
+    m_primaryQueue(nullptr)
 {
     m_worker = std::make_unique<DatabaseWorker>(m_queue, this);
 }
@@ -75,7 +81,12 @@ void MySQLConnection::Close()
 {
     // Stop the worker thread before the statements are cleared
     m_worker.reset();
-    m_stmts.clear();
+    m_batchStmts.clear();
+
+    {
+        std::lock_guard<std::mutex> guard(m_stmtsLock);
+        m_stmts.clear();
+    }
 
     if (m_Mysql)
     {
@@ -168,10 +179,27 @@ uint32 MySQLConnection::Open()
 
 bool MySQLConnection::PrepareStatements()
 {
-    DoPrepareStatements();
+    // merged statements are prepared again on first use
+    m_batchStmts.clear();
+
+    {
+        std::lock_guard<std::mutex> guard(m_stmtsLock);
+        DoPrepareStatements();
+    }
+
+    m_statistics.SetStatementCount(uint32(m_stmts.size()));
     return !m_prepareError;
 }
 
+std::string MySQLConnection::GetStatementQuery(uint32 index) const
+{
+    std::lock_guard<std::mutex> guard(m_stmtsLock);
+    if (index < m_stmts.size() && m_stmts[index])
+        return std::string(m_stmts[index]->GetRawQueryString());
+
+    return {};
+}
+
 bool MySQLConnection::Execute(std::string_view sql)
 {
     if (!m_Mysql)
@@ -215,6 +243,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
 
     uint32 _s = getMSTime();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 
 #if MYSQL_VERSION_ID >= 80300
     if (mysql_stmt_bind_named_param(msql_STMT, msql_BIND, m_mStmt->GetParameterCount(), nullptr))
@@ -246,6 +275,8 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
 
     LOG_DEBUG("sql.sql", "[{} ms] SQL(p): {}", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString());
 
+    m_statistics.RecordStatement(index, 1, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+
     m_mStmt->ClearParameters();
     return true;
 }
@@ -387,8 +418,9 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
 
     BeginTransaction();
 
-    for (auto const& data : queries)
+    for (std::size_t i = 0; i < queries.size(); ++i)
     {
+        auto const& data = queries[i];
         switch (data.type)
         {
             case SQL_ELEMENT_PREPARED:
@@ -407,6 +439,26 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
 
                 ASSERT(stmt);
 
+                // consecutive executions of the same statement are sent as one multi row statement
+                if (std::size_t count = GetBatchableCount(queries, i); count > 1)
+                {
+                    m_batch.clear();
+                    for (std::size_t j = i; j < i + count; ++j)
+                        m_batch.push_back(std::get<PreparedStatementBase*>(queries[j].element));
+
+                    i += count - 1;
+
+                    if (!ExecuteBatch(m_batch))
+                    {
+                        LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
+                        int errorCode = GetLastError();
+                        RollbackTransaction();
+                        return errorCode;
+                    }
+
+                    break;
+                }
+
                 if (!Execute(stmt))
                 {
                     LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
@@ -453,6 +505,153 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
     return 0;
 }
 
+MySQLConnection::BatchStatements::BatchStatements() = default;
+MySQLConnection::BatchStatements::~BatchStatements() = default;
+
+MySQLConnection::BatchStatements* MySQLConnection::GetBatchStatements(uint32 index)
+{
+    auto [itr, inserted] = m_batchStmts.try_emplace(index);
+    if (inserted)
+    {
+        itr->second = std::make_unique<BatchStatements>();
+
+        if (MySQLPreparedStatement* stmt = GetPreparedStatement(index))
+            if (Optional<StatementBatch> batch = StatementBatch::Create(stmt->m_queryString))
+                itr->second->Batch = std::make_unique<StatementBatch>(std::move(*batch));
+    }
+
+    return itr->second.get();
+}
+
+MySQLPreparedStatement* MySQLConnection::GetBatchStatement(uint32 index, uint32 sizeShift)
+{
+    BatchStatements* batchStmts = GetBatchStatements(index);
+    if (!batchStmts->Batch)
+        return nullptr;
+
+    std::unique_ptr<MySQLPreparedStatement>& batchStmt = batchStmts->Statements[sizeShift];
+    if (batchStmt)
+        return batchStmt.get();
+
+    std::string sql = batchStmts->Batch->GetQuery(1 << sizeShift);
+
+    MYSQL_STMT* stmt = mysql_stmt_init(m_Mysql);
+    if (!stmt)
+    {
+        LOG_ERROR("sql.sql", "In mysql_stmt_init() id: {}, sql: \"{}\"", index, sql);
+        LOG_ERROR("sql.sql", "{}", mysql_error(m_Mysql));
+        return nullptr;
+    }
+
+    if (mysql_stmt_prepare(stmt, sql.c_str(), static_cast<unsigned long>(sql.size())))
+    {
+        // keep sending the statement one by one
+        LOG_ERROR("sql.sql", "In mysql_stmt_prepare() id: {}, sql: \"{}\"", index, sql);
+        LOG_ERROR("sql.sql", "{}", mysql_stmt_error(stmt));
+        mysql_stmt_close(stmt);
+        batchStmts->Batch.reset();
+        return nullptr;
+    }
+
+    batchStmt = std::make_unique<MySQLPreparedStatement>(reinterpret_cast<MySQLStmt*>(stmt), sql);
+    return batchStmt.get();
+}
+
+std::size_t MySQLConnection::GetBatchableCount(std::vector<SQLElementData> const& queries, std::size_t first)
+{
+    uint32 index = std::get<PreparedStatementBase*>(queries[first].element)->GetIndex();
+
+    std::size_t count = 1;
+    while (first + count < queries.size())
+    {
+        PreparedStatementBase* const* next = std::get_if<PreparedStatementBase*>(&queries[first + count].element);
+        if (!next || (*next)->GetIndex() != index)
+            break;
+
+        ++count;
+    }
+
+    if (count > 1 && !GetBatchStatements(index)->Batch)
+        return 1;
+
+    return count;
+}
+
+bool MySQLConnection::ExecuteBatch(std::vector<PreparedStatementBase*> const& stmts)
+{
+    for (std::size_t first = 0; first < stmts.size();)
+    {
+        std::size_t remaining = stmts.size() - first;
+
+        // only power of two sizes are prepared, so every statement has a handful of merged variants at most
+        uint32 sizeShift = 0;
+        while (sizeShift < MAX_BATCH_SIZE_SHIFT && (std::size_t(2) << sizeShift) <= remaining)
+            ++sizeShift;
+
+        // mysql allows at most 65535 placeholders in a statement
+        while (sizeShift && (stmts[first]->GetParameters().GetCount() << sizeShift) > 65535)
+            --sizeShift;
+
+        MySQLPreparedStatement* m_mStmt = sizeShift ? GetBatchStatement(stmts[first]->GetIndex(), sizeShift) : nullptr;
+        if (!m_mStmt)
+        {
+            if (!Execute(stmts[first]))
+                return false;
+
+            ++first;
+            continue;
+        }
+
+        uint32 count = 1 << sizeShift;
+        m_mStmt->BindParameters(stmts, first, count);
+
+        MYSQL_STMT* msql_STMT = m_mStmt->GetSTMT();
+        MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
+
+        uint32 _s = getMSTime();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+#if MYSQL_VERSION_ID >= 80300
+        if (mysql_stmt_bind_named_param(msql_STMT, msql_BIND, m_mStmt->GetParameterCount(), nullptr))
+#else
+        if (mysql_stmt_bind_param(msql_STMT, msql_BIND))
+#endif
+        {
+            uint32 lErrno = mysql_errno(m_Mysql);
+            LOG_ERROR("sql.sql", "SQL(p): {} ({} rows)\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), count, lErrno, mysql_stmt_error(msql_STMT));
+
+            m_mStmt->ClearParameters();
+
+            if (_HandleMySQLErrno(lErrno, mysql_stmt_error(msql_STMT)))  // If it returns true, an error was handled successfully (i.e. reconnection)
+                continue;       // Try again
+
+            return false;
+        }
+
+        if (mysql_stmt_execute(msql_STMT))
+        {
+            uint32 lErrno = mysql_errno(m_Mysql);
+            LOG_ERROR("sql.sql", "SQL(p): {} ({} rows)\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), count, lErrno, mysql_stmt_error(msql_STMT));
+
+            m_mStmt->ClearParameters();
+
+            if (_HandleMySQLErrno(lErrno, mysql_stmt_error(msql_STMT)))  // If it returns true, an error was handled successfully (i.e. reconnection)
+                continue;       // Try again
+
+            return false;
+        }
+
+        LOG_DEBUG("sql.sql", "[{} ms] SQL(p): {} ({} rows)", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString(), count);
+
+        m_statistics.RecordStatement(stmts[first]->GetIndex(), count, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+
+        m_mStmt->ClearParameters();
+        first += count;
+    }
+
+    return true;
+}
+
 std::size_t MySQLConnection::EscapeString(char* to, const char* from, std::size_t length)
 {
     return mysql_real_escape_string(m_Mysql, to, from, length);
@@ -541,6 +740,8 @@ PreparedResultSet* MySQLConnection::Query(PreparedStatementBase* stmt)
     uint64 rowCount = 0;
     uint32 fieldCount = 0;
 
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
     if (!_Query(stmt, &mysqlStmt, &result, &rowCount, &fieldCount))
         return nullptr;
 
@@ -549,7 +750,57 @@ PreparedResultSet* MySQLConnection::Query(PreparedStatementBase* stmt)
         mysql_next_result(m_Mysql);
     }
 
-    return new PreparedResultSet(mysqlStmt->GetSTMT(), result, rowCount, fieldCount);
+    PreparedResultSet* resultSet = new PreparedResultSet(mysqlStmt->GetSTMT(), result, rowCount, fieldCount);
+
+    // fetching the rows is part of the statement
+    m_statistics.RecordStatement(stmt->GetIndex(), 1, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+    return resultSet;
+}
+
+bool MySQLConnection::RedirectIfReplicaDown(SQLOperation* op)
+{
+    if (!m_replicaHealthy)
+        return false;
+
+    // another connection lost the replica, this one reconnects before it is used again
+    if (m_Mysql && !m_replicaHealthy->load())
+    {
+        mysql_close(m_Mysql);
+        m_Mysql = nullptr;
+    }
+
+    if (m_Mysql || (std::chrono::steady_clock::now() >= m_nextReplicaReconnect && ReconnectReplica()))
+        return false;
+
+    m_primaryQueue->Push(op);
+    return true;
+}
+
+bool MySQLConnection::ReconnectReplica()
+{
+    m_nextReplicaReconnect = std::chrono::steady_clock::now() + REPLICA_RECONNECT_INTERVAL;
+
+    m_reconnecting = true;
+    m_prepareError = false;
+    bool reconnected = !Open() && PrepareStatements();
+    m_reconnecting = false;
+
+    if (!reconnected)
+    {
+        if (m_Mysql)
+        {
+            mysql_close(m_Mysql);
+            m_Mysql = nullptr;
+        }
+
+        return false;
+    }
+
+    LOG_INFO("sql.sql", "Successfully reconnected to the read replica {} @{}:{}.",
+        m_connectionInfo.database, m_connectionInfo.host, m_connectionInfo.port_or_socket);
+
+    m_replicaHealthy->store(true);
+    return true;
 }
 
 bool MySQLConnection::_HandleMySQLErrno(uint32 errNo, char const* err, uint8 attempts /*= 5*/)
@@ -572,6 +823,23 @@ bool MySQLConnection::_HandleMySQLErrno(uint32 errNo, char const* err, uint8 att
         }
         case CR_CONN_HOST_ERROR:
         {
+            // the primary can do without the read replica, its reads are passed on to the primary until it is back
+            if (m_replicaHealthy)
+            {
+                LOG_ERROR("sql.sql", "Lost the connection to the read replica {} @{}:{}, its reads go to the primary meanwhile.",
+                    m_connectionInfo.database, m_connectionInfo.host, m_connectionInfo.port_or_socket);
+
+                if (m_Mysql)
+                {
+                    mysql_close(m_Mysql);
+                    m_Mysql = nullptr;
+                }
+
+                m_replicaHealthy->store(false);
+                m_nextReplicaReconnect = std::chrono::steady_clock::now() + REPLICA_RECONNECT_INTERVAL;
+                return false;
+            }
+
             LOG_INFO("sql.sql", "Attempting to reconnect to the MySQL server...");
 
             m_reconnecting = true;
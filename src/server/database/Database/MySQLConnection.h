@@ -19,10 +19,16 @@
 #define _MYSQLCONNECTION_H
 
 #include "DatabaseEnvFwd.h"
+#include "DatabaseStatistics.h"
 #include "Define.h"
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 template <typename T>
@@ -31,12 +37,17 @@ class ProducerConsumerQueue;
 class DatabaseWorker;
 class MySQLPreparedStatement;
 class SQLOperation;
+class StatementBatch;
+struct SQLElementData;
 
 enum ConnectionFlags
 {
     CONNECTION_ASYNC = 0x1,
     CONNECTION_SYNCH = 0x2,
-    CONNECTION_BOTH = CONNECTION_ASYNC | CONNECTION_SYNCH
+    CONNECTION_BOTH = CONNECTION_ASYNC | CONNECTION_SYNCH,
+    CONNECTION_REPLICA = 0x4, //! Read only statement that may see slightly outdated data, asynchronous reads go to the read replica if one is configured
+    CONNECTION_ASYNC_REPLICA = CONNECTION_ASYNC | CONNECTION_REPLICA,
+    CONNECTION_BOTH_REPLICA = CONNECTION_BOTH | CONNECTION_REPLICA
 };
 
 struct AC_DATABASE_API MySQLConnectionInfo
@@ -84,6 +95,20 @@ public:
 
     uint32 GetLastError();
 
+    [[nodiscard]] std::string const& GetDatabaseName() const { return m_connectionInfo.database; }
+    DatabaseConnectionStatistics& GetStatistics() { return m_statistics; }
+
+    //! Time between two attempts of a replica connection to reconnect to its read replica
+    static constexpr std::chrono::seconds REPLICA_RECONNECT_INTERVAL = std::chrono::seconds(10);
+
+    /// Called by the worker of a replica connection before it executes op. While the read replica is down, op is passed
+    /// on to the primary and true is returned. Meanwhile the connection tries to reconnect every REPLICA_RECONNECT_INTERVAL.
+    bool RedirectIfReplicaDown(SQLOperation* op);
+
+    /// SQL of a prepared statement, empty if it is not prepared on this connection. Safe to call from any thread,
+    /// the statements are prepared again by the thread of the connection when it reconnects.
+    [[nodiscard]] std::string GetStatementQuery(uint32 index) const;
+
 protected:
     /// Tries to acquire lock. If lock is acquired by another thread
     /// the calling parent will just try another connection
@@ -103,15 +128,45 @@ protected:
     typedef std::vector<std::unique_ptr<MySQLPreparedStatement>> PreparedStatementContainer;
 
     PreparedStatementContainer m_stmts; //! PreparedStatements storage
+    mutable std::mutex m_stmtsLock;     //! Held while m_stmts is modified, see GetStatementQuery
     bool m_reconnecting;  //! Are we reconnecting?
     bool m_prepareError;  //! Was there any error while preparing statements?
     MySQLHandle* m_Mysql; //! MySQL Handle.
 
 private:
+    //! Largest number of executions merged into one statement, as power of two
+    static constexpr uint32 MAX_BATCH_SIZE_SHIFT = 6;
+
+    //! Merged variants of one prepared statement, prepared when a transaction first executes it several times in a row
+    struct BatchStatements
+    {
+        BatchStatements();
+        ~BatchStatements();
+
+        std::unique_ptr<StatementBatch> Batch;  //! nullptr if the statement cannot be merged
+        std::array<std::unique_ptr<MySQLPreparedStatement>, MAX_BATCH_SIZE_SHIFT + 1> Statements; //! Merging 2^i executions
+    };
+
+    bool ReconnectReplica();
+
+    BatchStatements* GetBatchStatements(uint32 index);
+    MySQLPreparedStatement* GetBatchStatement(uint32 index, uint32 sizeShift);
+
+    //! Number of executions of the same statement starting at queries[first] that can be merged
+    std::size_t GetBatchableCount(std::vector<SQLElementData> const& queries, std::size_t first);
+    bool ExecuteBatch(std::vector<PreparedStatementBase*> const& stmts);
+
+    std::unordered_map<uint32, std::unique_ptr<BatchStatements>> m_batchStmts;
+    std::vector<PreparedStatementBase*> m_batch;        //! Executions merged by ExecuteTransaction, reused to not allocate
+
     ProducerConsumerQueue<SQLOperation*>* m_queue;      //! Queue shared with other asynchronous connections.
     std::unique_ptr<DatabaseWorker> m_worker;           //! Core worker task.
     MySQLConnectionInfo& m_connectionInfo;              //! Connection info (used for logging)
     ConnectionFlags m_connectionFlags;                  //! Connection flags (for preparing relevant statements)
+    std::atomic<bool>* m_replicaHealthy;                //! Replica connections only: shared by the replica connections of the pool, cleared while the replica is down
+    ProducerConsumerQueue<SQLOperation*>* m_primaryQueue; //! Replica connections only: queue of the asynchronous primary connections
+    std::chrono::steady_clock::time_point m_nextReplicaReconnect; //! Replica connections only: earliest next attempt to reconnect
+    DatabaseConnectionStatistics m_statistics;          //! Queue wait, execution time and statement counters of this connection
     std::mutex m_Mutex;
 
     MySQLConnection(MySQLConnection const& right) = delete;
@@ -21,20 +21,6 @@
 #include "MySQLHacks.h"
 #include "PreparedStatement.h"
 
-template<typename T>
-struct MySQLType { };
-
-template<> struct MySQLType<uint8> : std::integral_constant<enum_field_types, MYSQL_TYPE_TINY> { };
-template<> struct MySQLType<uint16> : std::integral_constant<enum_field_types, MYSQL_TYPE_SHORT> { };
-template<> struct MySQLType<uint32> : std::integral_constant<enum_field_types, MYSQL_TYPE_LONG> { };
-template<> struct MySQLType<uint64> : std::integral_constant<enum_field_types, MYSQL_TYPE_LONGLONG> { };
-template<> struct MySQLType<int8> : std::integral_constant<enum_field_types, MYSQL_TYPE_TINY> { };
-template<> struct MySQLType<int16> : std::integral_constant<enum_field_types, MYSQL_TYPE_SHORT> { };
-template<> struct MySQLType<int32> : std::integral_constant<enum_field_types, MYSQL_TYPE_LONG> { };
-template<> struct MySQLType<int64> : std::integral_constant<enum_field_types, MYSQL_TYPE_LONGLONG> { };
-template<> struct MySQLType<float> : std::integral_constant<enum_field_types, MYSQL_TYPE_FLOAT> { };
-template<> struct MySQLType<double> : std::integral_constant<enum_field_types, MYSQL_TYPE_DOUBLE> { };
-
 MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt* stmt, std::string_view queryString) :
     m_stmt(nullptr),
     m_Mstmt(stmt),
@@ -69,45 +55,50 @@ void MySQLPreparedStatement::BindParameters(PreparedStatementBase* stmt)
 {
     m_stmt = stmt;     // Cross reference them for debug output
 
-    uint8 pos = 0;
-    for (PreparedStatementData const& data : stmt->GetParameters())
-    {
-        std::visit([&](auto&& param)
-        {
-            SetParameter(pos, param);
-        }, data.data);
-
-        ++pos;
-    }
+    PreparedStatementParameters const& parameters = stmt->GetParameters();
+    for (std::size_t i = 0; i < parameters.GetCount(); ++i)
+        SetParameter(uint32(i), parameters, i);
 
 #ifdef _DEBUG
-    if (pos < m_paramCount)
+    if (parameters.GetCount() < m_paramCount)
         LOG_WARN("sql.sql", "[WARNING]: BindParameters() for statement {} did not bind all allocated parameters", stmt->GetIndex());
 #endif
 }
 
+void MySQLPreparedStatement::BindParameters(std::vector<PreparedStatementBase*> const& stmts, std::size_t first, uint32 count)
+{
+    m_stmt = stmts[first];
+
+    uint32 pos = 0;
+    for (std::size_t i = first; i < first + count; ++i)
+    {
+        PreparedStatementParameters const& parameters = stmts[i]->GetParameters();
+        for (std::size_t j = 0; j < parameters.GetCount(); ++j)
+            SetParameter(pos++, parameters, j);
+    }
+}
+
 void MySQLPreparedStatement::ClearParameters()
 {
+    // the binds point into the parameters of the statement, nothing is owned here
     for (uint32 i=0; i < m_paramCount; ++i)
     {
-        delete m_bind[i].length;
         m_bind[i].length = nullptr;
-        delete[] (char*)m_bind[i].buffer;
         m_bind[i].buffer = nullptr;
         m_paramsSet[i] = false;
     }
 }
 
-static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint8 index, uint32 paramCount)
+static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint32 index, uint32 paramCount)
 {
     LOG_ERROR("sql.driver", "Attempted to bind parameter {}{} on a PreparedStatement {} (statement has only {} parameters)",
-        uint32(index) + 1, (index == 1 ? "st" : (index == 2 ? "nd" : (index == 3 ? "rd" : "nd"))), stmtIndex, paramCount);
+        index + 1, (index == 1 ? "st" : (index == 2 ? "nd" : (index == 3 ? "rd" : "nd"))), stmtIndex, paramCount);
 
     return false;
 }
 
 //- Bind on mysql level
-void MySQLPreparedStatement::AssertValidIndex(uint8 index)
+void MySQLPreparedStatement::AssertValidIndex(uint32 index)
 {
     ASSERT(index < m_paramCount || ParamenterIndexAssertFail(m_stmt->GetIndex(), index, m_paramCount));
 
@@ -115,75 +106,67 @@ void MySQLPreparedStatement::AssertValidIndex(uint8 index)
         LOG_ERROR("sql.sql", "[ERROR] Prepared Statement (id: {}) trying to bind value on already bound index ({}).", m_stmt->GetIndex(), index);
 }
 
-template<typename T>
-void MySQLPreparedStatement::SetParameter(const uint8 index, T value)
+void MySQLPreparedStatement::SetParameter(const uint32 index, PreparedStatementParameters const& parameters, std::size_t parameterIndex)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
-    MYSQL_BIND* param = &m_bind[index];
-    uint32 len = uint32(sizeof(T));
-    param->buffer_type = MySQLType<T>::value;
-    delete[] static_cast<char*>(param->buffer);
-    param->buffer = new char[len];
-    param->buffer_length = 0;
-    param->is_null_value = 0;
-    param->length = nullptr; // Only != NULL for strings
-    param->is_unsigned = std::is_unsigned_v<T>;
-
-    memcpy(param->buffer, &value, len);
-}
 
-void MySQLPreparedStatement::SetParameter(const uint8 index, bool value)
-{
-    SetParameter(index, uint8(value ? 1 : 0));
-}
-
-void MySQLPreparedStatement::SetParameter(const uint8 index, std::nullptr_t /*value*/)
-{
-    AssertValidIndex(index);
-    m_paramsSet[index] = true;
+    PreparedStatementData const& data = parameters[parameterIndex];
     MYSQL_BIND* param = &m_bind[index];
-    param->buffer_type = MYSQL_TYPE_NULL;
-    delete[] static_cast<char*>(param->buffer);
-    param->buffer = nullptr;
+    param->buffer = const_cast<void*>(parameters.GetBuffer(parameterIndex));
     param->buffer_length = 0;
-    param->is_null_value = 1;
-    delete param->length;
-    param->length = nullptr;
-}
-
-void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
-{
-    AssertValidIndex(index);
-    m_paramsSet[index] = true;
-    MYSQL_BIND* param = &m_bind[index];
-    uint32 len = uint32(value.size());
-    param->buffer_type = MYSQL_TYPE_VAR_STRING;
-    delete[] static_cast<char*>(param->buffer);
-    param->buffer = new char[len];
-    param->buffer_length = len;
     param->is_null_value = 0;
-    delete param->length;
-    param->length = new unsigned long(len);
-
-    memcpy(param->buffer, value.c_str(), len);
-}
-
-void MySQLPreparedStatement::SetParameter(uint8 index, std::vector<uint8> const& value)
-{
-    AssertValidIndex(index);
-    m_paramsSet[index] = true;
-    MYSQL_BIND* param = &m_bind[index];
-    uint32 len = uint32(value.size());
-    param->buffer_type = MYSQL_TYPE_BLOB;
-    delete[] static_cast<char*>(param->buffer);
-    param->buffer = new char[len];
-    param->buffer_length = len;
-    param->is_null_value = 0;
-    delete param->length;
-    param->length = new unsigned long(len);
+    param->length = nullptr; // Only != NULL for strings
+    param->is_unsigned = false;
 
-    memcpy(param->buffer, value.data(), len);
+    switch (data.Type)
+    {
+        case PreparedStatementDataType::Bool:
+        case PreparedStatementDataType::UInt8:
+            param->buffer_type = MYSQL_TYPE_TINY;
+            param->is_unsigned = true;
+            break;
+        case PreparedStatementDataType::UInt16:
+            param->buffer_type = MYSQL_TYPE_SHORT;
+            param->is_unsigned = true;
+            break;
+        case PreparedStatementDataType::UInt32:
+            param->buffer_type = MYSQL_TYPE_LONG;
+            param->is_unsigned = true;
+            break;
+        case PreparedStatementDataType::UInt64:
+            param->buffer_type = MYSQL_TYPE_LONGLONG;
+            param->is_unsigned = true;
+            break;
+        case PreparedStatementDataType::Int8:
+            param->buffer_type = MYSQL_TYPE_TINY;
+            break;
+        case PreparedStatementDataType::Int16:
+            param->buffer_type = MYSQL_TYPE_SHORT;
+            break;
+        case PreparedStatementDataType::Int32:
+            param->buffer_type = MYSQL_TYPE_LONG;
+            break;
+        case PreparedStatementDataType::Int64:
+            param->buffer_type = MYSQL_TYPE_LONGLONG;
+            break;
+        case PreparedStatementDataType::Float:
+            param->buffer_type = MYSQL_TYPE_FLOAT;
+            break;
+        case PreparedStatementDataType::Double:
+            param->buffer_type = MYSQL_TYPE_DOUBLE;
+            break;
+        case PreparedStatementDataType::String:
+        case PreparedStatementDataType::Binary:
+            param->buffer_type = data.Type == PreparedStatementDataType::String ? MYSQL_TYPE_VAR_STRING : MYSQL_TYPE_BLOB;
+            param->buffer_length = data.Length;
+            param->length = const_cast<unsigned long*>(&data.Length);
+            break;
+        case PreparedStatementDataType::Null:
+            param->buffer_type = MYSQL_TYPE_NULL;
+            param->is_null_value = 1;
+            break;
+    }
 }
 
 std::string MySQLPreparedStatement::getQueryString() const
@@ -192,14 +175,12 @@ std::string MySQLPreparedStatement::getQueryString() const
 
     std::size_t pos = 0;
 
-    for (PreparedStatementData const& data : m_stmt->GetParameters())
+    PreparedStatementParameters const& parameters = m_stmt->GetParameters();
+    for (std::size_t i = 0; i < parameters.GetCount(); ++i)
     {
         pos = queryString.find('?', pos);
 
-        std::string replaceStr = std::visit([&](auto&& data)
-        {
-            return PreparedStatementData::ToString(data);
-        }, data.data);
+        std::string replaceStr = parameters.ToString(i);
 
         queryString.replace(pos, 1, replaceStr);
         pos += replaceStr.length();
@@ -26,6 +26,7 @@
 
 class MySQLConnection;
 class PreparedStatementBase;
+class PreparedStatementParameters;
 
 //- Class of which the instances are unique per MySQLConnection
 //- access to these class objects is only done when a prepared statement task
@@ -41,22 +42,22 @@ public:
 
     void BindParameters(PreparedStatementBase* stmt);
 
+    /// Binds the parameters of several statements one after another, for statements merged by StatementBatch
+    void BindParameters(std::vector<PreparedStatementBase*> const& stmts, std::size_t first, uint32 count);
+
     uint32 GetParameterCount() const { return m_paramCount; }
 
-protected:
-    void SetParameter(const uint8 index, bool value);
-    void SetParameter(const uint8 index, std::nullptr_t /*value*/);
-    void SetParameter(const uint8 index, std::string const& value);
-    void SetParameter(const uint8 index, std::vector<uint8> const& value);
+    /// The statement as prepared, without parameter values
+    [[nodiscard]] std::string const& GetRawQueryString() const { return m_queryString; }
 
-    template<typename T>
-    void SetParameter(const uint8 index, T value);
+protected:
+    void SetParameter(const uint32 index, PreparedStatementParameters const& parameters, std::size_t parameterIndex);
 
     MySQLStmt* GetSTMT() { return m_Mstmt; }
     MySQLBind* GetBind() { return m_bind; }
     PreparedStatementBase* m_stmt;
     void ClearParameters();
-    void AssertValidIndex(const uint8 index);
+    void AssertValidIndex(const uint32 index);
     std::string getQueryString() const;
 
 private:
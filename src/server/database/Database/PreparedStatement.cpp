@@ -21,6 +21,8 @@
 #include "MySQLConnection.h"
 #include "MySQLWorkaround.h"
 #include "QueryResult.h"
+#include "StringFormat.h"
+#include <algorithm>
 
 PreparedStatementBase::PreparedStatementBase(uint32 index, uint8 capacity) :
     m_index(index),
@@ -28,39 +30,124 @@ PreparedStatementBase::PreparedStatementBase(uint32 index, uint8 capacity) :
 
 PreparedStatementBase::~PreparedStatementBase() { }
 
-//- Bind to buffer
-template<typename T>
-Acore::Types::is_non_string_view_v<T> PreparedStatementBase::SetValidData(const uint8 index, T const& value)
+void PreparedStatementParameters::SetNull(uint8 index)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data.emplace<T>(value);
+    PreparedStatementData& data = At(index);
+    data.Type = PreparedStatementDataType::Null;
+    data.Length = 0;
 }
 
-// Non template functions
-void PreparedStatementBase::SetValidData(const uint8 index)
+void PreparedStatementParameters::SetBytes(uint8 index, PreparedStatementDataType type, void const* bytes, std::size_t size)
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data.emplace<std::nullptr_t>(nullptr);
+    PreparedStatementData& data = At(index);
+    std::size_t required = _bytesUsed + size;
+
+    // past the inline bytes everything moves to the heap once, growing like a vector from there
+    if (required > InlineBytes && _heapBytes.size() < required)
+    {
+        std::vector<char> heapBytes(std::max(required, _heapBytes.size() * 2));
+        std::memcpy(heapBytes.data(), GetBytes(), _bytesUsed);
+        _heapBytes = std::move(heapBytes);
+    }
+
+    char* storage = _heapBytes.empty() ? _inlineBytes.data() : _heapBytes.data();
+    if (size)
+        std::memcpy(storage + _bytesUsed, bytes, size);
+
+    data.Type = type;
+    data.Offset = _bytesUsed;
+    data.Length = static_cast<unsigned long>(size);
+    _bytesUsed = static_cast<uint32>(required);
+}
+
+void const* PreparedStatementParameters::GetBuffer(std::size_t index) const
+{
+    PreparedStatementData const& data = _data[index];
+    switch (data.Type)
+    {
+        case PreparedStatementDataType::String:
+        case PreparedStatementDataType::Binary:
+            return GetBytes() + data.Offset;
+        case PreparedStatementDataType::Null:
+            return nullptr;
+        default:
+            return data.Value;
+    }
+}
+
+namespace
+{
+    template<typename T>
+    std::string ValueToString(PreparedStatementData const& data)
+    {
+        T value;
+        std::memcpy(&value, data.Value, sizeof(T));
+        return Acore::StringFormat("{}", value);
+    }
+}
+
+std::string PreparedStatementParameters::ToString(std::size_t index) const
+{
+    PreparedStatementData const& data = _data[index];
+    switch (data.Type)
+    {
+        case PreparedStatementDataType::Bool:   return ValueToString<bool>(data);
+        case PreparedStatementDataType::UInt8:  return ValueToString<uint8>(data);
+        case PreparedStatementDataType::UInt16: return ValueToString<uint16>(data);
+        case PreparedStatementDataType::UInt32: return ValueToString<uint32>(data);
+        case PreparedStatementDataType::UInt64: return ValueToString<uint64>(data);
+        case PreparedStatementDataType::Int8:   return ValueToString<int8>(data);
+        case PreparedStatementDataType::Int16:  return ValueToString<int16>(data);
+        case PreparedStatementDataType::Int32:  return ValueToString<int32>(data);
+        case PreparedStatementDataType::Int64:  return ValueToString<int64>(data);
+        case PreparedStatementDataType::Float:  return ValueToString<float>(data);
+        case PreparedStatementDataType::Double: return ValueToString<double>(data);
+        case PreparedStatementDataType::String: return std::string(GetBytes() + data.Offset, data.Length);
+        case PreparedStatementDataType::Binary: return "BINARY";
+        case PreparedStatementDataType::Null:   return "NULL";
+    }
+
+    return "";
 }
 
-void PreparedStatementBase::SetValidData(const uint8 index, std::string_view value)
+bool PreparedStatementParameters::operator==(PreparedStatementParameters const& right) const
 {
-    ASSERT(index < statement_data.size());
-    statement_data[index].data.emplace<std::string>(value);
+    if (_data.size() != right._data.size())
+        return false;
+
+    for (std::size_t i = 0; i < _data.size(); ++i)
+    {
+        PreparedStatementData const& left = _data[i];
+        PreparedStatementData const& other = right._data[i];
+        if (left.Type != other.Type)
+            return false;
+
+        // only the member of the type is compared, the other one may hold what was set before
+        switch (left.Type)
+        {
+            case PreparedStatementDataType::String:
+            case PreparedStatementDataType::Binary:
+                if (left.Length != other.Length || (left.Length && std::memcmp(GetBytes() + left.Offset, right.GetBytes() + other.Offset, left.Length)))
+                    return false;
+                break;
+            case PreparedStatementDataType::Null:
+                break;
+            default:
+                // unused value bytes are zeroed by Set
+                if (std::memcmp(left.Value, other.Value, sizeof(left.Value)))
+                    return false;
+                break;
+        }
+    }
+
+    return true;
 }
 
-template void PreparedStatementBase::SetValidData(const uint8 index, uint8 const& value);
-template void PreparedStatementBase::SetValidData(const uint8 index, int8 const& value);
-template void PreparedStatementBase::SetValidData(const uint8 index, uint16 const& value);
-template void PreparedStatementBase::SetValidData(const uint8 index, int16 const& value);
-template void PreparedStatementBase::SetValidData(const uint8 index, uint32 const& value);
-template void PreparedStatementBase::SetValidData(const uint8 index, int32 const& value);
-template void PreparedStatementBase::SetValidData(const uint8 index, uint64 const& value);
-template void PreparedStatementBase::SetValidData(const uint8 index, int64 const& value);
-template void PreparedStatementBase::SetValidData(const uint8 index, bool const& value);
-template void PreparedStatementBase::SetValidData(const uint8 index, float const& value);
-template void PreparedStatementBase::SetValidData(const uint8 index, std::string const& value);
-template void PreparedStatementBase::SetValidData(const uint8 index, std::vector<uint8> const& value);
+PreparedStatementData& PreparedStatementParameters::At(uint8 index)
+{
+    ASSERT(index < _data.size());
+    return _data[index];
+}
 
 //- Execution
 PreparedStatementTask::PreparedStatementTask(PreparedStatementBase* stmt, bool async) :
@@ -99,33 +186,3 @@ bool PreparedStatementTask::Execute()
 
     return m_conn->Execute(m_stmt);
 }
-
-template<typename T>
-std::string PreparedStatementData::ToString(T value)
-{
-    return Acore::StringFormat("{}", value);
-}
-
-template<>
-std::string PreparedStatementData::ToString(std::vector<uint8> /*value*/)
-{
-    return "BINARY";
-}
-
-template std::string PreparedStatementData::ToString(uint8);
-template std::string PreparedStatementData::ToString(uint16);
-template std::string PreparedStatementData::ToString(uint32);
-template std::string PreparedStatementData::ToString(uint64);
-template std::string PreparedStatementData::ToString(int8);
-template std::string PreparedStatementData::ToString(int16);
-template std::string PreparedStatementData::ToString(int32);
-template std::string PreparedStatementData::ToString(int64);
-template std::string PreparedStatementData::ToString(std::string);
-template std::string PreparedStatementData::ToString(float);
-template std::string PreparedStatementData::ToString(double);
-template std::string PreparedStatementData::ToString(bool);
-
-std::string PreparedStatementData::ToString(std::nullptr_t /*value*/)
-{
-    return "NULL";
-}
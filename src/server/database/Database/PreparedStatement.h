@@ -21,46 +21,112 @@
 #include "Define.h"
 #include "Duration.h"
 #include "SQLOperation.h"
+#include <array>
+#include <cstring>
 #include <future>
+#include <string>
 #include <tuple>
-#include <variant>
 #include <vector>
 
 namespace Acore::Types
 {
     template <typename T>
-    using is_default = std::enable_if_t<std::is_arithmetic_v<T> || std::is_same_v<std::vector<uint8>, T>>;
+    using is_default = std::enable_if_t<std::is_arithmetic_v<T>>;
 
     template <typename T>
     using is_enum_v = std::enable_if_t<std::is_enum_v<T>>;
-
-    template <typename T>
-    using is_non_string_view_v = std::enable_if_t<!std::is_base_of_v<std::string_view, T>>;
 }
 
+/// Type of a parameter, unset parameters are bound as false like before
+enum class PreparedStatementDataType : uint8
+{
+    Bool,
+    UInt8,
+    UInt16,
+    UInt32,
+    UInt64,
+    Int8,
+    Int16,
+    Int32,
+    Int64,
+    Float,
+    Double,
+    String,
+    Binary,
+    Null
+};
+
+template<typename T>
+struct PreparedStatementDataTypeOf { };
+
+template<> struct PreparedStatementDataTypeOf<bool> : std::integral_constant<PreparedStatementDataType, PreparedStatementDataType::Bool> { };
+template<> struct PreparedStatementDataTypeOf<uint8> : std::integral_constant<PreparedStatementDataType, PreparedStatementDataType::UInt8> { };
+template<> struct PreparedStatementDataTypeOf<uint16> : std::integral_constant<PreparedStatementDataType, PreparedStatementDataType::UInt16> { };
+template<> struct PreparedStatementDataTypeOf<uint32> : std::integral_constant<PreparedStatementDataType, PreparedStatementDataType::UInt32> { };
+template<> struct PreparedStatementDataTypeOf<uint64> : std::integral_constant<PreparedStatementDataType, PreparedStatementDataType::UInt64> { };
+template<> struct PreparedStatementDataTypeOf<int8> : std::integral_constant<PreparedStatementDataType, PreparedStatementDataType::Int8> { };
+template<> struct PreparedStatementDataTypeOf<int16> : std::integral_constant<PreparedStatementDataType, PreparedStatementDataType::Int16> { };
+template<> struct PreparedStatementDataTypeOf<int32> : std::integral_constant<PreparedStatementDataType, PreparedStatementDataType::Int32> { };
+template<> struct PreparedStatementDataTypeOf<int64> : std::integral_constant<PreparedStatementDataType, PreparedStatementDataType::Int64> { };
+template<> struct PreparedStatementDataTypeOf<float> : std::integral_constant<PreparedStatementDataType, PreparedStatementDataType::Float> { };
+template<> struct PreparedStatementDataTypeOf<double> : std::integral_constant<PreparedStatementDataType, PreparedStatementDataType::Double> { };
+
+/// One parameter. Numbers are stored in place, strings and binary data in the byte storage of PreparedStatementParameters
 struct PreparedStatementData
 {
-    std::variant<
-        bool,
-        uint8,
-        uint16,
-        uint32,
-        uint64,
-        int8,
-        int16,
-        int32,
-        int64,
-        float,
-        double,
-        std::string,
-        std::vector<uint8>,
-        std::nullptr_t
-    > data;
+    PreparedStatementDataType Type = PreparedStatementDataType::Bool;
+    alignas(uint64) uint8 Value[sizeof(uint64)] = { };
+    uint32 Offset = 0;        ///< Offset of strings and binary data in the byte storage
+    unsigned long Length = 0; ///< Length of strings and binary data, unsigned long as MYSQL_BIND::length points here
+};
+
+/**
+ * @brief Parameters of a prepared statement.
+ *
+ * The parameter count is fixed on construction, so the parameters are allocated once. Strings and binary data
+ * are appended to one byte storage that lives inline for short values, and MySQLPreparedStatement binds
+ * MYSQL_BIND straight to this storage.
+ */
+class AC_DATABASE_API PreparedStatementParameters
+{
+public:
+    explicit PreparedStatementParameters(uint8 count = 0) : _data(count) { }
 
     template<typename T>
-    static std::string ToString(T value);
+    void Set(uint8 index, T value)
+    {
+        static_assert(sizeof(T) <= sizeof(uint64));
+
+        PreparedStatementData& data = At(index);
+        data.Type = PreparedStatementDataTypeOf<T>::value;
+        std::memset(data.Value, 0, sizeof(data.Value));
+        std::memcpy(data.Value, &value, sizeof(T));
+        data.Length = 0;
+    }
 
-    static std::string ToString(std::nullptr_t /*value*/);
+    void SetNull(uint8 index);
+    void SetBytes(uint8 index, PreparedStatementDataType type, void const* bytes, std::size_t size);
+
+    [[nodiscard]] std::size_t GetCount() const { return _data.size(); }
+    [[nodiscard]] PreparedStatementData const& operator[](std::size_t index) const { return _data[index]; }
+
+    /// The value a parameter is bound to, numbers in place and strings and binary data in the byte storage
+    [[nodiscard]] void const* GetBuffer(std::size_t index) const;
+
+    [[nodiscard]] std::string ToString(std::size_t index) const;
+
+    bool operator==(PreparedStatementParameters const& right) const;
+
+private:
+    static constexpr std::size_t InlineBytes = 64;
+
+    PreparedStatementData& At(uint8 index);
+    char const* GetBytes() const { return _heapBytes.empty() ? _inlineBytes.data() : _heapBytes.data(); }
+
+    std::vector<PreparedStatementData> _data;
+    std::array<char, InlineBytes> _inlineBytes;
+    std::vector<char> _heapBytes;
+    uint32 _bytesUsed = 0;
 };
 
 //- Upper-level class that is used in code
@@ -72,45 +138,52 @@ public:
     explicit PreparedStatementBase(uint32 index, uint8 capacity);
     virtual ~PreparedStatementBase();
 
-    // Set numerlic and default binary
+    // Set numerlic
     template<typename T>
     inline Acore::Types::is_default<T> SetData(const uint8 index, T value)
     {
-        SetValidData(index, value);
+        statement_data.Set(index, value);
     }
 
     // Set enums
     template<typename T>
     inline Acore::Types::is_enum_v<T> SetData(const uint8 index, T value)
     {
-        SetValidData(index, std::underlying_type_t<T>(value));
+        statement_data.Set(index, std::underlying_type_t<T>(value));
     }
 
     // Set string_view
     inline void SetData(const uint8 index, std::string_view value)
     {
-        SetValidData(index, value);
+        statement_data.SetBytes(index, PreparedStatementDataType::String, value.data(), value.size());
     }
 
     // Set nullptr
     inline void SetData(const uint8 index, std::nullptr_t = nullptr)
     {
-        SetValidData(index);
+        statement_data.SetNull(index);
+    }
+
+    // Set binary
+    inline void SetData(const uint8 index, std::vector<uint8> const& value)
+    {
+        statement_data.SetBytes(index, PreparedStatementDataType::Binary, value.data(), value.size());
     }
 
-    // Set non default binary
     template<std::size_t Size>
     inline void SetData(const uint8 index, std::array<uint8, Size> const& value)
     {
-        std::vector<uint8> vec(value.begin(), value.end());
-        SetValidData(index, vec);
+        statement_data.SetBytes(index, PreparedStatementDataType::Binary, value.data(), value.size());
     }
 
     // Set duration
     template<class _Rep, class _Period>
     inline void SetData(const uint8 index, std::chrono::duration<_Rep, _Period> const& value, bool convertToUin32 = true)
     {
-        SetValidData(index, convertToUin32 ? static_cast<uint32>(value.count()) : value.count());
+        if (convertToUin32)
+            SetData(index, static_cast<uint32>(value.count()));
+        else
+            SetData(index, value.count());
     }
 
     // Set all
@@ -121,15 +194,9 @@ public:
     }
 
     [[nodiscard]] uint32 GetIndex() const { return m_index; }
-    [[nodiscard]] std::vector<PreparedStatementData> const& GetParameters() const { return statement_data; }
+    [[nodiscard]] PreparedStatementParameters const& GetParameters() const { return statement_data; }
 
 protected:
-    template<typename T>
-    Acore::Types::is_non_string_view_v<T> SetValidData(const uint8 index, T const& value);
-
-    void SetValidData(const uint8 index);
-    void SetValidData(const uint8 index, std::string_view value);
-
     template<typename... Ts>
     inline void SetDataTuple(std::tuple<Ts...> const& argsList)
     {
@@ -146,7 +213,7 @@ protected:
     uint32 m_index;
 
     //- Buffer of parameters, not tied to MySQL in any way yet
-    std::vector<PreparedStatementData> statement_data;
+    PreparedStatementParameters statement_data;
 
     PreparedStatementBase(PreparedStatementBase const& right) = delete;
     PreparedStatementBase& operator=(PreparedStatementBase const& right) = delete;
@@ -21,6 +21,7 @@
 #include "MySQLConnection.h"
 #include "PreparedStatement.h"
 #include "QueryResult.h"
+#include <algorithm>
 
 bool SQLQueryHolderBase::SetPreparedQueryImpl(std::size_t index, PreparedStatementBase* stmt)
 {
@@ -56,6 +57,41 @@ void SQLQueryHolderBase::SetPreparedResult(std::size_t index, PreparedResultSet*
         m_queries[index].second = PreparedQueryResult(result);
 }
 
+std::vector<SQLQueryHolderPart> SQLQueryHolderBase::SplitIntoParts(std::size_t maxParts) const
+{
+    std::size_t statementCount = 0;
+    for (std::pair<PreparedStatementBase*, PreparedQueryResult> const& query : m_queries)
+        if (query.first)
+            ++statementCount;
+
+    std::size_t partCount = std::min(maxParts, statementCount);
+    if (partCount <= 1)
+        return { { 0, m_queries.size() } };
+
+    std::vector<SQLQueryHolderPart> parts;
+    parts.reserve(partCount);
+
+    SQLQueryHolderPart part;
+    std::size_t statements = 0;
+    for (std::size_t i = 0; i < m_queries.size(); ++i)
+    {
+        if (!m_queries[i].first)
+            continue;
+
+        // part n ends after statement (n + 1) * statementCount / partCount
+        if (++statements == (parts.size() + 1) * statementCount / partCount)
+        {
+            part.End = i + 1;
+            parts.push_back(part);
+            part.Begin = part.End;
+        }
+    }
+
+    // queries without statement at the end
+    parts.back().End = m_queries.size();
+    return parts;
+}
+
 SQLQueryHolderBase::~SQLQueryHolderBase()
 {
     for (std::pair<PreparedStatementBase*, PreparedQueryResult>& query : m_queries)
@@ -72,16 +108,21 @@ void SQLQueryHolderBase::SetSize(std::size_t size)
     m_queries.resize(size);
 }
 
+SQLQueryHolderTask::SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder)
+    : m_holder(std::move(holder)), m_part{ 0, m_holder->m_queries.size() }, m_completion(std::make_shared<SQLQueryHolderCompletion>(1)) { }
+
 SQLQueryHolderTask::~SQLQueryHolderTask() = default;
 
 bool SQLQueryHolderTask::Execute()
 {
-    /// execute all queries in the holder and pass the results
-    for (std::size_t i = 0; i < m_holder->m_queries.size(); ++i)
+    /// execute the queries of this part and pass the results, other parts only write their own results
+    for (std::size_t i = m_part.Begin; i < m_part.End; ++i)
         if (PreparedStatementBase* stmt = m_holder->m_queries[i].first)
             m_holder->SetPreparedResult(i, m_conn->Query(stmt));
 
-    m_result.set_value();
+    if (m_completion->RemainingParts.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        m_completion->Result.set_value();
+
     return true;
 }
 
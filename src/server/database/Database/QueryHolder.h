@@ -19,11 +19,29 @@
 #define _QUERYHOLDER_H
 
 #include "SQLOperation.h"
+#include <atomic>
 #include <vector>
 
+/// Queries [Begin, End) of a holder, executed by one SQLQueryHolderTask
+struct SQLQueryHolderPart
+{
+    std::size_t Begin = 0;
+    std::size_t End = 0;
+};
+
+/// Shared by the tasks of a holder split into several parts, the last finished part completes the holder
+struct SQLQueryHolderCompletion
+{
+    explicit SQLQueryHolderCompletion(std::size_t parts) : RemainingParts(parts) { }
+
+    std::atomic<std::size_t> RemainingParts;
+    QueryResultHolderPromise Result;
+};
+
 class AC_DATABASE_API SQLQueryHolderBase
 {
 friend class SQLQueryHolderTask;
+template <class T> friend class DatabaseWorkerPool;
 
 public:
     SQLQueryHolderBase() = default;
@@ -32,6 +50,10 @@ public:
     PreparedQueryResult GetPreparedResult(std::size_t index) const;
     void SetPreparedResult(std::size_t index, PreparedResultSet* result);
 
+    /// Splits the queries into at most maxParts consecutive parts holding about the same number of statements,
+    /// every part can be executed on a different connection
+    std::vector<SQLQueryHolderPart> SplitIntoParts(std::size_t maxParts) const;
+
 protected:
     bool SetPreparedQueryImpl(std::size_t index, PreparedStatementBase* stmt);
 
@@ -52,17 +74,21 @@ public:
 class AC_DATABASE_API SQLQueryHolderTask : public SQLOperation
 {
 public:
-    explicit SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder)
-        : m_holder(std::move(holder)) { }
+    explicit SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder);
+
+    /// Executes one part of the holder, the holder is complete once all tasks sharing completion finished
+    SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder, SQLQueryHolderPart part, std::shared_ptr<SQLQueryHolderCompletion> completion)
+        : m_holder(std::move(holder)), m_part(part), m_completion(std::move(completion)) { }
 
     ~SQLQueryHolderTask();
 
     bool Execute() override;
-    QueryResultHolderFuture GetFuture() { return m_result.get_future(); }
+    QueryResultHolderFuture GetFuture() { return m_completion->Result.get_future(); }
 
 private:
     std::shared_ptr<SQLQueryHolderBase> m_holder;
-    QueryResultHolderPromise m_result;
+    SQLQueryHolderPart m_part;
+    std::shared_ptr<SQLQueryHolderCompletion> m_completion;
 };
 
 class AC_DATABASE_API SQLQueryHolderCallback
@@ -21,6 +21,7 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "MySQLWorkaround.h"
+#include <limits>
 
 namespace
 {
@@ -74,6 +75,28 @@ namespace
         }
     }
 
+    static bool IsFixedSizeType(enum_field_types type)
+    {
+        switch (type)
+        {
+            case MYSQL_TYPE_TINY:
+            case MYSQL_TYPE_YEAR:
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_INT24:
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_FLOAT:
+            case MYSQL_TYPE_DOUBLE:
+            case MYSQL_TYPE_LONGLONG:
+            case MYSQL_TYPE_TIMESTAMP:
+            case MYSQL_TYPE_DATE:
+            case MYSQL_TYPE_TIME:
+            case MYSQL_TYPE_DATETIME:
+                return true;
+            default:
+                return false;
+        }
+    }
+
     DatabaseFieldTypes MysqlTypeToFieldType(enum_field_types type)
     {
         switch (type)
@@ -251,7 +274,9 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
     m_fieldCount(fieldCount),
     m_rBind(nullptr),
     m_stmt(stmt),
-    m_metadataResult(result)
+    m_metadataResult(result),
+    m_data(nullptr),
+    m_currentRowPosition(std::numeric_limits<uint64>::max())
 {
     if (!m_metadataResult)
         return;
@@ -279,6 +304,7 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
     {
         LOG_WARN("sql.sql", "{}:mysql_stmt_store_result, cannot bind result from MySQL server. Error: {}", __FUNCTION__, mysql_stmt_error(m_stmt));
         delete[] m_rBind;
+        m_rBind = nullptr;
         delete[] m_isNull;
         delete[] m_length;
         return;
@@ -289,6 +315,7 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
     //- This is where we prepare the buffer based on metadata
     MySQLField* field = reinterpret_cast<MySQLField*>(mysql_fetch_fields(m_metadataResult));
     m_fieldMetadata.resize(m_fieldCount);
+    m_columns.resize(m_fieldCount);
     std::size_t rowSize = 0;
 
     for (uint32 i = 0; i < m_fieldCount; ++i)
@@ -298,6 +325,11 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
 
         InitializeDatabaseFieldMetadata(&m_fieldMetadata[i], &field[i], i);
 
+        m_columns[i].Stride = size;
+        m_columns[i].Type = m_fieldMetadata[i].Type;
+        if (!IsFixedSizeType(field[i].type))
+            m_columns[i].Lengths.resize(m_rowCount);
+
         m_rBind[i].buffer_type = field[i].type;
         m_rBind[i].buffer_length = size;
         m_rBind[i].length = &m_length[i];
@@ -306,11 +338,13 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
         m_rBind[i].is_unsigned = field[i].flags & UNSIGNED_FLAG;
     }
 
-    char* dataBuffer = new char[rowSize * m_rowCount];
-    for (uint32 i = 0, offset = 0; i < m_fieldCount; ++i)
+    //- Every column gets its own block, so the rows are fetched straight into their final place and a column is read sequentially
+    m_data = new char[rowSize * m_rowCount];
+    for (std::size_t i = 0, offset = 0; i < m_fieldCount; ++i)
     {
-        m_rBind[i].buffer = dataBuffer + offset;
-        offset += m_rBind[i].buffer_length;
+        m_columns[i].Data = m_data + offset;
+        m_rBind[i].buffer = m_columns[i].Data;
+        offset += m_columns[i].Stride * m_rowCount;
     }
 
     //- This is where we bind the bind the buffer to the statement
@@ -324,19 +358,17 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
         return;
     }
 
-    m_rows.resize(uint32(m_rowCount) * m_fieldCount);
-
     while (_NextRow())
     {
         for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
         {
-            m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetMetadata(&m_fieldMetadata[fIndex]);
+            Column& column = m_columns[fIndex];
 
             unsigned long buffer_length = m_rBind[fIndex].buffer_length;
             unsigned long fetched_length = *m_rBind[fIndex].length;
+            void* buffer = m_stmt->bind[fIndex].buffer;
             if (!*m_rBind[fIndex].is_null)
             {
-                void* buffer = m_stmt->bind[fIndex].buffer;
                 switch (m_rBind[fIndex].buffer_type)
                 {
                 case MYSQL_TYPE_TINY_BLOB:
@@ -357,15 +389,20 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
                     break;
                 }
 
-                m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetByteValue((char const*)buffer, fetched_length);
-
-                // move buffer pointer to next part
-                m_stmt->bind[fIndex].buffer = (char*)buffer + rowSize;
+                if (!column.Lengths.empty())
+                    column.Lengths[m_rowPosition] = fetched_length;
             }
             else
             {
-                m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetByteValue(nullptr, *m_rBind[fIndex].length);
+                // nullable columns only pay for the flags once they really hold a NULL
+                if (column.Nulls.empty())
+                    column.Nulls.resize(m_rowCount);
+
+                column.Nulls[m_rowPosition] = 1;
             }
+
+            // move buffer pointer to the value of the next row
+            m_stmt->bind[fIndex].buffer = (char*)buffer + column.Stride;
         }
 
         m_rowPosition++;
@@ -373,6 +410,10 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
 
     m_rowPosition = 0;
 
+    m_currentRow.resize(m_fieldCount);
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+        m_currentRow[i].SetMetadata(&m_fieldMetadata[i]);
+
     /// All data is buffered, let go of mysql c api structures
     mysql_stmt_free_result(m_stmt);
 }
@@ -406,27 +447,51 @@ bool PreparedResultSet::_NextRow()
 Field* PreparedResultSet::Fetch() const
 {
     ASSERT(m_rowPosition < m_rowCount);
-    return const_cast<Field*>(&m_rows[uint32(m_rowPosition) * m_fieldCount]);
+    return GetCurrentRow();
 }
 
 Field const& PreparedResultSet::operator[](std::size_t index) const
 {
     ASSERT(m_rowPosition < m_rowCount);
     ASSERT(index < m_fieldCount);
-    return m_rows[uint32(m_rowPosition) * m_fieldCount + index];
+    return GetCurrentRow()[index];
+}
+
+Field* PreparedResultSet::GetCurrentRow() const
+{
+    if (m_currentRowPosition != m_rowPosition)
+    {
+        for (uint32 i = 0; i < m_fieldCount; ++i)
+        {
+            Column const& column = m_columns[i];
+            if (column.IsNull(m_rowPosition))
+                m_currentRow[i].SetByteValue(nullptr, 0);
+            else
+                m_currentRow[i].SetByteValue(column.GetValue(m_rowPosition), column.GetLength(m_rowPosition));
+        }
+
+        m_currentRowPosition = m_rowPosition;
+    }
+
+    return m_currentRow.data();
 }
 
 void PreparedResultSet::CleanUp()
 {
     if (m_metadataResult)
+    {
         mysql_free_result(m_metadataResult);
+        m_metadataResult = nullptr;
+    }
 
     if (m_rBind)
     {
-        delete[](char*)m_rBind->buffer;
         delete[] m_rBind;
         m_rBind = nullptr;
     }
+
+    delete[] m_data;
+    m_data = nullptr;
 }
 
 void PreparedResultSet::AssertRows(std::size_t sizeRows)
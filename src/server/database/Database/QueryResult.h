@@ -20,8 +20,15 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "Errors.h"
 #include "Field.h"
+#include "Optional.h"
+#include "StringConvert.h"
+#include "Types.h"
+#include <cstring>
 #include <tuple>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
 template<typename T>
@@ -97,6 +104,20 @@ private:
 
 class AC_DATABASE_API PreparedResultSet
 {
+    /// Values of one column in all rows, stored next to each other as MySQL wrote them
+    struct Column
+    {
+        char* Data = nullptr;           ///< Value of row n starts at Data + n * Stride
+        uint32 Stride = 0;
+        DatabaseFieldTypes Type = DatabaseFieldTypes::Null;
+        std::vector<uint32> Lengths;    ///< Fetched length of every row, empty for fixed size types
+        std::vector<uint8> Nulls;       ///< Empty as long as the column holds no NULL
+
+        [[nodiscard]] bool IsNull(uint64 row) const { return !Nulls.empty() && Nulls[row]; }
+        [[nodiscard]] char const* GetValue(uint64 row) const { return Data + row * Stride; }
+        [[nodiscard]] uint32 GetLength(uint64 row) const { return Lengths.empty() ? Stride : Lengths[row]; }
+    };
+
 public:
     PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount);
     ~PreparedResultSet();
@@ -105,6 +126,7 @@ public:
     [[nodiscard]] uint64 GetRowCount() const { return m_rowCount; }
     [[nodiscard]] uint32 GetFieldCount() const { return m_fieldCount; }
 
+    /// Fields of the current row, like ResultSet::Fetch the pointer is only valid until the next NextRow call
     [[nodiscard]] Field* Fetch() const;
     Field const& operator[](std::size_t index) const;
 
@@ -114,22 +136,93 @@ public:
         AssertRows(sizeof...(Ts));
 
         std::tuple<Ts...> theTuple = {};
+        Field const* fields = GetCurrentRow();
 
-        std::apply([this](Ts&... args)
+        std::apply([fields](Ts&... args)
         {
             uint8 index{ 0 };
-            ((args = m_rows[uint32(m_rowPosition) * m_fieldCount + index].Get<Ts>(), index++), ...);
+            ((args = fields[index].Get<Ts>(), index++), ...);
         }, theTuple);
 
         return theTuple;
     }
 
+    /**
+     * @brief Value of a column of the current row, read straight from the result buffer.
+     *
+     * Unlike Field::Get there is no conversion, T has to match the column type (checked in debug builds only).
+     * NULL is returned as a value initialized T, or std::nullopt for Optional<T>.
+     */
+    template<typename T>
+    [[nodiscard]] T Get(std::size_t index) const
+    {
+        ASSERT(m_rowPosition < m_rowCount);
+        ASSERT(index < m_fieldCount);
+#ifdef ACORE_DEBUG
+        AssertColumnType<T>(index);
+#endif
+        return GetValue<T>(m_columns[index], m_rowPosition);
+    }
+
+    /// Range over all rows of the result, dereferencing an iterator reads a row as std::tuple<Ts...>
+    template<typename... Ts>
+    class TypedRows
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type   = std::ptrdiff_t;
+            using value_type        = std::tuple<Ts...>;
+            using pointer           = value_type*;
+            using reference         = value_type;
+
+            iterator(PreparedResultSet const* result, uint64 row) : _result(result), _row(row) { }
+
+            value_type operator*() const { return _result->ReadRow<value_type>(_row, std::index_sequence_for<Ts...>()); }
+            iterator& operator++() { ++_row; return *this; }
+
+            bool operator!=(iterator const& right) const { return _row != right._row; }
+
+        private:
+            PreparedResultSet const* _result;
+            uint64 _row;
+        };
+
+        explicit TypedRows(PreparedResultSet const* result) : _result(result) { }
+
+        [[nodiscard]] iterator begin() const { return iterator(_result, 0); }
+        [[nodiscard]] iterator end() const { return iterator(_result, _result->m_rowCount); }
+
+    private:
+        PreparedResultSet const* _result;
+    };
+
+    /**
+     * @brief Typed view of all rows, for loaders walking big tables.
+     *
+     * for (auto [entry, id, x, y, z, o] : result->Rows<uint32, uint32, float, float, float, Optional<float>>())
+     *
+     * The column types are checked once here instead of for every field, rows are read without creating Fields.
+     */
+    template<typename... Ts>
+    [[nodiscard]] TypedRows<Ts...> Rows() const
+    {
+        ASSERT(sizeof...(Ts) == m_fieldCount, "> Tuple size != count fields");
+
+        std::size_t index = 0;
+        (AssertColumnType<Ts>(index++), ...);
+
+        return TypedRows<Ts...>(this);
+    }
+
     auto begin()        { return ResultIterator<PreparedResultSet>(this); }
     static auto end()   { return ResultIterator<PreparedResultSet>(nullptr); }
 
 protected:
     std::vector<QueryResultFieldMetadata> m_fieldMetadata;
-    std::vector<Field> m_rows;
+    std::vector<Column> m_columns;
     uint64 m_rowCount;
     uint64 m_rowPosition;
     uint32 m_fieldCount;
@@ -138,12 +231,92 @@ private:
     MySQLBind* m_rBind;
     MySQLStmt* m_stmt;
     MySQLResult* m_metadataResult;    ///< Field metadata, returned by mysql_stmt_result_metadata
+    char* m_data;                     ///< Values of all columns, column after column
+
+    mutable std::vector<Field> m_currentRow; ///< Fields handed out by Fetch, only filled when requested
+    mutable uint64 m_currentRowPosition;
 
     void CleanUp();
     bool _NextRow();
 
+    Field* GetCurrentRow() const;
+
     void AssertRows(std::size_t sizeRows);
 
+    template<typename T>
+    static constexpr bool IsColumnType(DatabaseFieldTypes type)
+    {
+        if constexpr (Acore::is_optional_v<T>)
+            return IsColumnType<typename T::value_type>(type);
+        else if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, int8> || std::is_same_v<T, uint8>)
+            return type == DatabaseFieldTypes::Int8;
+        else if constexpr (std::is_same_v<T, int16> || std::is_same_v<T, uint16>)
+            return type == DatabaseFieldTypes::Int16;
+        else if constexpr (std::is_same_v<T, int32> || std::is_same_v<T, uint32>)
+            return type == DatabaseFieldTypes::Int32;
+        else if constexpr (std::is_same_v<T, int64> || std::is_same_v<T, uint64>)
+            return type == DatabaseFieldTypes::Int64;
+        else if constexpr (std::is_same_v<T, float>)
+            return type == DatabaseFieldTypes::Float;
+        else if constexpr (std::is_same_v<T, double>)
+            return type == DatabaseFieldTypes::Double || type == DatabaseFieldTypes::Decimal;
+        else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>)
+            return type == DatabaseFieldTypes::Binary || type == DatabaseFieldTypes::Decimal;
+        else if constexpr (std::is_same_v<T, Binary>)
+            return type == DatabaseFieldTypes::Binary;
+        else
+            static_assert(Acore::dependant_false_v<T>, "Unsupported type used for PreparedResultSet::Get");
+    }
+
+    template<typename T>
+    void AssertColumnType(std::size_t index) const
+    {
+        ASSERT(IsColumnType<T>(m_columns[index].Type), "> Type {} does not match column {} ({}.{} is {})",
+            typeid(T).name(), index, m_fieldMetadata[index].TableName, m_fieldMetadata[index].Name, m_fieldMetadata[index].TypeName);
+    }
+
+    template<typename T>
+    static T GetValue(Column const& column, uint64 row)
+    {
+        if constexpr (Acore::is_optional_v<T>)
+        {
+            if (column.IsNull(row))
+                return std::nullopt;
+
+            return GetValue<typename T::value_type>(column, row);
+        }
+        else
+        {
+            if (column.IsNull(row))
+                return T{};
+
+            char const* value = column.GetValue(row);
+            if constexpr (std::is_same_v<T, bool>)
+                return *value != 0;
+            else if constexpr (std::is_arithmetic_v<T>)
+            {
+                // DECIMAL is transferred as text
+                if constexpr (std::is_same_v<T, double>)
+                    if (column.Type == DatabaseFieldTypes::Decimal)
+                        return Acore::StringTo<double>(std::string_view(value, column.GetLength(row))).value_or(0.0);
+
+                T result;
+                std::memcpy(&result, value, sizeof(T));
+                return result;
+            }
+            else if constexpr (std::is_same_v<T, Binary>)
+                return Binary(value, value + column.GetLength(row));
+            else
+                return T(value, column.GetLength(row));
+        }
+    }
+
+    template<typename Tuple, std::size_t... Indexes>
+    Tuple ReadRow(uint64 row, std::index_sequence<Indexes...>) const
+    {
+        return Tuple(GetValue<std::tuple_element_t<Indexes, Tuple>>(m_columns[Indexes], row)...);
+    }
+
     PreparedResultSet(PreparedResultSet const& right) = delete;
     PreparedResultSet& operator=(PreparedResultSet const& right) = delete;
 };
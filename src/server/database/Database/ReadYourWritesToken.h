@@ -0,0 +1,54 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _READYOURWRITESTOKEN_H
+#define _READYOURWRITESTOKEN_H
+
+#include "Define.h"
+#include <chrono>
+
+/**
+ * @brief Writes of one owner that a read replica may not have replicated yet.
+ *
+ * Reads passing the token are kept on the primary while a write of the owner is queued, and afterwards until the read
+ * replica had the time to replicate the last committed one. The allowed replication lag is configured per database
+ * (<Name>Database.ReplicaMaxLag).
+ */
+class ReadYourWritesToken
+{
+public:
+    /// Call when queueing a write the owner has to read back
+    void OnWriteQueued() { ++_pendingWrites; }
+
+    /// Call from the completion callback of the write, the replica starts replicating it only now
+    void OnWriteCommitted()
+    {
+        --_pendingWrites;
+        _lastCommit = std::chrono::steady_clock::now();
+    }
+
+    [[nodiscard]] bool IsReplicated(std::chrono::milliseconds maxLag) const
+    {
+        return !_pendingWrites && std::chrono::steady_clock::now() - _lastCommit >= maxLag;
+    }
+
+private:
+    uint32 _pendingWrites = 0;
+    std::chrono::steady_clock::time_point _lastCommit;
+};
+
+#endif
@@ -20,6 +20,7 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include <chrono>
 #include <variant>
 
 //- Type specifier of our element data
@@ -54,6 +55,7 @@ public:
     virtual void SetConnection(MySQLConnection* con) { m_conn = con; }
 
     MySQLConnection* m_conn{nullptr};
+    std::chrono::steady_clock::time_point m_enqueueTime; //! Set when queued for an asynchronous connection
 
 private:
     SQLOperation(SQLOperation const& right) = delete;
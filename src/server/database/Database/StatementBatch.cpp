@@ -0,0 +1,204 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StatementBatch.h"
+#include <algorithm>
+#include <cctype>
+#include <vector>
+
+namespace
+{
+    bool IsIdentifierChar(char c)
+    {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '`' || c == '.';
+    }
+
+    std::string_view Trim(std::string_view str)
+    {
+        std::size_t first = str.find_first_not_of(" \t\r\n");
+        if (first == std::string_view::npos)
+            return {};
+
+        std::size_t last = str.find_last_not_of(" \t\r\n;");
+        return str.substr(first, last - first + 1);
+    }
+
+    /// Position of keyword as a whole word outside of string literals
+    std::size_t FindKeyword(std::string_view sql, std::string_view keyword)
+    {
+        char quote = 0;
+        for (std::size_t i = 0; i + keyword.size() <= sql.size(); ++i)
+        {
+            char c = sql[i];
+            if (quote)
+            {
+                if (c == '\\')
+                    ++i;
+                else if (c == quote)
+                    quote = 0;
+
+                continue;
+            }
+
+            if (c == '\'' || c == '"')
+            {
+                quote = c;
+                continue;
+            }
+
+            if (i > 0 && IsIdentifierChar(sql[i - 1]))
+                continue;
+
+            if (i + keyword.size() < sql.size() && IsIdentifierChar(sql[i + keyword.size()]))
+                continue;
+
+            if (std::equal(keyword.begin(), keyword.end(), sql.begin() + i, [](char a, char b) { return std::toupper(static_cast<unsigned char>(a)) == std::toupper(static_cast<unsigned char>(b)); }))
+                return i;
+        }
+
+        return std::string_view::npos;
+    }
+
+    std::size_t FindClosingParenthesis(std::string_view sql, std::size_t open)
+    {
+        uint32 depth = 0;
+        char quote = 0;
+        for (std::size_t i = open; i < sql.size(); ++i)
+        {
+            char c = sql[i];
+            if (quote)
+            {
+                if (c == '\\')
+                    ++i;
+                else if (c == quote)
+                    quote = 0;
+            }
+            else if (c == '\'' || c == '"')
+                quote = c;
+            else if (c == '(')
+                ++depth;
+            else if (c == ')' && !--depth)
+                return i;
+        }
+
+        return std::string_view::npos;
+    }
+}
+
+Optional<StatementBatch> StatementBatch::Create(std::string_view sql)
+{
+    sql = Trim(sql);
+
+    if (FindKeyword(sql, "INSERT") == 0 || FindKeyword(sql, "REPLACE") == 0)
+    {
+        // INSERT ... SELECT and ON DUPLICATE KEY UPDATE depend on the rows inserted before
+        if (FindKeyword(sql, "SELECT") != std::string_view::npos || FindKeyword(sql, "DUPLICATE") != std::string_view::npos)
+            return {};
+
+        std::size_t values = FindKeyword(sql, "VALUES");
+        if (values == std::string_view::npos)
+            return {};
+
+        std::size_t rowStart = sql.find_first_not_of(" \t\r\n", values + 6);
+        if (rowStart == std::string_view::npos || sql[rowStart] != '(')
+            return {};
+
+        // the row has to end the statement, there is nothing to merge in statements inserting several rows already
+        if (FindClosingParenthesis(sql, rowStart) != sql.size() - 1)
+            return {};
+
+        return StatementBatch(std::string(sql.substr(0, rowStart)), std::string(sql.substr(rowStart)), "");
+    }
+
+    if (FindKeyword(sql, "DELETE") == 0)
+    {
+        std::size_t where = FindKeyword(sql, "WHERE");
+        if (where == std::string_view::npos)
+            return {};
+
+        // single table deletes only, no joins
+        std::string_view table = Trim(sql.substr(6, where - 6));
+        if (FindKeyword(table, "FROM") != 0)
+            return {};
+
+        table = Trim(table.substr(4));
+        if (table.empty() || !std::all_of(table.begin(), table.end(), IsIdentifierChar))
+            return {};
+
+        // the condition must be column = ? [AND column = ? ...], which also rules out ORDER BY and LIMIT
+        std::vector<std::string_view> columns;
+        std::string_view condition = sql.substr(where + 5);
+        for (;;)
+        {
+            std::size_t next = FindKeyword(condition, "AND");
+            std::string_view term = Trim(condition.substr(0, next));
+
+            std::size_t equals = term.find('=');
+            if (equals == std::string_view::npos || Trim(term.substr(equals + 1)) != "?")
+                return {};
+
+            std::string_view column = Trim(term.substr(0, equals));
+            if (column.empty() || !std::all_of(column.begin(), column.end(), IsIdentifierChar))
+                return {};
+
+            columns.push_back(column);
+
+            if (next == std::string_view::npos)
+                break;
+
+            condition = condition.substr(next + 3);
+        }
+
+        std::string head(sql.substr(0, where + 5));
+        std::string row;
+        if (columns.size() == 1)
+        {
+            head.append(" ").append(columns.front()).append(" IN (");
+            row = "?";
+        }
+        else
+        {
+            head.append(" (");
+            row = "(";
+            for (std::size_t i = 0; i < columns.size(); ++i)
+            {
+                head.append(i ? ", " : "").append(columns[i]);
+                row.append(i ? ", ?" : "?");
+            }
+
+            head.append(") IN (");
+            row.append(")");
+        }
+
+        return StatementBatch(std::move(head), std::move(row), ")");
+    }
+
+    return {};
+}
+
+std::string StatementBatch::GetQuery(uint32 rowCount) const
+{
+    std::string query;
+    query.reserve(_head.size() + (_row.size() + 2) * rowCount + _tail.size());
+
+    query.append(_head);
+    for (uint32 i = 0; i < rowCount; ++i)
+        query.append(i ? ", " : "").append(_row);
+
+    query.append(_tail);
+    return query;
+}
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _STATEMENTBATCH_H
+#define _STATEMENTBATCH_H
+
+#include "Define.h"
+#include "Optional.h"
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Rewrites a prepared statement so one execution covers several consecutive executions of it.
+ *
+ * Supported are
+ *   INSERT / REPLACE ... VALUES (?, ?)        -> ... VALUES (?, ?), (?, ?), ...
+ *   DELETE FROM t WHERE a = ?                 -> DELETE FROM t WHERE a IN (?, ?, ...)
+ *   DELETE FROM t WHERE a = ? AND b = ?       -> DELETE FROM t WHERE (a, b) IN ((?, ?), (?, ?), ...)
+ * The parameters of the merged statement are the parameters of every execution, one after another.
+ */
+class AC_DATABASE_API StatementBatch
+{
+public:
+    /// nullopt if the statement cannot be merged
+    static Optional<StatementBatch> Create(std::string_view sql);
+
+    [[nodiscard]] std::string GetQuery(uint32 rowCount) const;
+
+private:
+    StatementBatch(std::string head, std::string row, std::string tail)
+        : _head(std::move(head)), _row(std::move(row)), _tail(std::move(tail)) { }
+
+    std::string _head;
+    std::string _row;
+    std::string _tail;
+};
+
+#endif
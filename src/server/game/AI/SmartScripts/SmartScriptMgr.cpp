@@ -73,19 +73,8 @@ void SmartWaypointMgr::LoadFromDB()
     uint32 last_entry = 0;
     uint32 last_id = 1;
 
-    do
+    for (auto [entry, id, x, y, z, o, delay] : result->Rows<uint32, uint32, float, float, float, Optional<float>, uint32>())
     {
-        Field* fields = result->Fetch();
-        uint32 entry = fields[0].Get<uint32>();
-        uint32 id = fields[1].Get<uint32>();
-        float x = fields[2].Get<float>();
-        float y = fields[3].Get<float>();
-        float z = fields[4].Get<float>();
-        Optional<float> o;
-        if (!fields[5].IsNull())
-            o = fields[5].Get<float>();
-        uint32 delay = fields[6].Get<uint32>();
-
         if (last_entry != entry)
         {
             waypoint_map[entry] = new WPPath();
@@ -101,7 +90,7 @@ void SmartWaypointMgr::LoadFromDB()
 
         last_entry = entry;
         total++;
-    } while (result->NextRow());
+    }
 
     LOG_INFO("server.loading", ">> Loaded {} SmartAI waypoint paths (total {} waypoints) in {} ms", count, total, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
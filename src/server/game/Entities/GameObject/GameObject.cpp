@@ -2599,6 +2599,10 @@ void GameObject::EnableCollision(bool enable)
         phaseMask = GetPhaseMask();
 
     m_model->enable(phaseMask);
+
+    // heights and line of sight may change without the model being added or removed, e.g. doors
+    if (Map* map = FindMap())
+        map->UpdateGameObjectModelCollision(*m_model);
 }
 
 void GameObject::UpdateModel()
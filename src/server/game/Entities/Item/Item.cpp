@@ -1150,10 +1150,10 @@ bool Item::IsBindedNotWith(Player const* player) const
     return true;
 }
 
-void Item::BuildUpdate(UpdateDataMapType& data_map, UpdatePlayerSet&)
+void Item::BuildUpdate(UpdatePlayerList& players)
 {
     if (Player* owner = GetOwner())
-        BuildFieldsUpdate(owner, data_map);
+        BuildFieldsUpdate(owner, players);
     ClearUpdateMask(false);
 }
 
@@ -25,6 +25,7 @@
 #include "GameObjectAI.h"
 #include "GameTime.h"
 #include "GridNotifiers.h"
+#include "IVMapMgr.h"
 #include "Log.h"
 #include "MapMgr.h"
 #include "MiscPackets.h"
@@ -542,18 +543,15 @@ void Object::ClearUpdateMask(bool remove)
     }
 }
 
-void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map)
+void Object::BuildFieldsUpdate(Player* player, UpdatePlayerList& players)
 {
-    UpdateDataMapType::iterator iter = data_map.find(player);
+    UpdateData& data = player->GetObjectUpdateData();
 
-    if (iter == data_map.end())
-    {
-        std::pair<UpdateDataMapType::iterator, bool> p = data_map.insert(UpdateDataMapType::value_type(player, UpdateData()));
-        ASSERT(p.second);
-        iter = p.first;
-    }
+    // the buffer is flushed and cleared at the end of every pass, so an empty one means this is the first block for the player
+    if (!data.HasData())
+        players.push_back(player);
 
-    BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+    BuildValuesUpdateBlockForPlayer(&data, player);
 }
 
 uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
@@ -1339,19 +1337,9 @@ bool WorldObject::IsWithinLOS(float ox, float oy, float oz, VMAP::ModelIgnoreFla
 {
     if (IsInWorld())
     {
-        oz += GetCollisionHeight();
-        float x, y, z;
-        if (IsPlayer())
-        {
-            GetPosition(x, y, z);
-            z += GetCollisionHeight();
-        }
-        else
-        {
-            GetHitSpherePointFor({ ox, oy, oz }, x, y, z);
-        }
-
-        return GetMap()->isInLineOfSight(x, y, z, ox, oy, oz, GetPhaseMask(), checks, ignoreFlags);
+        VMAP::LineOfSightQuery query;
+        GetLineOfSightSegment(ox, oy, oz, query);
+        return GetMap()->isInLineOfSight(query.start.x, query.start.y, query.start.z, query.end.x, query.end.y, query.end.z, GetPhaseMask(), checks, ignoreFlags);
     }
     return true;
 }
@@ -1361,6 +1349,31 @@ bool WorldObject::IsWithinLOSInMap(WorldObject const* obj, VMAP::ModelIgnoreFlag
    if (!IsInMap(obj))
         return false;
 
+    VMAP::LineOfSightQuery query;
+    GetLineOfSightSegment(obj, query, collisionHeight, combatReach);
+    return GetMap()->isInLineOfSight(query.start.x, query.start.y, query.start.z, query.end.x, query.end.y, query.end.z, GetPhaseMask(), checks, ignoreFlags);
+}
+
+void WorldObject::GetLineOfSightSegment(float ox, float oy, float oz, VMAP::LineOfSightQuery& query) const
+{
+    oz += GetCollisionHeight();
+    float x, y, z;
+    if (IsPlayer())
+    {
+        GetPosition(x, y, z);
+        z += GetCollisionHeight();
+    }
+    else
+    {
+        GetHitSpherePointFor({ ox, oy, oz }, x, y, z);
+    }
+
+    query.start = G3D::Vector3(x, y, z);
+    query.end = G3D::Vector3(ox, oy, oz);
+}
+
+void WorldObject::GetLineOfSightSegment(WorldObject const* obj, VMAP::LineOfSightQuery& query, Optional<float> collisionHeight /*= { }*/, Optional<float> combatReach /*= { }*/) const
+{
     float ox, oy, oz;
     if (obj->IsPlayer())
     {
@@ -1379,7 +1392,8 @@ bool WorldObject::IsWithinLOSInMap(WorldObject const* obj, VMAP::ModelIgnoreFlag
     else
         GetHitSpherePointFor({ obj->GetPositionX(), obj->GetPositionY(), obj->GetPositionZ() + obj->GetCollisionHeight() }, x, y, z, collisionHeight, combatReach);
 
-    return GetMap()->isInLineOfSight(x, y, z, ox, oy, oz, GetPhaseMask(), checks, ignoreFlags);
+    query.start = G3D::Vector3(x, y, z);
+    query.end = G3D::Vector3(ox, oy, oz);
 }
 
 void WorldObject::GetHitSpherePointFor(Position const& dest, float& x, float& y, float& z, Optional<float> collisionHeight, Optional<float> combatReach) const
@@ -3027,88 +3041,6 @@ void WorldObject::AddToNotify(uint16 f)
         }
 }
 
-struct WorldObjectChangeAccumulator
-{
-    UpdateDataMapType& i_updateDatas;
-    UpdatePlayerSet& i_playerSet;
-    WorldObject& i_object;
-    WorldObjectChangeAccumulator(WorldObject& obj, UpdateDataMapType& d, UpdatePlayerSet& p) : i_updateDatas(d), i_playerSet(p), i_object(obj)
-    {
-        i_playerSet.clear();
-    }
-    void Visit(PlayerMapType& m)
-    {
-        Player* source = nullptr;
-        for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
-        {
-            source = iter->GetSource();
-
-            BuildPacket(source);
-
-            if (source->HasSharedVision())
-            {
-                SharedVisionList::const_iterator it = source->GetSharedVisionList().begin();
-                for (; it != source->GetSharedVisionList().end(); ++it)
-                    BuildPacket(*it);
-            }
-        }
-    }
-
-    void Visit(CreatureMapType& m)
-    {
-        Creature* source = nullptr;
-        for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
-        {
-            source = iter->GetSource();
-            if (source->HasSharedVision())
-            {
-                SharedVisionList::const_iterator it = source->GetSharedVisionList().begin();
-                for (; it != source->GetSharedVisionList().end(); ++it)
-                    BuildPacket(*it);
-            }
-        }
-    }
-
-    void Visit(DynamicObjectMapType& m)
-    {
-        DynamicObject* source = nullptr;
-        for (DynamicObjectMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
-        {
-            source = iter->GetSource();
-            ObjectGuid guid = source->GetCasterGUID();
-
-            if (guid)
-            {
-                //Caster may be nullptr if DynObj is in removelist
-                if (Player* caster = ObjectAccessor::FindPlayer(guid))
-                    if (caster->GetGuidValue(PLAYER_FARSIGHT) == source->GetGUID())
-                        BuildPacket(caster);
-            }
-        }
-    }
-
-    void BuildPacket(Player* player)
-    {
-        // Only send update once to a player
-        if (i_playerSet.find(player->GetGUID()) == i_playerSet.end() && player->HaveAtClient(&i_object))
-        {
-            i_object.BuildFieldsUpdate(player, i_updateDatas);
-            i_playerSet.insert(player->GetGUID());
-        }
-    }
-
-    template<class SKIP> void Visit(GridRefMgr<SKIP>&) {}
-};
-
-void WorldObject::BuildUpdate(UpdateDataMapType& data_map, UpdatePlayerSet& player_set)
-{
-    WorldObjectChangeAccumulator notifier(*this, data_map, player_set);
-    //we must build packets for all visible players
-    Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
-
-    ClearUpdateMask(false);
-}
-
 void WorldObject::GetCreaturesWithEntryInRange(std::list<Creature*>& creatureList, float radius, uint32 entry)
 {
     Acore::AllCreaturesOfEntryInRange check(this, entry, radius);
@@ -37,6 +37,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "UpdateFields.h"
 
@@ -95,8 +96,8 @@ class MotionTransport;
 
 struct PositionFullTerrainStatus;
 
-typedef std::unordered_map<Player*, UpdateData> UpdateDataMapType;
-typedef GuidUnorderedSet UpdatePlayerSet;
+// Players that received at least one block in the current Map::SendObjectUpdates pass, each one accumulates into Player::GetObjectUpdateData()
+typedef std::vector<Player*> UpdatePlayerList;
 
 static constexpr Milliseconds HEARTBEAT_INTERVAL = 5s + 200ms;
 
@@ -189,8 +190,10 @@ public:
 
     [[nodiscard]] virtual bool hasQuest(uint32 /* quest_id */) const { return false; }
     [[nodiscard]] virtual bool hasInvolvedQuest(uint32 /* quest_id */) const { return false; }
-    virtual void BuildUpdate(UpdateDataMapType&, UpdatePlayerSet&) {}
-    void BuildFieldsUpdate(Player*, UpdateDataMapType&);
+    virtual void BuildUpdate(UpdatePlayerList&) {}
+    void BuildFieldsUpdate(Player*, UpdatePlayerList&);
+    // True when changed fields go to the players around the object, Map::SendObjectUpdates then resolves those players once per cell instead of calling BuildUpdate
+    [[nodiscard]] virtual bool IsUpdateBatchedByCell() const { return false; }
 
     void SetFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags |= flag; }
     void RemoveFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags &= ~flag; }
@@ -534,6 +537,9 @@ public:
     bool IsWithinDistInMap(WorldObject const* obj, float dist2compare, bool is3D = true, bool useBoundingRadius = true) const;
     [[nodiscard]] bool IsWithinLOS(float x, float y, float z, VMAP::ModelIgnoreFlags ignoreFlags = VMAP::ModelIgnoreFlags::Nothing, LineOfSightChecks checks = LINEOFSIGHT_ALL_CHECKS) const;
     [[nodiscard]] bool IsWithinLOSInMap(WorldObject const* obj, VMAP::ModelIgnoreFlags ignoreFlags = VMAP::ModelIgnoreFlags::Nothing, LineOfSightChecks checks = LINEOFSIGHT_ALL_CHECKS, Optional<float> collisionHeight = { }, Optional<float> combatReach = { }) const;
+    // the segments checked by IsWithinLOS and IsWithinLOSInMap, to check several of them at once with Map::isInLineOfSight
+    void GetLineOfSightSegment(float ox, float oy, float oz, VMAP::LineOfSightQuery& query) const;
+    void GetLineOfSightSegment(WorldObject const* obj, VMAP::LineOfSightQuery& query, Optional<float> collisionHeight = { }, Optional<float> combatReach = { }) const;
     [[nodiscard]] Position GetHitSpherePointFor(Position const& dest, Optional<float> collisionHeight = { }, Optional<float> combatReach = { }) const;
     void GetHitSpherePointFor(Position const& dest, float& x, float& y, float& z, Optional<float> collisionHeight = { }, Optional<float> combatReach = { }) const;
     bool GetDistanceOrder(WorldObject const* obj1, WorldObject const* obj2, bool is3D = true) const;
@@ -612,7 +618,7 @@ public:
     void DestroyForNearbyPlayers();
     virtual void UpdateObjectVisibility(bool forced = true, bool fromUpdate = false);
     virtual void UpdateObjectVisibilityOnCreate() { UpdateObjectVisibility(true); }
-    void BuildUpdate(UpdateDataMapType& data_map, UpdatePlayerSet& player_set) override;
+    [[nodiscard]] bool IsUpdateBatchedByCell() const override { return true; }
     void GetCreaturesWithEntryInRange(std::list<Creature*>& creatureList, float radius, uint32 entry);
 
     void SetPositionDataUpdate();
@@ -394,6 +394,8 @@ Player::Player(WorldSession* session): Unit(true), m_mover(this)
     m_reputationMgr = new ReputationMgr(this);
 
     m_NeedToSaveGlyphs = false;
+    _instanceResetTimesChanged = 0;
+    m_saveSequence = 0;
     m_MountBlockId = 0;
     m_realDodge = 0.0f;
     m_realParry = 0.0f;
@@ -4302,17 +4304,20 @@ void Player::DeleteFromDB(ObjectGuid::LowType lowGuid, uint32 accountId, bool up
 
                 sScriptMgr->OnPlayerDeleteFromDB(trans, lowGuid);
 
-                CharacterDatabase.CommitTransaction(trans);
+                sWorldSessionMgr->CommitCharacterTransaction(accountId, trans);
                 break;
             }
         // The character gets unlinked from the account, the name gets freed up and appears as deleted ingame
         case CHAR_DELETE_UNLINK:
             {
+                CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+
                 stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_DELETE_INFO);
 
                 stmt->SetData(0, lowGuid);
 
-                CharacterDatabase.Execute(stmt);
+                trans->Append(stmt);
+                sWorldSessionMgr->CommitCharacterTransaction(accountId, trans);
                 break;
             }
         default:
@@ -14571,11 +14576,7 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     if (!mEntry)
         return;
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
-    stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PLAYER_ENTRY_POINT);
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PLAYER_ENTRY_POINT);
     stmt->SetData(0, GetGUID().GetCounter());
     stmt->SetData (1, m_entryPointData.joinPos.GetPositionX());
     stmt->SetData (2, m_entryPointData.joinPos.GetPositionY());
@@ -14585,6 +14586,17 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     stmt->SetData(6, m_entryPointData.taxiPath[0]);
     stmt->SetData(7, m_entryPointData.taxiPath[1]);
     stmt->SetData(8, m_entryPointData.mountSpell);
+
+    if (!IsSaveSectionChanged(PLAYER_SAVE_SECTION_ENTRY_POINT, stmt))
+    {
+        delete stmt;
+        return;
+    }
+
+    CharacterDatabasePreparedStatement* deleteStmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
+    deleteStmt->SetData(0, GetGUID().GetCounter());
+    trans->Append(deleteStmt);
+
     trans->Append(stmt);
 }
 
@@ -15838,7 +15850,7 @@ void Player::_LoadPetStable(uint8 petStableSlots, PreparedQueryResult result)
 
 void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
 {
-    if (_instanceResetTimes.empty())
+    if (!_instanceResetTimesChanged)
         return;
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
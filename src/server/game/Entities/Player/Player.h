@@ -41,6 +41,11 @@
 #include "TradeData.h"
 #include "Unit.h"
 #include "WorldSession.h"
+#include <array>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -917,6 +922,15 @@ enum PlayerDelayedOperations
     DELAYED_END
 };
 
+/// Sections saved as a whole without change tracking of their own, skipped while they would write the values of the last save again
+enum PlayerSaveSection : uint8
+{
+    PLAYER_SAVE_SECTION_STATS,
+    PLAYER_SAVE_SECTION_ENTRY_POINT,
+
+    MAX_PLAYER_SAVE_SECTIONS
+};
+
 enum PlayerCharmedAISpells
 {
     SPELL_T_STUN,
@@ -2370,6 +2384,11 @@ public:
     [[nodiscard]] uint32 GetSaveTimer() const { return m_nextSave; }
     void SetSaveTimer(uint32 timer) { m_nextSave = timer; }
 
+    /// Called once the transaction of the save saveSequence was committed, the sections it wrote are only written again when they change
+    void OnSaveCompleted(uint64 saveSequence);
+    /// AfterComplete handler of the transaction of the last save, calls OnSaveCompleted if the player is still in the world
+    [[nodiscard]] std::function<void(bool)> GetSaveCompletionHandler() const;
+
     // Recall position
     uint32 m_recallMap;
     float  m_recallX;
@@ -2395,10 +2414,14 @@ public:
     // currently visible objects at player client
     GuidUnorderedSet m_clientGUIDs;
     std::vector<Unit*> m_newVisible; // pussywizard
+    UpdateData m_objectUpdateData;
 
     [[nodiscard]] bool HaveAtClient(WorldObject const* u) const;
     [[nodiscard]] bool HaveAtClient(ObjectGuid guid) const;
 
+    // values updates collected for this player by Map::SendObjectUpdates, kept between ticks so its storage is reused
+    UpdateData& GetObjectUpdateData() { return m_objectUpdateData; }
+
     [[nodiscard]] bool IsNeverVisible() const override;
 
     bool IsVisibleGloballyFor(Player const* player) const;
@@ -2465,7 +2488,10 @@ public:
     void AddInstanceEnterTime(uint32 instanceId, time_t enterTime)
     {
         if (_instanceResetTimes.find(instanceId) == _instanceResetTimes.end())
+        {
             _instanceResetTimes.insert(InstanceTimeMap::value_type(instanceId, enterTime + HOUR));
+            _instanceResetTimesChanged = GetNextSaveSequence();
+        }
     }
 
     // last used pet number (for BG's)
@@ -2772,6 +2798,12 @@ protected:
     void _SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans);
     void _SavePlayerSettings(CharacterDatabaseTransaction trans);
 
+    /// Remembers the parameters of stmt until the save completes, returns false if the last completed save of section wrote the same values
+    bool IsSaveSectionChanged(PlayerSaveSection section, CharacterDatabasePreparedStatement const* stmt);
+
+    /// Sequence of the next save of any player, so a change is written by every save from this one on until one of them completes
+    static uint64 GetNextSaveSequence() { return _lastSaveSequence.load(std::memory_order_relaxed) + 1; }
+
     /*********************************************************/
     /***              ENVIRONMENTAL SYSTEM                 ***/
     /*********************************************************/
@@ -3002,6 +3034,7 @@ private:
     uint32 m_ChampioningFaction;
 
     InstanceTimeMap _instanceResetTimes;
+    uint64 _instanceResetTimesChanged; ///< First save writing the changed instance enter times, 0 once one of them completed
     uint32 _pendingBindId;
     uint32 _pendingBindTimer;
 
@@ -3022,6 +3055,13 @@ private:
     bool _wasOutdoor;
 
     PlayerSettingMap m_charSettingsMap;
+    std::map<std::string, uint64> m_changedCharSettings; ///< Sources of m_charSettingsMap changed and the first save writing them
+
+    std::array<PreparedStatementParameters, MAX_PLAYER_SAVE_SECTIONS> m_savedSectionData;                      ///< Written by the last completed save
+    std::array<std::pair<uint64, PreparedStatementParameters>, MAX_PLAYER_SAVE_SECTIONS> m_pendingSectionData; ///< Written by a save not completed yet
+
+    uint64 m_saveSequence;
+    static std::atomic<uint64> _lastSaveSequence;
 
     Seconds m_creationTime;
 };
@@ -26,6 +26,7 @@
 void Player::_LoadCharacterSettings(PreparedQueryResult result)
 {
     m_charSettingsMap.clear();
+    m_changedCharSettings.clear();
 
     if (!sWorld->getBoolConfig(CONFIG_PLAYER_SETTINGS_ENABLED))
         return;
@@ -76,11 +77,14 @@ void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans)
     if (!sWorld->getBoolConfig(CONFIG_PLAYER_SETTINGS_ENABLED))
         return;
 
-    for (auto const& [source, settings] : m_charSettingsMap)
+    for (auto const& [source, changeSequence] : m_changedCharSettings)
     {
-        if (settings.empty())
+        auto itr = m_charSettingsMap.find(source);
+        if (itr == m_charSettingsMap.end() || itr->second.empty())
             continue;
 
+        PlayerSettingVector const& settings = itr->second;
+
         std::ostringstream data;
         data << settings[0].value;
 
@@ -116,4 +120,6 @@ void Player::UpdatePlayerSetting(std::string const& source, uint8 index, uint32
 
         settings[index].value = value;
     }
+
+    m_changedCharSettings[source] = GetNextSaveSequence();
 }
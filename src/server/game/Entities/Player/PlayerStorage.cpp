@@ -63,6 +63,7 @@
 #include "Util.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include "WorldSessionMgr.h"
 
 /// @todo: this import is not necessary for compilation and marked as unused by the IDE
 //  however, for some reasons removing it would cause a damn linking issue
@@ -7054,13 +7055,22 @@ bool Player::_LoadHomeBind(PreparedQueryResult result)
 /***                   SAVE SYSTEM                     ***/
 /*********************************************************/
 
+std::atomic<uint64> Player::_lastSaveSequence = 0;
+
 void Player::SaveToDB(bool create, bool logout)
 {
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
 
     SaveToDB(trans, create, logout);
 
-    CharacterDatabase.CommitTransaction(trans);
+    // nothing to write while the player is teleported far, it saves itself after the teleport
+    if (!trans->GetSize())
+        return;
+
+    if (m_session)
+        sWorldSessionMgr->CommitCharacterTransaction(m_session->GetAccountId(), trans, GetSaveCompletionHandler());
+    else
+        CharacterDatabase.CommitTransaction(trans);
 }
 
 void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logout)
@@ -7075,6 +7085,8 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
         return;
     }
 
+    m_saveSequence = ++_lastSaveSequence;
+
     // pussywizard: full save now, so clear partial additional saves
     m_additionalSaveTimer = 0;
     m_additionalSaveMask = 0;
@@ -7701,6 +7713,7 @@ void Player::_SaveSkills(CharacterDatabaseTransaction trans)
 void Player::_SaveSpells(CharacterDatabaseTransaction trans)
 {
     CharacterDatabasePreparedStatement* stmt = nullptr;
+    std::vector<CharacterDatabasePreparedStatement*> inserts;
 
     for (PlayerSpellMap::iterator itr = m_spells.begin(); itr != m_spells.end();)
     {
@@ -7721,13 +7734,14 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
         }
 
         // xinef: insert statement for new / updated spell
+        // appended after all deletes, so the database layer can merge them into a single statement
         if (itr->second->State == PLAYERSPELL_NEW || itr->second->State == PLAYERSPELL_CHANGED)
         {
             stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_SPELL);
             stmt->SetData(0, GetGUID().GetCounter());
             stmt->SetData(1, itr->first);
             stmt->SetData(2, itr->second->specMask);
-            trans->Append(stmt);
+            inserts.push_back(stmt);
         }
 
         if (itr->second->State == PLAYERSPELL_REMOVED)
@@ -7741,6 +7755,9 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
             ++itr;
         }
     }
+
+    for (CharacterDatabasePreparedStatement* insert : inserts)
+        trans->Append(insert);
 }
 
 // save player stats -- only for external usage
@@ -7751,15 +7768,9 @@ void Player::_SaveStats(CharacterDatabaseTransaction trans)
     if (!sWorld->getIntConfig(CONFIG_MIN_LEVEL_STAT_SAVE) || GetLevel() < sWorld->getIntConfig(CONFIG_MIN_LEVEL_STAT_SAVE))
         return;
 
-    CharacterDatabasePreparedStatement* stmt = nullptr;
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_STATS);
-    stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-
     uint8 index = 0;
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_STATS);
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_STATS);
     stmt->SetData(index++, GetGUID().GetCounter());
     stmt->SetData(index++, GetMaxHealth());
 
@@ -7783,9 +7794,61 @@ void Player::_SaveStats(CharacterDatabaseTransaction trans)
     stmt->SetData(index++, GetBaseSpellPowerBonus());
     stmt->SetData(index++, GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + static_cast<uint16>(CR_CRIT_TAKEN_SPELL)));
 
+    if (!IsSaveSectionChanged(PLAYER_SAVE_SECTION_STATS, stmt))
+    {
+        delete stmt;
+        return;
+    }
+
+    CharacterDatabasePreparedStatement* deleteStmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_STATS);
+    deleteStmt->SetData(0, GetGUID().GetCounter());
+    trans->Append(deleteStmt);
+
     trans->Append(stmt);
 }
 
+bool Player::IsSaveSectionChanged(PlayerSaveSection section, CharacterDatabasePreparedStatement const* stmt)
+{
+    PreparedStatementParameters const& parameters = stmt->GetParameters();
+    if (parameters == m_savedSectionData[section])
+        return false;
+
+    m_pendingSectionData[section] = { m_saveSequence, parameters };
+    return true;
+}
+
+void Player::OnSaveCompleted(uint64 saveSequence)
+{
+    if (_instanceResetTimesChanged && _instanceResetTimesChanged <= saveSequence)
+        _instanceResetTimesChanged = 0;
+
+    std::erase_if(m_changedCharSettings, [saveSequence](auto const& changed) { return changed.second <= saveSequence; });
+
+    // a later save may have written other values meanwhile, it completes on its own
+    for (uint8 section = 0; section < MAX_PLAYER_SAVE_SECTIONS; ++section)
+    {
+        auto& [pendingSequence, parameters] = m_pendingSectionData[section];
+        if (pendingSequence != saveSequence)
+            continue;
+
+        m_savedSectionData[section] = std::move(parameters);
+        pendingSequence = 0;
+    }
+}
+
+std::function<void(bool)> Player::GetSaveCompletionHandler() const
+{
+    return [guid = GetGUID(), saveSequence = m_saveSequence](bool success)
+    {
+        // nothing is cleared, the next save writes the sections again
+        if (!success)
+            return;
+
+        if (Player* player = ObjectAccessor::FindConnectedPlayer(guid))
+            player->OnSaveCompleted(saveSequence);
+    };
+}
+
 void Player::outDebugValues() const
 {
     if (!sLog->ShouldLog("entities.player", LogLevel::LOG_LEVEL_DEBUG))                                  // optimize disabled debug output
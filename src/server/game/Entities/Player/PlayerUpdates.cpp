@@ -30,6 +30,7 @@
 #include "OutdoorPvPMgr.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerSaveScheduler.h"
 #include "ScriptMgr.h"
 #include "SkillDiscovery.h"
 #include "SpellAuraEffects.h"
@@ -320,16 +321,16 @@ void Player::Update(uint32 p_time)
 
     if (m_nextSave)
     {
-        if (p_time >= m_nextSave)
+        if (p_time < m_nextSave)
+        {
+            m_nextSave -= p_time;
+        }
+        else if (!sPlayerSaveScheduler->IsEnabled())
         {
             // m_nextSave reset in SaveToDB call
             SaveToDB(false, false);
             LOG_DEBUG("entities.player", "Player::Update: Player '{}' ({}) saved", GetName(), GetGUID().ToString());
         }
-        else
-        {
-            m_nextSave -= p_time;
-        }
     }
 
     // Handle Water/drowning
@@ -378,7 +379,10 @@ void Player::Update(uint32 p_time)
              itr != _instanceResetTimes.end();)
         {
             if (itr->second < now)
+            {
                 _instanceResetTimes.erase(itr++);
+                _instanceResetTimesChanged = GetNextSaveSequence();
+            }
             else
                 ++itr;
         }
@@ -123,14 +123,14 @@ void MotionTransport::CleanupsBeforeDelete(bool finalCleanup /*= true*/)
     GameObject::CleanupsBeforeDelete(finalCleanup);
 }
 
-void MotionTransport::BuildUpdate(UpdateDataMapType& data_map, UpdatePlayerSet&)
+void MotionTransport::BuildUpdate(UpdatePlayerList& updatePlayers)
 {
     Map::PlayerList const& players = GetMap()->GetPlayers();
     if (players.IsEmpty())
         return;
 
     for (Map::PlayerList::const_iterator itr = players.begin(); itr != players.end(); ++itr)
-        BuildFieldsUpdate(itr->GetSource(), data_map);
+        BuildFieldsUpdate(itr->GetSource(), updatePlayers);
 
     ClearUpdateMask(true);
 }
@@ -812,14 +812,14 @@ void StaticTransport::CleanupsBeforeDelete(bool finalCleanup /*= true*/)
     GameObject::CleanupsBeforeDelete(finalCleanup);
 }
 
-void StaticTransport::BuildUpdate(UpdateDataMapType& data_map, UpdatePlayerSet&)
+void StaticTransport::BuildUpdate(UpdatePlayerList& updatePlayers)
 {
     Map::PlayerList const& players = GetMap()->GetPlayers();
     if (players.IsEmpty())
         return;
 
     for (Map::PlayerList::const_iterator itr = players.begin(); itr != players.end(); ++itr)
-        BuildFieldsUpdate(itr->GetSource(), data_map);
+        BuildFieldsUpdate(itr->GetSource(), updatePlayers);
 
     ClearUpdateMask(true);
 }
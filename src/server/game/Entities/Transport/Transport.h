@@ -54,7 +54,8 @@ public:
 
     bool CreateMoTrans(ObjectGuid::LowType guidlow, uint32 entry, uint32 mapid, float x, float y, float z, float ang, uint32 animprogress);
     void CleanupsBeforeDelete(bool finalCleanup = true) override;
-    void BuildUpdate(UpdateDataMapType& data_map, UpdatePlayerSet&) override;
+    void BuildUpdate(UpdatePlayerList& updatePlayers) override;
+    [[nodiscard]] bool IsUpdateBatchedByCell() const override { return false; }
 
     void Update(uint32 diff) override;
     void DelayedUpdate(uint32 diff);
@@ -117,7 +118,8 @@ public:
 
     bool Create(ObjectGuid::LowType guidlow, uint32 name_id, Map* map, uint32 phaseMask, float x, float y, float z, float ang, G3D::Quat const& rotation, uint32 animprogress, GOState go_state, uint32 artKit = 0) override;
     void CleanupsBeforeDelete(bool finalCleanup = true) override;
-    void BuildUpdate(UpdateDataMapType& data_map, UpdatePlayerSet&) override;
+    void BuildUpdate(UpdatePlayerList& updatePlayers) override;
+    [[nodiscard]] bool IsUpdateBatchedByCell() const override { return false; }
 
     void Update(uint32 diff) override;
     void RelocateToProgress(uint32 progress);
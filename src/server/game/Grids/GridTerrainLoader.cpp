@@ -1,21 +1,45 @@
 #include "DisableMgr.h"
 #include "GridTerrainLoader.h"
+#include "GridTerrainPreloader.h"
 #include "MMapFactory.h"
 #include "MMapMgr.h"
 #include "ScriptMgr.h"
 #include "VMapFactory.h"
 #include "VMapMgr2.h"
 
+GridTerrainLoader::GridTerrainLoader(MapGridType& grid, Map* map)
+    : _grid(grid), _map(map) { }
+
+GridTerrainLoader::~GridTerrainLoader() = default;
+
 void GridTerrainLoader::LoadTerrain()
 {
+    // files read ahead by GridTerrainPreloader only have to be linked
+    if (_map->GetInstanceId() == 0)
+        _preloaded = sGridTerrainPreloader->Take(_map->GetId(), _grid.GetX(), _grid.GetY());
+
     LoadMap();
     if (_map->GetInstanceId() == 0)
     {
+        // the other threads of the map read the vmap and mmap trees meanwhile
+        if (_map->IsParallelUpdateActive())
+        {
+            _map->DeferGridCollisionLoading(_grid.GetX(), _grid.GetY(), std::move(_preloaded));
+            return;
+        }
+
         LoadVMap();
         LoadMMap();
     }
 }
 
+void GridTerrainLoader::LoadCollision(std::unique_ptr<PreloadedGridTerrain> preloaded)
+{
+    _preloaded = std::move(preloaded);
+    LoadVMap();
+    LoadMMap();
+}
+
 void GridTerrainLoader::LoadMap()
 {
     // Instances will point to the parent maps terrain data
@@ -29,6 +53,14 @@ void GridTerrainLoader::LoadMap()
         return;
     }
 
+    if (_preloaded)
+    {
+        _grid.SetTerrainData(std::move(_preloaded->TerrainData));
+        LogLoadMapResult(_preloaded->MapFileName, _preloaded->TerrainResult);
+        sScriptMgr->OnLoadGridMap(_map, _grid.GetTerrainData(), _grid.GetX(), _grid.GetY());
+        return;
+    }
+
     // map file name
     std::string const mapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", sWorld->GetDataPath(), _map->GetId(), _grid.GetX(), _grid.GetY());
 
@@ -38,15 +70,21 @@ void GridTerrainLoader::LoadMap()
     TerrainMapDataReadResult loadResult = terrainData->Load(mapFileName);
     if (loadResult == TerrainMapDataReadResult::Success)
         _grid.SetTerrainData(std::move(terrainData));
-    else
+
+    LogLoadMapResult(mapFileName, loadResult);
+
+    sScriptMgr->OnLoadGridMap(_map, _grid.GetTerrainData(), _grid.GetX(), _grid.GetY());
+}
+
+void GridTerrainLoader::LogLoadMapResult(std::string const& mapFileName, TerrainMapDataReadResult loadResult)
+{
+    if (loadResult != TerrainMapDataReadResult::Success)
     {
         if (loadResult == TerrainMapDataReadResult::InvalidMagic)
             LOG_ERROR("maps", "Map file '{}' is from an incompatible clientversion. Please recreate using the mapextractor.", mapFileName);
         else
             LOG_DEBUG("maps", "Error (result: {}) loading map file: {}", uint32(loadResult), mapFileName);
     }
-
-    sScriptMgr->OnLoadGridMap(_map, _grid.GetTerrainData(), _grid.GetX(), _grid.GetY());
 }
 
 void GridTerrainLoader::LoadVMap()
@@ -74,7 +112,10 @@ void GridTerrainLoader::LoadMMap()
     if (!DisableMgr::IsPathfindingEnabled(_map))
         return;
 
-    int mmapLoadResult = MMAP::MMapFactory::createOrGetMMapMgr()->loadMap(_map->GetId(), _grid.GetX(), _grid.GetY());
+    MMAP::MMapMgr* mmgr = MMAP::MMapFactory::createOrGetMMapMgr();
+    int mmapLoadResult = _preloaded && _preloaded->MMapTileRead
+        ? mmgr->loadMap(_map->GetId(), _grid.GetX(), _grid.GetY(), std::move(_preloaded->MMapTile))
+        : mmgr->loadMap(_map->GetId(), _grid.GetX(), _grid.GetY());
     switch (mmapLoadResult)
     {
     case MMAP::MMAP_LOAD_RESULT_OK:
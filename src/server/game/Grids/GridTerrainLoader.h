@@ -19,14 +19,21 @@
 #define ACORE_GRID_TERRAIN_LOADER_H
 
 #include "GridDefines.h"
+#include <memory>
+#include <string>
+
+enum class TerrainMapDataReadResult;
+struct PreloadedGridTerrain;
 
 class GridTerrainLoader
 {
 public:
-    GridTerrainLoader(MapGridType& grid, Map* map)
-        : _grid(grid), _map(map) { }
+    GridTerrainLoader(MapGridType& grid, Map* map);
+    ~GridTerrainLoader();
 
     void LoadTerrain();
+    /// Loads the vmap and mmap tiles deferred by LoadTerrain during a parallel update of the map
+    void LoadCollision(std::unique_ptr<PreloadedGridTerrain> preloaded);
 
     static bool ExistMap(uint32 mapid, int gx, int gy);
     static bool ExistVMap(uint32 mapid, int gx, int gy);
@@ -36,8 +43,11 @@ private:
     void LoadVMap();
     void LoadMMap();
 
+    static void LogLoadMapResult(std::string const& mapFileName, TerrainMapDataReadResult loadResult);
+
     MapGridType& _grid;
     Map* _map;
+    std::unique_ptr<PreloadedGridTerrain> _preloaded;
 };
 
 class GridTerrainUnloader
@@ -0,0 +1,287 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridTerrainPreloader.h"
+#include "DisableMgr.h"
+#include "Log.h"
+#include "Map.h"
+#include "MotionMaster.h"
+#include "Player.h"
+#include "StringFormat.h"
+#include "VMapFactory.h"
+#include "VMapMgr2.h"
+#include "WaypointMovementGenerator.h"
+#include "World.h"
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+namespace
+{
+    // terrain that nobody picked up is dropped, the player turned around or logged out
+    constexpr uint32 MaxReadyEntries = 64;
+    constexpr std::chrono::seconds ReadyEntryLifetime = std::chrono::seconds(60);
+}
+
+GridTerrainPreloader::~GridTerrainPreloader()
+{
+    Shutdown();
+}
+
+GridTerrainPreloader* GridTerrainPreloader::instance()
+{
+    static GridTerrainPreloader instance;
+    return &instance;
+}
+
+void GridTerrainPreloader::Initialize(uint32 threadCount)
+{
+    Shutdown();
+
+    _stop = false;
+    for (uint32 i = 0; i < threadCount; ++i)
+        _workers.emplace_back(&GridTerrainPreloader::WorkerThread, this);
+
+    if (threadCount)
+        LOG_INFO("server.loading", ">> Grid terrain preloading started with {} thread(s)", threadCount);
+}
+
+void GridTerrainPreloader::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stop = true;
+    }
+
+    _queueCondition.notify_all();
+
+    for (std::thread& worker : _workers)
+        worker.join();
+
+    _workers.clear();
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _entries.clear();
+        _queue.clear();
+        _readyCount = 0;
+    }
+
+    _loadedCondition.notify_all();
+}
+
+void GridTerrainPreloader::Request(Map const* map, uint16 gridX, uint16 gridY)
+{
+    // instances link the terrain of their parent map
+    if (!IsEnabled() || map->Instanceable())
+        return;
+
+    bool loadMMap = DisableMgr::IsPathfindingEnabled(map);
+    std::string dataPath = sWorld->GetDataPath();
+
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_stop)
+        return;
+
+    auto [itr, inserted] = _entries.try_emplace(MakeKey(map->GetId(), gridX, gridY));
+    if (!inserted)
+        return;
+
+    itr->second.LoadMMap = loadMMap;
+    itr->second.DataPath = std::move(dataPath);
+    _queue.push_back(itr->first);
+    _queueCondition.notify_one();
+}
+
+void GridTerrainPreloader::RequestAhead(Map const* map, Player const* player, float distance)
+{
+    if (!IsEnabled() || map->Instanceable() || distance <= 0.0f)
+        return;
+
+    std::vector<std::pair<float, float>> points;
+    if (player->IsInFlight())
+    {
+        // walk the remaining taxi nodes on this map
+        if (FlightPathMovementGenerator* flight = dynamic_cast<FlightPathMovementGenerator*>(player->GetMotionMaster()->top()))
+        {
+            TaxiPathNodeList const& path = flight->GetPath();
+            float lastX = player->GetPositionX();
+            float lastY = player->GetPositionY();
+            float travelled = 0.0f;
+            for (uint32 i = flight->GetCurrentNode(); i < path.size() && travelled < distance; ++i)
+            {
+                TaxiPathNodeEntry const* node = path[i];
+                if (node->mapid != map->GetId())
+                    break;
+
+                travelled += std::hypot(node->x - lastX, node->y - lastY);
+                lastX = node->x;
+                lastY = node->y;
+                points.emplace_back(lastX, lastY);
+            }
+        }
+    }
+    else if (player->isMoving())
+    {
+        // sample the movement direction, once per half grid is enough to not skip any grid
+        float angle = player->GetOrientation();
+        if (player->HasUnitMovementFlag(MOVEMENTFLAG_BACKWARD))
+            angle += float(M_PI);
+
+        float step = SIZE_OF_GRIDS / 2;
+        for (float travelled = step; travelled <= distance; travelled += step)
+            points.emplace_back(player->GetPositionX() + travelled * std::cos(angle), player->GetPositionY() + travelled * std::sin(angle));
+    }
+
+    std::unordered_set<uint32> requested;
+    float radius = map->GetVisibilityRange();
+    for (auto const& [x, y] : points)
+    {
+        GridCoord low = Acore::ComputeGridCoord(x + radius, y + radius).normalize();
+        GridCoord high = Acore::ComputeGridCoord(x - radius, y - radius).normalize();
+        for (uint32 gridX = low.x_coord; gridX <= high.x_coord; ++gridX)
+        {
+            for (uint32 gridY = low.y_coord; gridY <= high.y_coord; ++gridY)
+            {
+                if (!requested.insert((gridX << 16) | gridY).second)
+                    continue;
+
+                if (!map->IsGridCreated(GridCoord(gridX, gridY)))
+                    Request(map, uint16(gridX), uint16(gridY));
+            }
+        }
+    }
+}
+
+std::unique_ptr<PreloadedGridTerrain> GridTerrainPreloader::Take(uint32 mapId, uint16 gridX, uint16 gridY)
+{
+    if (!IsEnabled())
+        return nullptr;
+
+    std::unique_lock<std::mutex> lock(_lock);
+
+    uint64 key = MakeKey(mapId, gridX, gridY);
+    auto itr = _entries.find(key);
+    if (itr == _entries.end())
+        return nullptr;
+
+    if (itr->second.Status == State::Queued)
+    {
+        // loading it here is faster than waiting for the queue ahead of it
+        _queue.erase(std::find(_queue.begin(), _queue.end(), key));
+        _entries.erase(itr);
+        return nullptr;
+    }
+
+    _loadedCondition.wait(lock, [&]
+    {
+        itr = _entries.find(key);
+        return itr == _entries.end() || itr->second.Status == State::Ready;
+    });
+
+    // dropped by Shutdown
+    if (itr == _entries.end())
+        return nullptr;
+
+    std::unique_ptr<PreloadedGridTerrain> terrain = std::move(itr->second.Terrain);
+    _entries.erase(itr);
+    --_readyCount;
+    return terrain;
+}
+
+void GridTerrainPreloader::WorkerThread()
+{
+    for (;;)
+    {
+        uint64 key;
+        bool loadMMap;
+        std::string dataPath;
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _queueCondition.wait(lock, [this] { return _stop || !_queue.empty(); });
+            if (_stop)
+                return;
+
+            key = _queue.front();
+            _queue.pop_front();
+
+            Entry& entry = _entries[key];
+            entry.Status = State::Loading;
+            loadMMap = entry.LoadMMap;
+            dataPath = entry.DataPath;
+        }
+
+        std::unique_ptr<PreloadedGridTerrain> terrain = LoadTerrain(uint32(key >> 32), uint16(key >> 16), uint16(key), dataPath, loadMMap);
+
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+
+            Entry& entry = _entries[key];
+            entry.Status = State::Ready;
+            entry.ReadyTime = std::chrono::steady_clock::now();
+            entry.Terrain = std::move(terrain);
+            ++_readyCount;
+
+            RemoveExpiredEntries();
+        }
+
+        _loadedCondition.notify_all();
+    }
+}
+
+void GridTerrainPreloader::RemoveExpiredEntries()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    while (_readyCount > 0)
+    {
+        auto oldest = _entries.end();
+        for (auto itr = _entries.begin(); itr != _entries.end(); ++itr)
+            if (itr->second.Status == State::Ready && (oldest == _entries.end() || itr->second.ReadyTime < oldest->second.ReadyTime))
+                oldest = itr;
+
+        if (_readyCount <= MaxReadyEntries && now - oldest->second.ReadyTime < ReadyEntryLifetime)
+            break;
+
+        _entries.erase(oldest);
+        --_readyCount;
+    }
+}
+
+std::unique_ptr<PreloadedGridTerrain> GridTerrainPreloader::LoadTerrain(uint32 mapId, uint16 gridX, uint16 gridY, std::string const& dataPath, bool loadMMap)
+{
+    std::unique_ptr<PreloadedGridTerrain> terrain = std::make_unique<PreloadedGridTerrain>();
+
+    terrain->MapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", dataPath, mapId, gridX, gridY);
+
+    std::unique_ptr<GridTerrainData> terrainData = std::make_unique<GridTerrainData>();
+    TerrainMapDataReadResult loadResult = terrainData->Load(terrain->MapFileName);
+    terrain->TerrainResult = loadResult;
+    if (loadResult == TerrainMapDataReadResult::Success)
+        terrain->TerrainData = std::move(terrainData);
+
+    // the tree itself is updated by the map, loading the models is the expensive part
+    VMAP::VMapFactory::createOrGetVMapMgr()->preloadMapTileModels((dataPath + "vmaps").c_str(), mapId, gridX, gridY);
+
+    if (loadMMap)
+    {
+        MMAP::MMapMgr::readTile(mapId, gridX, gridY, terrain->MMapTile);
+        terrain->MMapTileRead = true;
+    }
+
+    LOG_DEBUG("maps", "Preloaded terrain of map {} grid [{}, {}]", mapId, gridX, gridY);
+    return terrain;
+}
@@ -0,0 +1,118 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_GRID_TERRAIN_PRELOADER_H
+#define ACORE_GRID_TERRAIN_PRELOADER_H
+
+#include "Define.h"
+#include "GridTerrainData.h"
+#include "MMapMgr.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class Map;
+class Player;
+
+/// Terrain of one grid read by GridTerrainPreloader, ready to be linked to the map
+struct PreloadedGridTerrain
+{
+    std::shared_ptr<GridTerrainData> TerrainData; ///< nullptr if the .map file could not be loaded
+    std::string MapFileName;
+    TerrainMapDataReadResult TerrainResult = TerrainMapDataReadResult::NotFound;
+    bool MMapTileRead = false;                    ///< MMapTile holds the mmtile, empty if reading it failed
+    MMAP::MMapTileData MMapTile;
+};
+
+/**
+ * @brief Reads grid terrain on background threads before the map needs it.
+ *
+ * Map::PlayerRelocation requests the grids ahead of moving players. The workers read the .map file, the
+ * models of the vmap tile and the mmtile, so MapGridManager::CreateGrid only has to link the results into
+ * the vmap tree and the navmesh, which are not thread safe, and spawn the objects.
+ * Only grids of non instanceable maps are preloaded, instances share the terrain of their parent map.
+ */
+class AC_GAME_API GridTerrainPreloader
+{
+public:
+    static GridTerrainPreloader* instance();
+
+    void Initialize(uint32 threadCount);
+    void Shutdown();
+
+    [[nodiscard]] bool IsEnabled() const { return !_workers.empty(); }
+
+    /// Queues the terrain of a grid of map, does nothing if it is already queued or loaded
+    void Request(Map const* map, uint16 gridX, uint16 gridY);
+
+    /// Queues the grids around the path player is expected to take in the next distance yards
+    void RequestAhead(Map const* map, Player const* player, float distance);
+
+    /**
+     * @brief Hands the preloaded terrain of a grid over to the caller.
+     *
+     * Waits if a worker is still reading the grid, a grid that was not picked up by a worker yet is
+     * dropped from the queue so the caller loads it itself.
+     * @return nullptr if the grid was not requested
+     */
+    std::unique_ptr<PreloadedGridTerrain> Take(uint32 mapId, uint16 gridX, uint16 gridY);
+
+private:
+    enum class State
+    {
+        Queued,
+        Loading,
+        Ready
+    };
+
+    struct Entry
+    {
+        State Status = State::Queued;
+        bool LoadMMap = false;
+        std::string DataPath;
+        std::chrono::steady_clock::time_point ReadyTime;
+        std::unique_ptr<PreloadedGridTerrain> Terrain;
+    };
+
+    GridTerrainPreloader() = default;
+    ~GridTerrainPreloader();
+
+    static uint64 MakeKey(uint32 mapId, uint16 gridX, uint16 gridY) { return (uint64(mapId) << 32) | (uint32(gridX) << 16) | gridY; }
+
+    void WorkerThread();
+    void RemoveExpiredEntries();
+    static std::unique_ptr<PreloadedGridTerrain> LoadTerrain(uint32 mapId, uint16 gridX, uint16 gridY, std::string const& dataPath, bool loadMMap);
+
+    std::mutex _lock;
+    std::condition_variable _queueCondition;
+    std::condition_variable _loadedCondition;
+    std::unordered_map<uint64, Entry> _entries;
+    std::deque<uint64> _queue;
+    uint32 _readyCount = 0;
+    bool _stop = false;
+    std::vector<std::thread> _workers;
+};
+
+#define sGridTerrainPreloader GridTerrainPreloader::instance()
+
+#endif
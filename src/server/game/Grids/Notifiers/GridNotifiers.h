@@ -125,8 +125,15 @@ namespace Acore
             if (!player->HaveAtClient(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            // one copy shared by every receiver instead of one per socket
+            if (!i_sharedMessage)
+                i_sharedMessage = std::make_shared<WorldPacket const>(*i_message);
+
+            player->GetSession()->SendPacket(i_sharedMessage);
         }
+
+    private:
+        SharedWorldPacket i_sharedMessage;
     };
 
     struct MessageDistDelivererToHostile
@@ -150,8 +157,14 @@ namespace Acore
             if (player == i_source || !player->HaveAtClient(i_source) || player->IsFriendlyTo(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            if (!i_sharedMessage)
+                i_sharedMessage = std::make_shared<WorldPacket const>(*i_message);
+
+            player->GetSession()->SendPacket(i_sharedMessage);
         }
+
+    private:
+        SharedWorldPacket i_sharedMessage;
     };
 
     // SEARCHERS & LIST SEARCHERS & WORKERS
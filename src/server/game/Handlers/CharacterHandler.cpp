@@ -43,6 +43,7 @@
 #include "Pet.h"
 #include "Player.h"
 #include "PlayerDump.h"
+#include "PlayerSaveScheduler.h"
 #include "QueryHolder.h"
 #include "Realm.h"
 #include "ReputationMgr.h"
@@ -266,7 +267,7 @@ void WorldSession::HandleCharEnumOpcode(WorldPacket& /*recvData*/)
     stmt->SetData(0, PET_SAVE_AS_CURRENT);
     stmt->SetData(1, GetAccountId());
 
-    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSession::HandleCharEnum, this, std::placeholders::_1)));
+    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt, sWorldSessionMgr->GetCharacterWriteToken(GetAccountId())).WithPreparedCallback(std::bind(&WorldSession::HandleCharEnum, this, std::placeholders::_1)));
 }
 
 void WorldSession::HandleCharCreateOpcode(WorldPacket& recvData)
@@ -578,17 +579,22 @@ void WorldSession::HandleCharCreateOpcode(WorldPacket& recvData)
 
             LoginDatabase.CommitTransaction(trans);
 
-            AddTransactionCallback(CharacterDatabase.AsyncCommitTransaction(characterTransaction)).AfterComplete([this, newChar = std::move(newChar)](bool success)
+            sWorldSessionMgr->CommitCharacterTransaction(GetAccountId(), characterTransaction, [accountId = GetAccountId(), newChar = std::move(newChar)](bool success)
             {
+                // the session may be gone or replaced meanwhile, newChar still refers to the one that created it
+                WorldSession* session = sWorldSessionMgr->FindSession(accountId);
+                if (!session || session != newChar->GetSession())
+                    return;
+
                 if (success)
                 {
-                    LOG_INFO("entities.player.character", "Account: {} (IP: {}) Create Character: {} {}", GetAccountId(), GetRemoteAddress(), newChar->GetName(), newChar->GetGUID().ToString());
+                    LOG_INFO("entities.player.character", "Account: {} (IP: {}) Create Character: {} {}", accountId, session->GetRemoteAddress(), newChar->GetName(), newChar->GetGUID().ToString());
                     sScriptMgr->OnPlayerCreate(newChar.get());
-                    sCharacterCache->AddCharacterCacheEntry(newChar->GetGUID(), GetAccountId(), newChar->GetName(), newChar->getGender(), newChar->getRace(), newChar->getClass(), newChar->GetLevel());
-                    SendCharCreate(CHAR_CREATE_SUCCESS);
+                    sCharacterCache->AddCharacterCacheEntry(newChar->GetGUID(), accountId, newChar->GetName(), newChar->getGender(), newChar->getRace(), newChar->getClass(), newChar->GetLevel());
+                    session->SendCharCreate(CHAR_CREATE_SUCCESS);
                 }
                 else
-                    SendCharCreate(CHAR_CREATE_ERROR);
+                    session->SendCharCreate(CHAR_CREATE_ERROR);
             });
         };
 
@@ -786,7 +792,7 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
         return;
     }
 
-    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([this](SQLQueryHolderBase const& holder)
+    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder, sWorldSessionMgr->GetCharacterWriteToken(GetAccountId()))).AfterComplete([this](SQLQueryHolderBase const& holder)
     {
         HandlePlayerLoginFromDB(static_cast<LoginQueryHolder const&>(holder));
     });
@@ -891,6 +897,7 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
 
     // Xinef: moved this from below
     ObjectAccessor::AddObject(pCurrChar);
+    sPlayerSaveScheduler->AddPlayer(pCurrChar->GetGUID());
 
     if (!pCurrChar->GetMap()->AddPlayerToMap(pCurrChar) || !pCurrChar->CheckInstanceLoginValid())
     {
@@ -1399,21 +1406,25 @@ void WorldSession::HandleCharRenameCallBack(std::shared_ptr<CharacterRenameInfo>
         return;
     }
 
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+
     // Update name and at_login flag in the db
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_CHAR_NAME_AT_LOGIN);
     stmt->SetData(0, renameInfo->Name);
     stmt->SetData(1, atLoginFlags);
     stmt->SetData(2, guidLow);
-    CharacterDatabase.Execute(stmt);
+    trans->Append(stmt);
 
     // Removed declined name from db
     if (sWorld->getBoolConfig(CONFIG_DECLINED_NAMES_USED))
     {
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_DECLINED_NAME);
         stmt->SetData(0, guidLow);
-        CharacterDatabase.Execute(stmt);
+        trans->Append(stmt);
     }
 
+    sWorldSessionMgr->CommitCharacterTransaction(GetAccountId(), trans);
+
     LOG_INFO("entities.player.character", "Account: {} (IP: {}), Character [{}] (guid: {}) Changed name to: {}", GetAccountId(), GetRemoteAddress(), oldName, guidLow, renameInfo->Name);
 
     SendCharRename(RESPONSE_SUCCESS, renameInfo.get());
@@ -1496,7 +1507,7 @@ void WorldSession::HandleSetPlayerDeclinedNames(WorldPacket& recvData)
 
     trans->Append(stmt);
 
-    CharacterDatabase.CommitTransaction(trans);
+    sWorldSessionMgr->CommitCharacterTransaction(GetAccountId(), trans);
 
     SendSetPlayerDeclinedNamesResult(DECLINED_NAMES_RESULT_SUCCESS, guid);
 }
@@ -1734,7 +1745,7 @@ void WorldSession::HandleCharCustomizeCallback(std::shared_ptr<CharacterCustomiz
         }
     }
 
-    CharacterDatabase.CommitTransaction(trans);
+    sWorldSessionMgr->CommitCharacterTransaction(GetAccountId(), trans);
 
     sCharacterCache->UpdateCharacterData(customizeInfo->Guid, customizeInfo->Name, customizeInfo->Gender);
 
@@ -2552,7 +2563,7 @@ void WorldSession::HandleCharFactionOrRaceChangeCallback(std::shared_ptr<Charact
     stmt->SetData(1, lowGuid);
     trans->Append(stmt);
 
-    CharacterDatabase.CommitTransaction(trans);
+    sWorldSessionMgr->CommitCharacterTransaction(GetAccountId(), trans);
 
     LOG_DEBUG("entities.player", "{} (IP: {}) changed race from {} to {}", GetPlayerInfo(), GetRemoteAddress(), oldRace, factionChangeInfo->Race);
 
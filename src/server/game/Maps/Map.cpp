@@ -24,12 +24,15 @@
 #include "GameTime.h"
 #include "Geometry.h"
 #include "GridNotifiers.h"
+#include "GridTerrainLoader.h"
+#include "GridTerrainPreloader.h"
 #include "Group.h"
 #include "InstanceScript.h"
 #include "IVMapMgr.h"
 #include "LFGMgr.h"
 #include "MapGrid.h"
 #include "MapInstanced.h"
+#include "MapMgr.h"
 #include "Metric.h"
 #include "MiscPackets.h"
 #include "MMapFactory.h"
@@ -38,11 +41,14 @@
 #include "ObjectMgr.h"
 #include "Pet.h"
 #include "ScriptMgr.h"
+#include "TerrainQueryCache.h"
+#include "TickProfiler.h"
 #include "Transport.h"
 #include "VMapFactory.h"
 #include "Vehicle.h"
 #include "VMapMgr2.h"
 #include "Weather.h"
+#include <bit>
 
 #define MAP_INVALID_ZONE        0xFFFFFFFF
 
@@ -75,7 +81,9 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
     _mapGridManager(this), i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
     m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
     _instanceResetPeriod(0), m_activeNonPlayersIter(m_activeNonPlayers.end()),
-    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id))
+    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id)),
+    _updateTimeEstimate(0), _regionUpdateActive(false), _parallelUpdateActive(false), _updatableObjectListHasHoles(false),
+    _pathfindingService(this)
 {
     m_parentMap = (_parent ? _parent : this);
 
@@ -273,6 +281,8 @@ void Map::EnsureGridCreated(GridCoord const& gridCoord)
 
 bool Map::EnsureGridLoaded(Cell const& cell)
 {
+    auto guard = LockForRegionUpdate();
+
     EnsureGridCreated(GridCoord(cell.GridX(), cell.GridY()));
 
     if (_mapGridManager.LoadGrid(cell.GridX(), cell.GridY()))
@@ -394,6 +404,8 @@ void Map::InitializeObject(GameObject*  /*obj*/)
 template<class T>
 bool Map::AddToMap(T* obj, bool checkTransport)
 {
+    auto guard = LockForRegionUpdate();
+
     //TODO: Needs clean up. An object should not be added to map twice.
     if (obj->IsInWorld())
     {
@@ -531,23 +543,29 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 
 void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 {
+    TICK_PROFILE_MAP_ZONE(TICK_PROFILE_MAP_UPDATE, this);
+
     if (t_diff)
         _dynamicTree.update(t_diff);
 
     // Update world sessions and players
-    for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
     {
-        Player* player = m_mapRefIter->GetSource();
-        if (player && player->IsInWorld())
+        TICK_PROFILE_MAP_ZONE(TICK_PROFILE_MAP_SESSIONS, this);
+
+        for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
         {
-            // Update session
-            WorldSession* session = player->GetSession();
-            MapSessionFilter updater(session);
-            session->Update(s_diff, updater);
-
-            // update players at tick
-            if (!t_diff)
-                player->Update(s_diff);
+            Player* player = m_mapRefIter->GetSource();
+            if (player && player->IsInWorld())
+            {
+                // Update session
+                WorldSession* session = player->GetSession();
+                MapSessionFilter updater(session);
+                session->Update(s_diff, updater);
+
+                // update players at tick
+                if (!t_diff)
+                    player->Update(s_diff);
+            }
         }
     }
 
@@ -555,6 +573,7 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
     if (!t_diff)
     {
+        TICK_PROFILE_MAP_ZONE(TICK_PROFILE_MAP_DELAYED_VISIBILITY, this);
         HandleDelayedVisibility();
         return;
     }
@@ -563,26 +582,30 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     resetMarkedCells();
 
     // Update players
-    for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
     {
-        Player* player = m_mapRefIter->GetSource();
+        TICK_PROFILE_MAP_ZONE(TICK_PROFILE_MAP_PLAYERS, this);
 
-        if (!player || !player->IsInWorld())
-            continue;
+        for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
+        {
+            Player* player = m_mapRefIter->GetSource();
 
-        player->Update(s_diff);
+            if (!player || !player->IsInWorld())
+                continue;
 
-        if (_updatableObjectListRecheckTimer.Passed())
-        {
-            MarkNearbyCellsOf(player);
+            player->Update(s_diff);
 
-            // If player is using far sight, update viewpoint
-            if (WorldObject* viewPoint = player->GetViewpoint())
+            if (_updatableObjectListRecheckTimer.Passed())
             {
-                if (Creature* viewCreature = viewPoint->ToCreature())
-                    MarkNearbyCellsOf(viewCreature);
-                else if (DynamicObject* viewObject = viewPoint->ToDynObject())
-                    MarkNearbyCellsOf(viewObject);
+                MarkNearbyCellsOf(player);
+
+                // If player is using far sight, update viewpoint
+                if (WorldObject* viewPoint = player->GetViewpoint())
+                {
+                    if (Creature* viewCreature = viewPoint->ToCreature())
+                        MarkNearbyCellsOf(viewCreature);
+                    else if (DynamicObject* viewObject = viewPoint->ToDynObject())
+                        MarkNearbyCellsOf(viewObject);
+                }
             }
         }
     }
@@ -600,23 +623,41 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         }
     }
 
-    UpdateNonPlayerObjects(t_diff);
+    {
+        TICK_PROFILE_MAP_ZONE(TICK_PROFILE_MAP_NON_PLAYER_OBJECTS, this);
+        UpdateNonPlayerObjects(t_diff);
+    }
 
-    SendObjectUpdates();
+    {
+        TICK_PROFILE_MAP_ZONE(TICK_PROFILE_MAP_PATHFINDING, this);
+        _pathfindingService.Update();
+    }
+
+    {
+        TICK_PROFILE_MAP_ZONE(TICK_PROFILE_MAP_OBJECT_UPDATES, this);
+        SendObjectUpdates();
+    }
 
     ///- Process necessary scripts
     if (!m_scriptSchedule.empty())
     {
+        TICK_PROFILE_MAP_ZONE(TICK_PROFILE_MAP_SCRIPTS, this);
         i_scriptLock = true;
         ScriptsProcess();
         i_scriptLock = false;
     }
 
-    MoveAllCreaturesInMoveList();
-    MoveAllGameObjectsInMoveList();
-    MoveAllDynamicObjectsInMoveList();
+    {
+        TICK_PROFILE_MAP_ZONE(TICK_PROFILE_MAP_MOVE_LISTS, this);
+        MoveAllCreaturesInMoveList();
+        MoveAllGameObjectsInMoveList();
+        MoveAllDynamicObjectsInMoveList();
+    }
 
-    HandleDelayedVisibility();
+    {
+        TICK_PROFILE_MAP_ZONE(TICK_PROFILE_MAP_DELAYED_VISIBILITY, this);
+        HandleDelayedVisibility();
+    }
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
@@ -627,6 +668,14 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_terrain_query_cache_hits", GetTerrainQueryCacheHits(),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_terrain_query_cache_misses", GetTerrainQueryCacheMisses(),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
 }
 
 void Map::UpdateNonPlayerObjects(uint32 const diff)
@@ -635,6 +684,12 @@ void Map::UpdateNonPlayerObjects(uint32 const diff)
         _AddObjectToUpdateList(obj);
     _pendingAddUpdatableObjectList.clear();
 
+    if (CanUpdateNonPlayerObjectsByRegion())
+    {
+        UpdateNonPlayerObjectsByRegion(diff);
+        return;
+    }
+
     if (_updatableObjectListRecheckTimer.Passed())
     {
         for (uint32 i = 0; i < _updatableObjectList.size();)
@@ -672,11 +727,184 @@ void Map::UpdateNonPlayerObjects(uint32 const diff)
     }
 }
 
+bool Map::CanUpdateNonPlayerObjectsByRegion() const
+{
+    // Instances and battlegrounds are small and share state through their scripts, only continents are split
+    if (Instanceable() || !sWorld->getBoolConfig(CONFIG_MAP_UPDATE_PARALLEL_REGIONS))
+        return false;
+
+    return sMapMgr->GetMapUpdater()->activated();
+}
+
+bool Map::CanUpdateObjectInRegion(WorldObject const* obj)
+{
+    // Active objects keep far grids loaded and objects seeing further than half a grid may reach the
+    // objects of another region updated at the same time
+    if (obj->isActiveObject() || obj->GetVisibilityRange() > SIZE_OF_GRIDS / 2)
+        return false;
+
+    // Threat, combat and charm references point to units of any region
+    if (Unit const* unit = obj->ToUnit())
+        if (unit->IsInCombat() || unit->IsCharmed() || unit->HasSharedVision())
+            return false;
+
+    return true;
+}
+
+void Map::UpdateNonPlayerObjectsByRegion(uint32 const diff)
+{
+    // Color of the grid in the high bits, so sorting groups the entries by pass and then by grid
+    _regionUpdateEntries.clear();
+    _serialUpdateEntries.clear();
+    for (uint32 i = 0; i < _updatableObjectList.size(); ++i)
+    {
+        WorldObject* obj = _updatableObjectList[i];
+        if (!obj->IsInWorld())
+            continue;
+
+        if (!CanUpdateObjectInRegion(obj))
+        {
+            _serialUpdateEntries.push_back(i);
+            continue;
+        }
+
+        GridCoord gridCoord = Acore::ComputeGridCoord(obj->GetPositionX(), obj->GetPositionY());
+        uint32 color = (gridCoord.x_coord & 1) | ((gridCoord.y_coord & 1) << 1);
+        _regionUpdateEntries.emplace_back((color << 16) | (gridCoord.x_coord * MAX_NUMBER_OF_GRIDS + gridCoord.y_coord), i);
+    }
+
+    std::sort(_regionUpdateEntries.begin(), _regionUpdateEntries.end());
+
+    bool const recheck = _updatableObjectListRecheckTimer.Passed();
+    std::vector<std::pair<std::size_t, std::size_t>> regions;
+
+    // Removals only leave holes in the update list until both the passes and the serial updates are done
+    _regionUpdateActive = true;
+
+    // Rebuilt lazily by the first query otherwise, which would race between the regions
+    _dynamicTree.balance();
+
+    BeginParallelUpdate();
+
+    for (std::size_t passBegin = 0; passBegin < _regionUpdateEntries.size();)
+    {
+        uint32 const color = _regionUpdateEntries[passBegin].first >> 16;
+        std::size_t passEnd = passBegin;
+
+        regions.clear();
+        while (passEnd < _regionUpdateEntries.size() && (_regionUpdateEntries[passEnd].first >> 16) == color)
+        {
+            std::size_t regionEnd = passEnd;
+            while (regionEnd < _regionUpdateEntries.size() && _regionUpdateEntries[regionEnd].first == _regionUpdateEntries[passEnd].first)
+                ++regionEnd;
+
+            regions.emplace_back(passEnd, regionEnd);
+            passEnd = regionEnd;
+        }
+
+        while (_regionUpdateBuffers.size() < regions.size())
+            _regionUpdateBuffers.push_back(std::make_unique<RegionUpdateBuffer>());
+
+        sMapMgr->GetMapUpdater()->run_parallel(regions.size(), [this, diff, recheck, &regions](std::size_t regionIndex)
+        {
+            RegionUpdateBuffer& buffer = *_regionUpdateBuffers[regionIndex];
+            buffer.map = this;
+            _regionUpdateBuffer = &buffer;
+
+            for (std::size_t i = regions[regionIndex].first; i < regions[regionIndex].second; ++i)
+            {
+                // nullptr when removed from the update list by another region during this pass
+                WorldObject* obj = std::atomic_ref<WorldObject*>(_updatableObjectList[_regionUpdateEntries[i].second]).load(std::memory_order_relaxed);
+                if (!obj || !obj->IsInWorld())
+                    continue;
+
+                obj->Update(diff);
+
+                if (recheck && !obj->IsUpdateNeeded())
+                {
+                    auto guard = LockForRegionUpdate();
+                    _RemoveObjectFromUpdateList(obj);
+                }
+            }
+
+            _regionUpdateBuffer = nullptr;
+        });
+
+        for (std::size_t i = 0; i < regions.size(); ++i)
+            MergeRegionUpdateBuffer(*_regionUpdateBuffers[i]);
+
+        passBegin = passEnd;
+    }
+
+    EndParallelUpdate();
+
+    for (uint32 offset : _serialUpdateEntries)
+    {
+        WorldObject* obj = _updatableObjectList[offset];
+        if (!obj || !obj->IsInWorld())
+            continue;
+
+        obj->Update(diff);
+
+        if (recheck && !obj->IsUpdateNeeded())
+            _RemoveObjectFromUpdateList(obj);
+    }
+
+    _regionUpdateActive = false;
+
+    if (_updatableObjectListHasHoles)
+        CompactUpdatableObjectList();
+
+    if (recheck)
+        _updatableObjectListRecheckTimer.Reset();
+}
+
+void Map::MergeRegionUpdateBuffer(RegionUpdateBuffer& buffer)
+{
+    _updateObjects.insert(buffer.updateObjects.begin(), buffer.updateObjects.end());
+    _creaturesToMove.insert(_creaturesToMove.end(), buffer.creaturesToMove.begin(), buffer.creaturesToMove.end());
+    _gameObjectsToMove.insert(_gameObjectsToMove.end(), buffer.gameObjectsToMove.begin(), buffer.gameObjectsToMove.end());
+    _dynamicObjectsToMove.insert(_dynamicObjectsToMove.end(), buffer.dynamicObjectsToMove.begin(), buffer.dynamicObjectsToMove.end());
+    i_objectsForDelayedVisibility.insert(buffer.delayedVisibility.begin(), buffer.delayedVisibility.end());
+
+    buffer.updateObjects.clear();
+    buffer.creaturesToMove.clear();
+    buffer.gameObjectsToMove.clear();
+    buffer.dynamicObjectsToMove.clear();
+    buffer.delayedVisibility.clear();
+}
+
+void Map::CompactUpdatableObjectList()
+{
+    std::size_t count = 0;
+    for (WorldObject* obj : _updatableObjectList)
+    {
+        if (!obj)
+            continue;
+
+        dynamic_cast<UpdatableMapObject*>(obj)->SetMapUpdateListOffset(count);
+        _updatableObjectList[count++] = obj;
+    }
+
+    _updatableObjectList.resize(count);
+    _updatableObjectListHasHoles = false;
+}
+
+std::unique_lock<std::recursive_mutex> Map::LockForRegionUpdate()
+{
+    if (!_regionUpdateActive)
+        return std::unique_lock<std::recursive_mutex>();
+
+    return std::unique_lock<std::recursive_mutex>(_regionUpdateLock);
+}
+
 void Map::AddObjectToPendingUpdateList(WorldObject* obj)
 {
     if (!obj->CanBeAddedToMapUpdateList())
         return;
 
+    auto guard = LockForRegionUpdate();
+
     UpdatableMapObject* mapUpdatableObject = dynamic_cast<UpdatableMapObject*>(obj);
     if (mapUpdatableObject->GetUpdateState() != UpdatableMapObject::UpdateState::NotUpdating)
         return;
@@ -702,6 +930,15 @@ void Map::_RemoveObjectFromUpdateList(WorldObject* obj)
     UpdatableMapObject* mapUpdatableObject = dynamic_cast<UpdatableMapObject*>(obj);
     ASSERT(mapUpdatableObject && mapUpdatableObject->GetUpdateState() == UpdatableMapObject::UpdateState::Updating);
 
+    // Other regions may still iterate the list, leave a hole and compact it once all passes are done
+    if (_regionUpdateActive)
+    {
+        std::atomic_ref<WorldObject*>(_updatableObjectList[mapUpdatableObject->GetMapUpdateListOffset()]).store(nullptr, std::memory_order_relaxed);
+        _updatableObjectListHasHoles = true;
+        mapUpdatableObject->SetUpdateState(UpdatableMapObject::UpdateState::NotUpdating);
+        return;
+    }
+
     if (obj != _updatableObjectList.back())
     {
         dynamic_cast<UpdatableMapObject*>(_updatableObjectList.back())->SetMapUpdateListOffset(mapUpdatableObject->GetMapUpdateListOffset());
@@ -717,6 +954,8 @@ void Map::RemoveObjectFromMapUpdateList(WorldObject* obj)
     if (!obj->CanBeAddedToMapUpdateList())
         return;
 
+    auto guard = LockForRegionUpdate();
+
     UpdatableMapObject* mapUpdatableObject = dynamic_cast<UpdatableMapObject*>(obj);
     if (mapUpdatableObject->GetUpdateState() == UpdatableMapObject::UpdateState::PendingAdd)
         _pendingAddUpdatableObjectList.erase(obj);
@@ -724,6 +963,14 @@ void Map::RemoveObjectFromMapUpdateList(WorldObject* obj)
         _RemoveObjectFromUpdateList(obj);
 }
 
+void Map::AddUnitToDelayedVisibilityList(Unit* unit)
+{
+    if (RegionUpdateBuffer* buffer = GetRegionUpdateBuffer())
+        buffer->delayedVisibility.push_back(unit);
+    else
+        i_objectsForDelayedVisibility.insert(unit);
+}
+
 void Map::HandleDelayedVisibility()
 {
     if (i_objectsForDelayedVisibility.empty())
@@ -777,6 +1024,8 @@ void Map::AfterPlayerUnlinkFromMap()
 template<class T>
 void Map::RemoveFromMap(T* obj, bool remove)
 {
+    auto guard = LockForRegionUpdate();
+
     bool inWorld = obj->IsInWorld() && obj->GetTypeId() >= TYPEID_UNIT && obj->GetTypeId() <= TYPEID_GAMEOBJECT;
     obj->RemoveFromWorld();
 
@@ -859,6 +1108,11 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float o)
     }
 
     player->Relocate(x, y, z, o);
+
+    // queue the terrain of grids the player is heading to, only cell changes can reveal new ones
+    if (old_cell.DiffGrid(new_cell) || old_cell.DiffCell(new_cell))
+        sGridTerrainPreloader->RequestAhead(this, player, sWorld->getFloatConfig(CONFIG_MAP_TERRAIN_PRELOAD_DISTANCE));
+
     if (player->IsVehicle())
         player->GetVehicleKit()->RelocatePassengers();
     player->UpdatePositionData();
@@ -931,7 +1185,12 @@ void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float
 void Map::AddCreatureToMoveList(Creature* c)
 {
     if (c->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _creaturesToMove.push_back(c);
+    {
+        if (RegionUpdateBuffer* buffer = GetRegionUpdateBuffer())
+            buffer->creaturesToMove.push_back(c);
+        else
+            _creaturesToMove.push_back(c);
+    }
     c->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
 }
 
@@ -944,7 +1203,12 @@ void Map::RemoveCreatureFromMoveList(Creature* c)
 void Map::AddGameObjectToMoveList(GameObject* go)
 {
     if (go->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _gameObjectsToMove.push_back(go);
+    {
+        if (RegionUpdateBuffer* buffer = GetRegionUpdateBuffer())
+            buffer->gameObjectsToMove.push_back(go);
+        else
+            _gameObjectsToMove.push_back(go);
+    }
     go->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
 }
 
@@ -957,7 +1221,12 @@ void Map::RemoveGameObjectFromMoveList(GameObject* go)
 void Map::AddDynamicObjectToMoveList(DynamicObject* dynObj)
 {
     if (dynObj->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
-        _dynamicObjectsToMove.push_back(dynObj);
+    {
+        if (RegionUpdateBuffer* buffer = GetRegionUpdateBuffer())
+            buffer->dynamicObjectsToMove.push_back(dynObj);
+        else
+            _dynamicObjectsToMove.push_back(dynObj);
+    }
     dynObj->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
 }
 
@@ -1135,6 +1404,13 @@ GridTerrainData* Map::GetGridTerrainData(GridCoord const& gridCoord)
     if (!MapGridManager::IsValidGridCoordinates(gridCoord.x_coord, gridCoord.y_coord))
         return nullptr;
 
+    if (_parallelUpdateActive && !IsGridCreated(gridCoord))
+    {
+        std::lock_guard<std::mutex> guard(_deferredGridsLock);
+        _deferredGrids.push_back(gridCoord);
+        return nullptr;
+    }
+
     // ensure GridMap is created
     EnsureGridCreated(gridCoord);
     return _mapGridManager.GetGrid(gridCoord.x_coord, gridCoord.y_coord)->GetTerrainData();
@@ -1146,6 +1422,79 @@ GridTerrainData* Map::GetGridTerrainData(float x, float y)
     return GetGridTerrainData(gridCoord);
 }
 
+void Map::BeginParallelUpdate()
+{
+    _parallelUpdateActive = true;
+}
+
+void Map::EndParallelUpdate()
+{
+    _parallelUpdateActive = false;
+
+    for (auto& [gridX, gridY, preloaded] : _deferredGridCollision)
+        GridTerrainLoader(*_mapGridManager.GetGrid(gridX, gridY), this).LoadCollision(std::move(preloaded));
+
+    _deferredGridCollision.clear();
+
+    for (GridCoord const& gridCoord : _deferredGrids)
+        EnsureGridCreated(gridCoord);
+
+    _deferredGrids.clear();
+}
+
+void Map::DeferGridCollisionLoading(uint32 gridX, uint32 gridY, std::unique_ptr<PreloadedGridTerrain> preloaded)
+{
+    std::lock_guard<std::mutex> guard(_deferredGridsLock);
+    _deferredGridCollision.emplace_back(gridX, gridY, std::move(preloaded));
+}
+
+std::shared_lock<std::shared_mutex> Map::LockDynamicTreeForRead() const
+{
+    if (!_parallelUpdateActive)
+        return std::shared_lock<std::shared_mutex>();
+
+    return std::shared_lock<std::shared_mutex>(_dynamicTreeLock);
+}
+
+std::unique_lock<std::shared_mutex> Map::LockDynamicTreeForWrite()
+{
+    if (!_parallelUpdateActive)
+        return std::unique_lock<std::shared_mutex>();
+
+    return std::unique_lock<std::shared_mutex>(_dynamicTreeLock);
+}
+
+void Map::Balance()
+{
+    auto guard = LockDynamicTreeForWrite();
+    _dynamicTree.balance();
+}
+
+void Map::RemoveGameObjectModel(const GameObjectModel& model)
+{
+    auto guard = LockDynamicTreeForWrite();
+    _dynamicTree.remove(model);
+
+    // the queries of the other threads would rebuild the tree lazily
+    if (guard)
+        _dynamicTree.balance();
+}
+
+void Map::InsertGameObjectModel(const GameObjectModel& model)
+{
+    auto guard = LockDynamicTreeForWrite();
+    _dynamicTree.insert(model);
+
+    if (guard)
+        _dynamicTree.balance();
+}
+
+bool Map::ContainsGameObjectModel(const GameObjectModel& model) const
+{
+    auto guard = LockDynamicTreeForRead();
+    return _dynamicTree.contains(model);
+}
+
 float Map::GetWaterOrGroundLevel(uint32 phasemask, float x, float y, float z, float* ground /*= nullptr*/, bool /*swim = false*/, float collisionHeight) const
 {
     // we need ground level (including grid height version) for proper return water level in point
@@ -1268,7 +1617,11 @@ bool Map::GetAreaInfo(uint32 phaseMask, float x, float y, float z, uint32& flags
     int32 dgroupId;
 
     bool hasVmapAreaInfo = vmgr->GetAreaInfo(GetId(), x, y, vmap_z, vflags, vadtId, vrootId, vgroupId);
-    bool hasDynamicAreaInfo = _dynamicTree.GetAreaInfo(x, y, dynamic_z, phaseMask, dflags, dadtId, drootId, dgroupId);
+    bool hasDynamicAreaInfo;
+    {
+        auto guard = LockDynamicTreeForRead();
+        hasDynamicAreaInfo = _dynamicTree.GetAreaInfo(x, y, dynamic_z, phaseMask, dflags, dadtId, drootId, dgroupId);
+    }
     auto useVmap = [&]() { check_z = vmap_z; flags = vflags; adtId = vadtId; rootId = vrootId; groupId = vgroupId; };
     auto useDyn = [&]() { check_z = dynamic_z; flags = dflags; adtId = dadtId; rootId = drootId; groupId = dgroupId; };
 
@@ -1359,6 +1712,14 @@ LiquidData const Map::GetLiquidData(uint32 phaseMask, float x, float y, float z,
 {
    LiquidData liquidData;
 
+    TerrainQueryCache& cache = TerrainQueryCache::GetForCurrentThread(sWorld->getIntConfig(CONFIG_TERRAIN_QUERY_CACHE_SIZE));
+    TerrainQueryCache::Key key(_dynamicTree.GetGeneration(x, y), x, y, z, phaseMask, (uint64(std::bit_cast<uint32>(collisionHeight)) << 8) | ReqLiquidType);
+    if (cache.FindLiquid(key, liquidData))
+    {
+        _terrainQueryCacheHits.fetch_add(1, std::memory_order_relaxed);
+        return liquidData;
+    }
+
     VMAP::IVMapMgr* vmgr = VMAP::VMapFactory::createOrGetVMapMgr();
     float liquid_level = INVALID_HEIGHT;
     float ground_level = INVALID_HEIGHT;
@@ -1438,6 +1799,13 @@ LiquidData const Map::GetLiquidData(uint32 phaseMask, float x, float y, float z,
         }
     }
 
+    // the grid is only created after a parallel update, until then the result lacks its terrain
+    if (cache.GetSize() && IsGridCreated(x, y))
+    {
+        _terrainQueryCacheMisses.fetch_add(1, std::memory_order_relaxed);
+        cache.StoreLiquid(key, liquidData);
+    }
+
    return liquidData;
 }
 
@@ -1623,6 +1991,7 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
             ignoreFlags = VMAP::ModelIgnoreFlags::M2;
         }
 
+        auto guard = LockDynamicTreeForRead();
         if (!_dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, ignoreFlags))
         {
             return false;
@@ -1632,12 +2001,46 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
     return true;
 }
 
+void Map::isInLineOfSight(std::vector<VMAP::LineOfSightQuery>& queries, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    if ((!sWorld->getBoolConfig(CONFIG_VMAP_BLIZZLIKE_PVP_LOS) && IsBattlegroundOrArena()) ||
+        (!sWorld->getBoolConfig(CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD) && IsWorldMap()))
+    {
+        ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+    }
+
+    if (checks & LINEOFSIGHT_CHECK_VMAP)
+    {
+        VMAP::VMapFactory::createOrGetVMapMgr()->isInLineOfSight(GetId(), queries, ignoreFlags);
+    }
+
+    if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT_ALL))
+    {
+        ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+        if (!(checks & LINEOFSIGHT_CHECK_GOBJECT_M2))
+        {
+            ignoreFlags = VMAP::ModelIgnoreFlags::M2;
+        }
+
+        // only the segments not blocked by the static models are left
+        auto guard = LockDynamicTreeForRead();
+        for (VMAP::LineOfSightQuery& query : queries)
+        {
+            if (query.inLineOfSight)
+            {
+                query.inLineOfSight = _dynamicTree.isInLineOfSight(query.start.x, query.start.y, query.start.z, query.end.x, query.end.y, query.end.z, phasemask, ignoreFlags);
+            }
+        }
+    }
+}
+
 bool Map::GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
 {
     G3D::Vector3 startPos(x1, y1, z1);
     G3D::Vector3 dstPos(x2, y2, z2);
 
     G3D::Vector3 resultPos;
+    auto guard = LockDynamicTreeForRead();
     bool result = _dynamicTree.GetObjectHitPos(phasemask, startPos, dstPos, resultPos, modifyDist);
 
     rx = resultPos.x;
@@ -1648,10 +2051,31 @@ bool Map::GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float
 
 float Map::GetHeight(uint32 phasemask, float x, float y, float z, bool vmap/*=true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
 {
+    TerrainQueryCache& cache = TerrainQueryCache::GetForCurrentThread(sWorld->getIntConfig(CONFIG_TERRAIN_QUERY_CACHE_SIZE));
+    TerrainQueryCache::Key key(_dynamicTree.GetGeneration(x, y), x, y, z, phasemask, (uint64(std::bit_cast<uint32>(maxSearchDist)) << 1) | uint64(vmap));
+    float height;
+    if (cache.FindHeight(key, height))
+    {
+        _terrainQueryCacheHits.fetch_add(1, std::memory_order_relaxed);
+        return height;
+    }
+
     float h1, h2;
     h1 = GetHeight(x, y, z, vmap, maxSearchDist);
-    h2 = _dynamicTree.getHeight(x, y, z, maxSearchDist, phasemask);
-    return std::max<float>(h1, h2);
+    {
+        auto guard = LockDynamicTreeForRead();
+        h2 = _dynamicTree.getHeight(x, y, z, maxSearchDist, phasemask);
+    }
+    height = std::max<float>(h1, h2);
+
+    // the grid is only created after a parallel update, until then the result lacks its terrain
+    if (cache.GetSize() && IsGridCreated(x, y))
+    {
+        _terrainQueryCacheMisses.fetch_add(1, std::memory_order_relaxed);
+        cache.StoreHeight(key, height);
+    }
+
+    return height;
 }
 
 bool Map::IsInWater(uint32 phaseMask, float x, float y, float pZ, float collisionHeight) const
@@ -1758,27 +2182,132 @@ void Map::SendRemoveTransports(Player* player)
     player->GetSession()->SendPacket(&packet);
 }
 
-void Map::SendObjectUpdates()
+namespace
 {
-    UpdateDataMapType update_players;
-    UpdatePlayerSet player_set;
+    // Collects every player that may have a client copy of an object standing in the visited cells
+    struct ObjectUpdateViewerCollector
+    {
+        std::vector<Player*>& i_viewers;
+
+        explicit ObjectUpdateViewerCollector(std::vector<Player*>& viewers) : i_viewers(viewers) { }
+
+        void Visit(PlayerMapType& m)
+        {
+            for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+            {
+                Player* source = iter->GetSource();
+                i_viewers.push_back(source);
+
+                if (source->HasSharedVision())
+                    for (Player* viewer : source->GetSharedVisionList())
+                        i_viewers.push_back(viewer);
+            }
+        }
+
+        void Visit(CreatureMapType& m)
+        {
+            for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+            {
+                Creature* source = iter->GetSource();
+                if (source->HasSharedVision())
+                    for (Player* viewer : source->GetSharedVisionList())
+                        i_viewers.push_back(viewer);
+            }
+        }
+
+        void Visit(DynamicObjectMapType& m)
+        {
+            for (DynamicObjectMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+            {
+                DynamicObject* source = iter->GetSource();
+                ObjectGuid guid = source->GetCasterGUID();
 
+                if (guid)
+                {
+                    //Caster may be nullptr if DynObj is in removelist
+                    if (Player* caster = ObjectAccessor::FindPlayer(guid))
+                        if (caster->GetGuidValue(PLAYER_FARSIGHT) == source->GetGUID())
+                            i_viewers.push_back(caster);
+                }
+            }
+        }
+
+        template<class SKIP> void Visit(GridRefMgr<SKIP>&) { }
+    };
+}
+
+void Map::SendObjectUpdates()
+{
     while (!_updateObjects.empty())
     {
-        Object* obj = *_updateObjects.begin();
-        ASSERT(obj->IsInWorld());
+        // Objects updating nearby players are bucketed by cell, the others (items, transports) pick their receivers themselves
+        for (Object* obj : _updateObjects)
+        {
+            ASSERT(obj->IsInWorld());
+
+            if (obj->IsUpdateBatchedByCell())
+            {
+                WorldObject* worldObj = static_cast<WorldObject*>(obj);
+                CellCoord cellCoord = Acore::ComputeCellCoord(worldObj->GetPositionX(), worldObj->GetPositionY());
+                _cellUpdateObjects.emplace_back(cellCoord.GetId(), worldObj);
+            }
+            else
+                _ownUpdateObjects.push_back(obj);
+        }
+
+        _updateObjects.clear();
+
+        for (Object* obj : _ownUpdateObjects)
+            obj->BuildUpdate(_updatePlayers);
 
-        _updateObjects.erase(_updateObjects.begin());
-        obj->BuildUpdate(update_players, player_set);
+        _ownUpdateObjects.clear();
+
+        std::sort(_cellUpdateObjects.begin(), _cellUpdateObjects.end(), [](auto const& left, auto const& right) { return left.first < right.first; });
+
+        for (auto cellBegin = _cellUpdateObjects.begin(); cellBegin != _cellUpdateObjects.end();)
+        {
+            auto cellEnd = cellBegin;
+            float visibilityRange = 0.0f;
+            for (; cellEnd != _cellUpdateObjects.end() && cellEnd->first == cellBegin->first; ++cellEnd)
+                visibilityRange = std::max(visibilityRange, cellEnd->second->GetVisibilityRange());
+
+            // Every object of the cell is at most a cell diagonal away from the first one,
+            // so widening the search by that much finds the receivers of all of them in a single grid visit
+            WorldObject* first = cellBegin->second;
+            ObjectUpdateViewerCollector collector(_cellUpdateViewers);
+            Cell::VisitWorldObjects(first->GetPositionX(), first->GetPositionY(), this, collector, visibilityRange + SIZE_OF_GRID_CELL * static_cast<float>(M_SQRT2));
+
+            std::sort(_cellUpdateViewers.begin(), _cellUpdateViewers.end());
+            _cellUpdateViewers.erase(std::unique(_cellUpdateViewers.begin(), _cellUpdateViewers.end()), _cellUpdateViewers.end());
+
+            for (auto itr = cellBegin; itr != cellEnd; ++itr)
+            {
+                WorldObject* obj = itr->second;
+                for (Player* viewer : _cellUpdateViewers)
+                    if (viewer->HaveAtClient(obj))
+                        obj->BuildFieldsUpdate(viewer, _updatePlayers);
+
+                obj->ClearUpdateMask(false);
+            }
+
+            _cellUpdateViewers.clear();
+            cellBegin = cellEnd;
+        }
+
+        _cellUpdateObjects.clear();
     }
 
     WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
-    for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
+    for (Player* player : _updatePlayers)
     {
-        iter->second.BuildPacket(packet);
-        iter->first->GetSession()->SendPacket(&packet);
+        UpdateData& data = player->GetObjectUpdateData();
+        data.BuildPacket(packet);
+        player->GetSession()->SendPacket(&packet);
         packet.clear();                                     // clean the string
+        data.Clear();
     }
+
+    _updatePlayers.clear();
 }
 
 uint32 Map::ApplyDynamicModeRespawnScaling(WorldObject const* obj, uint32 respawnDelay) const
@@ -1837,6 +2366,8 @@ void Map::AddObjectToRemoveList(WorldObject* obj)
 {
     ASSERT(obj->GetMapId() == GetId() && obj->GetInstanceId() == GetInstanceId());
 
+    auto guard = LockForRegionUpdate();
+
     obj->CleanupsBeforeDelete(false);                            // remove or simplify at least cross referenced links
 
     i_objectsToRemove.insert(obj);
@@ -1851,6 +2382,8 @@ void Map::AddObjectToSwitchList(WorldObject* obj, bool on)
     if (!obj->IsCreature() && !obj->IsGameObject())
         return;
 
+    auto guard = LockForRegionUpdate();
+
     std::map<WorldObject*, bool>::iterator itr = i_objectsToSwitch.find(obj);
     if (itr == i_objectsToSwitch.end())
         i_objectsToSwitch.insert(itr, std::make_pair(obj, on));
@@ -1938,8 +2471,9 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    SharedWorldPacket sharedData = std::make_shared<WorldPacket const>(*data);
     for (MapRefMgr::const_iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
-        itr->GetSource()->GetSession()->SendPacket(data);
+        itr->GetSource()->GetSession()->SendPacket(sharedData);
 }
 
 template<class T>
@@ -2495,21 +3029,25 @@ void BattlegroundMap::RemoveAllPlayers()
 
 Corpse* Map::GetCorpse(ObjectGuid const guid)
 {
+    auto guard = LockForRegionUpdate();
     return _objectsStore.Find<Corpse>(guid);
 }
 
 Creature* Map::GetCreature(ObjectGuid const guid)
 {
+    auto guard = LockForRegionUpdate();
     return _objectsStore.Find<Creature>(guid);
 }
 
 GameObject* Map::GetGameObject(ObjectGuid const guid)
 {
+    auto guard = LockForRegionUpdate();
     return _objectsStore.Find<GameObject>(guid);
 }
 
 Pet* Map::GetPet(ObjectGuid const guid)
 {
+    auto guard = LockForRegionUpdate();
     return _objectsStore.Find<Pet>(guid);
 }
 
@@ -2524,6 +3062,7 @@ Transport* Map::GetTransport(ObjectGuid guid)
 
 DynamicObject* Map::GetDynamicObject(ObjectGuid guid)
 {
+    auto guard = LockForRegionUpdate();
     return _objectsStore.Find<DynamicObject>(guid);
 }
 
@@ -2546,6 +3085,7 @@ void Map::SaveCreatureRespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTi
     if (GetInstanceResetPeriod() > 0 && respawnTime - now + 5 >= GetInstanceResetPeriod())
         respawnTime = now + YEAR;
 
+    auto guard = LockForRegionUpdate();
     _creatureRespawnTimes[spawnId] = respawnTime;
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CREATURE_RESPAWN);
@@ -2558,6 +3098,7 @@ void Map::SaveCreatureRespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTi
 
 void Map::RemoveCreatureRespawnTime(ObjectGuid::LowType spawnId)
 {
+    auto guard = LockForRegionUpdate();
     _creatureRespawnTimes.erase(spawnId);
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
@@ -2580,6 +3121,7 @@ void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
     if (GetInstanceResetPeriod() > 0 && respawnTime - now + 5 >= GetInstanceResetPeriod())
         respawnTime = now + YEAR;
 
+    auto guard = LockForRegionUpdate();
     _goRespawnTimes[spawnId] = respawnTime;
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_GO_RESPAWN);
@@ -2592,6 +3134,7 @@ void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
 
 void Map::RemoveGORespawnTime(ObjectGuid::LowType spawnId)
 {
+    auto guard = LockForRegionUpdate();
     _goRespawnTimes.erase(spawnId);
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN);
@@ -2893,6 +3436,7 @@ void Map::RemoveOldCorpses()
 
 void Map::ScheduleCreatureRespawn(ObjectGuid creatureGuid, Milliseconds respawnTimer, Position pos)
 {
+    auto guard = LockForRegionUpdate();
     _creatureRespawnScheduler.Schedule(respawnTimer, [this, creatureGuid, pos](TaskContext)
     {
         if (Creature* creature = GetCreature(creatureGuid))
@@ -31,15 +31,19 @@
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
 #include "PathGenerator.h"
+#include "PathfindingService.h"
 #include "Position.h"
 #include "SharedDefines.h"
 #include "TaskScheduler.h"
 #include "Timer.h"
 #include "GridTerrainData.h"
+#include <atomic>
 #include <bitset>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <tuple>
 
 class Unit;
 class WorldPacket;
@@ -62,12 +66,14 @@ class Transport;
 class StaticTransport;
 class MotionTransport;
 class PathGenerator;
+struct PreloadedGridTerrain;
 
 enum WeatherState : uint32;
 
 namespace VMAP
 {
     enum class ModelIgnoreFlags : uint32;
+    struct LineOfSightQuery;
 }
 
 namespace Acore
@@ -187,6 +193,10 @@ public:
 
     virtual void Update(const uint32, const uint32, bool thread = true);
 
+    // Moving average of the time spent in Update(), in microseconds, maintained by MapUpdater
+    [[nodiscard]] uint32 GetUpdateTimeEstimate() const { return _updateTimeEstimate; }
+    void SetUpdateTimeEstimate(uint32 estimate) { _updateTimeEstimate = estimate; }
+
     [[nodiscard]] float GetVisibilityRange() const { return m_VisibleDistance; }
     void SetVisibilityRange(float range) { m_VisibleDistance = range; }
     void OnCreateMap();
@@ -221,6 +231,19 @@ public:
     GridTerrainData* GetGridTerrainData(GridCoord const& gridCoord);
     GridTerrainData* GetGridTerrainData(float x, float y);
 
+    /**
+     * Parallel phase of the map: its objects are updated or its paths calculated by several threads at once.
+     *
+     * The vmap and mmap trees are read by all threads, so grids are not created meanwhile: the terrain of
+     * a grid that is not created yet is missing (GetGridTerrainData returns nullptr) and the grid is created
+     * once the phase ends, the vmap and mmap tiles of the grids created by the map thread just before are
+     * loaded then too. Gameobject models added or removed meanwhile exclude the queries of the dynamic tree.
+     */
+    void BeginParallelUpdate();
+    void EndParallelUpdate();
+    [[nodiscard]] bool IsParallelUpdateActive() const { return _parallelUpdateActive; }
+    void DeferGridCollisionLoading(uint32 gridX, uint32 gridY, std::unique_ptr<PreloadedGridTerrain> preloaded);
+
     [[nodiscard]] uint32 GetId() const { return i_mapEntry->MapID; }
 
     [[nodiscard]] Map const* GetParent() const { return m_parentMap; }
@@ -229,6 +252,7 @@ public:
     [[nodiscard]] std::shared_mutex& GetMMapLock() const { return *(const_cast<std::shared_mutex*>(&MMapLock)); }
     // pussywizard:
     std::unordered_set<Unit*> i_objectsForDelayedVisibility;
+    void AddUnitToDelayedVisibilityList(Unit* unit);
     void HandleDelayedVisibility();
 
     // some calls like isInWater should not use vmaps due to processor power
@@ -391,18 +415,25 @@ public:
     float GetWaterOrGroundLevel(uint32 phasemask, float x, float y, float z, float* ground = nullptr, bool swim = false, float collisionHeight = DEFAULT_COLLISION_HEIGHT) const;
     [[nodiscard]] float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
     [[nodiscard]] bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+    // isInLineOfSight of several segments at once, segments blocked by the static models are not checked against gameobjects
+    void isInLineOfSight(std::vector<VMAP::LineOfSightQuery>& queries, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, PathGenerator *path, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CheckCollisionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true) const;
-    void Balance() { _dynamicTree.balance(); }
-    void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); }
-    void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); }
-    [[nodiscard]] bool ContainsGameObjectModel(const GameObjectModel& model) const { return _dynamicTree.contains(model);}
+    void Balance();
+    void RemoveGameObjectModel(const GameObjectModel& model);
+    void InsertGameObjectModel(const GameObjectModel& model);
+    void UpdateGameObjectModelCollision(const GameObjectModel& model) { _dynamicTree.invalidate(model); }
+    [[nodiscard]] bool ContainsGameObjectModel(const GameObjectModel& model) const;
     [[nodiscard]] DynamicMapTree const& GetDynamicMapTree() const { return _dynamicTree; }
+    PathfindingService& GetPathfindingService() { return _pathfindingService; }
+    [[nodiscard]] uint64 GetTerrainQueryCacheHits() const { return _terrainQueryCacheHits.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64 GetTerrainQueryCacheMisses() const { return _terrainQueryCacheMisses.load(std::memory_order_relaxed); }
     bool GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist);
     [[nodiscard]] float GetGameObjectFloor(uint32 phasemask, float x, float y, float z, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const
     {
+        auto guard = LockDynamicTreeForRead();
         return _dynamicTree.getHeight(x, y, z, maxSearchDist, phasemask);
     }
     /*
@@ -479,16 +510,35 @@ public:
     inline ObjectGuid::LowType GenerateLowGuid()
     {
         static_assert(ObjectGuidTraits<high>::MapSpecific, "Only map specific guid can be generated in Map context");
+        auto guard = LockForRegionUpdate();
         return GetGuidSequenceGenerator<high>().Generate();
     }
 
     void AddUpdateObject(Object* obj)
     {
-        _updateObjects.insert(obj);
+        if (RegionUpdateBuffer* buffer = GetRegionUpdateBuffer())
+        {
+            std::lock_guard<std::mutex> guard(buffer->lock);
+            buffer->updateObjects.push_back(obj);
+        }
+        else
+            _updateObjects.insert(obj);
     }
 
     void RemoveUpdateObject(Object* obj)
     {
+        auto guard = LockForRegionUpdate();
+
+        // the object may have been added by any region of the pass, not only the calling one
+        if (_regionUpdateActive)
+        {
+            for (std::unique_ptr<RegionUpdateBuffer> const& buffer : _regionUpdateBuffers)
+            {
+                std::lock_guard<std::mutex> bufferGuard(buffer->lock);
+                std::erase(buffer->updateObjects, obj);
+            }
+        }
+
         _updateObjects.erase(obj);
     }
 
@@ -546,6 +596,9 @@ protected:
     uint32 m_unloadTimer;
     float m_VisibleDistance;
     DynamicMapTree _dynamicTree;
+    // GetHeight and GetLiquidData results found in and missing from the TerrainQueryCache of the querying thread
+    mutable std::atomic<uint64> _terrainQueryCacheHits = 0;
+    mutable std::atomic<uint64> _terrainQueryCacheMisses = 0;
     time_t _instanceResetPeriod; // pussywizard
 
     MapRefMgr m_mapRefMgr;
@@ -588,11 +641,14 @@ private:
 
     void AddToActiveHelper(WorldObject* obj)
     {
+        auto guard = LockForRegionUpdate();
         m_activeNonPlayers.insert(obj);
     }
 
     void RemoveFromActiveHelper(WorldObject* obj)
     {
+        auto guard = LockForRegionUpdate();
+
         // Map::Update for active object in proccess
         if (m_activeNonPlayersIter != m_activeNonPlayers.end())
         {
@@ -609,6 +665,43 @@ private:
 
     void UpdateNonPlayerObjects(uint32 const diff);
 
+    /**
+     * Parallel update of non-player objects (MapUpdate.ParallelRegions).
+     *
+     * The updatable objects are split by grid and the grids are colored in a 2x2 pattern, so grids sharing
+     * a color are never adjacent. Each color is a pass in which all its grids are updated in parallel on the
+     * MapUpdater pool: objects updated concurrently are always at least one grid (533 yards) apart.
+     * Map-wide containers filled by the updates (object updates, cell move lists, delayed visibility) are
+     * written to a per-region buffer and merged on the map thread after each pass, the remaining map-wide
+     * state (grids, object store, respawn times...) is serialized by _regionUpdateLock while a pass runs.
+     * Objects whose update can reach another region (see CanUpdateObjectInRegion) are updated on the map
+     * thread once all passes are done.
+     */
+    struct RegionUpdateBuffer
+    {
+        Map* map = nullptr;
+        std::mutex lock;                ///< guards updateObjects, other regions remove from it
+        std::vector<Object*> updateObjects;
+        std::vector<Creature*> creaturesToMove;
+        std::vector<GameObject*> gameObjectsToMove;
+        std::vector<DynamicObject*> dynamicObjectsToMove;
+        std::vector<Unit*> delayedVisibility;
+    };
+
+    bool CanUpdateNonPlayerObjectsByRegion() const;
+    static bool CanUpdateObjectInRegion(WorldObject const* obj);
+    void UpdateNonPlayerObjectsByRegion(uint32 const diff);
+    void MergeRegionUpdateBuffer(RegionUpdateBuffer& buffer);
+    void CompactUpdatableObjectList();
+
+    RegionUpdateBuffer* GetRegionUpdateBuffer() const { return _regionUpdateBuffer && _regionUpdateBuffer->map == this ? _regionUpdateBuffer : nullptr; }
+    std::unique_lock<std::recursive_mutex> LockForRegionUpdate();
+
+    static inline thread_local RegionUpdateBuffer* _regionUpdateBuffer = nullptr;
+
+    std::shared_lock<std::shared_mutex> LockDynamicTreeForRead() const;
+    std::unique_lock<std::shared_mutex> LockDynamicTreeForWrite();
+
     void _AddObjectToUpdateList(WorldObject* obj);
     void _RemoveObjectFromUpdateList(WorldObject* obj);
 
@@ -640,9 +733,31 @@ private:
 
     std::unordered_set<Object*> _updateObjects;
 
+    // Scratch storage of SendObjectUpdates, kept as members so a tick does not reallocate them
+    std::vector<std::pair<uint32 /*cellId*/, WorldObject*>> _cellUpdateObjects;
+    std::vector<Object*> _ownUpdateObjects;
+    std::vector<Player*> _cellUpdateViewers;
+    std::vector<Player*> _updatePlayers;
+
     UpdatableObjectList _updatableObjectList;
     PendingAddUpdatableObjectList _pendingAddUpdatableObjectList;
     IntervalTimer _updatableObjectListRecheckTimer;
+
+    uint32 _updateTimeEstimate;
+
+    std::vector<std::pair<uint32 /*region key*/, uint32 /*update list offset*/>> _regionUpdateEntries;
+    std::vector<uint32 /*update list offset*/> _serialUpdateEntries;
+    std::vector<std::unique_ptr<RegionUpdateBuffer>> _regionUpdateBuffers;
+    std::recursive_mutex _regionUpdateLock;
+    bool _regionUpdateActive;
+    std::atomic<bool> _parallelUpdateActive;
+    mutable std::shared_mutex _dynamicTreeLock;
+    std::mutex _deferredGridsLock;
+    std::vector<GridCoord> _deferredGrids;
+    std::vector<std::tuple<uint32 /*gridX*/, uint32 /*gridY*/, std::unique_ptr<PreloadedGridTerrain>>> _deferredGridCollision;
+    bool _updatableObjectListHasHoles;
+
+    PathfindingService _pathfindingService;
 };
 
 enum InstanceResetMethod
@@ -20,6 +20,7 @@
 #include "DatabaseEnv.h"
 #include "GridDefines.h"
 #include "GridTerrainLoader.h"
+#include "GridTerrainPreloader.h"
 #include "Group.h"
 #include "InstanceSaveMgr.h"
 #include "LFGMgr.h"
@@ -59,6 +60,8 @@ void MapMgr::Initialize()
     // Start mtmaps if needed
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    sGridTerrainPreloader->Initialize(sWorld->getIntConfig(CONFIG_MAP_TERRAIN_PRELOAD_THREADS));
 }
 
 void MapMgr::InitializeVisibilityDistanceInfo()
@@ -326,6 +329,8 @@ bool MapMgr::IsValidMAP(uint32 mapid, bool startUp)
 
 void MapMgr::UnloadAll()
 {
+    sGridTerrainPreloader->Shutdown();
+
     for (MapMapType::iterator iter = i_maps.begin(); iter != i_maps.end();)
     {
         iter->second->UnloadAll();
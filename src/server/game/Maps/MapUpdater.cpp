@@ -20,73 +20,171 @@
 #include "LFGMgr.h"
 #include "Map.h"
 #include "Metric.h"
+#include "StringFormat.h"
+#include "TickProfiler.h"
+#include "Timer.h"
+#include <algorithm>
+#include <limits>
+#include <utility>
 
-class UpdateRequest
-{
-public:
-    UpdateRequest() = default;
-    virtual ~UpdateRequest() = default;
+// Set for the lifetime of a worker thread, lets requests scheduled from inside the pool skip the staging step
+static thread_local MapUpdater* currentUpdater = nullptr;
+static thread_local std::size_t currentWorkerIndex = 0;
+static thread_local std::size_t currentParallelTaskSlot = 0;
 
-    virtual void call() = 0;
-};
-
-class MapUpdateRequest : public UpdateRequest
+// Shared by the helpers of one run_parallel() call, each helper claims indices until all are taken
+class ParallelTaskState
 {
 public:
-    MapUpdateRequest(Map& m, MapUpdater& u, uint32 d, uint32 sd)
-        : m_map(m), m_updater(u), m_diff(d), s_diff(sd)
+    ParallelTaskState(std::size_t count, std::function<void(std::size_t)> const& task)
+        : _count(count), _task(task), _next(0), _done(0)
     {
     }
 
-    void call() override
+    void run(std::size_t slot)
     {
-        METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(m_map.GetId())));
-        m_map.Update(m_diff, s_diff);
-        m_updater.update_finished();
+        std::size_t const previousSlot = std::exchange(currentParallelTaskSlot, slot);
+
+        for (std::size_t index = _next.fetch_add(1); index < _count; index = _next.fetch_add(1))
+        {
+            _task(index);
+
+            if (_done.fetch_add(1, std::memory_order_acq_rel) + 1 == _count)
+            {
+                std::lock_guard<std::mutex> guard(_lock);
+                _condition.notify_all();
+            }
+        }
+
+        currentParallelTaskSlot = previousSlot;
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> guard(_lock);
+        _condition.wait(guard, [this] {
+            return _done.load(std::memory_order_acquire) == _count;
+        });
     }
 
 private:
-    Map& m_map;
-    MapUpdater& m_updater;
-    uint32 m_diff;
-    uint32 s_diff;
+    std::size_t const _count;
+    std::function<void(std::size_t)> const& _task; // only called for claimed indices, the caller waits for those
+    std::atomic<std::size_t> _next;
+    std::atomic<std::size_t> _done;
+    std::mutex _lock;
+    std::condition_variable _condition;
 };
 
-class LFGUpdateRequest : public UpdateRequest
+// Every kind of request shares this layout so they can all be pooled in the request arena
+struct UpdateRequest
 {
-public:
-    LFGUpdateRequest(MapUpdater& u, uint32 d) : m_updater(u), m_diff(d) {}
+    enum class Type : uint8
+    {
+        MapUpdate,
+        LFGUpdate,
+        ParallelTask
+    };
+
+    Type type = Type::MapUpdate;
+    bool pooled = true;
+    Map* map = nullptr;
+    uint32 diff = 0;
+    uint32 s_diff = 0;
+    std::shared_ptr<ParallelTaskState> parallelTask;
+    std::size_t parallelTaskSlot = 0;
+
+    void call(MapUpdater& updater)
+    {
+        switch (type)
+        {
+            case Type::MapUpdate:
+            {
+                TimePoint start = std::chrono::steady_clock::now();
+
+                {
+                    METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(map->GetId())));
+                    map->Update(diff, s_diff);
+                }
+
+                uint32 updateTime = uint32(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start).count());
+                map->SetUpdateTimeEstimate(MapUpdater::update_time_estimate(map->GetUpdateTimeEstimate(), updateTime));
+                break;
+            }
+            case Type::LFGUpdate:
+            {
+                TimePoint start = std::chrono::steady_clock::now();
 
-    void call() override
+                sLFGMgr->Update(diff, 1);
+
+                uint32 updateTime = uint32(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start).count());
+                updater.set_lfg_update_time_estimate(MapUpdater::update_time_estimate(updater.get_lfg_update_time_estimate(), updateTime));
+                break;
+            }
+            case Type::ParallelTask:
+                parallelTask->run(parallelTaskSlot);
+                break;
+        }
+    }
+
+    // Estimated duration of call() in microseconds, used to run the most expensive requests first
+    [[nodiscard]] uint32 cost(MapUpdater const& updater) const
     {
-        sLFGMgr->Update(m_diff, 1);
-        m_updater.update_finished();
+        switch (type)
+        {
+            case Type::MapUpdate:
+                return map->GetUpdateTimeEstimate();
+            case Type::LFGUpdate:
+                return updater.get_lfg_update_time_estimate();
+            case Type::ParallelTask:
+                return std::numeric_limits<uint32>::max(); // Someone is already waiting on these
+        }
+
+        return 0;
     }
-private:
-    MapUpdater& m_updater;
-    uint32 m_diff;
 };
 
-MapUpdater::MapUpdater() : pending_requests(0), _cancelationToken(false)
+MapUpdater::MapUpdater() : _requestArena(std::make_unique<UpdateRequest[]>(REQUEST_ARENA_SIZE)), _requestArenaSize(REQUEST_ARENA_SIZE),
+    _requestArenaUsed(0), _queuedRequests(0), _sleepingWorkers(0), _lfgUpdateTimeEstimate(0), pending_requests(0), _cancelationToken(false)
+{
+}
+
+MapUpdater::~MapUpdater() = default;
+
+uint32 MapUpdater::update_time_estimate(uint32 previousEstimate, uint32 updateTime)
 {
+    if (!previousEstimate)
+        return updateTime;
+
+    // Exponential moving average, the newest sample weighs 1/8 so a single spike does not reorder the whole tick
+    return uint32((uint64(previousEstimate) * 7 + updateTime) / 8);
 }
 
 void MapUpdater::activate(std::size_t num_threads)
 {
+    _workerQueues.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i)
+        _workerQueues.push_back(std::make_unique<WorkerQueue>());
+
+    _workerLoads.resize(num_threads);
+
     _workerThreads.reserve(num_threads);
     for (std::size_t i = 0; i < num_threads; ++i)
     {
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this, i));
     }
 }
 
 void MapUpdater::deactivate()
 {
-    _cancelationToken = true;
-
     wait();  // This is where we wait for tasks to complete
 
-    _queue.Cancel();  // Cancel the queue to prevent further task processing
+    {
+        std::lock_guard<std::mutex> guard(_workLock);
+        _cancelationToken = true;
+    }
+
+    _workCondition.notify_all();  // Wake up sleeping workers so they can see the cancellation
 
     // Join all worker threads
     for (auto& thread : _workerThreads)
@@ -100,29 +198,95 @@ void MapUpdater::deactivate()
 
 void MapUpdater::wait()
 {
-    std::unique_lock<std::mutex> guard(_lock);  // Guard lock for safe waiting
+    dispatch_staged_requests();
 
-    // Wait until there are no pending requests
-    _condition.wait(guard, [this] {
-        return pending_requests.load(std::memory_order_acquire) == 0;
-    });
+    {
+        std::unique_lock<std::mutex> guard(_lock);  // Guard lock for safe waiting
+
+        // Wait until there are no pending requests
+        _condition.wait(guard, [this] {
+            return pending_requests.load(std::memory_order_acquire) == 0;
+        });
+    }
+
+    // Every request of this tick has been released, the arena can be reused
+    reset_request_arena();
+}
+
+UpdateRequest* MapUpdater::allocate_request()
+{
+    std::size_t index = _requestArenaUsed.fetch_add(1, std::memory_order_relaxed);
+    if (index < _requestArenaSize)
+    {
+        UpdateRequest* request = &_requestArena[index];
+        request->pooled = true;
+        return request;
+    }
+
+    // Arena exhausted for this tick, it is grown by the next reset
+    UpdateRequest* request = new UpdateRequest();
+    request->pooled = false;
+    return request;
+}
+
+void MapUpdater::release_request(UpdateRequest* request)
+{
+    if (!request->pooled)
+    {
+        delete request;
+        return;
+    }
+
+    request->parallelTask.reset();
+    request->parallelTaskSlot = 0;
+}
+
+void MapUpdater::reset_request_arena()
+{
+    std::size_t used = _requestArenaUsed.load(std::memory_order_acquire);
+    if (used > _requestArenaSize)
+    {
+        _requestArenaSize = used * 2;
+        _requestArena = std::make_unique<UpdateRequest[]>(_requestArenaSize);
+    }
+
+    _requestArenaUsed.store(0, std::memory_order_release);
 }
 
 void MapUpdater::schedule_task(UpdateRequest* request)
 {
     // Atomic increment for pending_requests
     pending_requests.fetch_add(1, std::memory_order_release);
-    _queue.Push(request);
+
+    // Scheduled by a worker, dispatched to its own queue once its current request is done
+    if (currentUpdater == this)
+    {
+        _workerQueues[currentWorkerIndex]->scheduledRequests.push_back(request);
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard(_stagedLock);
+    _stagedRequests.push_back(request);
 }
 
 void MapUpdater::schedule_update(Map& map, uint32 diff, uint32 s_diff)
 {
-    schedule_task(new MapUpdateRequest(map, *this, diff, s_diff));
+    UpdateRequest* request = allocate_request();
+    request->type = UpdateRequest::Type::MapUpdate;
+    request->map = &map;
+    request->diff = diff;
+    request->s_diff = s_diff;
+    schedule_task(request);
 }
 
 void MapUpdater::schedule_lfg_update(uint32 diff)
 {
-    schedule_task(new LFGUpdateRequest(*this, diff));
+    UpdateRequest* request = allocate_request();
+    request->type = UpdateRequest::Type::LFGUpdate;
+    request->map = nullptr;
+    request->diff = diff;
+    request->s_diff = 0;
+    schedule_task(request);
 }
 
 bool MapUpdater::activated()
@@ -133,7 +297,7 @@ bool MapUpdater::activated()
 void MapUpdater::update_finished()
 {
     // Atomic decrement for pending_requests
-    if (pending_requests.fetch_sub(1, std::memory_order_acquire) == 1)
+    if (pending_requests.fetch_sub(1, std::memory_order_acq_rel) == 1)
     {
         // Only notify when pending_requests becomes 0 (i.e., all tasks are finished)
         std::lock_guard<std::mutex> lock(_lock);  // Lock only for condition variable notification
@@ -141,22 +305,191 @@ void MapUpdater::update_finished()
     }
 }
 
-void MapUpdater::WorkerThread()
+std::size_t MapUpdater::GetParallelTaskSlot()
+{
+    return currentParallelTaskSlot;
+}
+
+void MapUpdater::run_parallel(std::size_t count, std::function<void(std::size_t)> const& task)
+{
+    if (count < 2 || !activated() || (currentUpdater == this && _workerThreads.size() < 2))
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            task(i);
+
+        return;
+    }
+
+    std::shared_ptr<ParallelTaskState> state = std::make_shared<ParallelTaskState>(count, task);
+
+    // Called from outside the pool between map updates, the caller runs its share and waits for the workers like for a map update
+    if (currentUpdater != this)
+    {
+        std::size_t helpers = std::min(count - 1, _workerThreads.size());
+        for (std::size_t i = 0; i < helpers; ++i)
+        {
+            UpdateRequest* request = allocate_request();
+            request->type = UpdateRequest::Type::ParallelTask;
+            request->parallelTask = state;
+            request->parallelTaskSlot = i + 1;
+            schedule_task(request);
+        }
+
+        dispatch_staged_requests();
+
+        state->run(0);
+        wait();
+        return;
+    }
+
+    // Helpers are pushed right away instead of waiting for the end of the current request like other requests scheduled by a worker
+    std::size_t helpers = std::min(count, _workerThreads.size()) - 1;
+    for (std::size_t i = 0; i < helpers; ++i)
+    {
+        UpdateRequest* request = allocate_request();
+        request->type = UpdateRequest::Type::ParallelTask;
+        request->parallelTask = state;
+        request->parallelTaskSlot = i + 1;
+
+        pending_requests.fetch_add(1, std::memory_order_release);
+        push_request(currentWorkerIndex, request);
+    }
+
+    notify_workers(helpers);
+
+    state->run(0);
+    state->wait();
+}
+
+void MapUpdater::push_request(std::size_t workerIndex, UpdateRequest* request)
+{
+    if (_workerQueues[workerIndex]->requests.Enqueue(request))
+        return;
+
+    std::lock_guard<std::mutex> guard(_overflowLock);
+    _overflowRequests.push_back(request);
+}
+
+UpdateRequest* MapUpdater::pop_request(std::size_t workerIndex)
+{
+    UpdateRequest* request = nullptr;
+
+    // Own queue first, then steal from the others starting with the next worker
+    for (std::size_t i = 0; i < _workerQueues.size(); ++i)
+    {
+        if (_workerQueues[(workerIndex + i) % _workerQueues.size()]->requests.Dequeue(request))
+        {
+            _queuedRequests.fetch_sub(1);
+            return request;
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(_overflowLock);
+    if (_overflowRequests.empty())
+        return nullptr;
+
+    request = _overflowRequests.back();
+    _overflowRequests.pop_back();
+    _queuedRequests.fetch_sub(1);
+    return request;
+}
+
+void MapUpdater::notify_workers(std::size_t count)
+{
+    // Sequentially consistent with the check in WorkerThread: either the worker sees the new requests
+    // before going to sleep, or we see it sleeping and wake it up
+    _queuedRequests.fetch_add(count);
+
+    if (!_sleepingWorkers.load())
+        return;
+
+    std::lock_guard<std::mutex> guard(_workLock);
+    if (count == 1)
+        _workCondition.notify_one();
+    else
+        _workCondition.notify_all();
+}
+
+void MapUpdater::dispatch_staged_requests()
+{
+    {
+        std::lock_guard<std::mutex> guard(_stagedLock);
+        _dispatchedRequests.swap(_stagedRequests);
+    }
+
+    if (_dispatchedRequests.empty())
+        return;
+
+    std::stable_sort(_dispatchedRequests.begin(), _dispatchedRequests.end(), [this](UpdateRequest const* left, UpdateRequest const* right)
+    {
+        return left->cost(*this) > right->cost(*this);
+    });
+
+    // Longest processing time first: each request goes to the worker with the least estimated work so far
+    std::fill(_workerLoads.begin(), _workerLoads.end(), 0);
+    for (UpdateRequest* request : _dispatchedRequests)
+    {
+        std::size_t workerIndex = std::distance(_workerLoads.begin(), std::min_element(_workerLoads.begin(), _workerLoads.end()));
+        _workerLoads[workerIndex] += request->cost(*this);
+        push_request(workerIndex, request);
+    }
+
+    notify_workers(_dispatchedRequests.size());
+    _dispatchedRequests.clear();
+}
+
+void MapUpdater::dispatch_worker_requests(std::size_t workerIndex)
+{
+    std::vector<UpdateRequest*>& requests = _workerQueues[workerIndex]->scheduledRequests;
+    if (requests.empty())
+        return;
+
+    std::stable_sort(requests.begin(), requests.end(), [this](UpdateRequest const* left, UpdateRequest const* right)
+    {
+        return left->cost(*this) > right->cost(*this);
+    });
+
+    for (UpdateRequest* request : requests)
+        push_request(workerIndex, request);
+
+    notify_workers(requests.size());
+    requests.clear();
+}
+
+void MapUpdater::WorkerThread(std::size_t workerIndex)
 {
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
 
+    currentUpdater = this;
+    currentWorkerIndex = workerIndex;
+
+    sTickProfiler->SetThreadName(Acore::StringFormat("Map updater {}", workerIndex));
+
     while (!_cancelationToken)
     {
-        UpdateRequest* request = nullptr;
+        UpdateRequest* request = pop_request(workerIndex);
 
-        _queue.WaitAndPop(request);  // Wait for and pop a request from the queue
-
-        if (!_cancelationToken && request)
+        if (!request)
         {
-            request->call();  // Execute the request
-            delete request;  // Clean up after processing
+            // Nothing to run or steal, sleep until new requests are queued
+            std::unique_lock<std::mutex> guard(_workLock);
+            _sleepingWorkers.fetch_add(1);
+            _workCondition.wait(guard, [this] {
+                return _queuedRequests.load() > 0 || _cancelationToken;
+            });
+            _sleepingWorkers.fetch_sub(1);
+            continue;
         }
+
+        request->call(*this);  // Execute the request
+        dispatch_worker_requests(workerIndex);
+
+        // Release before reporting completion, wait() recycles the arena as soon as the last request finishes
+        release_request(request);
+        update_finished();
     }
+
+    currentUpdater = nullptr;
 }
@@ -19,32 +19,97 @@
 #define _MAP_UPDATER_H_INCLUDED
 
 #include "Define.h"
-#include "PCQueue.h"
+#include "MPMCQueue.h"
+#include <atomic>
 #include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <thread>
-#include <atomic>
+#include <vector>
 
 class Map;
-class UpdateRequest;
+struct UpdateRequest;
 
+/**
+ * Work-stealing scheduler for map updates.
+ *
+ * Every worker thread owns a lock-free queue. Requests scheduled from outside the pool (the world thread)
+ * are staged and distributed longest-first over the worker queues when wait() is called, requests scheduled
+ * by a worker (instances scheduled by MapInstanced::Update) are pushed longest-first to that worker's own
+ * queue once its current request is done. Idle workers steal from the other queues, so a tick takes roughly
+ * max(longest map, total / threads).
+ *
+ * Requests live in an arena that is recycled once wait() has seen all of them complete, so scheduling
+ * does not allocate once the arena has grown to the number of requests of a tick.
+ */
 class MapUpdater
 {
 public:
     MapUpdater();
-    ~MapUpdater() = default;
+    ~MapUpdater();
 
-    void schedule_task(UpdateRequest* request);
     void schedule_update(Map& map, uint32 diff, uint32 s_diff);
     void schedule_lfg_update(uint32 diff);
     void wait();
     void activate(std::size_t num_threads);
     void deactivate();
     bool activated();
-    void update_finished();
+    [[nodiscard]] std::size_t get_thread_count() const { return _workerThreads.size(); }
+
+    // Runs task(0) .. task(count - 1) on the pool and returns once all of them are done, the caller runs its share as well.
+    // Outside of the pool it must not overlap a map update, as it waits for every scheduled request.
+    void run_parallel(std::size_t count, std::function<void(std::size_t)> const& task);
+
+    // Slot of the calling thread in the run_parallel() call it runs tasks of: 0 for the caller and outside of
+    // run_parallel(), 1 .. get_thread_count() for the helpers, so per thread resources can be indexed by it
+    static std::size_t GetParallelTaskSlot();
+
+    // Moving average of a request duration, in microseconds
+    static uint32 update_time_estimate(uint32 previousEstimate, uint32 updateTime);
+
+    [[nodiscard]] uint32 get_lfg_update_time_estimate() const { return _lfgUpdateTimeEstimate; }
+    void set_lfg_update_time_estimate(uint32 estimate) { _lfgUpdateTimeEstimate = estimate; }
 
 private:
-    void WorkerThread();
-    ProducerConsumerQueue<UpdateRequest*> _queue;
+    struct WorkerQueue
+    {
+        WorkerQueue() : requests(WORKER_QUEUE_SIZE) { }
+
+        MPMCQueue<UpdateRequest*> requests;
+        std::vector<UpdateRequest*> scheduledRequests; // scheduled by this worker, only touched by its thread
+    };
+
+    static constexpr std::size_t WORKER_QUEUE_SIZE = 1024;
+    static constexpr std::size_t REQUEST_ARENA_SIZE = 1024;
+
+    void WorkerThread(std::size_t workerIndex);
+    UpdateRequest* allocate_request();
+    void release_request(UpdateRequest* request);
+    void reset_request_arena();
+    void schedule_task(UpdateRequest* request);
+    void update_finished();
+    void push_request(std::size_t workerIndex, UpdateRequest* request);
+    UpdateRequest* pop_request(std::size_t workerIndex);
+    void notify_workers(std::size_t count);
+    void dispatch_staged_requests();
+    void dispatch_worker_requests(std::size_t workerIndex);
+
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::vector<UpdateRequest*> _overflowRequests; // worker queue was full, rare enough for a locked vector
+    std::mutex _overflowLock;
+    std::vector<UpdateRequest*> _stagedRequests; // scheduled from outside the pool, dispatched by wait()
+    std::vector<UpdateRequest*> _dispatchedRequests;
+    std::vector<uint64> _workerLoads;
+    std::mutex _stagedLock;
+    std::unique_ptr<UpdateRequest[]> _requestArena;
+    std::size_t _requestArenaSize;
+    std::atomic<std::size_t> _requestArenaUsed; // may go past _requestArenaSize, those requests are heap allocated
+    std::atomic<std::size_t> _queuedRequests;  // requests sitting in worker queues, workers sleep while it is 0
+    std::atomic<std::size_t> _sleepingWorkers;
+    std::mutex _workLock;
+    std::condition_variable _workCondition;
+    uint32 _lfgUpdateTimeEstimate;
     std::atomic<int> pending_requests;  // Use std::atomic for pending_requests to avoid lock contention
     std::atomic<bool> _cancelationToken;  // Atomic flag for cancellation to avoid race conditions
     std::vector<std::thread> _workerThreads;
@@ -0,0 +1,102 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TerrainQueryCache.h"
+#include <bit>
+#include <cmath>
+
+TerrainQueryCache::Key::Key(uint64 generation, float x, float y, float z, uint32 phaseMask, uint64 params) :
+    Generation(generation), X(int32(std::floor(x / Precision))), Y(int32(std::floor(y / Precision))), Z(int32(std::floor(z / Precision))),
+    PhaseMask(phaseMask), Params(params)
+{
+}
+
+TerrainQueryCache& TerrainQueryCache::GetForCurrentThread(uint32 size)
+{
+    thread_local TerrainQueryCache cache;
+    if (cache._requestedSize != size)
+        cache.SetSize(size);
+
+    return cache;
+}
+
+void TerrainQueryCache::SetSize(uint32 size)
+{
+    _requestedSize = size;
+
+    // a power of two so the slot is a mask of the hash
+    uint32 slots = size ? std::bit_ceil(size) : 0;
+    _heights.assign(slots, Entry<float>());
+    _liquids.assign(slots, Entry<LiquidData>());
+}
+
+std::size_t TerrainQueryCache::GetSlot(Key const& key) const
+{
+    uint64 hash = key.Generation * 0x9E3779B97F4A7C15ull;
+    hash ^= (uint64(uint32(key.X)) * 0xC2B2AE3D27D4EB4Full) ^ (uint64(uint32(key.Y)) * 0x165667B19E3779F9ull);
+    hash ^= (uint64(uint32(key.Z)) * 0x27D4EB2F165667C5ull) ^ (uint64(key.PhaseMask) << 32) ^ key.Params;
+    hash ^= hash >> 29;
+    return std::size_t(hash) & (_heights.size() - 1);
+}
+
+bool TerrainQueryCache::FindHeight(Key const& key, float& height) const
+{
+    if (_heights.empty())
+        return false;
+
+    Entry<float> const& entry = _heights[GetSlot(key)];
+    if (!entry.Used || !(entry.CacheKey == key))
+        return false;
+
+    height = entry.Value;
+    return true;
+}
+
+void TerrainQueryCache::StoreHeight(Key const& key, float height)
+{
+    if (_heights.empty())
+        return;
+
+    Entry<float>& entry = _heights[GetSlot(key)];
+    entry.CacheKey = key;
+    entry.Value = height;
+    entry.Used = true;
+}
+
+bool TerrainQueryCache::FindLiquid(Key const& key, LiquidData& liquidData) const
+{
+    if (_liquids.empty())
+        return false;
+
+    Entry<LiquidData> const& entry = _liquids[GetSlot(key)];
+    if (!entry.Used || !(entry.CacheKey == key))
+        return false;
+
+    liquidData = entry.Value;
+    return true;
+}
+
+void TerrainQueryCache::StoreLiquid(Key const& key, LiquidData const& liquidData)
+{
+    if (_liquids.empty())
+        return;
+
+    Entry<LiquidData>& entry = _liquids[GetSlot(key)];
+    entry.CacheKey = key;
+    entry.Value = liquidData;
+    entry.Used = true;
+}
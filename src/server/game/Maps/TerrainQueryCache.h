@@ -0,0 +1,84 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TERRAIN_QUERY_CACHE_H
+#define _TERRAIN_QUERY_CACHE_H
+
+#include "GridTerrainData.h"
+#include <vector>
+
+/**
+ * @brief Height and liquid results of the last terrain queries made by one thread.
+ *
+ * Movement generators, movement flag updates and summon placement ask for the height and liquid of
+ * nearly the same positions several times per update. Positions are rounded to 1/16 yard and the
+ * results are keyed by the generation of the dynamic tree cell holding the position, so results from
+ * before a gameobject model overlapping the cell was added, removed, opened or closed are never found
+ * again. Each key has a single slot, a newer result overwrites the older one.
+ */
+class TerrainQueryCache
+{
+public:
+    struct Key
+    {
+        uint64 Generation = 0;  ///< DynamicMapTree::GetGeneration of the position, unique among all maps
+        int32 X = 0;
+        int32 Y = 0;
+        int32 Z = 0;
+        uint32 PhaseMask = 0;
+        uint64 Params = 0;      ///< the other arguments of the query
+
+        Key() = default;
+        Key(uint64 generation, float x, float y, float z, uint32 phaseMask, uint64 params);
+
+        bool operator==(Key const& other) const
+        {
+            return Generation == other.Generation && X == other.X && Y == other.Y && Z == other.Z && PhaseMask == other.PhaseMask && Params == other.Params;
+        }
+    };
+
+    static constexpr float Precision = 1.0f / 16.0f;
+
+    /// Cache of the calling thread with room for size heights and size liquids, 0 disables it
+    static TerrainQueryCache& GetForCurrentThread(uint32 size);
+
+    bool FindHeight(Key const& key, float& height) const;
+    void StoreHeight(Key const& key, float height);
+
+    bool FindLiquid(Key const& key, LiquidData& liquidData) const;
+    void StoreLiquid(Key const& key, LiquidData const& liquidData);
+
+    [[nodiscard]] uint32 GetSize() const { return uint32(_heights.size()); }
+    void SetSize(uint32 size);
+
+private:
+    template<class T>
+    struct Entry
+    {
+        Key CacheKey;
+        T Value;
+        bool Used = false;
+    };
+
+    [[nodiscard]] std::size_t GetSlot(Key const& key) const;
+
+    std::vector<Entry<float>> _heights;
+    std::vector<Entry<LiquidData>> _liquids;
+    uint32 _requestedSize = 0;
+};
+
+#endif
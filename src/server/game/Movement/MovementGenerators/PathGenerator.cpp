@@ -23,23 +23,49 @@
 #include "MMapFactory.h"
 #include "MMapMgr.h"
 #include "Map.h"
+#include "MapUpdater.h"
 #include "Metric.h"
+#include "World.h"
+
+namespace
+{
+    // Paths are built in buffers large enough for the longest allowed path, one set per thread calculating paths
+    struct PathBuffers
+    {
+        std::vector<dtPolyRef> Polys;       // poly path of BuildPolyPath
+        std::vector<dtPolyRef> SmoothPolys; // corridor walked along by FindSmoothPath
+        std::vector<float> Points;          // point path of BuildPointPath
+    };
+
+    PathBuffers& GetPathBuffers(uint32 maxPathLength)
+    {
+        thread_local PathBuffers buffers;
+        if (buffers.Polys.size() < maxPathLength)
+        {
+            buffers.Polys.resize(maxPathLength);
+            buffers.SmoothPolys.resize(maxPathLength);
+            buffers.Points.resize(maxPathLength * VERTEX_SIZE);
+        }
+
+        return buffers;
+    }
+}
 
  ////////////////// PathGenerator //////////////////
 PathGenerator::PathGenerator(WorldObject const* owner) :
-    _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false), _forceDestination(false),
-    _slopeCheck(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false),
+    _pathPolyRefs(nullptr), _polyLength(0), _maxPathLength(sWorld->getIntConfig(CONFIG_MMAP_MAX_PATH_LENGTH)),
+    _type(PATHFIND_BLANK), _useStraightPath(false), _forceDestination(false),
+    _slopeCheck(false), _pointPathLimit(_maxPathLength), _useRaycast(false),
     _endPosition(G3D::Vector3::zero()), _source(owner), _navMesh(nullptr),
-    _navMeshQuery(nullptr)
+    _navMeshQuery(nullptr), _corridorCache(nullptr)
 {
-    memset(_pathPolyRefs, 0, sizeof(_pathPolyRefs));
-
     uint32 mapId = _source->GetMapId();
     //if (sDisableMgr->IsPathfindingEnabled(_sourceUnit->FindMap()))
     {
         MMAP::MMapMgr* mmap = MMAP::MMapFactory::createOrGetMMapMgr();
         _navMesh = mmap->GetNavMesh(mapId);
         _navMeshQuery = mmap->GetNavMeshQuery(mapId, _source->GetInstanceId());
+        _corridorCache = mmap->GetPathCorridorCache(mapId);
     }
 
     CreateFilter();
@@ -83,12 +109,54 @@ bool PathGenerator::CalculatePath(float x, float y, float z, float destX, float
         return true;
     }
 
+    // paths calculated by several threads of the map at once each use the navmesh query of their thread
+    dtNavMeshQuery const* navMeshQuery = _navMeshQuery;
+    if (std::size_t slot = MapUpdater::GetParallelTaskSlot())
+    {
+        _navMeshQuery = MMAP::MMapFactory::createOrGetMMapMgr()->GetNavMeshQuery(_source->GetMapId(), _source->GetInstanceId(), uint32(slot));
+        if (!_navMeshQuery)
+        {
+            _navMeshQuery = navMeshQuery;
+            BuildShortcut();
+            _type = PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH);
+            return true;
+        }
+    }
+
     UpdateFilter();
 
+    // the polygons of the last path may be reused, they are copied to the buffer of this thread and back once done
+    PathBuffers& buffers = GetPathBuffers(_maxPathLength);
+    _polyLength = std::min<uint32>(_pathPolys.size(), _maxPathLength);
+    std::copy_n(_pathPolys.begin(), _polyLength, buffers.Polys.begin());
+    _pathPolyRefs = buffers.Polys.data();
+
     BuildPolyPath(start, dest);
+
+    _pathPolys.assign(_pathPolyRefs, _pathPolyRefs + _polyLength);
+    _pathPolyRefs = nullptr;
+    _navMeshQuery = navMeshQuery;
     return true;
 }
 
+void PathGenerator::CopyPathFrom(PathGenerator const& other)
+{
+    _pathPolys = other._pathPolys;
+    _polyLength = other._polyLength;
+    _pathPoints = other._pathPoints;
+    _type = other._type;
+    _forceDestination = other._forceDestination;
+    _endPosition = other._endPosition;
+    _actualEndPosition = other._actualEndPosition;
+
+    // the path starts where we are, not where the other source is
+    float x, y, z;
+    _source->GetPosition(x, y, z);
+    SetStartPosition(G3D::Vector3(x, y, z));
+    if (!_pathPoints.empty())
+        _pathPoints[0] = _startPosition;
+}
+
 dtPolyRef PathGenerator::GetPathPolyByPosition(dtPolyRef const* polyPath, uint32 polyPathSize, float const* point, float* distance) const
 {
     if (!polyPath || !polyPathSize)
@@ -377,7 +445,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
                 &_filter,            // polygon search filter
                 _pathPolyRefs + prefixPolyLength - 1,    // [out] path
                 (int*)&suffixPolyLength,
-                MAX_PATH_LENGTH - prefixPolyLength); // max number of polygons in output path
+                _maxPathLength - prefixPolyLength); // max number of polygons in output path
         }
 
         if (!suffixPolyLength || dtStatusFailed(dtResult))
@@ -416,7 +484,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
                 hitNormal,
                 _pathPolyRefs,
                 (int*)&_polyLength,
-                MAX_PATH_LENGTH);
+                _maxPathLength);
 
             if (!_polyLength || dtStatusFailed(dtResult))
             {
@@ -472,15 +540,28 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         }
         else
         {
-            dtResult = _navMeshQuery->findPath(
-                startPoly,          // start polygon
-                endPoly,            // end polygon
-                startPoint,         // start position
-                endPoint,           // end position
-                &_filter,           // polygon search filter
-                _pathPolyRefs,     // [out] path
-                (int*)&_polyLength,
-                MAX_PATH_LENGTH);   // max number of polygons in output path
+            // other sources may have asked for the same polygons already
+            MMAP::PathCorridorCache::Key corridorKey{ startPoly, endPoly, _filter.getIncludeFlags(), _filter.getExcludeFlags() };
+            _polyLength = _corridorCache ? _corridorCache->Find(corridorKey, _pathPolyRefs, _maxPathLength) : 0;
+            if (_polyLength)
+                dtResult = DT_SUCCESS;
+            else
+            {
+                dtResult = _navMeshQuery->findPath(
+                    startPoly,          // start polygon
+                    endPoly,            // end polygon
+                    startPoint,         // start position
+                    endPoint,           // end position
+                    &_filter,           // polygon search filter
+                    _pathPolyRefs,     // [out] path
+                    (int*)&_polyLength,
+                    _maxPathLength);   // max number of polygons in output path
+
+                // a partial corridor ends short of endPoly, found again it would pass for the complete one
+                if (_corridorCache && _polyLength && dtStatusSucceed(dtResult) &&
+                    !dtStatusDetail(dtResult, DT_PARTIAL_RESULT) && !dtStatusDetail(dtResult, DT_OUT_OF_NODES))
+                    _corridorCache->Store(corridorKey, _pathPolyRefs, _polyLength);
+            }
         }
 
         if (!_polyLength || dtStatusFailed(dtResult))
@@ -519,7 +600,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
 
 void PathGenerator::BuildPointPath(const float* startPoint, const float* endPoint)
 {
-    float pathPoints[MAX_POINT_PATH_LENGTH * VERTEX_SIZE];
+    float* pathPoints = GetPathBuffers(_maxPathLength).Points.data();
     uint32 pointCount = 0;
     dtStatus dtResult = DT_FAILURE;
     if (_useRaycast)
@@ -821,7 +902,7 @@ dtStatus PathGenerator::FindSmoothPath(float const* startPos, float const* endPo
     *smoothPathSize = 0;
     uint32 nsmoothPath = 0;
 
-    dtPolyRef polys[MAX_PATH_LENGTH];
+    dtPolyRef* polys = GetPathBuffers(_maxPathLength).SmoothPolys.data();
     memcpy(polys, polyPath, sizeof(dtPolyRef) * polyPathSize);
     uint32 npolys = polyPathSize;
 
@@ -888,7 +969,7 @@ dtStatus PathGenerator::FindSmoothPath(float const* startPos, float const* endPo
         {
             return DT_FAILURE;
         }
-        npolys = FixupCorridor(polys, npolys, MAX_PATH_LENGTH, visited, nvisited);
+        npolys = FixupCorridor(polys, npolys, _maxPathLength, visited, nvisited);
 
         if (dtStatusFailed(_navMeshQuery->getPolyHeight(polys[0], result, &result[1])))
             LOG_DEBUG("maps", "PathGenerator::FindSmoothPath: Cannot find height at position X: {} Y: {} Z: {} for {}",
@@ -963,7 +1044,7 @@ dtStatus PathGenerator::FindSmoothPath(float const* startPos, float const* endPo
     *smoothPathSize = nsmoothPath;
 
     // this is most likely a loop
-    return nsmoothPath < MAX_POINT_PATH_LENGTH ? DT_SUCCESS : DT_FAILURE;
+    return nsmoothPath < _maxPathLength ? DT_SUCCESS : DT_FAILURE;
 }
 
 bool PathGenerator::IsWalkableClimb(float const* v1, float const* v2) const
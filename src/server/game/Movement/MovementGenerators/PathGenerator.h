@@ -29,12 +29,7 @@
 class Unit;
 class WorldObject;
 
-// 74*4.0f=296y number_of_points*interval = max_path_len
-// this is way more than actual evade range
-// I think we can safely cut those down even more
-#define MAX_PATH_LENGTH         74
-#define MAX_POINT_PATH_LENGTH   74
-
+// the maximum number of polygons and points of a path is set by MoveMaps.MaxPathLength, points are SMOOTH_PATH_STEP_SIZE apart
 #define SMOOTH_PATH_STEP_SIZE   4.0f
 #define SMOOTH_PATH_SLOP        0.3f
 #define DISALLOW_TIME_AFTER_FAIL    3 // secs
@@ -79,7 +74,7 @@ class PathGenerator
         // when set, it skips paths with too high slopes (doesn't work with StraightPath enabled)
         void SetSlopeCheck(bool checkSlope) { _slopeCheck = checkSlope; }
         void SetUseStraightPath(bool useStraightPath) { _useStraightPath = useStraightPath; }
-        void SetPathLengthLimit(float distance) { _pointPathLimit = std::min<uint32>(uint32(distance/SMOOTH_PATH_STEP_SIZE), MAX_POINT_PATH_LENGTH); }
+        void SetPathLengthLimit(float distance) { _pointPathLimit = std::min<uint32>(uint32(distance/SMOOTH_PATH_STEP_SIZE), _maxPathLength); }
         void SetUseRaycast(bool useRaycast) { _useRaycast = useRaycast; }
 
         // result getters
@@ -91,6 +86,15 @@ class PathGenerator
 
         [[nodiscard]] PathType GetPathType() const { return _type; }
 
+        [[nodiscard]] WorldObject const* GetSource() const { return _source; }
+
+        // the query used by CalculatePath, every thread calculating paths at the same time needs its own
+        [[nodiscard]] dtNavMeshQuery const* GetNavMeshQuery() const { return _navMeshQuery; }
+        void SetNavMeshQuery(dtNavMeshQuery const* navMeshQuery) { _navMeshQuery = navMeshQuery; }
+
+        // takes over the path other calculated from a start position close to ours, see PathfindingService
+        void CopyPathFrom(PathGenerator const& other);
+
         // shortens the path until the destination is the specified distance from the target point
         void ShortenPathUntilDist(G3D::Vector3 const& point, float dist);
 
@@ -124,12 +128,15 @@ class PathGenerator
         void Clear()
         {
             _polyLength = 0;
+            _pathPolys.clear();
             _pathPoints.clear();
         }
 
     private:
-        dtPolyRef _pathPolyRefs[MAX_PATH_LENGTH];   // array of detour polygon references
-        uint32 _polyLength;                         // number of polygons in the path
+        std::vector<dtPolyRef> _pathPolys;  // detour polygon references of the last path
+        dtPolyRef* _pathPolyRefs;           // buffer of the calculating thread holding the polygons, set while calculating
+        uint32 _polyLength;                 // number of polygons in the path
+        uint32 _maxPathLength;              // maximum number of polygons and points of the path
 
         Movement::PointsArray _pathPoints;  // our actual (x,y,z) path to the target
         PathType _type;                     // tells what kind of path this is
@@ -137,7 +144,7 @@ class PathGenerator
         bool _useStraightPath;  // type of path will be generated (do not use it for movement paths)
         bool _forceDestination; // when set, we will always arrive at given point
         bool _slopeCheck;       // when set, it skips paths with too high slopes (doesn't work with _useStraightPath)
-        uint32 _pointPathLimit; // limit point path size; min(this, MAX_POINT_PATH_LENGTH)
+        uint32 _pointPathLimit; // limit point path size; min(this, _maxPathLength)
         bool _useRaycast;       // use raycast if true for a straight line path
 
         G3D::Vector3 _startPosition;        // {x, y, z} of current location
@@ -147,6 +154,7 @@ class PathGenerator
         WorldObject const* const _source;       // the object that is moving
         dtNavMesh const* _navMesh;              // the nav mesh
         dtNavMeshQuery const* _navMeshQuery;    // the nav mesh query used to find the path
+        MMAP::PathCorridorCache* _corridorCache; // poly paths found by every source on the nav mesh
 
         dtQueryFilterExt _filter;  // use single filter for all movements, update it when needed
 
@@ -78,6 +78,7 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
     {
         owner->StopMoving();
         _lastTargetPosition.reset();
+        _pathRequest = nullptr;
         if (cOwner)
         {
             cOwner->UpdateLeashExtensionTime();
@@ -119,6 +120,14 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
         mutualChase = true;
     }
 
+    // the path requested by an earlier update was calculated by the map
+    if (_pathRequest && _pathRequest->Calculated)
+    {
+        std::shared_ptr<PathfindingRequest> request = std::move(_pathRequest);
+        i_path = std::move(request->Path);
+        LaunchPath(owner, target, request->Success, _shortenRequestedPath, maxTarget);
+    }
+
     // periodically check if we're already in the expected range...
     i_recheckDistance.Update(time_diff);
     if (i_recheckDistance.Passed())
@@ -131,6 +140,7 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
             {
                 i_recalculateTravel = false;
                 i_path = nullptr;
+                _pathRequest = nullptr;
                 if (cOwner)
                     cOwner->SetCannotReachTarget();
                 owner->StopMoving();
@@ -181,6 +191,7 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
                 cOwner->SetCannotReachTarget(target->GetGUID());
                 cOwner->StopMoving();
                 i_path = nullptr;
+                _pathRequest = nullptr;
                 return true;
             }
 
@@ -234,54 +245,69 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
             if (owner->IsHovering())
                 owner->UpdateAllowedPositionZ(x, y, z);
 
-            bool success = i_path->CalculatePath(x, y, z, forceDest);
-            if (!success || i_path->GetPathType() & PATHFIND_NOPATH)
+            if (PathfindingService::IsEnabled())
             {
-                if (cOwner)
-                {
-                    cOwner->SetCannotReachTarget(target->GetGUID());
-                }
-
-                owner->StopMoving();
+                _pathRequest = owner->GetMap()->GetPathfindingService().Request(std::move(i_path), G3D::Vector3(x, y, z), forceDest);
+                _shortenRequestedPath = shortenPath;
                 return true;
             }
 
-            if (shortenPath)
-                i_path->ShortenPathUntilDist(G3D::Vector3(x, y, z), maxTarget);
+            bool success = i_path->CalculatePath(x, y, z, forceDest);
+            LaunchPath(owner, target, success, shortenPath, maxTarget);
+        }
+    }
 
-            if (cOwner)
-            {
-                cOwner->SetCannotReachTarget();
-            }
+    return true;
+}
 
-            bool walk = false;
-            if (cOwner && !cOwner->IsPet())
-            {
-                switch (cOwner->GetMovementTemplate().GetChase())
-                {
-                case CreatureChaseMovementType::CanWalk:
-                    walk = owner->IsWalking();
-                    break;
-                case CreatureChaseMovementType::AlwaysWalk:
-                    walk = true;
-                    break;
-                default:
-                    break;
-                }
-            }
+template<class T>
+void ChaseMovementGenerator<T>::LaunchPath(T* owner, Unit* target, bool success, bool shortenPath, float maxTarget)
+{
+    Creature* cOwner = owner->ToCreature();
 
-            owner->AddUnitState(UNIT_STATE_CHASE_MOVE);
-            i_recalculateTravel = true;
+    if (!success || i_path->GetPathType() & PATHFIND_NOPATH)
+    {
+        if (cOwner)
+        {
+            cOwner->SetCannotReachTarget(target->GetGUID());
+        }
 
-            Movement::MoveSplineInit init(owner);
-            init.MovebyPath(i_path->GetPath());
-            init.SetFacing(target);
-            init.SetWalk(walk);
-            init.Launch();
+        owner->StopMoving();
+        return;
+    }
+
+    if (shortenPath)
+        i_path->ShortenPathUntilDist(i_path->GetEndPosition(), maxTarget);
+
+    if (cOwner)
+    {
+        cOwner->SetCannotReachTarget();
+    }
+
+    bool walk = false;
+    if (cOwner && !cOwner->IsPet())
+    {
+        switch (cOwner->GetMovementTemplate().GetChase())
+        {
+        case CreatureChaseMovementType::CanWalk:
+            walk = owner->IsWalking();
+            break;
+        case CreatureChaseMovementType::AlwaysWalk:
+            walk = true;
+            break;
+        default:
+            break;
         }
     }
 
-    return true;
+    owner->AddUnitState(UNIT_STATE_CHASE_MOVE);
+    i_recalculateTravel = true;
+
+    Movement::MoveSplineInit init(owner);
+    init.MovebyPath(i_path->GetPath());
+    init.SetFacing(target);
+    init.SetWalk(walk);
+    init.Launch();
 }
 
 //-----------------------------------------------//
@@ -289,6 +315,7 @@ template<>
 void ChaseMovementGenerator<Player>::DoInitialize(Player* owner)
 {
     i_path = nullptr;
+    _pathRequest = nullptr;
     _lastTargetPosition.reset();
     owner->StopMoving();
     owner->AddUnitState(UNIT_STATE_CHASE);
@@ -298,6 +325,7 @@ template<>
 void ChaseMovementGenerator<Creature>::DoInitialize(Creature* owner)
 {
     i_path = nullptr;
+    _pathRequest = nullptr;
     _lastTargetPosition.reset();
     i_recheckDistance.Reset(0);
     i_leashExtensionTimer.Reset(owner->GetAttackTime(BASE_ATTACK));
@@ -456,6 +484,7 @@ bool FollowMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
     if (owner->HasUnitState(UNIT_STATE_NOT_MOVE) || (cOwner && owner->ToCreature()->IsMovementPreventedByCasting()))
     {
         i_path = nullptr;
+        _pathRequest = nullptr;
         owner->StopMoving();
         _lastTargetPosition.reset();
         return true;
@@ -474,6 +503,14 @@ bool FollowMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
         (i_target->IsPlayer() && i_target->ToPlayer()->IsGameMaster()) // for .npc follow
         ; // closes "bool forceDest", that way it is more appropriate, so we can comment out crap whenever we need to
 
+    // the path requested by an earlier update was calculated by the map
+    if (_pathRequest && _pathRequest->Calculated)
+    {
+        std::shared_ptr<PathfindingRequest> request = std::move(_pathRequest);
+        i_path = std::move(request->Path);
+        LaunchPath(owner, target, request->Success, followingMaster);
+    }
+
     bool targetIsMoving = false;
     if (PositionOkay(target, owner->IsGuardian() && target->IsPlayer(), targetIsMoving, time_diff))
     {
@@ -526,35 +563,48 @@ bool FollowMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
         if (owner->IsHovering())
             owner->UpdateAllowedPositionZ(x, y, z);
 
-        bool success = i_path->CalculatePath(x, y, z, forceDest);
-        if (!success || (i_path->GetPathType() & PATHFIND_NOPATH && !followingMaster))
+        if (PathfindingService::IsEnabled())
         {
-            if (!owner->IsStopped())
-                owner->StopMoving();
-
+            _pathRequest = owner->GetMap()->GetPathfindingService().Request(std::move(i_path), G3D::Vector3(x, y, z), forceDest);
             return true;
         }
 
-        owner->AddUnitState(UNIT_STATE_FOLLOW_MOVE);
+        bool success = i_path->CalculatePath(x, y, z, forceDest);
+        LaunchPath(owner, target, success, followingMaster);
+    }
+
+    return true;
+}
 
-        Movement::MoveSplineInit init(owner);
-        init.MovebyPath(i_path->GetPath());
-        if (_inheritWalkState)
-            init.SetWalk(target->IsWalking() || target->movespline->isWalking());
+template<class T>
+void FollowMovementGenerator<T>::LaunchPath(T* owner, Unit* target, bool success, bool followingMaster)
+{
+    if (!success || (i_path->GetPathType() & PATHFIND_NOPATH && !followingMaster))
+    {
+        if (!owner->IsStopped())
+            owner->StopMoving();
 
-        if (_inheritSpeed)
-            if (Optional<float> velocity = GetVelocity(owner, target, i_path->GetActualEndPosition(), owner->IsGuardian()))
-                init.SetVelocity(*velocity);
-        init.Launch();
+        return;
     }
 
-    return true;
+    owner->AddUnitState(UNIT_STATE_FOLLOW_MOVE);
+
+    Movement::MoveSplineInit init(owner);
+    init.MovebyPath(i_path->GetPath());
+    if (_inheritWalkState)
+        init.SetWalk(target->IsWalking() || target->movespline->isWalking());
+
+    if (_inheritSpeed)
+        if (Optional<float> velocity = GetVelocity(owner, target, i_path->GetActualEndPosition(), owner->IsGuardian()))
+            init.SetVelocity(*velocity);
+    init.Launch();
 }
 
 template<class T>
 void FollowMovementGenerator<T>::DoInitialize(T* owner)
 {
     i_path = nullptr;
+    _pathRequest = nullptr;
     _lastTargetPosition.reset();
     owner->AddUnitState(UNIT_STATE_FOLLOW);
 }
@@ -22,6 +22,7 @@
 #include "MovementGenerator.h"
 #include "Optional.h"
 #include "PathGenerator.h"
+#include "PathfindingService.h"
 #include "Timer.h"
 #include "Unit.h"
 
@@ -59,8 +60,12 @@ public:
     bool HasLostTarget(Unit* unit) const { return unit->GetVictim() != this->GetTarget(); }
 
 private:
+    void LaunchPath(T* owner, Unit* target, bool success, bool shortenPath, float maxTarget);
+
     TimeTrackerSmall i_leashExtensionTimer;
     std::unique_ptr<PathGenerator> i_path;
+    std::shared_ptr<PathfindingRequest> _pathRequest;
+    bool _shortenRequestedPath = false;
     TimeTrackerSmall i_recheckDistance;
     bool i_recalculateTravel;
 
@@ -99,7 +104,10 @@ public:
     float GetFollowRange() const { return _range; }
 
 private:
+    void LaunchPath(T* owner, Unit* target, bool success, bool followingMaster);
+
     std::unique_ptr<PathGenerator> i_path;
+    std::shared_ptr<PathfindingRequest> _pathRequest;
     TimeTrackerSmall i_recheckPredictedDistanceTimer;
     bool i_recheckPredictedDistance;
 
@@ -0,0 +1,224 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathfindingService.h"
+#include "Creature.h"
+#include "MMapFactory.h"
+#include "Map.h"
+#include "MapMgr.h"
+#include "Metric.h"
+#include "Optional.h"
+#include "PathGenerator.h"
+#include "World.h"
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+namespace
+{
+    // Requests of creatures of the same entry and movement abilities whose start lies in the same cell and whose
+    // destination is the same share a path, the start cell is small enough for the first path segment to stay valid
+    constexpr float SharedPathStartCellSize = 1.0f;
+    constexpr float SharedPathDestinationCellSize = 0.1f;
+
+    // entry, movement flags, start cell, destination cell, forced destination
+    typedef std::tuple<uint32, uint8, int32, int32, int32, int32, int32, int32, bool> SharedPathKey;
+
+    Optional<SharedPathKey> GetSharedPathKey(PathfindingRequest const& request)
+    {
+        Creature const* creature = request.Path->GetSource()->ToCreature();
+        if (!creature || creature->IsFalling())
+            return {};
+
+        uint8 movementFlags = (creature->CanWalk() ? 0x01 : 0) | (creature->CanSwim() ? 0x02 : 0) | (creature->CanFly() ? 0x04 : 0) |
+            (creature->CanEnterWater() ? 0x08 : 0) | (creature->IsInWater() ? 0x10 : 0) | (creature->HasUnitState(UNIT_STATE_IGNORE_PATHFINDING) ? 0x20 : 0);
+
+        auto startCell = [creature](float coord) { return int32(std::floor(coord / SharedPathStartCellSize)); };
+        auto destinationCell = [](float coord) { return int32(std::floor(coord / SharedPathDestinationCellSize)); };
+
+        return SharedPathKey(creature->GetEntry(), movementFlags,
+            startCell(creature->GetPositionX()), startCell(creature->GetPositionY()), startCell(creature->GetPositionZ()),
+            destinationCell(request.Destination.x), destinationCell(request.Destination.y), destinationCell(request.Destination.z),
+            request.ForceDestination);
+    }
+
+    /// Calls visit for every grid the straight segment between both positions crosses, in order
+    template<class Visitor>
+    void VisitGridsAlongSegment(float startX, float startY, float endX, float endY, Visitor&& visit)
+    {
+        GridCoord const start = Acore::ComputeGridCoord(startX, startY);
+        GridCoord const end = Acore::ComputeGridCoord(endX, endY);
+
+        // in grid units, grid coordinates grow towards smaller positions
+        float const deltaX = std::abs(startX - endX) / SIZE_OF_GRIDS;
+        float const deltaY = std::abs(startY - endY) / SIZE_OF_GRIDS;
+        float const offsetX = float(CENTER_GRID_ID) - startX / SIZE_OF_GRIDS - float(start.x_coord);
+        float const offsetY = float(CENTER_GRID_ID) - startY / SIZE_OF_GRIDS - float(start.y_coord);
+        int32 const stepX = end.x_coord > start.x_coord ? 1 : -1;
+        int32 const stepY = end.y_coord > start.y_coord ? 1 : -1;
+
+        // fraction of the segment until the next grid border of each axis
+        float const infinity = std::numeric_limits<float>::infinity();
+        float borderX = deltaX > 0.0f ? (stepX > 0 ? 1.0f - offsetX : offsetX) / deltaX : infinity;
+        float borderY = deltaY > 0.0f ? (stepY > 0 ? 1.0f - offsetY : offsetY) / deltaY : infinity;
+
+        int32 x = start.x_coord;
+        int32 y = start.y_coord;
+        visit(GridCoord(x, y));
+
+        // rounding may pick the wrong axis at a corner, but never one that already reached the end
+        while (x != int32(end.x_coord) || y != int32(end.y_coord))
+        {
+            if (y == int32(end.y_coord) || (x != int32(end.x_coord) && borderX < borderY))
+            {
+                x += stepX;
+                borderX += 1.0f / deltaX;
+            }
+            else
+            {
+                y += stepY;
+                borderY += 1.0f / deltaY;
+            }
+
+            visit(GridCoord(x, y));
+        }
+    }
+}
+
+PathfindingRequest::PathfindingRequest(std::unique_ptr<PathGenerator> path, G3D::Vector3 const& destination, bool forceDestination)
+    : Path(std::move(path)), Destination(destination), ForceDestination(forceDestination)
+{
+}
+
+PathfindingRequest::~PathfindingRequest() = default;
+
+bool PathfindingService::IsEnabled()
+{
+    return sWorld->getBoolConfig(CONFIG_MAP_UPDATE_ASYNC_PATHFINDING);
+}
+
+std::shared_ptr<PathfindingRequest> PathfindingService::Request(std::unique_ptr<PathGenerator> path, G3D::Vector3 const& destination, bool forceDestination)
+{
+    std::shared_ptr<PathfindingRequest> request = std::make_shared<PathfindingRequest>(std::move(path), destination, forceDestination);
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _requests.push_back(request);
+    return request;
+}
+
+void PathfindingService::Update()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (_requests.empty())
+            return;
+
+        _processedRequests.swap(_requests);
+    }
+
+    std::vector<std::pair<SharedPathKey, PathfindingRequest*>> sharedPaths;
+    for (std::shared_ptr<PathfindingRequest> const& request : _processedRequests)
+    {
+        // the generator does not wait for it anymore
+        if (request.use_count() == 1)
+            continue;
+
+        // the paths read the map of their source, it must not have left it
+        WorldObject const* source = request->Path->GetSource();
+        if (!source->IsInWorld() || source->GetMap() != _map)
+        {
+            request->Calculated = true;
+            continue;
+        }
+
+        if (Optional<SharedPathKey> key = GetSharedPathKey(*request))
+            sharedPaths.emplace_back(*key, request.get());
+        else
+            _calculations.push_back(request.get());
+    }
+
+    std::sort(sharedPaths.begin(), sharedPaths.end());
+    for (std::size_t i = 0; i < sharedPaths.size(); ++i)
+    {
+        if (i && sharedPaths[i].first == sharedPaths[i - 1].first)
+            _duplicates.emplace_back(sharedPaths[i].second, _calculations.back());
+        else
+            _calculations.push_back(sharedPaths[i].second);
+    }
+
+    // grids are created when their terrain is read for the first time, which must not happen on several threads at once.
+    // The grids along the straight line to the destination are created now, the path points rarely leave them
+    for (PathfindingRequest const* request : _calculations)
+    {
+        WorldObject const* source = request->Path->GetSource();
+        VisitGridsAlongSegment(source->GetPositionX(), source->GetPositionY(), request->Destination.x, request->Destination.y, [this](GridCoord const& grid)
+        {
+            _map->EnsureGridCreated(grid);
+        });
+    }
+
+    // the query of every thread but the map thread is created beforehand, see PathGenerator::CalculatePath
+    MapUpdater* updater = sMapMgr->GetMapUpdater();
+    std::size_t slots = std::min<std::size_t>(_calculations.size(), updater->activated() ? std::max<std::size_t>(updater->get_thread_count(), 1) : 1);
+
+    MMAP::MMapMgr* mmap = MMAP::MMapFactory::createOrGetMMapMgr();
+    if (mmap->GetNavMesh(_map->GetId()))
+    {
+        for (std::size_t slot = 1; slot < slots; ++slot)
+        {
+            if (!mmap->GetNavMeshQuery(_map->GetId(), _map->GetInstanceId(), uint32(slot)))
+            {
+                slots = 1;
+                break;
+            }
+        }
+    }
+
+    // anything else the paths read is missing meanwhile instead of being loaded by several threads
+    _map->BeginParallelUpdate();
+
+    updater->run_parallel(slots, [this, slots](std::size_t slot)
+    {
+        for (std::size_t i = slot; i < _calculations.size(); i += slots)
+        {
+            PathfindingRequest* request = _calculations[i];
+            request->Success = request->Path->CalculatePath(request->Destination.x, request->Destination.y, request->Destination.z, request->ForceDestination);
+            request->Calculated = true;
+        }
+    });
+
+    _map->EndParallelUpdate();
+
+    for (auto const& [request, calculatedRequest] : _duplicates)
+    {
+        request->Path->CopyPathFrom(*calculatedRequest->Path);
+        request->Success = calculatedRequest->Success;
+        request->Calculated = true;
+    }
+
+    METRIC_VALUE("map_path_requests", uint64(_calculations.size() + _duplicates.size()),
+        METRIC_TAG("map_id", std::to_string(_map->GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(_map->GetInstanceId())));
+
+    METRIC_VALUE("map_path_calculations", uint64(_calculations.size()),
+        METRIC_TAG("map_id", std::to_string(_map->GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(_map->GetInstanceId())));
+
+    _calculations.clear();
+    _duplicates.clear();
+    _processedRequests.clear();
+}
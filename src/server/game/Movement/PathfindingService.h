@@ -0,0 +1,80 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_PATHFINDING_SERVICE_H
+#define ACORE_PATHFINDING_SERVICE_H
+
+#include "Define.h"
+#include <G3D/Vector3.h>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+class Map;
+class PathGenerator;
+
+/// A path queued with PathfindingService::Request, owned by the movement generator waiting for it
+struct PathfindingRequest
+{
+    PathfindingRequest(std::unique_ptr<PathGenerator> path, G3D::Vector3 const& destination, bool forceDestination);
+    ~PathfindingRequest();
+
+    std::unique_ptr<PathGenerator> Path;
+    G3D::Vector3 Destination;
+    bool ForceDestination;
+    bool Calculated = false; ///< set by the map update the path was requested in
+    bool Success = false;    ///< result of PathGenerator::CalculatePath
+};
+
+/**
+ * @brief Calculates the paths of the chase and follow movement generators of a map in parallel.
+ *
+ * Generators queue their paths while the objects are updated and pick them up in their next update.
+ * Once all objects of the map were updated, Map::Update calculates the queued paths on the map update
+ * threads, each of them with its own dtNavMeshQuery, while the map thread waits. Nothing else touches
+ * the map meanwhile, so the paths can read its objects like on the map thread. The grids the straight line
+ * from start to destination crosses are created beforehand, the map is in its parallel phase during the
+ * calculation so the terrain of other grids is missing instead of being loaded by several threads at once.
+ *
+ * Creatures of the same entry chasing the same spot from about the same position, like a pack running
+ * at a player, share a single calculation.
+ */
+class PathfindingService
+{
+public:
+    explicit PathfindingService(Map* map) : _map(map) { }
+
+    /// Paths are calculated synchronously by the generators when disabled, see MapUpdate.AsyncPathfinding
+    [[nodiscard]] static bool IsEnabled();
+
+    /// Queues path->CalculatePath(destination), the request is dropped if the caller releases it before it was calculated
+    std::shared_ptr<PathfindingRequest> Request(std::unique_ptr<PathGenerator> path, G3D::Vector3 const& destination, bool forceDestination);
+
+    /// Calculates the queued paths, called by Map::Update once its objects were updated
+    void Update();
+
+private:
+    Map* _map;
+    std::mutex _lock; ///< objects of continents may be updated by several threads, see Map::UpdateNonPlayerObjectsByRegion
+    std::vector<std::shared_ptr<PathfindingRequest>> _requests;
+    std::vector<std::shared_ptr<PathfindingRequest>> _processedRequests;
+    std::vector<PathfindingRequest*> _calculations;
+    std::vector<std::pair<PathfindingRequest*, PathfindingRequest const*>> _duplicates; ///< request, request calculating the same path
+};
+
+#endif
@@ -21,6 +21,7 @@
 #include "ByteBuffer.h"
 #include "Duration.h"
 #include "Opcodes.h"
+#include <memory>
 
 class WorldPacket : public ByteBuffer
 {
@@ -82,4 +83,7 @@ protected:
     TimePoint m_receivedTime; // only set for a specific set of opcodes, for performance reasons.
 };
 
+/// Immutable packet payload shared between the send queues of several sockets, the header is still built and encrypted per socket
+using SharedWorldPacket = std::shared_ptr<WorldPacket const>;
+
 #endif
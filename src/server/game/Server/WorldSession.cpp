@@ -41,6 +41,7 @@
 #include "PacketUtilities.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerSaveScheduler.h"
 #include "QueryHolder.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
@@ -72,6 +73,10 @@ bool MapSessionFilter::Process(WorldPacket* packet)
     if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE)
         return false;
 
+    //session local packets may read global data changed by other maps
+    if (opHandle->ProcessingPlace == PROCESS_SESSION_LOCAL)
+        return false;
+
     Player* player = m_pSession->GetPlayer();
     if (!player)
         return false;
@@ -94,6 +99,10 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
     if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE)
         return true;
 
+    //session local packets left behind by the parallel pass keep their order
+    if (opHandle->ProcessingPlace == PROCESS_SESSION_LOCAL)
+        return true;
+
     //no player attached? -> our client! ^^
     Player* player = m_pSession->GetPlayer();
     if (!player)
@@ -103,6 +112,13 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
     return !player->IsInWorld();
 }
 
+//the parallel pass stops at the first packet that is not session local, so packets keep their order
+bool SessionLocalFilter::Process(WorldPacket* packet)
+{
+    ClientOpcodeHandler const* opHandle = opcodeTable[static_cast<OpcodeClient>(packet->GetOpcode())];
+    return opHandle->ProcessingPlace == PROCESS_SESSION_LOCAL;
+}
+
 /// WorldSession constructor
 WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldSocket> sock, AccountTypes sec, uint8 expansion,
     time_t mute_time, LocaleConstant locale, uint32 recruiter, bool isARecruiter, bool skipQueue, uint32 TotalTime) :
@@ -225,9 +241,22 @@ ObjectGuid::LowType WorldSession::GetGuidLow() const
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const* packet)
 {
-    if (!m_Socket)
+    if (!m_Socket || !CanSendPacket(*packet))
         return;
 
+    m_Socket->SendPacket(*packet);
+}
+
+void WorldSession::SendPacket(SharedWorldPacket const& packet)
+{
+    if (!m_Socket || !CanSendPacket(*packet))
+        return;
+
+    m_Socket->SendPacket(packet);
+}
+
+bool WorldSession::CanSendPacket(WorldPacket const& packet)
+{
 #if defined(ACORE_DEBUG)
     // Code for network use statistic
     static uint64 sendPacketCount = 0;
@@ -244,10 +273,10 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     if ((cur_time - lastTime) < 60)
     {
         sendPacketCount += 1;
-        sendPacketBytes += packet->size();
+        sendPacketBytes += packet.size();
 
         sendLastPacketCount += 1;
-        sendLastPacketBytes += packet->size();
+        sendLastPacketBytes += packet.size();
     }
     else
     {
@@ -260,16 +289,11 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 
         lastTime = cur_time;
         sendLastPacketCount = 1;
-        sendLastPacketBytes = packet->wpos();               // wpos is real written size
+        sendLastPacketBytes = packet.wpos();                // wpos is real written size
     }
 #endif                                                      // !ACORE_DEBUG
 
-    if (!sScriptMgr->CanPacketSend(this, *packet))
-    {
-        return;
-    }
-
-    m_Socket->SendPacket(*packet);
+    return sScriptMgr->CanPacketSend(this, packet);
 }
 
 /// Add an incoming packet to the queue
@@ -311,6 +335,70 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     HandleTeleportTimeout(updater.ProcessUnsafe());
 
+    time_t currentTime = GameTime::GetGameTime().count();
+    uint32 processedPackets = ProcessReceivedPackets(updater, currentTime);
+
+    METRIC_VALUE("processed_packets", processedPackets);
+    METRIC_VALUE("addon_messages", _addonMessageReceiveCount.load());
+    _addonMessageReceiveCount = 0;
+
+    if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
+    {
+        // Send time sync packet every 10s.
+        if (_timeSyncTimer > 0)
+        {
+            if (diff >= _timeSyncTimer)
+            {
+                SendTimeSync();
+            }
+            else
+            {
+                _timeSyncTimer -= diff;
+            }
+        }
+    }
+
+    ProcessQueryCallbacks();
+
+    //check if we are safe to proceed with logout
+    //logout procedure should happen only in World::UpdateSessions() method!!!
+    if (updater.ProcessUnsafe())
+    {
+        if (m_Socket && m_Socket->IsOpen() && _warden)
+        {
+            _warden->Update(diff);
+        }
+
+        if (ShouldLogOut(currentTime) && !m_playerLoading)
+        {
+            LogoutPlayer(true);
+        }
+
+        if (m_Socket && !m_Socket->IsOpen())
+        {
+            if (GetPlayer() && _warden)
+                _warden->Update(diff);
+
+            m_Socket = nullptr;
+        }
+
+        if (!m_Socket)
+        {
+            return false;                                       //Will remove this session from the world session map
+        }
+    }
+
+    return true;
+}
+
+void WorldSession::ProcessSessionLocalPackets()
+{
+    SessionLocalFilter updater(this);
+    ProcessReceivedPackets(updater, GameTime::GetGameTime().count());
+}
+
+uint32 WorldSession::ProcessReceivedPackets(PacketFilter& updater, time_t currentTime)
+{
     ///- Retrieve packets from the receive queue and call the appropriate handlers
     /// not process packets if socket already closed
     WorldPacket* packet = nullptr;
@@ -319,7 +407,6 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     bool deletePacket = true;
     std::vector<WorldPacket*> requeuePackets;
     uint32 processedPackets = 0;
-    time_t currentTime = GameTime::GetGameTime().count();
 
     constexpr uint32 MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 150;
 
@@ -481,57 +568,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
 
-    METRIC_VALUE("processed_packets", processedPackets);
-    METRIC_VALUE("addon_messages", _addonMessageReceiveCount.load());
-    _addonMessageReceiveCount = 0;
-
-    if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
-    {
-        // Send time sync packet every 10s.
-        if (_timeSyncTimer > 0)
-        {
-            if (diff >= _timeSyncTimer)
-            {
-                SendTimeSync();
-            }
-            else
-            {
-                _timeSyncTimer -= diff;
-            }
-        }
-    }
-
-    ProcessQueryCallbacks();
-
-    //check if we are safe to proceed with logout
-    //logout procedure should happen only in World::UpdateSessions() method!!!
-    if (updater.ProcessUnsafe())
-    {
-        if (m_Socket && m_Socket->IsOpen() && _warden)
-        {
-            _warden->Update(diff);
-        }
-
-        if (ShouldLogOut(currentTime) && !m_playerLoading)
-        {
-            LogoutPlayer(true);
-        }
-
-        if (m_Socket && !m_Socket->IsOpen())
-        {
-            if (GetPlayer() && _warden)
-                _warden->Update(diff);
-
-            m_Socket = nullptr;
-        }
-
-        if (!m_Socket)
-        {
-            return false;                                       //Will remove this session from the world session map
-        }
-    }
-
-    return true;
+    return processedPackets;
 }
 
 bool WorldSession::HandleSocketClosed()
@@ -735,6 +772,7 @@ void WorldSession::LogoutPlayer(bool save)
         // the player may not be in the world when logging out
         // e.g if he got disconnected during a transfer to another map
         // calls to GetMap in this case may cause crashes
+        sPlayerSaveScheduler->RemovePlayer(_player->GetGUID());
         _player->CleanupsBeforeDelete();
         if (Map* _map = _player->FindMap())
         {
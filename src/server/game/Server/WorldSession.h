@@ -262,6 +262,17 @@ public:
     bool Process(WorldPacket* packet) override;
 };
 
+//process only session local packets, used to update sessions in parallel in WorldSessionMgr::UpdateSessions()
+class SessionLocalFilter : public PacketFilter
+{
+public:
+    explicit SessionLocalFilter(WorldSession* pSession) : PacketFilter(pSession) {}
+    ~SessionLocalFilter() override = default;
+
+    bool Process(WorldPacket* packet) override;
+    [[nodiscard]] bool ProcessUnsafe() const override { return false; }
+};
+
 // Proxy structure to contain data passed to callback function,
 // only to prevent bloating the parameter list
 class CharacterCreateInfo
@@ -346,6 +357,7 @@ public:
     void WriteMovementInfo(WorldPacket* data, MovementInfo* mi);
 
     void SendPacket(WorldPacket const* packet);
+    void SendPacket(SharedWorldPacket const& packet);        // queues the payload without copying it, for packets sent to many sessions
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
     void SendPartyResult(PartyOperation operation, std::string const& member, PartyResult res, uint32 val = 0);
 
@@ -423,6 +435,8 @@ public:
 
     void QueuePacket(WorldPacket* new_packet);
     bool Update(uint32 diff, PacketFilter& updater);
+    /// Handles the PROCESS_SESSION_LOCAL packets at the front of the receive queue, other sessions may do the same at the same time
+    void ProcessSessionLocalPackets();
 
     /// Handle the authentication waiting queue (to be completed)
     void SendAuthWaitQueue(uint32 position);
@@ -1135,6 +1149,10 @@ private:
 
     bool recoveryItem(Item* pItem);
 
+    bool CanSendPacket(WorldPacket const& packet);
+
+    uint32 ProcessReceivedPackets(PacketFilter& updater, time_t currentTime);
+
     // logging helper
     void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char* reason);
     void LogUnprocessedTail(WorldPacket* packet);
@@ -17,7 +17,9 @@
 
 #include "Chat.h"
 #include "ChatPackets.h"
+#include "DatabaseEnv.h"
 #include "GameTime.h"
+#include "MapMgr.h"
 #include "Metric.h"
 #include "Player.h"
 #include "World.h"
@@ -90,6 +92,8 @@ WorldSession* WorldSessionMgr::FindOfflineSessionForCharacterGUID(ObjectGuid::Lo
 
 void WorldSessionMgr::UpdateSessions(uint32 const diff)
 {
+    ProcessCharacterWriteCallbacks();
+
     {
         METRIC_DETAILED_NO_THRESHOLD_TIMER("world_update_time",
             METRIC_TAG("type", "Add sessions"),
@@ -103,6 +107,29 @@ void WorldSessionMgr::UpdateSessions(uint32 const diff)
         }
     }
 
+    ///- Handle the packets that only touch their own session on the idle map update threads first
+    if (sWorld->getBoolConfig(CONFIG_MAP_UPDATE_PARALLEL_SESSIONS))
+    {
+        METRIC_DETAILED_NO_THRESHOLD_TIMER("world_update_time",
+            METRIC_TAG("type", "Process session local packets"),
+            METRIC_TAG("parent_type", "Update sessions"));
+
+        _parallelSessions.clear();
+        for (auto const& [accountId, session] : _sessions)
+            if (!session->IsSocketClosed())
+                _parallelSessions.push_back(session);
+
+        // a task per session would cost more to schedule than most sessions take to process
+        static constexpr std::size_t SessionsPerTask = 32;
+        std::size_t taskCount = (_parallelSessions.size() + SessionsPerTask - 1) / SessionsPerTask;
+        sMapMgr->GetMapUpdater()->run_parallel(taskCount, [this](std::size_t task)
+        {
+            std::size_t end = std::min(_parallelSessions.size(), (task + 1) * SessionsPerTask);
+            for (std::size_t i = task * SessionsPerTask; i < end; ++i)
+                _parallelSessions[i]->ProcessSessionLocalPackets();
+        });
+    }
+
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = _sessions.begin(), next; itr != _sessions.end(); itr = next)
     {
@@ -366,6 +393,7 @@ void WorldSessionMgr::UpdateMaxSessionCounters()
 /// Send a packet to all players (except self if mentioned)
 void WorldSessionMgr::SendGlobalMessage(WorldPacket const* packet, WorldSession* self, TeamId teamId)
 {
+    SharedWorldPacket sharedPacket = std::make_shared<WorldPacket const>(*packet);
     SessionMap::const_iterator itr;
     for (itr = _sessions.begin(); itr != _sessions.end(); ++itr)
     {
@@ -375,7 +403,7 @@ void WorldSessionMgr::SendGlobalMessage(WorldPacket const* packet, WorldSession*
             itr->second != self &&
             (teamId == TEAM_NEUTRAL || itr->second->GetPlayer()->GetTeamId() == teamId))
         {
-            itr->second->SendPacket(packet);
+            itr->second->SendPacket(sharedPacket);
         }
     }
 }
@@ -459,3 +487,49 @@ void WorldSessionMgr::DoForAllOnlinePlayers(std::function<void(Player*)> exec)
         }
     }
 }
+
+void WorldSessionMgr::CommitCharacterTransaction(uint32 accountId, CharacterDatabaseTransaction trans, std::function<void(bool)> callback)
+{
+    std::lock_guard<std::mutex> guard(_characterWritesLock);
+
+    _characterWrites[accountId].OnWriteQueued();
+
+    _queuedCharacterWriteCallbacks.emplace_back(CharacterDatabase.AsyncCommitTransaction(trans)).AfterComplete([this, accountId, callback = std::move(callback)](bool success)
+    {
+        {
+            std::lock_guard<std::mutex> guard(_characterWritesLock);
+            _characterWrites[accountId].OnWriteCommitted();
+        }
+
+        if (callback)
+            callback(success);
+    });
+}
+
+ReadYourWritesToken WorldSessionMgr::GetCharacterWriteToken(uint32 accountId) const
+{
+    std::lock_guard<std::mutex> guard(_characterWritesLock);
+
+    auto itr = _characterWrites.find(accountId);
+    return itr != _characterWrites.end() ? itr->second : ReadYourWritesToken();
+}
+
+void WorldSessionMgr::ProcessCharacterWriteCallbacks()
+{
+    {
+        std::lock_guard<std::mutex> guard(_characterWritesLock);
+        for (TransactionCallback& callback : _queuedCharacterWriteCallbacks)
+            _characterWriteCallbacks.AddCallback(std::move(callback));
+
+        _queuedCharacterWriteCallbacks.clear();
+    }
+
+    _characterWriteCallbacks.ProcessReadyCallbacks();
+
+    // forget the accounts the read replica caught up with
+    std::lock_guard<std::mutex> guard(_characterWritesLock);
+    std::erase_if(_characterWrites, [maxLag = CharacterDatabase.GetReplicaMaxLag()](auto const& pair)
+    {
+        return pair.second.IsReplicated(maxLag);
+    });
+}
@@ -18,12 +18,18 @@
 #ifndef __WORLDSESSIONMGR_H
 #define __WORLDSESSIONMGR_H
 
+#include "AsyncCallbackProcessor.h"
 #include "Common.h"
+#include "DatabaseEnvFwd.h"
 #include "IWorld.h"
 #include "LockedQueue.h"
 #include "ObjectGuid.h"
+#include "ReadYourWritesToken.h"
+#include <functional>
 #include <list>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 class Player;
 class WorldPacket;
@@ -87,13 +93,26 @@ public:
 
     void DoForAllOnlinePlayers(std::function<void(Player*)> exec);
 
+    /// Commits a character database transaction written for the account. Until it is committed and the read replica had the
+    /// time to replicate it, GetCharacterWriteToken keeps the reads of the account on the primary, also after a relog.
+    /// Can be called by any thread, callback is called by the world thread once the transaction completed.
+    void CommitCharacterTransaction(uint32 accountId, CharacterDatabaseTransaction trans, std::function<void(bool)> callback = nullptr);
+
+    /// Pass to the character database reads of the account that have to see its own writes (character list, login)
+    ReadYourWritesToken GetCharacterWriteToken(uint32 accountId) const;
+
 private:
+    void ProcessCharacterWriteCallbacks();
+
     LockedQueue<WorldSession*> _addSessQueue;
     void AddSession_(WorldSession* session);
 
     SessionMap _sessions;
     SessionMap _offlineSessions;
 
+    /// Sessions handed to the map update threads to process their session local packets
+    std::vector<WorldSession*> _parallelSessions;
+
     typedef std::unordered_map<uint32, time_t> DisconnectMap;
     DisconnectMap _disconnects;
 
@@ -105,6 +124,13 @@ private:
     uint32 _maxQueuedSessionCount;
     uint32 _playerCount;
     uint32 _maxPlayerCount;
+
+    mutable std::mutex _characterWritesLock;
+    /// Accounts with character writes the read replica may not have replicated yet
+    std::unordered_map<uint32, ReadYourWritesToken> _characterWrites;
+    /// Completion callbacks of CommitCharacterTransaction added since the last update, other threads may add them
+    std::vector<TransactionCallback> _queuedCharacterWriteCallbacks;
+    AsyncCallbackProcessor<TransactionCallback> _characterWriteCallbacks;
 };
 
 #define sWorldSessionMgr WorldSessionMgr::Instance()
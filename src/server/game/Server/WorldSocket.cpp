@@ -32,66 +32,144 @@
 #include "WorldSession.h"
 #include "WorldSessionMgr.h"
 #include "zlib.h"
+#include <array>
 #include <memory>
+#include <mutex>
+#include <string_view>
 
 #include "ServerPktHeader.h"
 
 using boost::asio::ip::tcp;
 
-void compressBuff(void* dst, uint32* dst_size, void* src, int src_size)
+namespace
 {
-    z_stream c_stream;
+    /// zlib deflate state of one network thread, reset between packets instead of being initialised and released for each of them
+    class UpdatePacketDeflater
+    {
+    public:
+        UpdatePacketDeflater() : _level(-1)
+        {
+            _stream.zalloc = (alloc_func)0;
+            _stream.zfree = (free_func)0;
+            _stream.opaque = (voidpf)0;
+        }
 
-    c_stream.zalloc = (alloc_func)0;
-    c_stream.zfree = (free_func)0;
-    c_stream.opaque = (voidpf)0;
+        ~UpdatePacketDeflater()
+        {
+            if (_level >= 0)
+                deflateEnd(&_stream);
+        }
 
-    // default Z_BEST_SPEED (1)
-    int z_res = deflateInit(&c_stream, sWorld->getIntConfig(CONFIG_COMPRESSION));
-    if (z_res != Z_OK)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
+        UpdatePacketDeflater(UpdatePacketDeflater const&) = delete;
+        UpdatePacketDeflater& operator=(UpdatePacketDeflater const&) = delete;
 
-    c_stream.next_out = (Bytef*)dst;
-    c_stream.avail_out = *dst_size;
-    c_stream.next_in = (Bytef*)src;
-    c_stream.avail_in = (uInt)src_size;
+        /// Returns the compressed size written to dst, 0 on failure
+        uint32 Compress(uint8* dst, uint32 dstSize, uint8 const* src, uint32 srcSize, int level)
+        {
+            int z_res;
+            if (_level != level)
+            {
+                if (_level >= 0)
+                    deflateEnd(&_stream);
 
-    z_res = deflate(&c_stream, Z_NO_FLUSH);
-    if (z_res != Z_OK)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
+                _level = -1;
+                z_res = deflateInit(&_stream, level);
+                if (z_res != Z_OK)
+                {
+                    LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
+                    return 0;
+                }
 
-    if (c_stream.avail_in != 0)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate not greedy)");
-        *dst_size = 0;
-        return;
-    }
+                _level = level;
+            }
+            else
+            {
+                z_res = deflateReset(&_stream);
+                if (z_res != Z_OK)
+                {
+                    LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateReset) Error code: {} ({})", z_res, zError(z_res));
+                    return 0;
+                }
+            }
 
-    z_res = deflate(&c_stream, Z_FINISH);
-    if (z_res != Z_STREAM_END)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate should report Z_STREAM_END instead {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
+            _stream.next_out = (Bytef*)dst;
+            _stream.avail_out = dstSize;
+            _stream.next_in = (Bytef*)src;
+            _stream.avail_in = (uInt)srcSize;
 
-    z_res = deflateEnd(&c_stream);
-    if (z_res != Z_OK)
+            // dst is compressBound() sized, so the whole input fits in a single finishing call
+            z_res = deflate(&_stream, Z_FINISH);
+            if (z_res != Z_STREAM_END)
+            {
+                LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate should report Z_STREAM_END instead {} ({})", z_res, zError(z_res));
+                return 0;
+            }
+
+            return _stream.total_out;
+        }
+
+    private:
+        z_stream _stream;
+        int _level;
+    };
+
+    /// Recently compressed update packets, a payload queued to many sockets or built identically for many players is only deflated once
+    class CompressedPacketCache
     {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateEnd) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
+    public:
+        SharedWorldPacket Find(SharedWorldPacket const& packet, std::size_t hash)
+        {
+            Shard& shard = _shards[hash % ShardCount];
+            std::lock_guard<std::mutex> guard(shard.Lock);
+            for (Entry const& entry : shard.Entries)
+            {
+                if (entry.Hash != hash || entry.Packet->size() != packet->size())
+                    continue;
+
+                if (entry.Packet == packet || !memcmp(entry.Packet->contents(), packet->contents(), packet->size()))
+                    return entry.Compressed;
+            }
+
+            return nullptr;
+        }
+
+        void Add(SharedWorldPacket const& packet, std::size_t hash, SharedWorldPacket const& compressed, std::size_t capacity)
+        {
+            Shard& shard = _shards[hash % ShardCount];
+            std::size_t shardCapacity = std::max<std::size_t>(1, capacity / ShardCount);
+            std::lock_guard<std::mutex> guard(shard.Lock);
+            if (shard.Entries.size() < shardCapacity)
+                shard.Entries.push_back({ hash, packet, compressed });
+            else
+                shard.Entries[shard.Next++ % shard.Entries.size()] = { hash, packet, compressed };
+        }
+
+    private:
+        struct Entry
+        {
+            std::size_t Hash;
+            SharedWorldPacket Packet;
+            SharedWorldPacket Compressed;
+        };
+
+        struct Shard
+        {
+            std::mutex Lock;
+            std::vector<Entry> Entries;
+            std::size_t Next = 0;
+        };
+
+        static constexpr std::size_t ShardCount = 16;
+
+        std::array<Shard, ShardCount> _shards;
+    };
+
+    CompressedPacketCache compressedPacketCache;
+}
 
-    *dst_size = c_stream.total_out;
+bool EncryptableAndCompressiblePacket::NeedsCompression() const
+{
+    return GetOpcode() == SMSG_UPDATE_OBJECT && size() > sWorld->getIntConfig(CONFIG_COMPRESSION_THRESHOLD);
 }
 
 void EncryptableAndCompressiblePacket::CompressIfNeeded()
@@ -99,21 +177,39 @@ void EncryptableAndCompressiblePacket::CompressIfNeeded()
     if (!NeedsCompression())
         return;
 
+    uint32 cacheSize = sWorld->getIntConfig(CONFIG_COMPRESSION_CACHE_SIZE);
+    std::size_t hash = 0;
+    if (cacheSize)
+    {
+        hash = std::hash<std::string_view>()(std::string_view(reinterpret_cast<char const*>(contents()), size()));
+        if (SharedWorldPacket compressed = compressedPacketCache.Find(_packet, hash))
+        {
+            _packet = std::move(compressed);
+            return;
+        }
+    }
+
+    static thread_local UpdatePacketDeflater deflater;
+
     uint32 pSize = size();
 
     uint32 destsize = compressBound(pSize);
-    ByteBuffer buf(destsize + sizeof(uint32));
+    WorldPacket buf(SMSG_COMPRESSED_UPDATE_OBJECT, destsize + sizeof(uint32));
     buf.resize(destsize + sizeof(uint32));
 
     buf.put<uint32>(0, pSize);
-    compressBuff(const_cast<uint8*>(buf.contents()) + sizeof(uint32), &destsize, (void*)contents(), pSize);
+    destsize = deflater.Compress(const_cast<uint8*>(buf.contents()) + sizeof(uint32), destsize, contents(), pSize, sWorld->getIntConfig(CONFIG_COMPRESSION));
     if (destsize == 0)
         return;
 
     buf.resize(destsize + sizeof(uint32));
 
-    ByteBuffer::operator=(std::move(buf));
-    SetOpcode(SMSG_COMPRESSED_UPDATE_OBJECT);
+    // the uncompressed payload may be shared with other sockets, so the compressed one replaces it instead of overwriting it
+    SharedWorldPacket compressed = std::make_shared<WorldPacket const>(std::move(buf));
+    if (cacheSize)
+        compressedPacketCache.Add(_packet, hash, compressed, cacheSize);
+
+    _packet = std::move(compressed);
 }
 
 WorldSocket::WorldSocket(tcp::socket&& socket)
@@ -166,8 +262,8 @@ bool WorldSocket::Update()
     EncryptableAndCompressiblePacket* queued;
     if (_bufferQueue.Dequeue(queued))
     {
-        // Allocate buffer only when it's needed but not on every Update() call.
-        MessageBuffer buffer(_sendBufferSize);
+        // Take a buffer only when it's needed but not on every Update() call, its storage is recycled once sent.
+        MessageBuffer buffer = GetWriteBuffer(_sendBufferSize);
         std::size_t currentPacketSize;
         do
         {
@@ -181,7 +277,7 @@ bool WorldSocket::Update()
             if (buffer.GetRemainingSpace() < currentPacketSize)
             {
                 QueuePacket(std::move(buffer));
-                buffer.Resize(_sendBufferSize);
+                buffer = GetWriteBuffer(_sendBufferSize);
             }
 
             if (buffer.GetRemainingSpace() >= currentPacketSize)
@@ -521,7 +617,18 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     if (sPacketLog->CanLogPacket())
         sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
 
-    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized()));
+    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(std::make_shared<WorldPacket const>(packet), _authCrypt.IsInitialized()));
+}
+
+void WorldSocket::SendPacket(SharedWorldPacket packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(std::move(packet), _authCrypt.IsInitialized()));
 }
 
 void WorldSocket::HandleAuthSession(WorldPacket & recvPacket)
@@ -29,23 +29,29 @@
 
 using boost::asio::ip::tcp;
 
-class EncryptableAndCompressiblePacket : public WorldPacket
+class EncryptableAndCompressiblePacket
 {
 public:
-    EncryptableAndCompressiblePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
+    EncryptableAndCompressiblePacket(SharedWorldPacket packet, bool encrypt) : _packet(std::move(packet)), _encrypt(encrypt)
     {
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
     bool NeedsEncryption() const { return _encrypt; }
 
-    bool NeedsCompression() const { return GetOpcode() == SMSG_UPDATE_OBJECT && size() > 100; }
+    bool NeedsCompression() const;
 
     void CompressIfNeeded();
 
+    uint16 GetOpcode() const { return _packet->GetOpcode(); }
+    std::size_t size() const { return _packet->size(); }
+    bool empty() const { return _packet->empty(); }
+    uint8 const* contents() const { return _packet->contents(); }
+
     std::atomic<EncryptableAndCompressiblePacket*> SocketQueueLink;
 
 private:
+    SharedWorldPacket _packet; ///< may be queued to several sockets, never modified once shared
     bool _encrypt;
 };
 
@@ -82,6 +88,7 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(SharedWorldPacket packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
@@ -1333,6 +1333,8 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
             Acore::Containers::RandomResize(targets, maxTargets);
         }
 
+        CheckAreaTargetsLineOfSight(targets);
+
         for (std::list<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
         {
             if (Unit* unitTarget = (*itr)->ToUnit())
@@ -1340,6 +1342,8 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
             else if (GameObject* gObjTarget = (*itr)->ToGameObject())
                 AddGOTarget(gObjTarget, effMask);
         }
+
+        m_areaTargetLineOfSight.clear();
     }
 }
 
@@ -8054,45 +8058,34 @@ bool Spell::CheckEffectTarget(Unit const* target, uint32 eff) const
             break;
         default: // normal case
         {
-            uint32 losChecks = LINEOFSIGHT_ALL_CHECKS;
-            GameObject* gobCaster = nullptr;
-            if (m_originalCasterGUID.IsGameObject())
+            Optional<LineOfSightChecks> losChecks = GetEffectTargetLineOfSightChecks();
+            if (!losChecks)
             {
-                gobCaster = m_caster->GetMap()->GetGameObject(m_originalCasterGUID);
-            }
-            else if (m_caster->GetEntry() == WORLD_TRIGGER)
-            {
-                if (TempSummon* tempSummon = m_caster->ToTempSummon())
-                {
-                    gobCaster = tempSummon->GetSummonerGameObject();
-                }
+                return true;
             }
 
-            if (gobCaster)
+            if (target != m_caster)
             {
-                if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
+                auto itr = m_areaTargetLineOfSight.find(target->GetGUID());
+                if (itr != m_areaTargetLineOfSight.end())
                 {
-                    return true;
+                    if (!itr->second)
+                    {
+                        return false;
+                    }
                 }
-
-                // If spell casted by gameobject then ignore M2 models
-                losChecks &= ~LINEOFSIGHT_CHECK_GOBJECT_M2;
-            }
-
-            if (target != m_caster)
-            {
-                if (m_targets.HasDst())
+                else if (m_targets.HasDst())
                 {
                     float x = m_targets.GetDstPos()->GetPositionX();
                     float y = m_targets.GetDstPos()->GetPositionY();
                     float z = m_targets.GetDstPos()->GetPositionZ();
 
-                    if (!target->IsWithinLOS(x, y, z, VMAP::ModelIgnoreFlags::M2, LineOfSightChecks(losChecks)))
+                    if (!target->IsWithinLOS(x, y, z, VMAP::ModelIgnoreFlags::M2, *losChecks))
                     {
                         return false;
                     }
                 }
-                else if (!m_caster->IsWithinLOSInMap(target, VMAP::ModelIgnoreFlags::M2, LineOfSightChecks(losChecks)))
+                else if (!m_caster->IsWithinLOSInMap(target, VMAP::ModelIgnoreFlags::M2, *losChecks))
                 {
                     return false;
                 }
@@ -8104,6 +8097,85 @@ bool Spell::CheckEffectTarget(Unit const* target, uint32 eff) const
     return true;
 }
 
+/// Line of sight checks between the targets and the caster or destination, nothing if the gameobject casting the spell ignores line of sight
+Optional<LineOfSightChecks> Spell::GetEffectTargetLineOfSightChecks() const
+{
+    uint32 losChecks = LINEOFSIGHT_ALL_CHECKS;
+    GameObject* gobCaster = nullptr;
+    if (m_originalCasterGUID.IsGameObject())
+    {
+        gobCaster = m_caster->GetMap()->GetGameObject(m_originalCasterGUID);
+    }
+    else if (m_caster->GetEntry() == WORLD_TRIGGER)
+    {
+        if (TempSummon* tempSummon = m_caster->ToTempSummon())
+        {
+            gobCaster = tempSummon->GetSummonerGameObject();
+        }
+    }
+
+    if (gobCaster)
+    {
+        if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
+        {
+            return {};
+        }
+
+        // If spell casted by gameobject then ignore M2 models
+        losChecks &= ~LINEOFSIGHT_CHECK_GOBJECT_M2;
+    }
+
+    return LineOfSightChecks(losChecks);
+}
+
+/// Checks the line of sight of all unit targets of an area at once, CheckEffectTarget uses the results while they are added
+void Spell::CheckAreaTargetsLineOfSight(std::list<WorldObject*> const& targets)
+{
+    // same early outs as CheckEffectTarget, which does not check the line of sight either then
+    if (m_spellInfo->HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT))
+        return;
+
+    if (IsTriggered() && m_triggeredByAuraSpell && (m_triggeredByAuraSpell.spellInfo->HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT) ||
+        sDisableMgr->IsDisabledFor(DISABLE_TYPE_SPELL, m_triggeredByAuraSpell.spellInfo->Id, nullptr, SPELL_DISABLE_LOS)))
+        return;
+
+    Optional<LineOfSightChecks> losChecks = GetEffectTargetLineOfSightChecks();
+    if (!losChecks || !m_caster->IsInWorld())
+        return;
+
+    std::vector<VMAP::LineOfSightQuery> queries;
+    std::vector<Unit const*> units;
+    for (WorldObject const* target : targets)
+    {
+        Unit const* unit = target->ToUnit();
+        if (!unit || unit == m_caster || !m_caster->IsInMap(unit))
+            continue;
+
+        VMAP::LineOfSightQuery query;
+        if (m_targets.HasDst())
+        {
+            // checked from the target with its own phase mask, the others are checked one by one
+            if (unit->GetPhaseMask() != m_caster->GetPhaseMask())
+                continue;
+
+            unit->GetLineOfSightSegment(m_targets.GetDstPos()->GetPositionX(), m_targets.GetDstPos()->GetPositionY(), m_targets.GetDstPos()->GetPositionZ(), query);
+        }
+        else
+            m_caster->GetLineOfSightSegment(unit, query);
+
+        queries.push_back(query);
+        units.push_back(unit);
+    }
+
+    if (queries.size() < 2)
+        return;
+
+    m_caster->GetMap()->isInLineOfSight(queries, m_caster->GetPhaseMask(), *losChecks, VMAP::ModelIgnoreFlags::M2);
+
+    for (std::size_t i = 0; i < queries.size(); ++i)
+        m_areaTargetLineOfSight[units[i]->GetGUID()] = queries[i].inLineOfSight;
+}
+
 bool Spell::IsNextMeleeSwingSpell() const
 {
     return m_spellInfo->HasAttribute(SPELL_ATTR0_ON_NEXT_SWING_NO_DAMAGE);
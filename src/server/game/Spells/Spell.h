@@ -490,6 +490,8 @@ public:
     void WriteAmmoToPacket(WorldPacket* data);
 
     bool CheckEffectTarget(Unit const* target, uint32 eff) const;
+    Optional<LineOfSightChecks> GetEffectTargetLineOfSightChecks() const;
+    void CheckAreaTargetsLineOfSight(std::list<WorldObject*> const& targets);
     bool CanAutoCast(Unit* target);
     void CheckSrc() { if (!m_targets.HasSrc()) m_targets.SetSrc(*m_caster); }
     void CheckDst() { if (!m_targets.HasDst()) m_targets.SetDst(*m_caster); }
@@ -685,6 +687,7 @@ public:
     // *****************************************
     std::list<TargetInfo> m_UniqueTargetInfo;
     uint8 m_channelTargetEffectMask;                        // Mask req. alive targets
+    std::unordered_map<ObjectGuid, bool> m_areaTargetLineOfSight; // line of sight of the area targets being added, see CheckAreaTargetsLineOfSight
 
     struct GOTargetInfo
     {
@@ -0,0 +1,250 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TickProfiler.h"
+#include "Config.h"
+#include "Log.h"
+#include "StringFormat.h"
+#include <algorithm>
+
+namespace
+{
+    struct ZoneInfo
+    {
+        char const* Name;
+        char const* Category;
+        bool MapArgument;
+    };
+
+    constexpr ZoneInfo ZoneInfos[MAX_TICK_PROFILE_ZONES] =
+    {
+        { "World::Update",              "world", false }, // TICK_PROFILE_WORLD_UPDATE
+        { "Update sessions",            "world", false }, // TICK_PROFILE_WORLD_SESSIONS
+        { "Update maps",                "world", false }, // TICK_PROFILE_WORLD_MAPS
+        { "Update battlegrounds",       "world", false }, // TICK_PROFILE_WORLD_BATTLEGROUNDS
+        { "Update outdoor pvp",         "world", false }, // TICK_PROFILE_WORLD_OUTDOOR_PVP
+        { "Update battlefields",        "world", false }, // TICK_PROFILE_WORLD_BATTLEFIELDS
+        { "Process query callbacks",    "world", false }, // TICK_PROFILE_WORLD_QUERY_CALLBACKS
+        { "Map::Update",                "map",   true  }, // TICK_PROFILE_MAP_UPDATE
+        { "Update sessions",            "map",   true  }, // TICK_PROFILE_MAP_SESSIONS
+        { "Update players",             "map",   true  }, // TICK_PROFILE_MAP_PLAYERS
+        { "Update non player objects",  "map",   true  }, // TICK_PROFILE_MAP_NON_PLAYER_OBJECTS
+        { "Calculate queued paths",     "map",   true  }, // TICK_PROFILE_MAP_PATHFINDING
+        { "Send object updates",        "map",   true  }, // TICK_PROFILE_MAP_OBJECT_UPDATES
+        { "Process scripts",            "map",   true  }, // TICK_PROFILE_MAP_SCRIPTS
+        { "Move objects in move lists", "map",   true  }, // TICK_PROFILE_MAP_MOVE_LISTS
+        { "Handle delayed visibility",  "map",   true  }, // TICK_PROFILE_MAP_DELAYED_VISIBILITY
+    };
+
+    constexpr uint32 DurationBits = 56;
+    constexpr uint64 DurationMask = (uint64(1) << DurationBits) - 1;
+}
+
+/**
+ * Single writer seqlock ring: the owner claims an entry before overwriting it and publishes it afterwards.
+ * A reader copies the published entries and drops the ones that were claimed again while it was copying.
+ */
+struct TickProfiler::ThreadRing
+{
+    struct Entry
+    {
+        std::atomic<uint64> Start;
+        std::atomic<uint64> ZoneAndDuration; ///< Zone in the top 8 bits
+        std::atomic<uint64> Argument;
+    };
+
+    struct Copy
+    {
+        uint64 Start;
+        uint64 ZoneAndDuration;
+        uint64 Argument;
+    };
+
+    ThreadRing(uint32 id, uint32 size) : Id(id), Entries(std::make_unique<Entry[]>(size)), Size(size), Claimed(0), Published(0), InUse(true)
+    {
+        Name = Acore::StringFormat("Thread {}", id);
+    }
+
+    void Push(uint64 start, uint64 zoneAndDuration, uint64 argument)
+    {
+        uint64 index = Published.load(std::memory_order_relaxed);
+        Claimed.store(index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        Entry& entry = Entries[index % Size];
+        entry.Start.store(start, std::memory_order_relaxed);
+        entry.ZoneAndDuration.store(zoneAndDuration, std::memory_order_relaxed);
+        entry.Argument.store(argument, std::memory_order_relaxed);
+
+        Published.store(index + 1, std::memory_order_release);
+    }
+
+    void CopyTo(std::vector<Copy>& copies) const
+    {
+        uint64 published = Published.load(std::memory_order_acquire);
+        uint64 first = published > Size ? published - Size : 0;
+
+        copies.clear();
+        for (uint64 index = first; index < published; ++index)
+        {
+            Entry const& entry = Entries[index % Size];
+            copies.push_back({ entry.Start.load(std::memory_order_relaxed), entry.ZoneAndDuration.load(std::memory_order_relaxed), entry.Argument.load(std::memory_order_relaxed) });
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // entry i was overwritten once i + Size got claimed
+        uint64 claimed = Claimed.load(std::memory_order_relaxed);
+        uint64 firstValid = claimed >= Size ? claimed - Size + 1 : 0;
+        if (firstValid > first)
+            copies.erase(copies.begin(), copies.begin() + std::min<uint64>(firstValid - first, copies.size()));
+    }
+
+    uint32 Id;
+    std::string Name; ///< Guarded by _ringsLock
+    std::unique_ptr<Entry[]> Entries;
+    uint32 Size;
+    std::atomic<uint64> Claimed;
+    std::atomic<uint64> Published;
+    std::atomic<bool> InUse;
+};
+
+thread_local TickProfiler::ThreadRingHolder TickProfiler::_threadRingHolder;
+
+TickProfiler::ThreadRingHolder::~ThreadRingHolder()
+{
+    if (Ring)
+        Ring->InUse.store(false, std::memory_order_release);
+}
+
+TickProfiler::TickProfiler() : _epoch(std::chrono::steady_clock::now()), _enabled(false), _ringSize(0) { }
+
+TickProfiler::~TickProfiler() = default;
+
+TickProfiler* TickProfiler::instance()
+{
+    static TickProfiler instance;
+    return &instance;
+}
+
+void TickProfiler::LoadFromConfig()
+{
+    std::lock_guard<std::mutex> guard(_ringsLock);
+
+    // rings are never resized, the size only applies to the first load
+    if (!_ringSize)
+        _ringSize = std::max<uint32>(sConfigMgr->GetOption<uint32>("TickProfiler.EventsPerThread", 16384), 64);
+
+    _enabled.store(sConfigMgr->GetOption<bool>("TickProfiler.Enable", false), std::memory_order_relaxed);
+}
+
+void TickProfiler::SetThreadName(std::string const& name)
+{
+    ThreadRing* ring = GetThreadRing();
+
+    std::lock_guard<std::mutex> guard(_ringsLock);
+    ring->Name = name;
+}
+
+void TickProfiler::Record(TickProfileZone zone, uint64 argument, uint64 start, uint64 end)
+{
+    uint64 duration = std::min<uint64>(end > start ? end - start : 0, DurationMask);
+    GetThreadRing()->Push(start, (uint64(zone) << DurationBits) | duration, argument);
+}
+
+TickProfiler::ThreadRing* TickProfiler::GetThreadRing()
+{
+    if (_threadRingHolder.Ring)
+        return _threadRingHolder.Ring;
+
+    std::lock_guard<std::mutex> guard(_ringsLock);
+
+    for (std::unique_ptr<ThreadRing> const& ring : _rings)
+    {
+        if (!ring->InUse.load(std::memory_order_acquire))
+        {
+            ring->InUse.store(true, std::memory_order_relaxed);
+            ring->Name = Acore::StringFormat("Thread {}", ring->Id);
+            _threadRingHolder.Ring = ring.get();
+            return _threadRingHolder.Ring;
+        }
+    }
+
+    // zones can be recorded before the config is loaded (SetThreadName of the world thread)
+    uint32 ringSize = _ringSize ? _ringSize : 16384;
+    _threadRingHolder.Ring = _rings.emplace_back(std::make_unique<ThreadRing>(uint32(_rings.size()) + 1, ringSize)).get();
+    return _threadRingHolder.Ring;
+}
+
+std::size_t TickProfiler::DumpChromeTrace(std::ostream& out)
+{
+    std::vector<std::pair<uint32, std::string>> threads;
+    std::vector<ThreadRing const*> rings;
+    {
+        std::lock_guard<std::mutex> guard(_ringsLock);
+        for (std::unique_ptr<ThreadRing> const& ring : _rings)
+        {
+            threads.emplace_back(ring->Id, ring->Name);
+            rings.push_back(ring.get());
+        }
+    }
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    for (auto const& [id, name] : threads)
+    {
+        out << (first ? "" : ",") << Acore::StringFormat(R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"{}"}}}})", id, name);
+        first = false;
+    }
+
+    // rings are never freed, copying them without _ringsLock keeps SetThreadName and new threads from blocking
+    std::size_t zoneCount = 0;
+    std::vector<ThreadRing::Copy> copies;
+    for (ThreadRing const* ring : rings)
+    {
+        ring->CopyTo(copies);
+        for (ThreadRing::Copy const& copy : copies)
+        {
+            TickProfileZone zone = TickProfileZone(copy.ZoneAndDuration >> DurationBits);
+            if (zone >= MAX_TICK_PROFILE_ZONES)
+                continue;
+
+            ZoneInfo const& info = ZoneInfos[zone];
+            double start = double(copy.Start) / 1000.0;
+            double duration = double(copy.ZoneAndDuration & DurationMask) / 1000.0;
+
+            out << (first ? "" : ",") << Acore::StringFormat(R"({{"name":"{}","cat":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f})",
+                info.Name, info.Category, ring->Id, start, duration);
+
+            if (info.MapArgument)
+                out << Acore::StringFormat(R"(,"args":{{"map":{},"instance":{}}})", uint32(copy.Argument >> 32), uint32(copy.Argument));
+
+            out << '}';
+            first = false;
+            ++zoneCount;
+        }
+    }
+
+    out << "]}";
+    return zoneCount;
+}
+
+char const* TickProfiler::GetZoneName(TickProfileZone zone)
+{
+    return zone < MAX_TICK_PROFILE_ZONES ? ZoneInfos[zone].Name : "";
+}
@@ -0,0 +1,144 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __TICKPROFILER_H
+#define __TICKPROFILER_H
+
+#include "Define.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+enum TickProfileZone : uint8
+{
+    TICK_PROFILE_WORLD_UPDATE,
+    TICK_PROFILE_WORLD_SESSIONS,
+    TICK_PROFILE_WORLD_MAPS,
+    TICK_PROFILE_WORLD_BATTLEGROUNDS,
+    TICK_PROFILE_WORLD_OUTDOOR_PVP,
+    TICK_PROFILE_WORLD_BATTLEFIELDS,
+    TICK_PROFILE_WORLD_QUERY_CALLBACKS,
+    TICK_PROFILE_MAP_UPDATE,
+    TICK_PROFILE_MAP_SESSIONS,
+    TICK_PROFILE_MAP_PLAYERS,
+    TICK_PROFILE_MAP_NON_PLAYER_OBJECTS,
+    TICK_PROFILE_MAP_PATHFINDING,
+    TICK_PROFILE_MAP_OBJECT_UPDATES,
+    TICK_PROFILE_MAP_SCRIPTS,
+    TICK_PROFILE_MAP_MOVE_LISTS,
+    TICK_PROFILE_MAP_DELAYED_VISIBILITY,
+
+    MAX_TICK_PROFILE_ZONES
+};
+
+/**
+ * @brief Flight recorder of the server tick.
+ *
+ * Code marks the phases of World::Update and Map::Update with TICK_PROFILE_ZONE, every thread writes the
+ * finished zones into its own fixed size ring, overwriting the oldest ones, without locks or allocations.
+ * DumpChromeTrace() copies the rings of all threads while they keep running, so the last seconds before a
+ * slow tick can be inspected in chrome://tracing or Perfetto.
+ */
+class AC_GAME_API TickProfiler
+{
+public:
+    static TickProfiler* instance();
+
+    void LoadFromConfig();
+    [[nodiscard]] bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+    /// Name of the calling thread in the trace
+    void SetThreadName(std::string const& name);
+
+    /// Nanoseconds since the profiler was created
+    [[nodiscard]] uint64 GetTime() const
+    {
+        return uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _epoch).count());
+    }
+
+    void Record(TickProfileZone zone, uint64 argument, uint64 start, uint64 end);
+
+    /// Writes the zones currently held by the rings as Chrome trace event JSON, returns the number of written zones
+    std::size_t DumpChromeTrace(std::ostream& out);
+
+    static char const* GetZoneName(TickProfileZone zone);
+
+private:
+    struct ThreadRing;
+
+    /// Ring of the calling thread, handed over to the next new thread once this one exits
+    struct ThreadRingHolder
+    {
+        ~ThreadRingHolder();
+
+        ThreadRing* Ring = nullptr;
+    };
+
+    static thread_local ThreadRingHolder _threadRingHolder;
+
+    TickProfiler();
+    ~TickProfiler();
+
+    ThreadRing* GetThreadRing();
+
+    std::chrono::steady_clock::time_point _epoch;
+    std::atomic<bool> _enabled;
+    uint32 _ringSize;
+
+    std::mutex _ringsLock;
+    std::vector<std::unique_ptr<ThreadRing>> _rings;
+};
+
+#define sTickProfiler TickProfiler::instance()
+
+/// Records the time between its construction and destruction as one zone
+class TickProfileScope
+{
+public:
+    explicit TickProfileScope(TickProfileZone zone, uint64 argument = 0)
+        : _zone(zone), _argument(argument), _start(sTickProfiler->IsEnabled() ? sTickProfiler->GetTime() + 1 : 0) { }
+
+    ~TickProfileScope()
+    {
+        if (_start)
+            sTickProfiler->Record(_zone, _argument, _start - 1, sTickProfiler->GetTime());
+    }
+
+    /// Argument of map zones, shown as map and instance id in the trace
+    static uint64 MapArgument(uint32 mapId, uint32 instanceId) { return (uint64(mapId) << 32) | instanceId; }
+
+private:
+    TickProfileZone _zone;
+    uint64 _argument;
+    uint64 _start; ///< Offset by one so 0 can mean disabled
+
+    TickProfileScope(TickProfileScope const&) = delete;
+    TickProfileScope& operator=(TickProfileScope const&) = delete;
+};
+
+#define TICK_PROFILE_DO_CONCAT(a, b) a##b
+#define TICK_PROFILE_CONCAT(a, b) TICK_PROFILE_DO_CONCAT(a, b)
+
+#define TICK_PROFILE_ZONE(zone) TickProfileScope TICK_PROFILE_CONCAT(__ac_tick_profile_zone, __LINE__)(zone)
+#define TICK_PROFILE_MAP_ZONE(zone, map) \
+        TickProfileScope TICK_PROFILE_CONCAT(__ac_tick_profile_zone, __LINE__)(zone, TickProfileScope::MapArgument((map)->GetId(), (map)->GetInstanceId()))
+
+#endif
@@ -0,0 +1,197 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PlayerSaveScheduler.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include "Metric.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "World.h"
+#include "WorldSession.h"
+#include "WorldSessionMgr.h"
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+    constexpr uint32 SlotDuration = 1000;
+}
+
+PlayerSaveScheduler* PlayerSaveScheduler::instance()
+{
+    static PlayerSaveScheduler instance;
+    return &instance;
+}
+
+bool PlayerSaveScheduler::IsEnabled() const
+{
+    return sWorld->getBoolConfig(CONFIG_PLAYER_SAVE_SCHEDULER) && sWorld->getIntConfig(CONFIG_INTERVAL_SAVE);
+}
+
+void PlayerSaveScheduler::AddPlayer(ObjectGuid guid)
+{
+    if (_playerSlots.find(guid) != _playerSlots.end())
+        return;
+
+    if (_slots.empty())
+        ResizeSlots(sWorld->getIntConfig(CONFIG_INTERVAL_SAVE));
+
+    AssignSlot(guid);
+}
+
+void PlayerSaveScheduler::RemovePlayer(ObjectGuid guid)
+{
+    auto itr = _playerSlots.find(guid);
+    if (itr == _playerSlots.end())
+        return;
+
+    std::vector<ObjectGuid>& slot = _slots[itr->second];
+    auto slotItr = std::find(slot.begin(), slot.end(), guid);
+    *slotItr = slot.back();
+    slot.pop_back();
+
+    _playerSlots.erase(itr);
+
+    if (_pendingSince.erase(guid))
+        _pendingSaveCount.store(uint32(_pendingSince.size()), std::memory_order_relaxed);
+}
+
+void PlayerSaveScheduler::Update(uint32 diff)
+{
+    // players save on their own timers meanwhile, see Player::Update
+    if (!IsEnabled())
+    {
+        _pendingSaves.clear();
+        _pendingSince.clear();
+        _pendingSaveCount.store(0, std::memory_order_relaxed);
+        return;
+    }
+
+    uint32 interval = sWorld->getIntConfig(CONFIG_INTERVAL_SAVE);
+    if (interval != _interval)
+        ResizeSlots(interval);
+
+    _time += diff;
+    _slotTimer += diff;
+    for (uint32 passed = 0; _slotTimer >= SlotDuration; _slotTimer -= SlotDuration)
+    {
+        // after a long stall every slot is due at most once
+        if (++passed > _slots.size())
+            continue;
+
+        _currentSlot = (_currentSlot + 1) % _slots.size();
+        for (ObjectGuid const& guid : _slots[_currentSlot])
+            if (_pendingSince.emplace(guid, _time).second)
+                _pendingSaves.push_back(guid);
+    }
+
+    uint32 maxInFlight = sWorld->getIntConfig(CONFIG_PLAYER_SAVE_SCHEDULER_MAX_IN_FLIGHT);
+    uint32 maxQueueSize = sWorld->getIntConfig(CONFIG_PLAYER_SAVE_SCHEDULER_MAX_QUEUE_SIZE);
+    uint32 maxDelay = sWorld->getIntConfig(CONFIG_PLAYER_SAVE_SCHEDULER_MAX_DELAY);
+    while (!_pendingSaves.empty())
+    {
+        ObjectGuid guid = _pendingSaves.front();
+        auto pendingItr = _pendingSince.find(guid);
+        if (pendingItr == _pendingSince.end())
+        {
+            _pendingSaves.pop_front();
+            continue;
+        }
+
+        // the oldest save is in front, once it waited too long it is written whatever the load
+        if (!maxDelay || _time - pendingItr->second < maxDelay)
+        {
+            if (maxInFlight && _inFlightSaveCount.load(std::memory_order_relaxed) >= maxInFlight)
+                break;
+
+            // back off until the database caught up, the saves would only queue up behind everything else
+            if (maxQueueSize && CharacterDatabase.QueueSize() >= maxQueueSize)
+                break;
+        }
+
+        _pendingSaves.pop_front();
+        _pendingSince.erase(pendingItr);
+
+        Player* player = ObjectAccessor::FindConnectedPlayer(guid);
+        if (!player || !player->IsInWorld())
+            continue;
+
+        // saved within the last half interval already (logout of a group member, quest completion, .save ...)
+        if (player->GetSaveTimer() > _interval / 2)
+            continue;
+
+        SavePlayer(player);
+    }
+
+    _pendingSaveCount.store(uint32(_pendingSince.size()), std::memory_order_relaxed);
+}
+
+void PlayerSaveScheduler::ResizeSlots(uint32 interval)
+{
+    _interval = interval;
+
+    std::vector<ObjectGuid> players;
+    players.reserve(_playerSlots.size());
+    for (auto const& [guid, slot] : _playerSlots)
+        players.push_back(guid);
+
+    _slots.assign(std::max<uint32>(interval / SlotDuration, 1), {});
+    _playerSlots.clear();
+    _currentSlot = 0;
+    _slotTimer = 0;
+
+    for (ObjectGuid const& guid : players)
+        AssignSlot(guid);
+}
+
+void PlayerSaveScheduler::AssignSlot(ObjectGuid guid)
+{
+    // the least used slot, the earliest one after the current slot on ties
+    uint32 bestSlot = (_currentSlot + 1) % _slots.size();
+    for (uint32 i = 2; i <= _slots.size(); ++i)
+    {
+        uint32 slot = (_currentSlot + i) % _slots.size();
+        if (_slots[slot].size() < _slots[bestSlot].size())
+            bestSlot = slot;
+    }
+
+    _slots[bestSlot].push_back(guid);
+    _playerSlots[guid] = bestSlot;
+}
+
+void PlayerSaveScheduler::SavePlayer(Player* player)
+{
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    player->SaveToDB(trans, false, false);
+
+    // nothing to write while the player is teleported far, it saves itself after the teleport
+    if (!trans->GetSize())
+        return;
+
+    LOG_DEBUG("entities.player", "PlayerSaveScheduler: Player '{}' ({}) saved", player->GetName(), player->GetGUID().ToString());
+
+    _inFlightSaveCount.fetch_add(1, std::memory_order_relaxed);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    sWorldSessionMgr->CommitCharacterTransaction(player->GetSession()->GetAccountId(), trans, [this, start, onSaveCompleted = player->GetSaveCompletionHandler()](bool success)
+    {
+        _inFlightSaveCount.fetch_sub(1, std::memory_order_relaxed);
+        METRIC_VALUE("player_save_latency", std::chrono::steady_clock::now() - start);
+        onSaveCompleted(success);
+    });
+}
@@ -0,0 +1,77 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_PLAYER_SAVE_SCHEDULER_H
+#define ACORE_PLAYER_SAVE_SCHEDULER_H
+
+#include "Define.h"
+#include "ObjectGuid.h"
+#include <atomic>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+class Player;
+
+/**
+ * @brief Autosaves the players in the world from slots spread evenly over PlayerSaveInterval.
+ *
+ * Every player gets the least used one second slot of the interval when entering the world, so the
+ * saves do not cluster after a restart or a mass login like the timers of the players themselves.
+ * Saves whose slot has passed wait while too many of them are still written or while the
+ * character database queue is too long, but not longer than PlayerSave.Scheduler.MaxDelay.
+ */
+class AC_GAME_API PlayerSaveScheduler
+{
+public:
+    static PlayerSaveScheduler* instance();
+
+    [[nodiscard]] bool IsEnabled() const;
+
+    void AddPlayer(ObjectGuid guid);
+    void RemovePlayer(ObjectGuid guid);
+
+    void Update(uint32 diff);
+
+    /// Players whose slot has passed and that wait for their save to start
+    [[nodiscard]] uint32 GetPendingSaveCount() const { return _pendingSaveCount.load(std::memory_order_relaxed); }
+    /// Saves committed but not completed yet
+    [[nodiscard]] uint32 GetInFlightSaveCount() const { return _inFlightSaveCount.load(std::memory_order_relaxed); }
+
+private:
+    PlayerSaveScheduler() = default;
+
+    void ResizeSlots(uint32 interval);
+    void AssignSlot(ObjectGuid guid);
+    void SavePlayer(Player* player);
+
+    std::vector<std::vector<ObjectGuid>> _slots;
+    std::unordered_map<ObjectGuid, uint32> _playerSlots;
+    std::deque<ObjectGuid> _pendingSaves;                 ///< May still hold players removed meanwhile, they are skipped
+    std::unordered_map<ObjectGuid, uint64> _pendingSince; ///< Players waiting for their save and the time their slot passed
+    uint64 _time = 0;
+    uint32 _interval = 0;
+    uint32 _currentSlot = 0;
+    uint32 _slotTimer = 0;
+
+    std::atomic<uint32> _pendingSaveCount = 0;
+    std::atomic<uint32> _inFlightSaveCount = 0;
+};
+
+#define sPlayerSaveScheduler PlayerSaveScheduler::instance()
+
+#endif
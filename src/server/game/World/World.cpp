@@ -70,6 +70,7 @@
 #include "PetitionMgr.h"
 #include "Player.h"
 #include "PlayerDump.h"
+#include "PlayerSaveScheduler.h"
 #include "PoolMgr.h"
 #include "Realm.h"
 #include "ScriptMgr.h"
@@ -79,6 +80,7 @@
 #include "SmartAI.h"
 #include "SpellMgr.h"
 #include "TaskScheduler.h"
+#include "TickProfiler.h"
 #include "TicketMgr.h"
 #include "Transport.h"
 #include "TransportMgr.h"
@@ -182,6 +184,7 @@ void World::LoadConfigSettings(bool reload)
 
     // load update time related configs
     sWorldUpdateTime.LoadFromConfig();
+    sTickProfiler->LoadFromConfig();
 
     ///- Read the player limit and the Message of the day from the config file
     if (!reload)
@@ -1084,6 +1087,7 @@ void World::DetectDBCLang()
 void World::Update(uint32 diff)
 {
     METRIC_TIMER("world_update_time_total");
+    TICK_PROFILE_ZONE(TICK_PROFILE_WORLD_UPDATE);
 
     ///- Update the game time and check for shutdown time
     _UpdateGameTime();
@@ -1177,9 +1181,15 @@ void World::Update(uint32 diff)
 
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update sessions"));
+        TICK_PROFILE_ZONE(TICK_PROFILE_WORLD_SESSIONS);
         sWorldSessionMgr->UpdateSessions(diff);
     }
 
+    {
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update player saves"));
+        sPlayerSaveScheduler->Update(diff);
+    }
+
     /// <li> Handle weather updates when the timer has passed
     if (_timers[WUPDATE_WEATHERS].Passed())
     {
@@ -1211,6 +1221,7 @@ void World::Update(uint32 diff)
     {
         ///- Update objects when the timer has passed (maps, transport, creatures, ...)
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update maps"));
+        TICK_PROFILE_ZONE(TICK_PROFILE_WORLD_MAPS);
         sMapMgr->Update(diff);
     }
 
@@ -1226,11 +1237,13 @@ void World::Update(uint32 diff)
 
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update battlegrounds"));
+        TICK_PROFILE_ZONE(TICK_PROFILE_WORLD_BATTLEGROUNDS);
         sBattlegroundMgr->Update(diff);
     }
 
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update outdoor pvp"));
+        TICK_PROFILE_ZONE(TICK_PROFILE_WORLD_OUTDOOR_PVP);
         sOutdoorPvPMgr->Update(diff);
     }
 
@@ -1241,6 +1254,7 @@ void World::Update(uint32 diff)
 
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update battlefields"));
+        TICK_PROFILE_ZONE(TICK_PROFILE_WORLD_BATTLEFIELDS);
         sBattlefieldMgr->Update(diff);
     }
 
@@ -1251,6 +1265,7 @@ void World::Update(uint32 diff)
 
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Process query callbacks"));
+        TICK_PROFILE_ZONE(TICK_PROFILE_WORLD_QUERY_CALLBACKS);
         // execute callbacks from sql queries that were queued recently
         ProcessQueryCallbacks();
     }
@@ -142,6 +142,8 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_DURABILITY_LOSS_IN_PVP, "DurabilityLoss.InPvP", false);
 
     SetConfigValue<uint32>(CONFIG_COMPRESSION, "Compression", 1, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0 && value < 10; }, "> 0 && < 10");
+    SetConfigValue<uint32>(CONFIG_COMPRESSION_THRESHOLD, "Compression.Threshold", 100);
+    SetConfigValue<uint32>(CONFIG_COMPRESSION_CACHE_SIZE, "Compression.CacheSize", 64);
 
     SetConfigValue<bool>(CONFIG_ADDON_CHANNEL, "AddonChannel", true);
     SetConfigValue<bool>(CONFIG_CLEAN_CHARACTER_DB, "CleanCharacterDB", false);
@@ -160,6 +162,10 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<uint32>(CONFIG_INTERVAL_SAVE, "PlayerSaveInterval", 900000);
     SetConfigValue<uint32>(CONFIG_INTERVAL_DISCONNECT_TOLERANCE, "DisconnectToleranceInterval", 0);
     SetConfigValue<bool>(CONFIG_STATS_SAVE_ONLY_ON_LOGOUT, "PlayerSave.Stats.SaveOnlyOnLogout", true);
+    SetConfigValue<bool>(CONFIG_PLAYER_SAVE_SCHEDULER, "PlayerSave.Scheduler.Enable", false);
+    SetConfigValue<uint32>(CONFIG_PLAYER_SAVE_SCHEDULER_MAX_IN_FLIGHT, "PlayerSave.Scheduler.MaxInFlight", 8);
+    SetConfigValue<uint32>(CONFIG_PLAYER_SAVE_SCHEDULER_MAX_QUEUE_SIZE, "PlayerSave.Scheduler.MaxQueueSize", 200);
+    SetConfigValue<uint32>(CONFIG_PLAYER_SAVE_SCHEDULER_MAX_DELAY, "PlayerSave.Scheduler.MaxDelay", 60000);
 
     SetConfigValue<uint32>(CONFIG_MIN_LEVEL_STAT_SAVE, "PlayerSave.Stats.MinLevel", 0, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value < MAX_LEVEL; }, "< MAX_LEVEL");
 
@@ -513,6 +519,7 @@ void WorldConfig::BuildConfigCache()
 
     SetConfigValue<bool>(CONFIG_VMAP_BLIZZLIKE_PVP_LOS, "vmap.BlizzlikePvPLOS", true);
     SetConfigValue<bool>(CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD, "vmap.BlizzlikeLOSInOpenWorld", true);
+    SetConfigValue<uint32>(CONFIG_TERRAIN_QUERY_CACHE_SIZE, "vmap.TerrainQueryCacheSize", 1024, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value <= 65536; }, "<= 65536");
 
     SetConfigValue<bool>(CONFIG_START_CUSTOM_SPELLS, "PlayerStart.CustomSpells", false);
     SetConfigValue<uint32>(CONFIG_HONOR_AFTER_DUEL, "HonorPointsAfterDuel", 0);
@@ -530,6 +537,11 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_SHOW_MUTE_IN_WORLD, "ShowMuteInWorld", false);
     SetConfigValue<bool>(CONFIG_SHOW_BAN_IN_WORLD, "ShowBanInWorld", false);
     SetConfigValue<uint32>(CONFIG_NUMTHREADS, "MapUpdate.Threads", 1);
+    SetConfigValue<bool>(CONFIG_MAP_UPDATE_PARALLEL_REGIONS, "MapUpdate.ParallelRegions", false);
+    SetConfigValue<uint32>(CONFIG_MAP_TERRAIN_PRELOAD_THREADS, "MapUpdate.TerrainPreloadThreads", 1, ConfigValueCache::Reloadable::No);
+    SetConfigValue<float>(CONFIG_MAP_TERRAIN_PRELOAD_DISTANCE, "MapUpdate.TerrainPreloadDistance", 600.0f);
+    SetConfigValue<bool>(CONFIG_MAP_UPDATE_PARALLEL_SESSIONS, "MapUpdate.ParallelSessions", false);
+    SetConfigValue<bool>(CONFIG_MAP_UPDATE_ASYNC_PATHFINDING, "MapUpdate.AsyncPathfinding", false);
     SetConfigValue<uint32>(CONFIG_MAX_RESULTS_LOOKUP_COMMANDS, "Command.LookupMaxResults", 0);
 
     // Warden
@@ -566,6 +578,7 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_PDUMP_NO_PATHS, "PlayerDump.DisallowPaths", true);
     SetConfigValue<bool>(CONFIG_PDUMP_NO_OVERWRITE, "PlayerDump.DisallowOverwrite", true);
     SetConfigValue<bool>(CONFIG_ENABLE_MMAPS, "MoveMaps.Enable", true);
+    SetConfigValue<uint32>(CONFIG_MMAP_MAX_PATH_LENGTH, "MoveMaps.MaxPathLength", 256, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value >= 16 && value <= 1024; }, ">= 16 && <= 1024");
 
     // Wintergrasp
     SetConfigValue<uint32>(CONFIG_WINTERGRASP_ENABLE, "Wintergrasp.Enable", 1);
@@ -27,6 +27,7 @@ enum ServerConfigs
     CONFIG_ALLOW_PLAYER_COMMANDS,
     CONFIG_CLEAN_CHARACTER_DB,
     CONFIG_STATS_SAVE_ONLY_ON_LOGOUT,
+    CONFIG_PLAYER_SAVE_SCHEDULER,
     CONFIG_ALLOW_TWO_SIDE_ACCOUNTS,
     CONFIG_ALLOW_TWO_SIDE_INTERACTION_CALENDAR,
     CONFIG_ALLOW_TWO_SIDE_INTERACTION_CHAT,
@@ -98,6 +99,7 @@ enum ServerConfigs
     CONFIG_PDUMP_NO_PATHS,
     CONFIG_PDUMP_NO_OVERWRITE,
     CONFIG_ENABLE_MMAPS,
+    CONFIG_MMAP_MAX_PATH_LENGTH,
     CONFIG_ENABLE_LOGIN_AFTER_DC,
     CONFIG_DONT_CACHE_RANDOM_MOVEMENT_PATHS,
     CONFIG_QUEST_IGNORE_AUTO_ACCEPT,
@@ -132,6 +134,7 @@ enum ServerConfigs
     CONFIG_QUEST_POI_ENABLED,
     CONFIG_VMAP_BLIZZLIKE_PVP_LOS,
     CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD,
+    CONFIG_TERRAIN_QUERY_CACHE_SIZE,
     CONFIG_OBJECT_SPARKLES,
     CONFIG_LOW_LEVEL_REGEN_BOOST,
     CONFIG_OBJECT_QUEST_MARKERS,
@@ -158,10 +161,15 @@ enum ServerConfigs
     CONFIG_RESPAWN_DYNAMICRATE_GAMEOBJECT,
     CONFIG_RESPAWN_DYNAMICRATE_CREATURE,
     CONFIG_COMPRESSION,
+    CONFIG_COMPRESSION_THRESHOLD,
+    CONFIG_COMPRESSION_CACHE_SIZE,
     CONFIG_INTERVAL_MAPUPDATE,
     CONFIG_INTERVAL_CHANGEWEATHER,
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
     CONFIG_INTERVAL_SAVE,
+    CONFIG_PLAYER_SAVE_SCHEDULER_MAX_IN_FLIGHT,
+    CONFIG_PLAYER_SAVE_SCHEDULER_MAX_QUEUE_SIZE,
+    CONFIG_PLAYER_SAVE_SCHEDULER_MAX_DELAY,
     CONFIG_PORT_WORLD,
     CONFIG_SOCKET_TIMEOUTTIME,
     CONFIG_SESSION_ADD_DELAY,
@@ -291,6 +299,11 @@ enum ServerConfigs
     CONFIG_PVP_TOKEN_COUNT,
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_NUMTHREADS,
+    CONFIG_MAP_UPDATE_PARALLEL_REGIONS,
+    CONFIG_MAP_TERRAIN_PRELOAD_THREADS,
+    CONFIG_MAP_TERRAIN_PRELOAD_DISTANCE,
+    CONFIG_MAP_UPDATE_PARALLEL_SESSIONS,
+    CONFIG_MAP_UPDATE_ASYNC_PATHFINDING,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_TELEPORT_TIMEOUT_NEAR,
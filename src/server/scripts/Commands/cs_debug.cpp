@@ -1353,6 +1353,11 @@ public:
                 uint64(map->GetObjectsStore().Size<GameObject>()),
                 uint64(map->GetActiveNonPlayersCount()));
 
+        uint64 terrainQueries = map->GetTerrainQueryCacheHits() + map->GetTerrainQueryCacheMisses();
+        handler->PSendSysMessage("Terrain query cache hits: {} misses: {} ({:.1f}% hit rate)",
+                map->GetTerrainQueryCacheHits(), map->GetTerrainQueryCacheMisses(),
+                terrainQueries ? 100.0 * map->GetTerrainQueryCacheHits() / terrainQueries : 0.0);
+
         CreatureCountWorker worker;
         TypeContainerVisitor<CreatureCountWorker, MapStoredObjectTypesContainer> visitor(worker);
         visitor.Visit(map->GetObjectsStore());
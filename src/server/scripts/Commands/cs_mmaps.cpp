@@ -256,6 +256,15 @@ public:
         handler->PSendSysMessage(" {} triangles ({} vertices)", triCount, triVertCount);
         handler->PSendSysMessage(" {} MB of data (not including pointers)", ((float)dataSize / sizeof(unsigned char)) / 1048576);
 
+        if (MMAP::PathCorridorCache const* corridorCache = manager->GetPathCorridorCache(handler->GetSession()->GetPlayer()->GetMapId()))
+        {
+            uint64 hits = corridorCache->GetHits();
+            uint64 misses = corridorCache->GetMisses();
+            handler->PSendSysMessage("Path corridor cache:");
+            handler->PSendSysMessage(" {} corridors cached", corridorCache->GetSize());
+            handler->PSendSysMessage(" {} hits, {} misses ({:.1f}% hit rate)", hits, misses, hits + misses ? 100.0f * hits / (hits + misses) : 0.0f);
+        }
+
         return true;
     }
 
@@ -18,20 +18,26 @@
 #include "Chat.h"
 #include "CommandScript.h"
 #include "Common.h"
+#include "DatabaseEnv.h"
 #include "GameTime.h"
 #include "GitRevision.h"
 #include "Log.h"
+#include "MetricHistogram.h"
 #include "ModuleMgr.h"
 #include "MotdMgr.h"
 #include "MySQLThreading.h"
 #include "Realm.h"
 #include "StringConvert.h"
+#include "TickProfiler.h"
 #include "UpdateTime.h"
+#include "Util.h"
 #include "VMapFactory.h"
 #include "VMapMgr2.h"
 #include "WorldSessionMgr.h"
 #include <boost/version.hpp>
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <numeric>
 #include <openssl/crypto.h>
 #include <openssl/opensslv.h>
@@ -79,12 +85,14 @@ public:
         static ChatCommandTable serverCommandTable =
         {
             { "corpses",      HandleServerCorpsesCommand,        SEC_GAMEMASTER,    Console::Yes },
+            { "dbstats",      HandleServerDBStatsCommand,        SEC_ADMINISTRATOR, Console::Yes },
             { "debug",        HandleServerDebugCommand,          SEC_ADMINISTRATOR, Console::Yes },
             { "exit",         HandleServerExitCommand,           SEC_CONSOLE,       Console::Yes },
             { "idlerestart",  serverIdleRestartCommandTable },
             { "idleshutdown", serverIdleShutdownCommandTable },
             { "info",         HandleServerInfoCommand,           SEC_PLAYER,        Console::Yes },
             { "motd",         HandleServerMotdCommand,           SEC_PLAYER,        Console::Yes },
+            { "profile",      HandleServerProfileCommand,        SEC_ADMINISTRATOR, Console::Yes },
             { "restart",      serverRestartCommandTable },
             { "shutdown",     serverShutdownCommandTable },
             { "set",          serverSetCommandTable }
@@ -105,6 +113,63 @@ public:
         return true;
     }
 
+    static bool HandleServerDBStatsCommand(ChatHandler* handler, Optional<std::string> database, Optional<uint32> count)
+    {
+        std::string name = database ? *database : "all";
+        bool all = StringEqualI(name, "all");
+        if (!all && !StringEqualI(name, "login") && !StringEqualI(name, "character") && !StringEqualI(name, "world"))
+        {
+            handler->SendErrorMessage("Unknown database {}, use login, character, world or all.", name);
+            return false;
+        }
+
+        uint32 statementCount = count.value_or(10);
+
+        if (all || StringEqualI(name, "login"))
+            SendDatabaseStatistics(handler, "Login", LoginDatabase, statementCount);
+
+        if (all || StringEqualI(name, "character"))
+            SendDatabaseStatistics(handler, "Character", CharacterDatabase, statementCount);
+
+        if (all || StringEqualI(name, "world"))
+            SendDatabaseStatistics(handler, "World", WorldDatabase, statementCount);
+
+        return true;
+    }
+
+    template <class T>
+    static void SendDatabaseStatistics(ChatHandler* handler, std::string_view name, DatabaseWorkerPool<T>& database, uint32 statementCount)
+    {
+        DatabasePoolStatistics statistics = database.GetStatistics();
+
+        handler->PSendSysMessage("{} database: {} queued operations", name, statistics.QueueSize);
+
+        auto sendHistogram = [handler](std::string_view label, MetricHistogram::Buckets const& buckets)
+        {
+            handler->PSendSysMessage("  {}: {} operations, p50 {} us, p95 {} us, p99 {} us, max {} us", label, MetricHistogram::GetCount(buckets),
+                MetricHistogram::GetPercentile(buckets, 0.5), MetricHistogram::GetPercentile(buckets, 0.95), MetricHistogram::GetPercentile(buckets, 0.99),
+                MetricHistogram::GetMax(buckets));
+        };
+
+        sendHistogram("Queue wait", statistics.QueueWait);
+        sendHistogram("Execution", statistics.Execution);
+
+        std::vector<DatabaseStatementStatistics>& statements = statistics.Statements;
+        std::size_t shown = std::min<std::size_t>(statementCount, statements.size());
+        std::partial_sort(statements.begin(), statements.begin() + shown, statements.end(), [](DatabaseStatementStatistics const& left, DatabaseStatementStatistics const& right)
+        {
+            return left.TotalMicroseconds > right.TotalMicroseconds;
+        });
+
+        for (std::size_t i = 0; i < shown; ++i)
+        {
+            DatabaseStatementStatistics const& statement = statements[i];
+            std::string_view query = statement.Query;
+            handler->PSendSysMessage("  {}: {} executions, {} ms total, {} us average: {}{}", statement.Name.empty() ? std::to_string(statement.Index) : std::string(statement.Name), statement.Count,
+                statement.TotalMicroseconds / 1000, statement.TotalMicroseconds / statement.Count, query.substr(0, 100), query.size() > 100 ? "..." : "");
+        }
+    }
+
     static bool HandleServerDebugCommand(ChatHandler* handler)
     {
         uint16 worldPort = uint16(sWorld->getIntConfig(CONFIG_PORT_WORLD));
@@ -289,6 +354,33 @@ public:
         return true;
     }
 
+    // Write the recorded tick phases as Chrome trace JSON
+    static bool HandleServerProfileCommand(ChatHandler* handler, Optional<std::string> fileName)
+    {
+        if (!sTickProfiler->IsEnabled())
+        {
+            handler->SendErrorMessage("The tick profiler is disabled, set TickProfiler.Enable = 1 and reload the config.");
+            return false;
+        }
+
+        // only the file name is used, the trace always goes to the logs directory
+        std::string name = fileName ? std::filesystem::path(*fileName).filename().string() : "";
+        if (name.empty())
+            name = Acore::StringFormat("tickprofile_{}.json", GameTime::GetGameTime().count());
+
+        std::string path = sLog->GetLogsDir() + name;
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+        if (!file)
+        {
+            handler->SendErrorMessage("Could not open {} for writing.", path);
+            return false;
+        }
+
+        std::size_t zoneCount = sTickProfiler->DumpChromeTrace(file);
+        handler->PSendSysMessage("Wrote {} profiled zones to {}.", zoneCount, path);
+        return true;
+    }
+
     static bool HandleServerShutDownCancelCommand(ChatHandler* /*handler*/)
     {
         sWorld->ShutdownCancel();
@@ -27,10 +27,12 @@
 #include <memory>
 #include <queue>
 #include <type_traits>
+#include <vector>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
+#define WRITE_BUFFER_POOL_SIZE 4
 #ifdef BOOST_ASIO_HAS_IOCP
 #define AC_SOCKET_USE_IOCP
 #endif
@@ -139,6 +141,19 @@ public:
             std::bind(callback, this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
     }
 
+    /// Returns an empty buffer of bytes size, reusing the storage of an already sent buffer when one is available
+    MessageBuffer GetWriteBuffer(std::size_t bytes)
+    {
+        if (_writeBufferPool.empty())
+            return MessageBuffer(bytes);
+
+        MessageBuffer buffer(std::move(_writeBufferPool.back()));
+        _writeBufferPool.pop_back();
+        buffer.Reset();
+        buffer.Resize(bytes);
+        return buffer;
+    }
+
     void QueuePacket(MessageBuffer&& buffer)
     {
         _writeQueue.push(std::move(buffer));
@@ -176,6 +191,15 @@ protected:
     virtual void OnClose() { }
     virtual void ReadHandler() = 0;
 
+    /// Drops the fully sent front buffer, keeping its storage for GetWriteBuffer
+    void PopWriteQueue()
+    {
+        if (_writeBufferPool.size() < WRITE_BUFFER_POOL_SIZE)
+            _writeBufferPool.push_back(std::move(_writeQueue.front()));
+
+        _writeQueue.pop();
+    }
+
     bool AsyncProcessQueue()
     {
         if (_isWritingAsync)
@@ -338,7 +362,7 @@ private:
             _writeQueue.front().ReadCompleted(transferedBytes);
 
             if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+                PopWriteQueue();
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -376,7 +400,7 @@ private:
                 return AsyncProcessQueue();
             }
 
-            _writeQueue.pop();
+            PopWriteQueue();
 
             if (_closing && _writeQueue.empty())
             {
@@ -387,7 +411,7 @@ private:
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            PopWriteQueue();
 
             if (_closing && _writeQueue.empty())
             {
@@ -402,7 +426,7 @@ private:
             return AsyncProcessQueue();
         }
 
-        _writeQueue.pop();
+        PopWriteQueue();
 
         if (_closing && _writeQueue.empty())
         {
@@ -420,6 +444,7 @@ private:
 
     MessageBuffer _readBuffer;
     std::queue<MessageBuffer> _writeQueue;
+    std::vector<MessageBuffer> _writeBufferPool;
 
     std::atomic<bool> _closed;
     std::atomic<bool> _closing;
@@ -0,0 +1,216 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathCorridorCache.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <random>
+
+using MMAP::PathCorridorCache;
+
+namespace
+{
+    PathCorridorCache::Key MakeKey(dtPolyRef start, dtPolyRef end)
+    {
+        return PathCorridorCache::Key{ start, end, 0x01, 0x00 };
+    }
+}
+
+TEST(PathCorridorCacheTest, DisabledWithoutCapacity)
+{
+    PathCorridorCache cache;
+    dtPolyRef corridor[] = { 1, 2, 3 };
+    cache.Store(MakeKey(1, 3), corridor, 3);
+
+    dtPolyRef path[8];
+    EXPECT_EQ(cache.Find(MakeKey(1, 3), path, 8), 0u);
+    EXPECT_EQ(cache.GetSize(), 0u);
+    EXPECT_EQ(cache.GetHits(), 0u);
+    EXPECT_EQ(cache.GetMisses(), 0u);
+}
+
+TEST(PathCorridorCacheTest, FindsStoredCorridor)
+{
+    PathCorridorCache cache;
+    cache.SetCapacity(4);
+
+    dtPolyRef corridor[] = { 1, 2, 3 };
+    cache.Store(MakeKey(1, 3), corridor, 3);
+
+    dtPolyRef path[8];
+    ASSERT_EQ(cache.Find(MakeKey(1, 3), path, 8), 3u);
+    EXPECT_EQ(path[0], 1u);
+    EXPECT_EQ(path[2], 3u);
+
+    // other filters may take other polygons
+    EXPECT_EQ(cache.Find(PathCorridorCache::Key{ 1, 3, 0x01, 0x02 }, path, 8), 0u);
+    // the caller has no room for it
+    EXPECT_EQ(cache.Find(MakeKey(1, 3), path, 2), 0u);
+
+    EXPECT_EQ(cache.GetHits(), 1u);
+    EXPECT_EQ(cache.GetMisses(), 2u);
+}
+
+TEST(PathCorridorCacheTest, EvictsLeastRecentlyUsed)
+{
+    PathCorridorCache cache;
+    cache.SetCapacity(2);
+
+    dtPolyRef corridor[] = { 1, 2 };
+    dtPolyRef path[8];
+    cache.Store(MakeKey(1, 2), corridor, 2);
+    cache.Store(MakeKey(2, 3), corridor, 2);
+
+    // 1 -> 2 becomes the most recently used one
+    EXPECT_EQ(cache.Find(MakeKey(1, 2), path, 8), 2u);
+
+    cache.Store(MakeKey(3, 4), corridor, 2);
+    EXPECT_EQ(cache.GetSize(), 2u);
+    EXPECT_EQ(cache.Find(MakeKey(1, 2), path, 8), 2u);
+    EXPECT_EQ(cache.Find(MakeKey(2, 3), path, 8), 0u);
+    EXPECT_EQ(cache.Find(MakeKey(3, 4), path, 8), 2u);
+}
+
+TEST(PathCorridorCacheTest, ClearDropsCorridors)
+{
+    PathCorridorCache cache;
+    cache.SetCapacity(4);
+
+    dtPolyRef corridor[] = { 1, 2 };
+    dtPolyRef path[8];
+    cache.Store(MakeKey(1, 2), corridor, 2);
+    cache.Clear();
+
+    EXPECT_EQ(cache.GetSize(), 0u);
+    EXPECT_EQ(cache.Find(MakeKey(1, 2), path, 8), 0u);
+}
+
+namespace
+{
+    // Stand-in for a busy map: a grid of polygons, creatures patrolling between a few waypoints, escorts
+    // walking their route once and pets following their owner around, the later ones rarely ask twice
+    constexpr uint32 GridSize = 128;
+    constexpr uint32 TraceLength = 5000;
+    constexpr uint32 MaxCorridor = 1024;
+
+    dtPolyRef PolyAt(uint32 x, uint32 y) { return dtPolyRef(y * GridSize + x + 1); }
+
+    // breadth first search over the grid, roughly what findPath costs over open terrain
+    uint32 FindCorridor(dtPolyRef start, dtPolyRef end, dtPolyRef* path)
+    {
+        std::vector<dtPolyRef> parent(GridSize * GridSize + 1, 0);
+        std::deque<dtPolyRef> open{ start };
+        parent[start] = start;
+
+        while (!open.empty())
+        {
+            dtPolyRef poly = open.front();
+            open.pop_front();
+            if (poly == end)
+                break;
+
+            uint32 x = uint32(poly - 1) % GridSize;
+            uint32 y = uint32(poly - 1) / GridSize;
+            for (auto [dx, dy] : { std::pair<int32, int32>(1, 0), { -1, 0 }, { 0, 1 }, { 0, -1 } })
+            {
+                int32 nx = int32(x) + dx;
+                int32 ny = int32(y) + dy;
+                if (nx < 0 || ny < 0 || nx >= int32(GridSize) || ny >= int32(GridSize))
+                    continue;
+
+                dtPolyRef next = PolyAt(nx, ny);
+                if (!parent[next])
+                {
+                    parent[next] = poly;
+                    open.push_back(next);
+                }
+            }
+        }
+
+        uint32 length = 0;
+        for (dtPolyRef poly = end; length < MaxCorridor; poly = parent[poly])
+        {
+            path[length++] = poly;
+            if (poly == start)
+                break;
+        }
+
+        std::reverse(path, path + length);
+        return length;
+    }
+
+    std::vector<std::pair<dtPolyRef, dtPolyRef>> RecordTrace()
+    {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<uint32> coord(0, GridSize - 1);
+        auto randomPoly = [&]() { return PolyAt(coord(rng), coord(rng)); };
+
+        std::vector<std::vector<dtPolyRef>> patrols(200);
+        for (std::vector<dtPolyRef>& patrol : patrols)
+            for (uint32 i = 0; i < 4; ++i)
+                patrol.push_back(randomPoly());
+
+        std::vector<std::pair<dtPolyRef, dtPolyRef>> trace;
+        std::uniform_int_distribution<uint32> kind(0, 99);
+        while (trace.size() < TraceLength)
+        {
+            uint32 roll = kind(rng);
+            if (roll < 70)
+            {
+                std::vector<dtPolyRef> const& patrol = patrols[std::min<uint32>(std::geometric_distribution<uint32>(0.05)(rng), patrols.size() - 1)];
+                uint32 waypoint = std::uniform_int_distribution<uint32>(0, patrol.size() - 1)(rng);
+                trace.emplace_back(patrol[waypoint], patrol[(waypoint + 1) % patrol.size()]);
+            }
+            else
+                trace.emplace_back(randomPoly(), randomPoly());
+        }
+
+        return trace;
+    }
+}
+
+// Prints hit rate and time spent replaying a synthetic path trace with and without the cache, only run
+// on request (--gtest_also_run_disabled_tests) since the timings are not asserted on
+TEST(PathCorridorCacheBenchmark, DISABLED_ReplayTrace)
+{
+    std::vector<std::pair<dtPolyRef, dtPolyRef>> const trace = RecordTrace();
+    std::vector<dtPolyRef> path(MaxCorridor);
+
+    std::printf("%10s %10s %12s\n", "capacity", "hit rate", "time");
+    for (uint32 capacity : { 0u, 256u, 1024u, 4096u })
+    {
+        PathCorridorCache cache;
+        cache.SetCapacity(capacity);
+
+        auto start = std::chrono::steady_clock::now();
+        for (auto const& [startPoly, endPoly] : trace)
+        {
+            PathCorridorCache::Key key = MakeKey(startPoly, endPoly);
+            if (!cache.Find(key, path.data(), MaxCorridor))
+                cache.Store(key, path.data(), FindCorridor(startPoly, endPoly, path.data()));
+        }
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        uint64 lookups = cache.GetHits() + cache.GetMisses();
+        std::printf("%10u %9.1f%% %9.2f ms\n", capacity, lookups ? 100.0 * cache.GetHits() / lookups : 0.0, elapsed);
+
+        EXPECT_LE(cache.GetSize(), capacity);
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Define.h"
+#include "MetricHistogram.h"
+#include "gtest/gtest.h"
+
+TEST(MetricHistogramTest, BucketBoundsContainValue)
+{
+    for (uint64 value : { 0ULL, 1ULL, 15ULL, 16ULL, 17ULL, 31ULL, 32ULL, 1000ULL, 65535ULL, 123456789ULL, 0xFFFFFFFFULL })
+    {
+        uint32 index = MetricHistogram::GetBucketIndex(value);
+        ASSERT_LT(index, MetricHistogram::BucketCount);
+        EXPECT_LE(MetricHistogram::GetBucketLowerBound(index), value);
+        EXPECT_GE(MetricHistogram::GetBucketUpperBound(index), value);
+    }
+
+    // values too large for the histogram are clamped to the last bucket
+    EXPECT_EQ(MetricHistogram::GetBucketIndex(0x100000000ULL), MetricHistogram::BucketCount - 1);
+}
+
+TEST(MetricHistogramTest, BucketsAreContiguous)
+{
+    for (uint32 i = 1; i < MetricHistogram::BucketCount; ++i)
+        EXPECT_EQ(MetricHistogram::GetBucketLowerBound(i), MetricHistogram::GetBucketUpperBound(i - 1) + 1);
+}
+
+TEST(MetricHistogramTest, Percentiles)
+{
+    MetricHistogram histogram;
+    for (uint64 value = 1; value <= 1000; ++value)
+        histogram.Record(value);
+
+    MetricHistogram::Buckets buckets{};
+    histogram.AddTo(buckets);
+
+    EXPECT_EQ(MetricHistogram::GetCount(buckets), 1000u);
+
+    // every bucket is at most 1/16 of its magnitude wide
+    EXPECT_NEAR(double(MetricHistogram::GetPercentile(buckets, 0.50)), 500.0, 500.0 / 16);
+    EXPECT_NEAR(double(MetricHistogram::GetPercentile(buckets, 0.99)), 990.0, 990.0 / 16);
+    EXPECT_GE(MetricHistogram::GetMax(buckets), 1000u);
+    EXPECT_LE(MetricHistogram::GetMax(buckets), 1000u + 1000u / 16);
+}
+
+TEST(MetricHistogramTest, IntervalFromSnapshots)
+{
+    MetricHistogram histogram;
+    for (uint32 i = 0; i < 100; ++i)
+        histogram.Record(10);
+
+    MetricHistogram::Buckets previous{};
+    histogram.AddTo(previous);
+
+    for (uint32 i = 0; i < 50; ++i)
+        histogram.Record(5000);
+
+    MetricHistogram::Buckets current{};
+    histogram.AddTo(current);
+
+    MetricHistogram::Buckets interval{};
+    for (uint32 i = 0; i < MetricHistogram::BucketCount; ++i)
+        interval[i] = current[i] - previous[i];
+
+    EXPECT_EQ(MetricHistogram::GetCount(interval), 50u);
+    EXPECT_NEAR(double(MetricHistogram::GetPercentile(interval, 0.50)), 5000.0, 5000.0 / 16);
+}
+
+TEST(MetricHistogramTest, EmptyHistogram)
+{
+    MetricHistogram::Buckets buckets{};
+    EXPECT_EQ(MetricHistogram::GetPercentile(buckets, 0.5), 0u);
+    EXPECT_EQ(MetricHistogram::GetMax(buckets), 0u);
+}
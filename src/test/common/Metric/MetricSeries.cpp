@@ -0,0 +1,91 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Metric.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    /// Evicts the series of the former tests, frees their ids with the collect after
+    void EvictAllSeries()
+    {
+        for (uint32 i = 0; i <= Metric::MaxIdleIntervals + 1; ++i)
+            sMetric->CollectSeries();
+    }
+}
+
+TEST(MetricSeriesTest, EvictsIdleSeries)
+{
+    EvictAllSeries();
+    ASSERT_EQ(sMetric->GetSeriesCount(), 0u);
+
+    sMetric->LogIntegerValue("test_idle", 1, { METRIC_TAG("map_instanceid", "1") });
+    sMetric->LogDuration("test_idle_timer", std::chrono::milliseconds(5), { METRIC_TAG("map_instanceid", "1") });
+    EXPECT_EQ(sMetric->GetSeriesCount(), 2u);
+
+    // the first collect still merges the samples
+    for (uint32 i = 0; i < Metric::MaxIdleIntervals; ++i)
+        sMetric->CollectSeries();
+
+    EXPECT_EQ(sMetric->GetSeriesCount(), 2u);
+
+    sMetric->CollectSeries();
+    EXPECT_EQ(sMetric->GetSeriesCount(), 0u);
+}
+
+TEST(MetricSeriesTest, KeepsSeriesWithSamples)
+{
+    EvictAllSeries();
+    ASSERT_EQ(sMetric->GetSeriesCount(), 0u);
+
+    for (uint32 i = 0; i < Metric::MaxIdleIntervals * 2; ++i)
+    {
+        sMetric->LogIntegerValue("test_busy", 1, { });
+        sMetric->CollectSeries();
+    }
+
+    EXPECT_EQ(sMetric->GetSeriesCount(), 1u);
+}
+
+TEST(MetricSeriesTest, InternsEvictedSeriesAgain)
+{
+    EvictAllSeries();
+    ASSERT_EQ(sMetric->GetSeriesCount(), 0u);
+
+    sMetric->LogFloatValue("test_relogged", 1.0, { METRIC_TAG("map_instanceid", "2") });
+    EvictAllSeries();
+    ASSERT_EQ(sMetric->GetSeriesCount(), 0u);
+
+    // still cached by this thread, the cache is dropped with the eviction
+    sMetric->LogFloatValue("test_relogged", 1.0, { METRIC_TAG("map_instanceid", "2") });
+    EXPECT_EQ(sMetric->GetSeriesCount(), 1u);
+}
+
+TEST(MetricSeriesTest, ReusesIdsOfEvictedSeries)
+{
+    // more series than the limit over time, never more than half of it at once
+    for (uint32 round = 0; round < 4; ++round)
+    {
+        EvictAllSeries();
+        ASSERT_EQ(sMetric->GetSeriesCount(), 0u);
+
+        for (uint32 i = 0; i < 4096; ++i)
+            sMetric->LogIntegerValue("test_instance", 1, { METRIC_TAG("map_instanceid", std::to_string(round * 4096 + i)) });
+
+        EXPECT_EQ(sMetric->GetSeriesCount(), 4096u);
+    }
+}
@@ -0,0 +1,178 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BoundedWorkerPool.h"
+#include "CryptoRandom.h"
+#include "SRP6.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <memory>
+
+TEST(BoundedWorkerPoolTest, RunsInlineWithoutThreads)
+{
+    BoundedWorkerPool pool;
+    pool.Start(0, 1);
+
+    bool ran = false;
+    std::future<void> result = pool.Enqueue([&ran]() { ran = true; });
+
+    EXPECT_TRUE(ran);
+    EXPECT_EQ(result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_FALSE(pool.IsFull());
+}
+
+TEST(BoundedWorkerPoolTest, FullWhileJobsArePending)
+{
+    BoundedWorkerPool pool;
+    pool.Start(1, 2);
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    std::future<void> first = pool.Enqueue([released]() { released.wait(); });
+    EXPECT_FALSE(pool.IsFull());
+
+    std::future<void> second = pool.Enqueue([released]() { released.wait(); });
+    EXPECT_TRUE(pool.IsFull());
+
+    release.set_value();
+    first.wait();
+    second.wait();
+    pool.Stop();
+
+    EXPECT_EQ(pool.GetPendingCount(), 0u);
+    EXPECT_FALSE(pool.IsFull());
+}
+
+namespace
+{
+    // Stand-in for the authserver: clients of a reconnect storm arrive at once, the network thread
+    // accepts a batch of them per loop, answers their challenges and then checks their proofs
+    constexpr uint32 StormClients = 5000;
+    constexpr uint32 AcceptsPerLoop = 64;
+
+    struct StormClient
+    {
+        std::shared_ptr<Acore::Crypto::SRP6> Srp6;
+        std::future<void> Pending;
+        bool ProofSent = false;
+    };
+
+    struct StormResult
+    {
+        std::vector<double> AcceptLatency;    // ms from the storm until the network thread handled the challenge
+        std::vector<double> HandshakeLatency; // ms from the storm until the proof was checked
+        uint32 Rejected = 0;
+    };
+
+    double Percentile(std::vector<double>& values, double percentile)
+    {
+        if (values.empty())
+            return 0.0;
+
+        std::sort(values.begin(), values.end());
+        return values[std::min<std::size_t>(values.size() - 1, std::size_t(values.size() * percentile))];
+    }
+
+    StormResult MeasureStorm(uint32 threads, uint32 maxPending)
+    {
+        BoundedWorkerPool pool;
+        pool.Start(threads, maxPending);
+
+        Acore::Crypto::SRP6::Salt const salt = Acore::Crypto::GetRandomBytes<Acore::Crypto::SRP6::SALT_LENGTH>();
+        Acore::Crypto::SRP6::Verifier const verifier = Acore::Crypto::GetRandomBytes<Acore::Crypto::SRP6::VERIFIER_LENGTH>();
+        Acore::Crypto::SRP6::EphemeralKey const A = Acore::Crypto::GetRandomBytes<Acore::Crypto::SRP6::EPHEMERAL_KEY_LENGTH>();
+        Acore::Crypto::SHA1::Digest const clientM{};
+
+        std::vector<StormClient> clients(StormClients);
+        std::vector<StormClient*> waiting;
+        StormResult result;
+
+        auto start = std::chrono::steady_clock::now();
+        auto elapsed = [&start]() { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(); };
+
+        uint32 accepted = 0;
+        while (accepted < StormClients || !waiting.empty())
+        {
+            for (uint32 i = 0; i < AcceptsPerLoop && accepted < StormClients; ++i)
+            {
+                StormClient& client = clients[accepted++];
+                result.AcceptLatency.push_back(elapsed());
+
+                if (pool.IsFull())
+                {
+                    ++result.Rejected;
+                    continue;
+                }
+
+                client.Pending = pool.Enqueue([&client, &salt, &verifier]()
+                {
+                    client.Srp6 = std::make_shared<Acore::Crypto::SRP6>(std::string("STORM"), salt, verifier);
+                });
+                waiting.push_back(&client);
+            }
+
+            // the client answers the challenge right away, a wrong password costs the same as a right one
+            waiting.erase(std::remove_if(waiting.begin(), waiting.end(), [&](StormClient* client)
+            {
+                if (client->Pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                    return false;
+
+                if (client->ProofSent)
+                {
+                    result.HandshakeLatency.push_back(elapsed());
+                    return true;
+                }
+
+                client->ProofSent = true;
+                client->Pending = pool.Enqueue([client, &A, &clientM]() { client->Srp6->VerifyChallengeResponse(A, clientM); });
+                return false;
+            }), waiting.end());
+        }
+
+        pool.Stop();
+        return result;
+    }
+}
+
+// Prints accept and handshake latency of a reconnect storm with and without crypto workers. The SRP6
+// math of 5000 clients takes a while, so it only runs with --gtest_also_run_disabled_tests
+TEST(BoundedWorkerPoolBenchmark, DISABLED_ReconnectStorm)
+{
+    std::printf("%20s %14s %14s %14s %14s %10s\n", "mode", "accept p50", "accept p99", "handshake p50", "handshake p99", "rejected");
+
+    struct Mode
+    {
+        char const* Name;
+        uint32 Threads;
+        uint32 MaxPending;
+    };
+
+    for (Mode const& mode : { Mode{ "network thread", 0, 0 }, Mode{ "2 workers", 2, 0 }, Mode{ "4 workers", 4, 0 }, Mode{ "4 workers, 500 max", 4, 500 } })
+    {
+        StormResult result = MeasureStorm(mode.Threads, mode.MaxPending);
+        std::printf("%20s %11.2f ms %11.2f ms %11.2f ms %11.2f ms %10u\n", mode.Name,
+            Percentile(result.AcceptLatency, 0.5), Percentile(result.AcceptLatency, 0.99),
+            Percentile(result.HandshakeLatency, 0.5), Percentile(result.HandshakeLatency, 0.99), result.Rejected);
+
+        EXPECT_EQ(result.AcceptLatency.size(), StormClients);
+        EXPECT_EQ(result.HandshakeLatency.size() + result.Rejected, StormClients);
+    }
+}
@@ -0,0 +1,257 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Define.h"
+#include "MPMCQueue.h"
+#include "PCQueue.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+TEST(MPMCQueueTest, FifoOrder)
+{
+    MPMCQueue<uint32> queue(8);
+    for (uint32 i = 0; i < 8; ++i)
+        EXPECT_TRUE(queue.Enqueue(i));
+
+    uint32 value = 0;
+    for (uint32 i = 0; i < 8; ++i)
+    {
+        EXPECT_TRUE(queue.Dequeue(value));
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_FALSE(queue.Dequeue(value));
+}
+
+TEST(MPMCQueueTest, CapacityIsBounded)
+{
+    MPMCQueue<uint32> queue(5);
+    EXPECT_EQ(queue.Capacity(), 8u);
+
+    for (uint32 i = 0; i < 8; ++i)
+        EXPECT_TRUE(queue.Enqueue(i));
+
+    EXPECT_FALSE(queue.Enqueue(8));
+
+    uint32 value = 0;
+    EXPECT_TRUE(queue.Dequeue(value));
+    EXPECT_TRUE(queue.Enqueue(8));
+}
+
+TEST(MPMCQueueTest, WrapsAround)
+{
+    MPMCQueue<uint32> queue(4);
+    uint32 value = 0;
+    for (uint32 i = 0; i < 100; ++i)
+    {
+        EXPECT_TRUE(queue.Enqueue(i));
+        EXPECT_TRUE(queue.Dequeue(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST(MPMCQueueTest, ConcurrentProducersAndConsumers)
+{
+    constexpr uint32 ThreadCount = 4;
+    constexpr uint32 ItemsPerProducer = 10000;
+
+    MPMCQueue<uint32> queue(256);
+    std::atomic<uint64> sum(0);
+    std::atomic<uint32> consumed(0);
+    std::vector<std::thread> threads;
+
+    for (uint32 t = 0; t < ThreadCount; ++t)
+    {
+        threads.emplace_back([&queue, t]()
+        {
+            for (uint32 i = 1; i <= ItemsPerProducer; ++i)
+                while (!queue.Enqueue(t * ItemsPerProducer + i))
+                    std::this_thread::yield();
+        });
+
+        threads.emplace_back([&queue, &sum, &consumed]()
+        {
+            uint32 value = 0;
+            while (consumed.load() < ThreadCount * ItemsPerProducer)
+            {
+                if (queue.Dequeue(value))
+                {
+                    sum.fetch_add(value);
+                    consumed.fetch_add(1);
+                }
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    uint64 expected = uint64(ThreadCount * ItemsPerProducer) * (ThreadCount * ItemsPerProducer + 1) / 2;
+    EXPECT_EQ(consumed.load(), ThreadCount * ItemsPerProducer);
+    EXPECT_EQ(sum.load(), expected);
+}
+
+namespace
+{
+    // Stand-in for a map update request, the benchmark measures the scheduling path only
+    struct BenchmarkRequest
+    {
+        uint32 work = 0;
+    };
+
+    constexpr uint32 BenchmarkThreads = 4;
+    constexpr uint32 BenchmarkTicks = 200;
+
+    // Old MapUpdater path: heap allocated requests in a ProducerConsumerQueue, deleted by the worker
+    double MeasurePCQueue(uint32 requestCount)
+    {
+        ProducerConsumerQueue<BenchmarkRequest*> queue;
+        std::atomic<uint32> pending(0);
+        std::mutex lock;
+        std::condition_variable condition;
+        std::atomic<bool> stop(false);
+        std::vector<std::thread> workers;
+
+        for (uint32 i = 0; i < BenchmarkThreads; ++i)
+        {
+            workers.emplace_back([&]()
+            {
+                while (!stop)
+                {
+                    BenchmarkRequest* request = nullptr;
+                    queue.WaitAndPop(request);
+                    if (!request)
+                        continue;
+
+                    delete request;
+                    if (pending.fetch_sub(1) == 1)
+                    {
+                        std::lock_guard<std::mutex> guard(lock);
+                        condition.notify_all();
+                    }
+                }
+            });
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 tick = 0; tick < BenchmarkTicks; ++tick)
+        {
+            pending = requestCount;
+            for (uint32 i = 0; i < requestCount; ++i)
+                queue.Push(new BenchmarkRequest());
+
+            std::unique_lock<std::mutex> guard(lock);
+            condition.wait(guard, [&] { return pending.load() == 0; });
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        stop = true;
+        queue.Cancel();
+        for (std::thread& worker : workers)
+            worker.join();
+
+        return std::chrono::duration<double, std::micro>(elapsed).count() / BenchmarkTicks;
+    }
+
+    // New MapUpdater path: requests recycled from an arena, handed over through lock-free queues
+    double MeasureMPMCQueue(uint32 requestCount)
+    {
+        std::vector<BenchmarkRequest> arena(requestCount);
+        std::vector<std::unique_ptr<MPMCQueue<BenchmarkRequest*>>> queues;
+        for (uint32 i = 0; i < BenchmarkThreads; ++i)
+            queues.push_back(std::make_unique<MPMCQueue<BenchmarkRequest*>>(1024));
+
+        std::atomic<uint32> pending(0);
+        std::mutex lock;
+        std::condition_variable condition;
+        std::atomic<bool> stop(false);
+        std::vector<std::thread> workers;
+
+        for (uint32 i = 0; i < BenchmarkThreads; ++i)
+        {
+            workers.emplace_back([&, i]()
+            {
+                while (!stop)
+                {
+                    BenchmarkRequest* request = nullptr;
+                    for (uint32 q = 0; q < BenchmarkThreads && !request; ++q)
+                        queues[(i + q) % BenchmarkThreads]->Dequeue(request);
+
+                    if (!request)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    if (pending.fetch_sub(1) == 1)
+                    {
+                        std::lock_guard<std::mutex> guard(lock);
+                        condition.notify_all();
+                    }
+                }
+            });
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 tick = 0; tick < BenchmarkTicks; ++tick)
+        {
+            pending = requestCount;
+            for (uint32 i = 0; i < requestCount; ++i)
+                while (!queues[i % BenchmarkThreads]->Enqueue(&arena[i]))
+                    std::this_thread::yield();
+
+            std::unique_lock<std::mutex> guard(lock);
+            condition.wait(guard, [&] { return pending.load() == 0; });
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        stop = true;
+        for (std::thread& worker : workers)
+            worker.join();
+
+        return std::chrono::duration<double, std::micro>(elapsed).count() / BenchmarkTicks;
+    }
+}
+
+// Prints schedule -> complete latency per tick for both request paths. It spins up worker threads without
+// anything to check, so it is skipped unless run with --gtest_also_run_disabled_tests
+TEST(MPMCQueueBenchmark, DISABLED_ScheduleToCompleteLatency)
+{
+    std::printf("%8s %20s %20s\n", "requests", "PCQueue+new (us)", "MPMCQueue+arena (us)");
+
+    for (uint32 requestCount : { 1, 10, 100, 1000 })
+    {
+        double pcQueue = MeasurePCQueue(requestCount);
+        double mpmcQueue = MeasureMPMCQueue(requestCount);
+        std::printf("%8u %20.2f %20.2f\n", requestCount, pcQueue, mpmcQueue);
+
+        EXPECT_GT(pcQueue, 0.0);
+        EXPECT_GT(mpmcQueue, 0.0);
+    }
+}
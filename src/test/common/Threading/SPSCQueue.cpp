@@ -0,0 +1,74 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Define.h"
+#include "SPSCQueue.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+
+TEST(SPSCQueueTest, FifoOrderAndBound)
+{
+    SPSCQueue<uint32> queue(4);
+    EXPECT_EQ(queue.Capacity(), 4u);
+    EXPECT_TRUE(queue.Empty());
+
+    for (uint32 i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.Enqueue(i));
+
+    EXPECT_FALSE(queue.Enqueue(4));
+
+    uint32 value = 0;
+    for (uint32 i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.Dequeue(value));
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_FALSE(queue.Dequeue(value));
+    EXPECT_TRUE(queue.Empty());
+}
+
+TEST(SPSCQueueTest, ProducerAndConsumerThreads)
+{
+    constexpr uint32 ItemCount = 100000;
+
+    SPSCQueue<uint32> queue(64);
+    std::thread producer([&queue]()
+    {
+        for (uint32 i = 1; i <= ItemCount; ++i)
+            while (!queue.Enqueue(i))
+                std::this_thread::yield();
+    });
+
+    uint32 expected = 1;
+    uint32 value = 0;
+    while (expected <= ItemCount)
+    {
+        if (!queue.Dequeue(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        ASSERT_EQ(value, expected);
+        ++expected;
+    }
+
+    producer.join();
+    EXPECT_TRUE(queue.Empty());
+}
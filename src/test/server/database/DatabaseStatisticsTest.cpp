@@ -0,0 +1,68 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DatabaseStatistics.h"
+#include "gtest/gtest.h"
+
+using namespace std::chrono_literals;
+
+TEST(DatabaseStatisticsTest, ConnectionsAreMerged)
+{
+    DatabaseConnectionStatistics first;
+    first.SetStatementCount(8);
+    first.RecordStatement(5, 1, 100us);
+    first.RecordStatement(2, 4, 40us);
+    first.RecordOperation(10us, 200us);
+
+    DatabaseConnectionStatistics second;
+    second.SetStatementCount(8);
+    second.RecordStatement(5, 2, 300us);
+    second.RecordStatement(9, 1, 1000us); // out of range, ignored
+    second.RecordOperation(30us, 100us);
+
+    DatabasePoolStatistics statistics;
+    first.AddTo(statistics);
+    second.AddTo(statistics);
+
+    ASSERT_EQ(statistics.Statements.size(), 2u);
+    EXPECT_EQ(statistics.Statements[0].Index, 2u);
+    EXPECT_EQ(statistics.Statements[0].Count, 4u);
+    EXPECT_EQ(statistics.Statements[0].TotalMicroseconds, 40u);
+    EXPECT_EQ(statistics.Statements[1].Index, 5u);
+    EXPECT_EQ(statistics.Statements[1].Count, 3u);
+    EXPECT_EQ(statistics.Statements[1].TotalMicroseconds, 400u);
+
+    EXPECT_EQ(MetricHistogram::GetCount(statistics.QueueWait), 2u);
+    EXPECT_EQ(MetricHistogram::GetCount(statistics.Execution), 2u);
+    EXPECT_GE(MetricHistogram::GetMax(statistics.Execution), 200u);
+}
+
+TEST(DatabaseStatisticsTest, StatementCountIsSetOnce)
+{
+    DatabaseConnectionStatistics statistics;
+    statistics.RecordStatement(0, 1, 1us); // not prepared yet, ignored
+    statistics.SetStatementCount(2);
+    statistics.RecordStatement(1, 1, 5us);
+    statistics.SetStatementCount(4); // reconnect, counters are kept
+    statistics.RecordStatement(1, 1, 5us);
+
+    DatabasePoolStatistics pool;
+    statistics.AddTo(pool);
+    ASSERT_EQ(pool.Statements.size(), 1u);
+    EXPECT_EQ(pool.Statements[0].Count, 2u);
+    EXPECT_EQ(pool.Statements[0].TotalMicroseconds, 10u);
+}
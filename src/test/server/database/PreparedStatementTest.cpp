@@ -0,0 +1,89 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PreparedStatement.h"
+#include "gtest/gtest.h"
+#include <cstring>
+
+TEST(PreparedStatementParametersTest, NumbersAreStoredInPlace)
+{
+    PreparedStatementParameters parameters(4);
+    parameters.Set(0, uint32(123456));
+    parameters.Set(1, int8(-5));
+    parameters.Set(2, 1.5f);
+
+    EXPECT_EQ(parameters[0].Type, PreparedStatementDataType::UInt32);
+    uint32 value = 0;
+    std::memcpy(&value, parameters.GetBuffer(0), sizeof(value));
+    EXPECT_EQ(value, 123456u);
+
+    EXPECT_EQ(parameters.ToString(1), "-5");
+    EXPECT_EQ(parameters.ToString(2), "1.5");
+
+    // unset parameters keep binding as false
+    EXPECT_EQ(parameters[3].Type, PreparedStatementDataType::Bool);
+}
+
+TEST(PreparedStatementParametersTest, BytesMoveToHeapOnceFull)
+{
+    std::string const shortText = "short";
+    std::string const longText(100, 'x');
+    std::vector<uint8> const blob = { 1, 2, 3 };
+
+    PreparedStatementParameters parameters(4);
+    parameters.Set(0, uint8(7));
+    parameters.SetBytes(1, PreparedStatementDataType::String, shortText.data(), shortText.size());
+    parameters.SetBytes(2, PreparedStatementDataType::Binary, blob.data(), blob.size());
+    parameters.SetBytes(3, PreparedStatementDataType::String, longText.data(), longText.size());
+
+    EXPECT_EQ(parameters.ToString(1), shortText);
+    EXPECT_EQ(parameters.ToString(2), "BINARY");
+    EXPECT_EQ(parameters.ToString(3), longText);
+    EXPECT_EQ(parameters[1].Length, shortText.size());
+    EXPECT_EQ(std::memcmp(parameters.GetBuffer(2), blob.data(), blob.size()), 0);
+}
+
+TEST(PreparedStatementParametersTest, Equality)
+{
+    std::string const text = "Name";
+
+    PreparedStatementParameters left(3);
+    left.Set(0, uint32(1));
+    left.SetBytes(1, PreparedStatementDataType::String, text.data(), text.size());
+    left.SetNull(2);
+
+    PreparedStatementParameters right = left;
+    EXPECT_TRUE(left == right);
+
+    right.Set(0, int32(1));
+    EXPECT_FALSE(left == right);
+
+    right = left;
+    right.SetBytes(1, PreparedStatementDataType::String, "Nome", 4);
+    EXPECT_FALSE(left == right);
+
+    EXPECT_FALSE(left == PreparedStatementParameters(2));
+
+    // a string set over a number is equal to the same string set on its own
+    right = PreparedStatementParameters(3);
+    right.Set(0, uint32(1));
+    right.Set(1, uint64(42));
+    right.SetBytes(1, PreparedStatementDataType::String, text.data(), text.size());
+    right.Set(2, uint8(9));
+    right.SetNull(2);
+    EXPECT_TRUE(left == right);
+}
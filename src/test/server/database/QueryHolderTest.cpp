@@ -0,0 +1,165 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CharacterDatabase.h"
+#include "PCQueue.h"
+#include "PreparedStatement.h"
+#include "QueryHolder.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+    std::shared_ptr<SQLQueryHolder<CharacterDatabaseConnection>> CreateHolder(std::size_t size, std::vector<std::size_t> const& emptyIndexes = {})
+    {
+        auto holder = std::make_shared<SQLQueryHolder<CharacterDatabaseConnection>>();
+        holder->SetSize(size);
+        for (std::size_t i = 0; i < size; ++i)
+            if (std::find(emptyIndexes.begin(), emptyIndexes.end(), i) == emptyIndexes.end())
+                holder->SetPreparedQuery(i, new CharacterDatabasePreparedStatement(CHAR_SEL_CHARACTER, 0));
+
+        return holder;
+    }
+}
+
+TEST(QueryHolderTest, SplitIntoConsecutiveParts)
+{
+    auto holder = CreateHolder(10);
+
+    std::vector<SQLQueryHolderPart> parts = holder->SplitIntoParts(3);
+    ASSERT_EQ(parts.size(), 3u);
+    EXPECT_EQ(parts[0].Begin, 0u);
+    EXPECT_EQ(parts[0].End, 3u);
+    EXPECT_EQ(parts[1].Begin, 3u);
+    EXPECT_EQ(parts[1].End, 6u);
+    EXPECT_EQ(parts[2].Begin, 6u);
+    EXPECT_EQ(parts[2].End, 10u);
+
+    parts = holder->SplitIntoParts(1);
+    ASSERT_EQ(parts.size(), 1u);
+    EXPECT_EQ(parts[0].End, 10u);
+}
+
+TEST(QueryHolderTest, SplitCountsStatementsOnly)
+{
+    // 3 statements, the empty slots must not produce empty parts
+    auto holder = CreateHolder(6, { 1, 2, 5 });
+
+    std::vector<SQLQueryHolderPart> parts = holder->SplitIntoParts(8);
+    ASSERT_EQ(parts.size(), 3u);
+    EXPECT_EQ(parts[0].Begin, 0u);
+    EXPECT_EQ(parts[0].End, 1u);
+    EXPECT_EQ(parts[1].Begin, 1u);
+    EXPECT_EQ(parts[1].End, 4u);
+    EXPECT_EQ(parts[2].Begin, 4u);
+    EXPECT_EQ(parts[2].End, 6u);
+}
+
+namespace
+{
+    // Stand-in for SQLQueryHolderTask, every query costs one round trip to the database server
+    struct BenchmarkHolderTask
+    {
+        SQLQueryHolderPart Part;
+        std::shared_ptr<SQLQueryHolderCompletion> Completion;
+    };
+
+    constexpr uint32 BenchmarkWorkers = 4;
+    constexpr uint32 BenchmarkQueries = 40; // about the size of the character login holder
+    constexpr std::chrono::microseconds BenchmarkRoundTrip(100);
+
+    struct BenchmarkResult
+    {
+        double LoginLatency = 0.0; // average time from enqueueing a login until its holder completed
+        double TimeToWorld = 0.0;  // time until the holders of all logins completed
+    };
+
+    BenchmarkResult MeasureLogins(uint32 logins, std::size_t maxParts)
+    {
+        ProducerConsumerQueue<BenchmarkHolderTask*> queue;
+        std::vector<std::thread> workers;
+        for (uint32 i = 0; i < BenchmarkWorkers; ++i)
+        {
+            workers.emplace_back([&queue]()
+            {
+                for (;;)
+                {
+                    BenchmarkHolderTask* task = nullptr;
+                    queue.WaitAndPop(task);
+                    if (!task)
+                        return;
+
+                    std::this_thread::sleep_for(BenchmarkRoundTrip * (task->Part.End - task->Part.Begin));
+                    if (task->Completion->RemainingParts.fetch_sub(1) == 1)
+                        task->Completion->Result.set_value();
+
+                    delete task;
+                }
+            });
+        }
+
+        auto holder = CreateHolder(BenchmarkQueries);
+        std::vector<QueryResultHolderFuture> results;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < logins; ++i)
+        {
+            std::vector<SQLQueryHolderPart> parts = holder->SplitIntoParts(maxParts);
+            auto completion = std::make_shared<SQLQueryHolderCompletion>(parts.size());
+            results.push_back(completion->Result.get_future());
+            for (SQLQueryHolderPart const& part : parts)
+                queue.Push(new BenchmarkHolderTask{ part, completion });
+        }
+
+        BenchmarkResult result;
+        for (QueryResultHolderFuture& future : results)
+        {
+            future.wait();
+            result.LoginLatency += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        result.TimeToWorld = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        result.LoginLatency /= logins;
+
+        queue.Cancel();
+        for (std::thread& worker : workers)
+            worker.join();
+
+        return result;
+    }
+}
+
+// Prints login latency and time-to-world of sequential and split login holders. The round trips are
+// simulated with sleeps, the numbers only mean something on an idle machine (--gtest_also_run_disabled_tests)
+TEST(QueryHolderBenchmark, DISABLED_LoginLatency)
+{
+    std::printf("%8s %22s %22s %22s %22s\n", "logins", "sequential login (ms)", "sequential world (ms)", "split login (ms)", "split world (ms)");
+
+    // 1 is a single login on an idle server, the rest a mass login after a restart
+    for (uint32 logins : { 1, 8, 64 })
+    {
+        BenchmarkResult sequential = MeasureLogins(logins, 1);
+        BenchmarkResult split = MeasureLogins(logins, BenchmarkWorkers);
+        std::printf("%8u %22.2f %22.2f %22.2f %22.2f\n", logins, sequential.LoginLatency, sequential.TimeToWorld, split.LoginLatency, split.TimeToWorld);
+
+        EXPECT_GT(sequential.TimeToWorld, 0.0);
+        EXPECT_GT(split.TimeToWorld, 0.0);
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StatementBatch.h"
+#include "gtest/gtest.h"
+
+TEST(StatementBatchTest, InsertRowsAreRepeated)
+{
+    Optional<StatementBatch> batch = StatementBatch::Create("INSERT INTO character_spell (guid, spell, specMask) VALUES (?, ?, ?)");
+    ASSERT_TRUE(batch);
+    EXPECT_EQ(batch->GetQuery(1), "INSERT INTO character_spell (guid, spell, specMask) VALUES (?, ?, ?)");
+    EXPECT_EQ(batch->GetQuery(3), "INSERT INTO character_spell (guid, spell, specMask) VALUES (?, ?, ?), (?, ?, ?), (?, ?, ?)");
+
+    batch = StatementBatch::Create("REPLACE INTO item_instance (guid, text) VALUES (?, UNIX_TIMESTAMP())");
+    ASSERT_TRUE(batch);
+    EXPECT_EQ(batch->GetQuery(2), "REPLACE INTO item_instance (guid, text) VALUES (?, UNIX_TIMESTAMP()), (?, UNIX_TIMESTAMP())");
+}
+
+TEST(StatementBatchTest, DeleteBecomesIn)
+{
+    Optional<StatementBatch> batch = StatementBatch::Create("DELETE FROM item_instance WHERE guid = ?");
+    ASSERT_TRUE(batch);
+    EXPECT_EQ(batch->GetQuery(3), "DELETE FROM item_instance WHERE guid IN (?, ?, ?)");
+
+    batch = StatementBatch::Create("DELETE FROM character_spell WHERE guid = ? AND spell = ?");
+    ASSERT_TRUE(batch);
+    EXPECT_EQ(batch->GetQuery(2), "DELETE FROM character_spell WHERE (guid, spell) IN ((?, ?), (?, ?))");
+}
+
+TEST(StatementBatchTest, UnsupportedStatements)
+{
+    EXPECT_FALSE(StatementBatch::Create("UPDATE characters SET online = 0 WHERE guid = ?"));
+    EXPECT_FALSE(StatementBatch::Create("SELECT guid FROM characters WHERE account = ?"));
+    EXPECT_FALSE(StatementBatch::Create("INSERT INTO mail_items (mail_id) SELECT id FROM mail WHERE receiver = ?"));
+    EXPECT_FALSE(StatementBatch::Create("INSERT INTO account_data (accountId, type) VALUES (?, ?) ON DUPLICATE KEY UPDATE type = ?"));
+    EXPECT_FALSE(StatementBatch::Create("INSERT INTO pet_aura (guid) VALUES (?), (?)"));
+    EXPECT_FALSE(StatementBatch::Create("DELETE FROM character_aura WHERE guid = ? LIMIT 1"));
+    EXPECT_FALSE(StatementBatch::Create("DELETE FROM mail WHERE expire_time < ?"));
+    EXPECT_FALSE(StatementBatch::Create("DELETE FROM characters WHERE guid = ? OR account = ?"));
+    EXPECT_FALSE(StatementBatch::Create("DELETE FROM characters"));
+    EXPECT_FALSE(StatementBatch::Create("DELETE gi FROM guild_bank_item gi JOIN item_instance ii ON gi.item_guid = ii.guid WHERE ii.guid = ?"));
+}
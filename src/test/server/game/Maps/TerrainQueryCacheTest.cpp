@@ -0,0 +1,88 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TerrainQueryCache.h"
+#include "gtest/gtest.h"
+
+TEST(TerrainQueryCacheTest, DisabledWithoutSize)
+{
+    TerrainQueryCache cache;
+    TerrainQueryCache::Key key(1, 100.0f, 200.0f, 30.0f, 1, 0);
+    cache.StoreHeight(key, 29.5f);
+
+    float height = 0.0f;
+    EXPECT_FALSE(cache.FindHeight(key, height));
+    EXPECT_EQ(cache.GetSize(), 0u);
+}
+
+TEST(TerrainQueryCacheTest, RoundsPositions)
+{
+    TerrainQueryCache cache;
+    cache.SetSize(64);
+    cache.StoreHeight(TerrainQueryCache::Key(1, 100.01f, 200.01f, 30.01f, 1, 0), 29.5f);
+
+    float height = 0.0f;
+    ASSERT_TRUE(cache.FindHeight(TerrainQueryCache::Key(1, 100.05f, 200.05f, 30.05f, 1, 0), height));
+    EXPECT_FLOAT_EQ(height, 29.5f);
+
+    // next 1/16 yard
+    EXPECT_FALSE(cache.FindHeight(TerrainQueryCache::Key(1, 100.07f, 200.01f, 30.01f, 1, 0), height));
+}
+
+TEST(TerrainQueryCacheTest, KeyedByGenerationPhaseAndParams)
+{
+    TerrainQueryCache cache;
+    cache.SetSize(64);
+    cache.StoreHeight(TerrainQueryCache::Key(1, 100.0f, 200.0f, 30.0f, 1, 0), 29.5f);
+
+    float height = 0.0f;
+    // a gameobject model changed meanwhile
+    EXPECT_FALSE(cache.FindHeight(TerrainQueryCache::Key(2, 100.0f, 200.0f, 30.0f, 1, 0), height));
+    EXPECT_FALSE(cache.FindHeight(TerrainQueryCache::Key(1, 100.0f, 200.0f, 30.0f, 2, 0), height));
+    EXPECT_FALSE(cache.FindHeight(TerrainQueryCache::Key(1, 100.0f, 200.0f, 30.0f, 1, 1), height));
+    EXPECT_TRUE(cache.FindHeight(TerrainQueryCache::Key(1, 100.0f, 200.0f, 30.0f, 1, 0), height));
+}
+
+TEST(TerrainQueryCacheTest, StoresLiquids)
+{
+    TerrainQueryCache cache;
+    cache.SetSize(64);
+
+    LiquidData water;
+    water.Entry = 1;
+    water.Level = 12.0f;
+    water.Status = LIQUID_MAP_UNDER_WATER;
+
+    TerrainQueryCache::Key key(1, -50.0f, -60.0f, 5.0f, 1, MAP_ALL_LIQUIDS);
+    cache.StoreLiquid(key, water);
+
+    LiquidData liquidData;
+    ASSERT_TRUE(cache.FindLiquid(key, liquidData));
+    EXPECT_EQ(liquidData.Entry, 1u);
+    EXPECT_FLOAT_EQ(liquidData.Level, 12.0f);
+    EXPECT_EQ(liquidData.Status, LIQUID_MAP_UNDER_WATER);
+
+    // heights and liquids do not share their slots
+    float height = 0.0f;
+    EXPECT_FALSE(cache.FindHeight(key, height));
+}
+
+TEST(TerrainQueryCacheTest, ThreadCacheFollowsConfiguredSize)
+{
+    EXPECT_EQ(TerrainQueryCache::GetForCurrentThread(100).GetSize(), 128u);
+    EXPECT_EQ(TerrainQueryCache::GetForCurrentThread(0).GetSize(), 0u);
+}